@@ -407,30 +407,32 @@ namespace AZ::Data
 
     void AssetContainer::RemoveFromWaitingPreloads(const AssetId& waiterId, const AssetId& preloadID)
     {
+        if (RemovePreloadFromWaiter(waiterId, preloadID))
         {
-            AZStd::lock_guard<AZStd::recursive_mutex> preloadGuard(m_preloadMutex);
+            auto thisAsset = GetAssetData(waiterId);
+            AssetManager::Instance().ValidateAndPostLoad(thisAsset, true, waiterId == m_containerAssetId ? m_isReload : false, nullptr);
+        }
+    }
 
-            auto remainingPreloadIter = m_preloadList.find(waiterId);
-            if (remainingPreloadIter == m_preloadList.end())
-            {
-                // If we got here without an entry on the preload list, it probably means this asset was triggered to load multiple
-                // times, some with dependencies and some without.  To ensure that we don't disturb the loads that expect the
-                // dependencies, just silently return and don't treat the asset as finished loading.  We'll rely on the other load
-                // to send an OnAssetReady() whenever its expected dependencies are met.
-                return;
-            }
-            if (!remainingPreloadIter->second.erase(preloadID))
-            {
-                AZ_Warning("AssetContainer", !m_initComplete, "Couldn't remove %s from waiting list of %s", preloadID.ToString<AZStd::string>().c_str(), waiterId.ToString<AZStd::string>().c_str());
-                return;
-            }
-            if (!remainingPreloadIter->second.empty())
-            {
-                return;
-            }
+    bool AssetContainer::RemovePreloadFromWaiter(const AssetId& waiterId, const AssetId& preloadID)
+    {
+        AZStd::lock_guard<AZStd::recursive_mutex> preloadGuard(m_preloadMutex);
+
+        auto remainingPreloadIter = m_preloadList.find(waiterId);
+        if (remainingPreloadIter == m_preloadList.end())
+        {
+            // If we got here without an entry on the preload list, it probably means this asset was triggered to load multiple
+            // times, some with dependencies and some without.  To ensure that we don't disturb the loads that expect the
+            // dependencies, just silently return and don't treat the asset as finished loading.  We'll rely on the other load
+            // to send an OnAssetReady() whenever its expected dependencies are met.
+            return false;
         }
-        auto thisAsset = GetAssetData(waiterId);
-        AssetManager::Instance().ValidateAndPostLoad(thisAsset, true, waiterId == m_containerAssetId ? m_isReload : false, nullptr);
+        if (!remainingPreloadIter->second.erase(preloadID))
+        {
+            AZ_Warning("AssetContainer", !m_initComplete, "Couldn't remove %s from waiting list of %s", preloadID.ToString<AZStd::string>().c_str(), waiterId.ToString<AZStd::string>().c_str());
+            return false;
+        }
+        return remainingPreloadIter->second.empty();
     }
 
     void AssetContainer::RemoveFromAllWaitingPreloads(const AssetId& thisId)
@@ -446,11 +448,34 @@ namespace AZ::Data
                 m_preloadWaitList.erase(waitingList);
             }
         }
+
+        AZStd::vector<AssetId> readyWaiters;
         for (auto& thisDepId : checkList)
         {
-            if (thisDepId != thisId)
+            if (thisDepId != thisId && RemovePreloadFromWaiter(thisDepId, thisId))
+            {
+                readyWaiters.push_back(thisDepId);
+            }
+        }
+
+        // The waiters don't depend on each other, so all but the last one are finished in jobs, and the last one is finished
+        // on this thread.
+        for (size_t waiterIndex = 0; waiterIndex < readyWaiters.size(); ++waiterIndex)
+        {
+            const AssetId& waiterId = readyWaiters[waiterIndex];
+            const bool isReload = waiterId == m_containerAssetId ? m_isReload : false;
+            auto thisAsset = GetAssetData(waiterId);
+            if (!thisAsset)
+            {
+                continue;
+            }
+            if (waiterIndex + 1 < readyWaiters.size())
+            {
+                AssetManager::Instance().QueueValidateAndPostLoad(thisAsset, isReload);
+            }
+            else
             {
-                RemoveFromWaitingPreloads(thisDepId, thisId);
+                AssetManager::Instance().ValidateAndPostLoad(thisAsset, true, isReload, nullptr);
             }
         }
     }
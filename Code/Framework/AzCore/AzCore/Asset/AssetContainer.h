@@ -111,6 +111,8 @@ namespace AZ
 
             // Remove a specific id from the list an asset is waiting for and complete the load if everything is ready
             void RemoveFromWaitingPreloads(const AZ::Data::AssetId& waitingId, const AZ::Data::AssetId& preloadAssetId);
+            // Remove a specific id from the list an asset is waiting for, returns true if the asset isn't waiting on anything else
+            bool RemovePreloadFromWaiter(const AZ::Data::AssetId& waitingId, const AZ::Data::AssetId& preloadAssetId);
             // Iterate over the list that was waiting for this asset and remove it from each
             void RemoveFromAllWaitingPreloads(const AZ::Data::AssetId& assetId);
             Asset<AssetData> GetAssetData(const AZ::Data::AssetId& assetId) const;
@@ -27,6 +27,7 @@
 #include <AzCore/Utils/Utils.h>
 #include <AzCore/JSON/stringbuffer.h>
 #include <AzCore/JSON/prettywriter.h>
+#include <AzCore/std/sort.h>
 #include <cinttypes>
 #include <utility>
 #include <AzCore/Serialization/ObjectStream.h>
@@ -51,6 +52,25 @@ namespace AZ::Data
         "Number of milliseconds to artifically delay an asset load.");
     AZ_CVAR(bool, cl_assetLoadError, false, nullptr, AZ::ConsoleFunctorFlags::Null,
         "Enable failure of all asset loads.");
+    AZ_CVAR(bool, cl_assetParallelPreloadInit, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Initialize assets whose preload dependencies became ready at the same time in parallel jobs.");
+    AZ_CVAR(bool, cl_assetLoadTimingsEnable, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Record the queue, load and init times of each asset load. Print them with cl_assetLoadTimingsDump.");
+
+    static void cl_assetLoadTimingsDump(const AZ::ConsoleCommandContainer& arguments)
+    {
+        size_t maxCount = 20;
+        if (!arguments.empty())
+        {
+            AZ::ConsoleTypeHelpers::StringToValue(maxCount, arguments.front());
+        }
+        if (AssetManager::IsReady())
+        {
+            AssetManager::Instance().DumpAssetLoadTimings(maxCount);
+        }
+    }
+    AZ_CONSOLEFREEFUNC(cl_assetLoadTimingsDump, AZ::ConsoleFunctorFlags::Null,
+        "Print the slowest recorded asset loads. Takes the number of loads to print, 20 by default.");
 
     static constexpr char kAssetDBInstanceVarName[] = "AssetDatabaseInstance";
 
@@ -71,6 +91,9 @@ namespace AZ::Data
         ~AssetDatabaseAsyncJob() override
         {
         }
+
+        // Public so that a thread blocked waiting on the asset can process the job itself.
+        using Job::Process;
     };
 
     /**
@@ -190,7 +213,9 @@ namespace AZ::Data
             ASSET_DEBUG_OUTPUT(AZStd::string::format("LoadAndSignal - Pre - " AZ_STRING_FORMAT,
                 AZ_STRING_ARG(asset.GetId().ToFixedString())));
 
+            m_owner->RecordAssetLoadTiming(asset.GetId(), asset.GetType(), AssetManager::AssetLoadStage::LoadStart);
             const bool loadSucceeded = LoadData();
+            m_owner->RecordAssetLoadTiming(asset.GetId(), asset.GetType(), AssetManager::AssetLoadStage::LoadEnd);
 
             ASSET_DEBUG_OUTPUT(AZStd::string::format(
                 "LoadAndSignal - Post - Result: %s - Signal: %s - " AZ_STRING_FORMAT,
@@ -243,6 +268,43 @@ namespace AZ::Data
         bool m_signalLoaded{ false };
     };
 
+    /*
+     * This class finishes the load of an asset whose data and preload dependencies are ready.
+     * It allows the assets that were waiting on the same preload dependency to be initialized in parallel.
+     */
+    class InitAssetJob
+        : public AssetDatabaseAsyncJob
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(InitAssetJob, ThreadPoolAllocator);
+
+        InitAssetJob(AssetManager* owner, const Asset<AssetData>& asset, bool isReload)
+            : AssetDatabaseAsyncJob(JobContext::GetGlobalContext(), true, owner, asset, nullptr)
+            , m_isReload(isReload)
+        {
+        }
+
+        void Process() override
+        {
+            Asset<AssetData> asset = m_asset.GetStrongReference();
+
+            if (m_owner->ShouldCancelAllActiveJobs() || !asset)
+            {
+                BlockingAssetLoadBus::Event(m_asset.GetId(), &BlockingAssetLoadBus::Events::OnLoadCanceled, m_asset.GetId());
+                AssetManagerBus::Broadcast(&AssetManagerBus::Events::OnAssetCanceled, m_asset.GetId());
+                return;
+            }
+
+            AZ_PROFILE_SCOPE(AzCore, "AZ::Data::InitAssetJob::Process: %s", asset.GetHint().c_str());
+
+            constexpr bool loadSucceeded = true;
+            m_owner->ValidateAndPostLoad(asset, loadSucceeded, m_isReload);
+        }
+
+    private:
+        bool m_isReload{ false };
+    };
+
 
      /**
       * Utility class to wait when a blocking load is requested for an asset that's already loading asynchronously.
@@ -281,9 +343,9 @@ namespace AZ::Data
             }
         }
 
-        // Provides a blocked load with a LoadJob to process while it's blocking.
+        // Provides a blocked load with a LoadJob or InitJob for the asset to process while it's blocking.
         // Returns true if it can be queued, false if it can't.
-        bool QueueAssetLoadJob(LoadAssetJob* loadJob)
+        bool QueueAssetLoadJob(AssetDatabaseAsyncJob* loadJob)
         {
             if(m_shouldDispatchEvents)
             {
@@ -396,7 +458,7 @@ namespace AZ::Data
         Asset<AssetData> m_assetData;
         AZStd::binary_semaphore m_waitEvent;
         const bool m_shouldDispatchEvents{ false };
-        LoadAssetJob* m_loadJob{ nullptr };
+        AssetDatabaseAsyncJob* m_loadJob{ nullptr };
         AZStd::mutex m_loadJobMutex;
         AZStd::atomic_bool m_loadCompleted{ false };
     };
@@ -1079,25 +1141,28 @@ namespace AZ::Data
                 }
                 if (assetData->GetStatus() == AssetData::AssetStatus::NotLoaded)
                 {
+                    // Claiming the load inside the lock is enough to keep other callers from queueing it a second time, so the
+                    // catalog and handler queries for the stream info are done after the lock is released.
                     assetData->m_status = AssetData::AssetStatus::Queued;
                     UpdateDebugStatus(asset);
-                    loadInfo = GetModifiedLoadStreamInfoForAsset(asset, handler);
                     wasUnloaded = true;
+                }
+            }
+        }
 
-                    if (loadInfo.IsValid())
-                    {
-                        // Create the AssetDataStream instance here so it can claim an asset reference inside the lock (for a total
-                        // count of 2 before starting the load), otherwise the refcount will be 1, and the load could be canceled
-                        // before it is started, which creates state consistency issues.
+        if (wasUnloaded)
+        {
+            RecordAssetLoadTiming(assetInfo.m_assetId, assetInfo.m_assetType, AssetLoadStage::Queued);
 
-                        dataStream = AZStd::make_shared<AssetDataStream>(handler->GetAssetBufferAllocator());
-                    }
-                    else
-                    {
-                        // Asset creation was successful, but asset loading isn't, so trigger the OnAssetError notification
-                        triggerAssetErrorNotification = true;
-                    }
-                }
+            loadInfo = GetModifiedLoadStreamInfoForAsset(asset, handler);
+            if (loadInfo.IsValid())
+            {
+                dataStream = AZStd::make_shared<AssetDataStream>(handler->GetAssetBufferAllocator());
+            }
+            else
+            {
+                // Asset creation was successful, but asset loading isn't, so trigger the OnAssetError notification
+                triggerAssetErrorNotification = true;
             }
         }
 
@@ -1167,6 +1232,8 @@ namespace AZ::Data
         constexpr bool isReload = true;
         if (loadInfo.IsValid())
         {
+            RecordAssetLoadTiming(newAsset.GetId(), newAsset.GetType(), AssetLoadStage::Queued);
+
             // Create the AssetDataStream instance here so it can claim an asset reference inside the lock (for a total
             // count of 2 before starting the load), otherwise the refcount will be 1, and the load could be canceled
             // before it is started, which creates state consistency issues.
@@ -1788,44 +1855,21 @@ namespace AZ::Data
             {
                 AZ_PROFILE_SCOPE(AzCore, "AZ::Data::LoadAssetStreamerCallback %s",
                     loadingAsset.GetHint().c_str());
+                // The status is the only state that changes here, so an atomic transition is enough and the streamer thread
+                // doesn't have to wait on the asset map lock.
+                AssetData::AssetStatus expectedStatus = AssetData::AssetStatus::Queued;
+                if (!loadingAsset->m_status.compare_exchange_strong(expectedStatus, AssetData::AssetStatus::StreamReady))
                 {
-                    AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_assetMutex);
-                    AssetData* data = loadingAsset.Get();
-                    if (data->GetStatus() != AssetData::AssetStatus::Queued)
-                    {
-                        AZ_Warning("AssetManager", false, "Asset %s no longer in Queued state, abandoning load", loadingAsset.GetId().ToString<AZStd::string>().c_str());
-                        return;
-                    }
-                    data->m_status = AssetData::AssetStatus::StreamReady;
-                    UpdateDebugStatus(loadingAsset);
+                    AZ_Warning("AssetManager", false, "Asset %s no longer in Queued state, abandoning load", loadingAsset.GetId().ToString<AZStd::string>().c_str());
+                    return;
                 }
+                UpdateDebugStatus(loadingAsset);
+                RecordAssetLoadTiming(assetId, loadingAsset.GetType(), AssetLoadStage::StreamReady);
 
                 // The callback from AZ Streamer blocks the streaming thread until this function completes. To minimize the overhead,
                 // do the majority of the work in a separate job.
-                auto loadJob = aznew LoadAssetJob(this, loadingAsset,
-                    dataStream, isReload, status, handler, loadParams, signalLoaded);
-
-                bool jobQueued = false;
-
-                // If there's already an active blocking request waiting for this load to complete, let that thread handle
-                // the load itself instead of consuming a second thread.
-                {
-                    AZStd::scoped_lock<AZStd::recursive_mutex> requestLock(m_activeBlockingRequestMutex);
-                    auto range = m_activeBlockingRequests.equal_range(assetId);
-                    for(auto blockingRequest = range.first; blockingRequest != range.second; ++blockingRequest)
-                    {
-                        if(blockingRequest->second->QueueAssetLoadJob(loadJob))
-                        {
-                            jobQueued = true;
-                            break;
-                        }
-                    }
-                }
-
-                if (!jobQueued)
-                {
-                    loadJob->Start();
-                }
+                StartAssetJob(assetId, aznew LoadAssetJob(this, loadingAsset,
+                    dataStream, isReload, status, handler, loadParams, signalLoaded));
             }
             else
             {
@@ -1862,6 +1906,28 @@ namespace AZ::Data
             deadline, priority, assetDataStreamCallback);
     }
 
+    //=========================================================================
+    // StartAssetJob
+    //=========================================================================
+    void AssetManager::StartAssetJob(const AssetId& assetId, AssetDatabaseAsyncJob* job)
+    {
+        // If there's already an active blocking request waiting for this asset, let that thread handle
+        // the job itself instead of consuming a second thread.
+        {
+            AZStd::scoped_lock<AZStd::recursive_mutex> requestLock(m_activeBlockingRequestMutex);
+            auto range = m_activeBlockingRequests.equal_range(assetId);
+            for (auto blockingRequest = range.first; blockingRequest != range.second; ++blockingRequest)
+            {
+                if (blockingRequest->second->QueueAssetLoadJob(job))
+                {
+                    return;
+                }
+            }
+        }
+
+        job->Start();
+    }
+
     //=========================================================================
     // NotifyAssetReady
     //=========================================================================
@@ -1870,6 +1936,7 @@ namespace AZ::Data
         AssetData* data = asset.Get();
         AZ_Assert(data, "NotifyAssetReady: asset is missing info!");
         data->m_status = AssetData::AssetStatus::Ready;
+        RecordAssetLoadTiming(asset.GetId(), asset.GetType(), AssetLoadStage::Ready);
 
         AssetLoadBus::Event(asset.GetId(), &AssetLoadBus::Events::OnAssetReady, asset); // Broadcast to any containers first
         AssetBus::Event(asset.GetId(), &AssetBus::Events::OnAssetReady, asset);
@@ -1888,6 +1955,7 @@ namespace AZ::Data
     //=========================================================================
     void AssetManager::NotifyAssetReloaded(Asset<AssetData> asset)
     {
+        RecordAssetLoadTiming(asset.GetId(), asset.GetType(), AssetLoadStage::Ready);
         AssignAssetData(asset);
     }
 
@@ -1897,6 +1965,7 @@ namespace AZ::Data
     void AssetManager::NotifyAssetReloadError(Asset<AssetData> asset)
     {
         // Failed reloads have no side effects. Just notify observers (error reporting, etc).
+        RecordAssetLoadTiming(asset.GetId(), asset.GetType(), AssetLoadStage::Ready);
         {
             AZStd::lock_guard<AZStd::recursive_mutex> assetLock(m_assetMutex);
             m_reloads.erase(asset.GetId());
@@ -1911,6 +1980,7 @@ namespace AZ::Data
     void AssetManager::NotifyAssetError(Asset<AssetData> asset)
     {
         asset.Get()->m_status = AssetData::AssetStatus::Error;
+        RecordAssetLoadTiming(asset.GetId(), asset.GetType(), AssetLoadStage::Ready);
         AssetLoadBus::Event(asset.GetId(), &AssetLoadBus::Events::OnAssetError, asset); // Broadcast to any containers first
         AssetBus::Event(asset.GetId(), &AssetBus::Events::OnAssetError, asset);
     }
@@ -1942,25 +2012,21 @@ namespace AZ::Data
     bool AssetManager::ValidateAndRegisterAssetLoading(const Asset<AssetData>& asset)
     {
         AssetData* data = asset.Get();
+        if (data)
         {
-
-            AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_assetMutex);
-            if (data)
+            // The purpose of this function is to validate this asset is still in a StreamReady
+            // and only then continue the load.  We change status to loading if everything
+            // is expected which the blocking RegisterAssetLoading call does not do because it
+            // is already in loading status
+            AssetData::AssetStatus expectedStatus = AssetData::AssetStatus::StreamReady;
+            if (!data->m_status.compare_exchange_strong(expectedStatus, AssetData::AssetStatus::Loading))
             {
-                // The purpose of this function is to validate this asset is still in a StreamReady
-                // and only then continue the load.  We change status to loading if everything
-                // is expected which the blocking RegisterAssetLoading call does not do because it
-                // is already in loading status
-                if (data->GetStatus() != AssetData::AssetStatus::StreamReady)
-                {
-                    // Something else has attempted to load this asset
-                    ASSET_DEBUG_OUTPUT(AZStd::string::format(
-                        "ValidateAndRegisterAssetLoading - Aborting, status (%d) is not StreamReady", static_cast<int>(data->GetStatus())));
-                    return false;
-                }
-                data->m_status = AssetData::AssetStatus::Loading;
-                UpdateDebugStatus(asset);
+                // Something else has attempted to load this asset
+                ASSET_DEBUG_OUTPUT(AZStd::string::format(
+                    "ValidateAndRegisterAssetLoading - Aborting, status (%d) is not StreamReady", static_cast<int>(expectedStatus)));
+                return false;
             }
+            UpdateDebugStatus(asset);
         }
 
         return true;
@@ -2319,19 +2385,34 @@ namespace AZ::Data
     void AssetManager::ValidateAndPostLoad(AZ::Data::Asset<AZ::Data::AssetData>& asset, bool loadSucceeded,
                                            bool isReload, AZ::Data::AssetHandler* assetHandler)
     {
+        // We may need to revalidate that this asset hasn't already passed through postLoad.
+        // Several threads can finish the preloads of the same asset at once, so only the one that changes the status gets to continue.
+        AssetData::AssetStatus currentStatus = asset->m_status.load();
+        do
         {
-            // We may need to revalidate that this asset hasn't already passed through postLoad
-            AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_assetMutex);
-            if (asset->IsReady() || asset->m_status == AssetData::AssetStatus::LoadedPreReady)
+            if (currentStatus == AssetData::AssetStatus::ReadyPreNotify || currentStatus == AssetData::AssetStatus::Ready ||
+                currentStatus == AssetData::AssetStatus::LoadedPreReady)
             {
                 return;
             }
-            asset->m_status = AssetData::AssetStatus::LoadedPreReady;
-            UpdateDebugStatus(asset);
-        }
+        } while (!asset->m_status.compare_exchange_weak(currentStatus, AssetData::AssetStatus::LoadedPreReady));
+        UpdateDebugStatus(asset);
+
         PostLoad(asset, loadSucceeded, isReload, assetHandler);
     }
 
+    void AssetManager::QueueValidateAndPostLoad(const AZ::Data::Asset<AZ::Data::AssetData>& asset, bool isReload)
+    {
+        if (!cl_assetParallelPreloadInit)
+        {
+            Asset<AssetData> assetToInit = asset;
+            ValidateAndPostLoad(assetToInit, true, isReload);
+            return;
+        }
+
+        StartAssetJob(asset.GetId(), aznew InitAssetJob(this, asset, isReload));
+    }
+
     void AssetManager::PostLoad(AZ::Data::Asset<AZ::Data::AssetData>& asset, bool loadSucceeded,
                                 bool isReload, AZ::Data::AssetHandler* assetHandler)
     {
@@ -2487,6 +2568,96 @@ namespace AZ::Data
         AZ_TracePrintf("AssetManager", "Loaded assets size info is saved to file [%s]", filename.c_str());
     }
 
+    void AssetManager::SetAssetLoadTimingsEnabled(bool enable)
+    {
+        m_assetLoadTimingsEnabled = enable;
+    }
+
+    bool AssetManager::GetAssetLoadTimingsEnabled() const
+    {
+        return m_assetLoadTimingsEnabled || cl_assetLoadTimingsEnable;
+    }
+
+    AZStd::vector<AssetLoadTimings> AssetManager::GetAssetLoadTimings() const
+    {
+        AZStd::vector<AssetLoadTimings> timings;
+        AZStd::scoped_lock<AZStd::mutex> timingsLock(m_assetLoadTimingsMutex);
+        timings.reserve(m_assetLoadTimings.size());
+        for (const auto& timingEntry : m_assetLoadTimings)
+        {
+            timings.push_back(timingEntry.second);
+        }
+        return timings;
+    }
+
+    void AssetManager::ClearAssetLoadTimings()
+    {
+        AZStd::scoped_lock<AZStd::mutex> timingsLock(m_assetLoadTimingsMutex);
+        m_assetLoadTimings.clear();
+    }
+
+    void AssetManager::DumpAssetLoadTimings(size_t maxCount) const
+    {
+        AZStd::vector<AssetLoadTimings> timings = GetAssetLoadTimings();
+        AZStd::sort(timings.begin(), timings.end(), [](const AssetLoadTimings& lhs, const AssetLoadTimings& rhs)
+        {
+            return lhs.GetTotalDuration() > rhs.GetTotalDuration();
+        });
+        if (timings.size() > maxCount)
+        {
+            timings.resize(maxCount);
+        }
+
+        using Microseconds = AZStd::chrono::microseconds;
+        AZ_TracePrintf("AssetManager", "%-10s %-10s %-10s %-10s %s\n", "Total(us)", "Queue(us)", "Load(us)", "Init(us)", "Asset");
+        for (const AssetLoadTimings& timing : timings)
+        {
+            AssetInfo assetInfo;
+            AssetCatalogRequestBus::BroadcastResult(assetInfo, &AssetCatalogRequestBus::Events::GetAssetInfoById, timing.m_assetId);
+            AZ_TracePrintf("AssetManager", "%-10" PRId64 " %-10" PRId64 " %-10" PRId64 " %-10" PRId64 " %s\n",
+                static_cast<int64_t>(AZStd::chrono::duration_cast<Microseconds>(timing.GetTotalDuration()).count()),
+                static_cast<int64_t>(AZStd::chrono::duration_cast<Microseconds>(timing.GetQueueDuration()).count()),
+                static_cast<int64_t>(AZStd::chrono::duration_cast<Microseconds>(timing.GetLoadDuration()).count()),
+                static_cast<int64_t>(AZStd::chrono::duration_cast<Microseconds>(timing.GetInitDuration()).count()),
+                assetInfo.m_relativePath.empty() ? timing.m_assetId.ToString<AZStd::string>().c_str() : assetInfo.m_relativePath.c_str());
+        }
+    }
+
+    void AssetManager::RecordAssetLoadTiming(const AssetId& assetId, const AssetType& assetType, AssetLoadStage stage)
+    {
+        if (!GetAssetLoadTimingsEnabled())
+        {
+            return;
+        }
+
+        const AssetLoadTimings::Clock::time_point now = AssetLoadTimings::Clock::now();
+
+        AZStd::scoped_lock<AZStd::mutex> timingsLock(m_assetLoadTimingsMutex);
+        AssetLoadTimings& timings = m_assetLoadTimings[assetId];
+        switch (stage)
+        {
+        case AssetLoadStage::Queued:
+            // A new load of the asset starts over
+            timings = AssetLoadTimings();
+            timings.m_queuedTime = now;
+            break;
+        case AssetLoadStage::StreamReady:
+            timings.m_streamReadyTime = now;
+            break;
+        case AssetLoadStage::LoadStart:
+            timings.m_loadStartTime = now;
+            break;
+        case AssetLoadStage::LoadEnd:
+            timings.m_loadEndTime = now;
+            break;
+        case AssetLoadStage::Ready:
+            timings.m_readyTime = now;
+            break;
+        }
+        timings.m_assetId = assetId;
+        timings.m_assetType = assetType;
+    }
+
 } // namespace AZ::Data
 
 size_t AZStd::hash<AZ::Data::AssetContainerKey>::operator()(const AZ::Data::AssetContainerKey& obj) const
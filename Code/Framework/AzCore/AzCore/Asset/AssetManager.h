@@ -21,6 +21,7 @@
 #include <AzCore/std/containers/intrusive_list.h>
 #include <AzCore/std/parallel/binary_semaphore.h>
 #include <AzCore/std/smart_ptr/weak_ptr.h>
+#include <AzCore/std/chrono/chrono.h>
 
 namespace AZ::Data
 {
@@ -54,6 +55,7 @@ namespace AZ
         class AssetHandler;
         class AssetCatalog;
         class AssetDatabaseJob;
+        class AssetDatabaseAsyncJob;
         class WaitForAsset;
 
         struct AZCORE_API IDebugAssetEvent
@@ -105,6 +107,39 @@ namespace AZ
         };
         typedef AZStd::vector<AssetDependencyEntry> AssetDependencyList;
 
+        /**
+         * Timestamps of the stages of a single asset load.
+         * They're recorded by the AssetManager while load timings are enabled, either through
+         * AssetManager::SetAssetLoadTimingsEnabled or the cl_assetLoadTimingsEnable cvar.
+         * Stages that haven't been reached yet have a default constructed time point.
+         */
+        struct AZCORE_API AssetLoadTimings
+        {
+            using Clock = AZStd::chrono::steady_clock;
+
+            AssetId     m_assetId;
+            AssetType   m_assetType;
+            Clock::time_point m_queuedTime;         //!< The asset was queued for load.
+            Clock::time_point m_streamReadyTime;    //!< The asset file has been read.
+            Clock::time_point m_loadStartTime;      //!< A job thread started loading the asset data.
+            Clock::time_point m_loadEndTime;        //!< The asset data has been loaded.
+            Clock::time_point m_readyTime;          //!< The asset is ready, or the load failed.
+
+            //! Time from queueing the asset until a job thread picked up the load, including the file read.
+            Clock::duration GetQueueDuration() const { return GetDuration(m_queuedTime, m_loadStartTime); }
+            //! Time spent loading the asset data.
+            Clock::duration GetLoadDuration() const { return GetDuration(m_loadStartTime, m_loadEndTime); }
+            //! Time from loading the asset data until the asset is ready, including waiting on preload dependencies.
+            Clock::duration GetInitDuration() const { return GetDuration(m_loadEndTime, m_readyTime); }
+            Clock::duration GetTotalDuration() const { return GetDuration(m_queuedTime, m_readyTime); }
+
+        private:
+            static Clock::duration GetDuration(Clock::time_point start, Clock::time_point end)
+            {
+                return (start != Clock::time_point() && end > start) ? end - start : Clock::duration::zero();
+            }
+        };
+
         /*
          * This is the base class for Async AssetDatabase jobs
          */
@@ -140,6 +175,7 @@ namespace AZ
             friend class AssetDatabaseJob;
             friend class ReloadAssetJob;
             friend class LoadAssetJob;
+            friend class InitAssetJob;
             friend Asset<AssetData> AssetInternal::GetAssetData(const AssetId& id, AssetLoadBehavior assetReferenceLoadBehavior);
             friend class AssetContainer;
             friend class WaitForAsset;
@@ -327,6 +363,18 @@ namespace AZ
             // memory debug output
             void DumpLoadedAssetsInfo();
 
+            /**
+            * Enables recording of the load timings of each asset. Recording is also enabled while the
+            * cl_assetLoadTimingsEnable cvar is set. Disabled by default.
+            */
+            void SetAssetLoadTimingsEnabled(bool enable);
+            bool GetAssetLoadTimingsEnabled() const;
+            //! Returns the load timings recorded since the last ClearAssetLoadTimings call, one entry per asset.
+            AZStd::vector<AssetLoadTimings> GetAssetLoadTimings() const;
+            void ClearAssetLoadTimings();
+            //! Prints the recorded load timings, slowest loads first.
+            void DumpAssetLoadTimings(size_t maxCount) const;
+
         protected:
             AssetManager(const Descriptor& desc);
             virtual ~AssetManager();
@@ -352,6 +400,9 @@ namespace AZ
             void RemoveBlockingRequest(AssetId assetId, WaitForAsset* blockingRequest);
 
             void ValidateAndPostLoad(AZ::Data::Asset<AZ::Data::AssetData>& asset, bool loadSucceeded, bool isReload, AZ::Data::AssetHandler* assetHandler = nullptr);
+            //! Runs ValidateAndPostLoad for an asset whose preload dependencies are ready in a job, so that independent assets
+            //! are initialized in parallel.
+            void QueueValidateAndPostLoad(const AZ::Data::Asset<AZ::Data::AssetData>& asset, bool isReload);
             void PostLoad(AZ::Data::Asset<AZ::Data::AssetData>& asset, bool loadSucceeded, bool isReload, AZ::Data::AssetHandler* assetHandler = nullptr);
 
             Asset<AssetData> GetAssetInternal(const AssetId& assetId, const AssetType& assetType, AssetLoadBehavior assetReferenceLoadBehavior, const AssetLoadParameters& loadParams = AssetLoadParameters{}, AssetInfo assetInfo = AssetInfo(), bool signalLoaded = false);
@@ -406,6 +457,20 @@ namespace AZ
                 const AZ::Data::AssetStreamInfo& streamInfo, bool isReload,
                 AssetHandler* handler, const AssetLoadParameters& loadParameters, bool signalLoaded);
 
+            //! Starts a job for an asset, or hands it to a thread that is blocked waiting on that asset.
+            void StartAssetJob(const AssetId& assetId, AssetDatabaseAsyncJob* job);
+
+            enum class AssetLoadStage
+            {
+                Queued,
+                StreamReady,
+                LoadStart,
+                LoadEnd,
+                Ready
+            };
+            //! Records the time at which an asset reached a load stage if load timings are enabled.
+            void RecordAssetLoadTiming(const AssetId& assetId, const AssetType& assetType, AssetLoadStage stage);
+
             AssetHandlerMap         m_handlers;
             AssetCatalogMap         m_catalogs;
             AZStd::recursive_mutex  m_catalogMutex;     // lock when accessing the catalog map
@@ -466,6 +531,10 @@ namespace AZ
             // Setting this to true will cause all loadAssets jobs that have not started yet to cancel as soon as they start.
             bool m_cancelAllActiveJobs = false;
 
+            AZStd::unordered_map<AssetId, AssetLoadTimings> m_assetLoadTimings;
+            mutable AZStd::mutex m_assetLoadTimingsMutex;       // lock when accessing the load timings
+            AZStd::atomic_bool m_assetLoadTimingsEnabled{ false };
+
             AZStd::atomic_int m_suspendAssetRelease{ 0 };
         };
 
@@ -21,6 +21,7 @@
 #include <AzCore/Memory/AllocationRecords.h>
 
 #include <AzCore/Memory/AllocatorManager.h>
+#include <AzCore/Memory/FrameArenaAllocator.h>
 
 #include <AzCore/Metrics/EventLoggerFactoryImpl.h>
 #include <AzCore/Metrics/JsonTraceEventLogger.h>
@@ -46,6 +47,8 @@
 #include <AzCore/Settings/SettingsRegistryVisitorUtils.h>
 #include <AzCore/Settings/SettingsRegistryOriginTracker.h>
 #include <AzCore/StringFunc/StringFunc.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
 
 #include <AzCore/Module/Module.h>
 #include <AzCore/Module/ModuleManager.h>
@@ -147,6 +150,9 @@ namespace AZ::Internal
 
 namespace AZ
 {
+    AZ_CVAR(bool, t_parallelTick, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Tick the TickBus handlers that are parallel safe on the task graph workers, instead of serially on the main thread");
+
     // explicit instantiation of the template defined in ComponentApplicationBus.h
     static void PrintEntityName(const AZ::ConsoleCommandContainer& arguments)
     {
@@ -999,18 +1005,29 @@ namespace AZ
         AZ::UserSettingsComponentRequestBus::Broadcast(&AZ::UserSettingsComponentRequests::Finalize);
 
         // deactivate all entities
-        while (!m_entities.empty())
+        // Deleting an entity can delete other entities, so collect the ids and only delete the entities that are still registered.
+        AZStd::vector<EntityId> entityIds;
+        while (!m_entities.IsEmpty())
         {
-            Entity* entity = m_entities.begin()->second;
-            m_entities.erase(m_entities.begin());
+            entityIds.clear();
+            m_entities.EnumerateEntities([&entityIds](Entity* entity) { entityIds.push_back(entity->GetId()); });
 
-            if (entity->GetId() == SystemEntityId)
+            for (const EntityId& entityId : entityIds)
             {
-                AZ_Assert(m_systemEntity.get() == entity, "Activated system entity does not match the system entity created in Create().");
-            }
-            else
-            {
-                delete entity;
+                Entity* entity = m_entities.Extract(entityId);
+                if (!entity)
+                {
+                    continue;
+                }
+
+                if (entityId == SystemEntityId)
+                {
+                    AZ_Assert(m_systemEntity.get() == entity, "Activated system entity does not match the system entity created in Create().");
+                }
+                else
+                {
+                    delete entity;
+                }
             }
         }
 
@@ -1032,8 +1049,7 @@ namespace AZ
             }
         }
 
-        m_entities.clear();
-        m_entities.rehash(0); // force free all memory
+        m_entities.Clear(); // force free all memory
 
         DestroyReflectionManager();
         ComponentApplicationLifecycle::SignalEvent(*m_settingsRegistry, "ReflectionManagerUnavailable", R"({})");
@@ -1297,7 +1313,7 @@ namespace AZ
             return false;
         }
         m_entityAddedEvent.Signal(entity);
-        return m_entities.insert(AZStd::make_pair(entity->GetId(), entity)).second;
+        return m_entities.Insert(entity->GetId(), entity);
     }
 
     //=========================================================================
@@ -1312,7 +1328,7 @@ namespace AZ
             return false;
         }
         m_entityRemovedEvent.Signal(entity);
-        return (m_entities.erase(entity->GetId()) == 1);
+        return m_entities.Remove(entity->GetId());
     }
 
     //=========================================================================
@@ -1337,12 +1353,7 @@ namespace AZ
     //=========================================================================
     Entity* ComponentApplication::FindEntity(const EntityId& id)
     {
-        EntitySetType::const_iterator it = m_entities.find(id);
-        if (it != m_entities.end())
-        {
-            return it->second;
-        }
-        return nullptr;
+        return m_entities.Find(id);
     }
 
     //=========================================================================
@@ -1378,10 +1389,7 @@ namespace AZ
     //=========================================================================
     void ComponentApplication::EnumerateEntities(const ComponentApplicationRequests::EntityCallback& callback)
     {
-        for (const auto& entityIter : m_entities)
-        {
-            callback(entityIter.second);
-        }
+        m_entities.EnumerateEntities(callback);
     }
 
     //=========================================================================
@@ -1646,6 +1654,12 @@ namespace AZ
             m_lastTickTime = currentMonotonicTime;
         }
 
+        {
+            // Frame temporaries from the previous tick are no longer in use
+            AZ_PROFILE_SCOPE(AzCore, "ComponentApplication::Tick:ResetFrameArena");
+            static_cast<FrameArenaAllocator&>(AllocatorInstance<FrameArenaAllocator>::Get()).ResetFrame();
+        }
+
         {
             AZ_PROFILE_SCOPE(AzCore, "ComponentApplication::Tick:ExecuteQueuedEvents");
             TickBus::ExecuteQueuedEvents();
@@ -1655,7 +1669,9 @@ namespace AZ
             AZ_PROFILE_SCOPE(AzCore, "ComponentApplication::Tick:OnTick");
             const AZ::TimeUs deltaTimeUs = m_timeSystem->AdvanceTickDeltaTimes();
             const float deltaTimeSeconds = AZ::TimeUsToSeconds(deltaTimeUs);
-            AZ::TickBus::Broadcast(&TickEvents::OnTick, deltaTimeSeconds, GetTimeAtCurrentTick());
+            // Parallel safe handlers need a task executor, without one (tools that don't activate the task graph) everything ticks serially
+            TaskExecutor* executor = (t_parallelTick && Interface<TaskGraphActiveInterface>::Get()) ? &TaskExecutor::Instance() : nullptr;
+            DispatchTick(deltaTimeSeconds, GetTimeAtCurrentTick(), executor);
         }
 
         m_timeSystem->ApplyTickRateLimiterIfNeeded();
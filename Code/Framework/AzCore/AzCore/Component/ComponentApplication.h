@@ -11,6 +11,7 @@
 #include <AzCore/Component/ComponentApplicationBus.h>
 #include <AzCore/Component/Component.h>
 #include <AzCore/Component/Entity.h>
+#include <AzCore/Component/EntityDirectory.h>
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/Memory/AllocationRecords.h>
 #include <AzCore/Debug/BudgetTracker.h>
@@ -95,9 +96,6 @@ namespace AZ
         : public ComponentApplicationBus::Handler
         , public TickRequestBus::Handler
     {
-        // or try to use unordered set if we store the ID internally
-        typedef AZStd::unordered_map<EntityId, Entity*>  EntitySetType;
-
     public:
         AZ_RTTI(ComponentApplication, "{1F3B070F-89F7-4C3D-B5A3-8832D5BC81D7}");
         AZ_CLASS_ALLOCATOR(ComponentApplication, SystemAllocator);
@@ -218,6 +216,9 @@ namespace AZ
 
         Descriptor& GetDescriptor() { return m_descriptor; }
 
+        /// Returns the directory of all entities, which supports lookups through handles that remain valid for the lifetime of the entity.
+        const EntityDirectory& GetEntityDirectory() const { return m_entities; }
+
         /**
          * Ticks all components using the \ref AZ::TickBus during simulation time. May not tick if the application is not active (i.e. not in focus)
          */
@@ -376,7 +377,7 @@ namespace AZ
         Descriptor                                  m_descriptor;
         bool                                        m_isStarted{ false };
         IAllocator*                                 m_osAllocator{ nullptr };
-        EntitySetType                               m_entities;
+        EntityDirectory                             m_entities;
 
         AZ::SettingsRegistryInterface::NotifyEventHandler m_projectPathChangedHandler;
         AZ::SettingsRegistryInterface::NotifyEventHandler m_projectNameChangedHandler;
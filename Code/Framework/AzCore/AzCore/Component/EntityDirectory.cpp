@@ -0,0 +1,431 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Component/EntityDirectory.h>
+#include <AzCore/std/function/function_template.h>
+#include <AzCore/std/parallel/scoped_lock.h>
+#include <AzCore/std/parallel/thread.h>
+
+namespace AZ
+{
+    namespace EntityDirectoryInternal
+    {
+        // Marks the start of a change to a shard. Readers that see an odd sequence number, or a different sequence number
+        // after probing the table, retry.
+        static void BeginWrite(AZStd::atomic<u32>& sequence)
+        {
+            sequence.store(sequence.load(AZStd::memory_order_relaxed) + 1, AZStd::memory_order_relaxed);
+            AZStd::atomic_thread_fence(AZStd::memory_order_release);
+        }
+
+        static void EndWrite(AZStd::atomic<u32>& sequence)
+        {
+            sequence.store(sequence.load(AZStd::memory_order_relaxed) + 1, AZStd::memory_order_release);
+        }
+    } // namespace EntityDirectoryInternal
+
+    EntityDirectory::Table::Table(size_t capacity)
+        : m_entries(AZStd::make_unique<Entry[]>(capacity))
+        , m_mask(capacity - 1)
+    {
+    }
+
+    EntityDirectory::EntityDirectory()
+    {
+        for (AZStd::atomic<Slot*>& chunk : m_slotChunks)
+        {
+            chunk.store(nullptr, AZStd::memory_order_relaxed);
+        }
+    }
+
+    EntityDirectory::~EntityDirectory()
+    {
+        Clear();
+    }
+
+    bool EntityDirectory::Insert(const EntityId& id, Entity* entity)
+    {
+        const u64 hash = Hash(id);
+        Shard& shard = GetShard(hash);
+        AZStd::scoped_lock lock(shard.m_mutex);
+
+        Table* table = shard.m_table.load(AZStd::memory_order_relaxed);
+        if (table && FindEntry(*table, static_cast<u64>(id), hash) != InvalidEntryIndex)
+        {
+            return false;
+        }
+
+        Reserve(shard);
+        table = shard.m_table.load(AZStd::memory_order_relaxed);
+
+        size_t index = hash & table->m_mask;
+        u32 entrySlot = table->m_entries[index].m_slot.load(AZStd::memory_order_relaxed);
+        while (entrySlot != EmptyEntry && entrySlot != RemovedEntry)
+        {
+            index = (index + 1) & table->m_mask;
+            entrySlot = table->m_entries[index].m_slot.load(AZStd::memory_order_relaxed);
+        }
+
+        EntityDirectoryInternal::BeginWrite(shard.m_sequence);
+        Entry& entry = table->m_entries[index];
+        entry.m_id.store(static_cast<u64>(id), AZStd::memory_order_relaxed);
+        entry.m_entity.store(entity, AZStd::memory_order_relaxed);
+        entry.m_slot.store(AllocateSlot(entity), AZStd::memory_order_relaxed);
+        EntityDirectoryInternal::EndWrite(shard.m_sequence);
+
+        if (entrySlot == RemovedEntry)
+        {
+            --shard.m_removedCount;
+        }
+        ++shard.m_size;
+        m_size.fetch_add(1, AZStd::memory_order_relaxed);
+        return true;
+    }
+
+    bool EntityDirectory::Remove(const EntityId& id)
+    {
+        return Extract(id) != nullptr;
+    }
+
+    Entity* EntityDirectory::Extract(const EntityId& id)
+    {
+        const u64 hash = Hash(id);
+        Shard& shard = GetShard(hash);
+        AZStd::scoped_lock lock(shard.m_mutex);
+
+        Table* table = shard.m_table.load(AZStd::memory_order_relaxed);
+        const size_t index = table ? FindEntry(*table, static_cast<u64>(id), hash) : InvalidEntryIndex;
+        if (index == InvalidEntryIndex)
+        {
+            return nullptr;
+        }
+
+        Entry& entry = table->m_entries[index];
+        Entity* entity = entry.m_entity.load(AZStd::memory_order_relaxed);
+        const u32 slot = entry.m_slot.load(AZStd::memory_order_relaxed);
+
+        // The slot is released while the shard is being written, so readers that fetch the handle of the entity never
+        // combine the slot index with the generation of the next entity in the slot.
+        EntityDirectoryInternal::BeginWrite(shard.m_sequence);
+        entry.m_slot.store(RemovedEntry, AZStd::memory_order_relaxed);
+        entry.m_entity.store(nullptr, AZStd::memory_order_relaxed);
+        if (slot != InvalidSlotIndex)
+        {
+            ReleaseSlot(slot);
+        }
+        EntityDirectoryInternal::EndWrite(shard.m_sequence);
+
+        --shard.m_size;
+        ++shard.m_removedCount;
+        m_size.fetch_sub(1, AZStd::memory_order_relaxed);
+        return entity;
+    }
+
+    Entity* EntityDirectory::Find(const EntityId& id) const
+    {
+        const u64 hash = Hash(id);
+        const Shard& shard = GetShard(hash);
+        EpochReclaimer::ReadGuard readGuard(m_tableReclaimer);
+        while (true)
+        {
+            const u32 sequence = shard.m_sequence.load(AZStd::memory_order_acquire);
+            if ((sequence & 1) == 0)
+            {
+                Entity* entity = nullptr;
+                if (const Table* table = shard.m_table.load(AZStd::memory_order_acquire))
+                {
+                    const size_t index = FindEntry(*table, static_cast<u64>(id), hash);
+                    if (index != InvalidEntryIndex)
+                    {
+                        entity = table->m_entries[index].m_entity.load(AZStd::memory_order_relaxed);
+                    }
+                }
+
+                AZStd::atomic_thread_fence(AZStd::memory_order_acquire);
+                if (shard.m_sequence.load(AZStd::memory_order_relaxed) == sequence)
+                {
+                    return entity;
+                }
+            }
+            AZStd::this_thread::yield();
+        }
+    }
+
+    EntityDirectory::Handle EntityDirectory::GetHandle(const EntityId& id) const
+    {
+        const u64 hash = Hash(id);
+        const Shard& shard = GetShard(hash);
+        EpochReclaimer::ReadGuard readGuard(m_tableReclaimer);
+        while (true)
+        {
+            const u32 sequence = shard.m_sequence.load(AZStd::memory_order_acquire);
+            if ((sequence & 1) == 0)
+            {
+                Handle handle;
+                if (const Table* table = shard.m_table.load(AZStd::memory_order_acquire))
+                {
+                    const size_t index = FindEntry(*table, static_cast<u64>(id), hash);
+                    if (index != InvalidEntryIndex)
+                    {
+                        handle.m_index = table->m_entries[index].m_slot.load(AZStd::memory_order_relaxed);
+                        if (const Slot* slot = GetSlot(handle.m_index))
+                        {
+                            handle.m_generation = slot->m_generation.load(AZStd::memory_order_relaxed);
+                        }
+                    }
+                }
+
+                AZStd::atomic_thread_fence(AZStd::memory_order_acquire);
+                if (shard.m_sequence.load(AZStd::memory_order_relaxed) == sequence)
+                {
+                    return handle;
+                }
+            }
+            AZStd::this_thread::yield();
+        }
+    }
+
+    Entity* EntityDirectory::Find(Handle handle) const
+    {
+        const Slot* slot = GetSlot(handle.m_index);
+        if (!slot)
+        {
+            return nullptr;
+        }
+
+        // A slot is only reused after its generation has been bumped, so if the entity of the next owner of the slot is seen
+        // the new generation is seen as well.
+        Entity* entity = slot->m_entity.load(AZStd::memory_order_acquire);
+        return slot->m_generation.load(AZStd::memory_order_acquire) == handle.m_generation ? entity : nullptr;
+    }
+
+    void EntityDirectory::EnumerateEntities(const AZStd::function<void(Entity*)>& callback) const
+    {
+        AZStd::vector<Entity*> entities;
+        entities.reserve(GetSize());
+        for (const Shard& shard : m_shards)
+        {
+            AZStd::scoped_lock lock(shard.m_mutex);
+            if (const Table* table = shard.m_table.load(AZStd::memory_order_relaxed))
+            {
+                for (size_t index = 0; index <= table->m_mask; ++index)
+                {
+                    const Entry& entry = table->m_entries[index];
+                    const u32 slot = entry.m_slot.load(AZStd::memory_order_relaxed);
+                    if (slot != EmptyEntry && slot != RemovedEntry)
+                    {
+                        entities.push_back(entry.m_entity.load(AZStd::memory_order_relaxed));
+                    }
+                }
+            }
+        }
+
+        for (Entity* entity : entities)
+        {
+            callback(entity);
+        }
+    }
+
+    size_t EntityDirectory::GetSize() const
+    {
+        return m_size.load(AZStd::memory_order_relaxed);
+    }
+
+    bool EntityDirectory::IsEmpty() const
+    {
+        return GetSize() == 0;
+    }
+
+    size_t EntityDirectory::GetRetiredTableCount() const
+    {
+        AZStd::scoped_lock lock(m_tableReclaimerMutex);
+        return m_tableReclaimer.GetRetiredCount();
+    }
+
+    void EntityDirectory::Clear()
+    {
+        for (Shard& shard : m_shards)
+        {
+            AZStd::scoped_lock lock(shard.m_mutex);
+            EntityDirectoryInternal::BeginWrite(shard.m_sequence);
+            Table* table = shard.m_table.exchange(nullptr, AZStd::memory_order_relaxed);
+            EntityDirectoryInternal::EndWrite(shard.m_sequence);
+            delete table;
+            shard.m_size = 0;
+            shard.m_removedCount = 0;
+        }
+
+        {
+            AZStd::scoped_lock lock(m_tableReclaimerMutex);
+            m_tableReclaimer.Reclaim();
+        }
+
+        AZStd::scoped_lock lock(m_slotMutex);
+        for (AZStd::atomic<Slot*>& chunk : m_slotChunks)
+        {
+            delete[] chunk.exchange(nullptr, AZStd::memory_order_relaxed);
+        }
+        m_freeSlots.clear();
+        m_freeSlots.shrink_to_fit();
+        m_slotCount = 0;
+        m_size.store(0, AZStd::memory_order_relaxed);
+    }
+
+    u64 EntityDirectory::Hash(const EntityId& id)
+    {
+        // Entity ids are usually random, but spread them anyway in case they're assigned sequentially.
+        u64 hash = static_cast<u64>(id);
+        hash ^= hash >> 33;
+        hash *= 0xff51afd7ed558ccdull;
+        hash ^= hash >> 33;
+        hash *= 0xc4ceb9fe1a85ec53ull;
+        hash ^= hash >> 33;
+        return hash;
+    }
+
+    EntityDirectory::Shard& EntityDirectory::GetShard(u64 hash)
+    {
+        // The top bits pick the shard, the bottom bits the entry in the table of the shard.
+        return m_shards[hash >> (64 - ShardCountShift)];
+    }
+
+    const EntityDirectory::Shard& EntityDirectory::GetShard(u64 hash) const
+    {
+        return m_shards[hash >> (64 - ShardCountShift)];
+    }
+
+    size_t EntityDirectory::FindEntry(const Table& table, u64 id, u64 hash)
+    {
+        // Tables are never more than three quarters full, but a reader may look at a table that's being changed, so limit the
+        // number of probes as well.
+        size_t index = hash & table.m_mask;
+        for (size_t probe = 0; probe <= table.m_mask; ++probe)
+        {
+            const Entry& entry = table.m_entries[index];
+            const u32 slot = entry.m_slot.load(AZStd::memory_order_relaxed);
+            if (slot == EmptyEntry)
+            {
+                break;
+            }
+            if (slot != RemovedEntry && entry.m_id.load(AZStd::memory_order_relaxed) == id)
+            {
+                return index;
+            }
+            index = (index + 1) & table.m_mask;
+        }
+        return InvalidEntryIndex;
+    }
+
+    void EntityDirectory::Reserve(Shard& shard)
+    {
+        Table* table = shard.m_table.load(AZStd::memory_order_relaxed);
+        const size_t capacity = table ? table->m_mask + 1 : 0;
+        if ((shard.m_size + shard.m_removedCount + 1) * 4 <= capacity * 3)
+        {
+            return;
+        }
+
+        // Rebuilding the table drops the removed entries, so only grow if the table is actually filling up.
+        size_t newCapacity = MinTableCapacity;
+        while ((shard.m_size + 1) * 2 > newCapacity)
+        {
+            newCapacity *= 2;
+        }
+
+        Table* newTable = aznew Table(newCapacity);
+        if (table)
+        {
+            for (size_t index = 0; index < capacity; ++index)
+            {
+                const Entry& entry = table->m_entries[index];
+                const u32 slot = entry.m_slot.load(AZStd::memory_order_relaxed);
+                if (slot == EmptyEntry || slot == RemovedEntry)
+                {
+                    continue;
+                }
+
+                const u64 id = entry.m_id.load(AZStd::memory_order_relaxed);
+                size_t newIndex = Hash(EntityId(id)) & newTable->m_mask;
+                while (newTable->m_entries[newIndex].m_slot.load(AZStd::memory_order_relaxed) != EmptyEntry)
+                {
+                    newIndex = (newIndex + 1) & newTable->m_mask;
+                }
+
+                Entry& newEntry = newTable->m_entries[newIndex];
+                newEntry.m_id.store(id, AZStd::memory_order_relaxed);
+                newEntry.m_entity.store(entry.m_entity.load(AZStd::memory_order_relaxed), AZStd::memory_order_relaxed);
+                newEntry.m_slot.store(slot, AZStd::memory_order_relaxed);
+            }
+        }
+
+        // The old table holds the same entities as the new one and doesn't change anymore, so readers that are still
+        // probing it find the right entities. It's released once those readers are done.
+        shard.m_table.store(newTable, AZStd::memory_order_release);
+        shard.m_removedCount = 0;
+        if (table)
+        {
+            RetireTable(table);
+        }
+    }
+
+    void EntityDirectory::RetireTable(Table* table)
+    {
+        AZStd::scoped_lock lock(m_tableReclaimerMutex);
+        m_tableReclaimer.Retire(table);
+    }
+
+    u32 EntityDirectory::AllocateSlot(Entity* entity)
+    {
+        AZStd::scoped_lock lock(m_slotMutex);
+
+        u32 index;
+        if (!m_freeSlots.empty())
+        {
+            index = m_freeSlots.back();
+            m_freeSlots.pop_back();
+        }
+        else if (m_slotCount < MaxSlotChunks * SlotChunkSize)
+        {
+            index = m_slotCount++;
+            AZStd::atomic<Slot*>& chunk = m_slotChunks[index >> SlotChunkShift];
+            if (!chunk.load(AZStd::memory_order_relaxed))
+            {
+                chunk.store(new Slot[SlotChunkSize], AZStd::memory_order_release);
+            }
+        }
+        else
+        {
+            return InvalidSlotIndex;
+        }
+
+        Slot& slot = m_slotChunks[index >> SlotChunkShift].load(AZStd::memory_order_relaxed)[index & (SlotChunkSize - 1)];
+        slot.m_entity.store(entity, AZStd::memory_order_release);
+        return index;
+    }
+
+    void EntityDirectory::ReleaseSlot(u32 index)
+    {
+        AZStd::scoped_lock lock(m_slotMutex);
+
+        Slot& slot = m_slotChunks[index >> SlotChunkShift].load(AZStd::memory_order_relaxed)[index & (SlotChunkSize - 1)];
+        slot.m_generation.store(slot.m_generation.load(AZStd::memory_order_relaxed) + 1, AZStd::memory_order_relaxed);
+        slot.m_entity.store(nullptr, AZStd::memory_order_release);
+        m_freeSlots.push_back(index);
+    }
+
+    const EntityDirectory::Slot* EntityDirectory::GetSlot(u32 index) const
+    {
+        if (index >= MaxSlotChunks * SlotChunkSize)
+        {
+            return nullptr;
+        }
+
+        const Slot* chunk = m_slotChunks[index >> SlotChunkShift].load(AZStd::memory_order_acquire);
+        return chunk ? &chunk[index & (SlotChunkSize - 1)] : nullptr;
+    }
+} // namespace AZ
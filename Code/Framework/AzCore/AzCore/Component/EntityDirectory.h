@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/function/function_fwd.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/Threading/EpochReclaimer.h>
+
+namespace AZ
+{
+    class Entity;
+
+    //! Concurrent map from entity ids to entities, used by the ComponentApplication to keep track of all entities.
+    //! The entities are spread over a fixed number of shards based on the hash of the entity id. Every shard is an open
+    //! addressing hash table with its own mutex for writers, so adding and removing entities on different threads rarely
+    //! contend. Lookups don't take a lock. Writers bump a sequence counter in the shard before and after every change and
+    //! readers retry if the counter changed while they were probing the table. Tables that were replaced by a rebuild are
+    //! released once no lookup can still be probing them.
+    //! In addition every entity gets a slot in a generation indexed slot map. Systems that look up the same entities
+    //! repeatedly can store the Handle of an entity and use it for lookups, which is a single array access. A handle no
+    //! longer finds the entity once it has been removed, even if the slot has been reused by another entity.
+    class EntityDirectory final
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(EntityDirectory, SystemAllocator);
+
+        static constexpr u32 InvalidSlotIndex = AZStd::numeric_limits<u32>::max();
+
+        //! Index and generation of the slot of an entity in the slot map.
+        struct Handle
+        {
+            u32 m_index = InvalidSlotIndex;
+            u32 m_generation = 0;
+
+            bool IsValid() const
+            {
+                return m_index != InvalidSlotIndex;
+            }
+        };
+
+        EntityDirectory();
+        ~EntityDirectory();
+
+        EntityDirectory(const EntityDirectory&) = delete;
+        EntityDirectory& operator=(const EntityDirectory&) = delete;
+
+        //! Adds the entity under the provided id. Returns false if there's already an entity with the same id.
+        bool Insert(const EntityId& id, Entity* entity);
+        //! Removes the entity with the provided id. Returns false if there's no entity with the id.
+        bool Remove(const EntityId& id);
+        //! Removes the entity with the provided id and returns it, or nullptr if there's no entity with the id.
+        Entity* Extract(const EntityId& id);
+
+        //! Returns the entity with the provided id or nullptr if there's no entity with the id. Safe to call concurrently with
+        //! Insert and Remove.
+        Entity* Find(const EntityId& id) const;
+        //! Returns the handle of the entity with the provided id. The handle is invalid if there's no entity with the id, or in
+        //! the unlikely case the slot map is full.
+        Handle GetHandle(const EntityId& id) const;
+        //! Returns the entity the handle was created for, or nullptr if the entity has been removed since.
+        Entity* Find(Handle handle) const;
+
+        //! Calls the callback for all entities. The entities are collected first, so the callback is allowed to add or
+        //! remove entities.
+        void EnumerateEntities(const AZStd::function<void(Entity*)>& callback) const;
+
+        size_t GetSize() const;
+        bool IsEmpty() const;
+        //! Returns the number of replaced tables that haven't been released yet.
+        size_t GetRetiredTableCount() const;
+
+        //! Removes all entities and releases all memory. Unlike the other functions this is not safe to call while other
+        //! threads access the directory.
+        void Clear();
+
+    private:
+        static constexpr size_t ShardCountShift = 6;
+        static constexpr size_t ShardCount = size_t{ 1 } << ShardCountShift;
+        static constexpr size_t MinTableCapacity = 16;
+        //! Number of replaced tables that are collected before waiting on lookups to release them.
+        static constexpr size_t RetiredTableBatchSize = 16;
+
+        static constexpr u32 SlotChunkShift = 12;
+        static constexpr u32 SlotChunkSize = u32{ 1 } << SlotChunkShift;
+        static constexpr u32 MaxSlotChunks = 1024;
+
+        //! Values of Entry::m_slot for entries that don't hold an entity.
+        static constexpr u32 EmptyEntry = AZStd::numeric_limits<u32>::max();
+        static constexpr u32 RemovedEntry = EmptyEntry - 1;
+        static constexpr size_t InvalidEntryIndex = AZStd::numeric_limits<size_t>::max();
+
+        // All fields are atomics so readers can probe the tables while they're modified. The sequence counter of the shard
+        // tells them whether they've seen a consistent state.
+        struct Entry
+        {
+            AZStd::atomic<u64> m_id{ 0 };
+            AZStd::atomic<Entity*> m_entity{ nullptr };
+            //! The index in the slot map, InvalidSlotIndex if the slot map is full, or EmptyEntry or RemovedEntry.
+            AZStd::atomic<u32> m_slot{ EmptyEntry };
+        };
+
+        struct Table
+        {
+            AZ_CLASS_ALLOCATOR(Table, SystemAllocator);
+
+            explicit Table(size_t capacity);
+
+            AZStd::unique_ptr<Entry[]> m_entries;
+            size_t m_mask;
+        };
+
+        struct Shard
+        {
+            mutable AZStd::mutex m_mutex;
+            AZStd::atomic<u32> m_sequence{ 0 };
+            //! Owned by the shard. Replaced tables are handed to m_tableReclaimer.
+            AZStd::atomic<Table*> m_table{ nullptr };
+            size_t m_size = 0;
+            size_t m_removedCount = 0;
+        };
+
+        struct Slot
+        {
+            AZStd::atomic<Entity*> m_entity{ nullptr };
+            AZStd::atomic<u32> m_generation{ 0 };
+        };
+
+        static u64 Hash(const EntityId& id);
+        Shard& GetShard(u64 hash);
+        const Shard& GetShard(u64 hash) const;
+        //! Returns the index of the entry of the id, or InvalidEntryIndex. Readers are responsible for checking the sequence
+        //! counter of the shard.
+        static size_t FindEntry(const Table& table, u64 id, u64 hash);
+        //! Replaces the table of the shard by a larger one if there's not enough room to add an entry. Requires the shard mutex.
+        void Reserve(Shard& shard);
+        //! Releases the table once no lookup can be probing it anymore.
+        void RetireTable(Table* table);
+
+        u32 AllocateSlot(Entity* entity);
+        void ReleaseSlot(u32 index);
+        const Slot* GetSlot(u32 index) const;
+
+        AZStd::array<Shard, ShardCount> m_shards;
+
+        //! Lookups hold a read guard while they probe a table. Retiring is serialized by m_tableReclaimerMutex, because the
+        //! shards are rebuilt under their own mutexes.
+        EpochReclaimer m_tableReclaimer{ RetiredTableBatchSize };
+        mutable AZStd::mutex m_tableReclaimerMutex;
+
+        AZStd::array<AZStd::atomic<Slot*>, MaxSlotChunks> m_slotChunks;
+        AZStd::vector<u32> m_freeSlots;
+        u32 m_slotCount = 0;
+        AZStd::mutex m_slotMutex;
+
+        AZStd::atomic<size_t> m_size{ 0 };
+    };
+} // namespace AZ
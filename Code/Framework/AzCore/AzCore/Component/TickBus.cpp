@@ -6,7 +6,165 @@
  *
  */
 #include <AzCore/Component/TickBus.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Memory/FrameArenaAllocator.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
 
 AZ_INSTANTIATE_EBUS_SINGLE_ADDRESS(AZCORE_API, AZ::TickEvents);
 AZ_INSTANTIATE_EBUS_SINGLE_ADDRESS(AZCORE_API, AZ::SystemTickEvents);
 AZ_INSTANTIATE_EBUS_SINGLE_ADDRESS(AZCORE_API, AZ::TickRequests);
+
+namespace AZ
+{
+    namespace
+    {
+        using TickHandlerList = AZStd::vector<TickEvents*, FrameArenaStdAllocator>;
+
+        void TickHandler(TickEvents* handler, float deltaTime, ScriptTimePoint time)
+        {
+            AZ_PROFILE_SCOPE(AzCore, "%s::OnTick", handler->RTTI_GetTypeName());
+            handler->OnTick(deltaTime, time);
+        }
+
+        // Tracks the tasks that accessed a piece of data since it was last written
+        struct ParallelTickDataAccess
+        {
+            AZStd::vector<size_t, FrameArenaStdAllocator> m_readers;
+            size_t m_writer = 0;
+            bool m_hasWriter = false;
+        };
+
+        void TickParallelHandlers(const TickHandlerList& handlers, float deltaTime, ScriptTimePoint time, TaskExecutor& executor)
+        {
+            if (handlers.size() == 1)
+            {
+                TickHandler(handlers.front(), deltaTime, time);
+                return;
+            }
+
+            AZ_PROFILE_SCOPE(AzCore, "DispatchTick:ParallelBucket");
+
+            TaskGraph taskGraph{ "TickBus" };
+            AZStd::vector<TaskToken, FrameArenaStdAllocator> tasks;
+            tasks.reserve(handlers.size());
+            AZStd::unordered_map<Crc32, ParallelTickDataAccess, AZStd::hash<Crc32>, AZStd::equal_to<Crc32>, FrameArenaStdAllocator>
+                dataAccesses;
+
+            const TaskDescriptor descriptor{ "OnTick", "TickBus" };
+            for (TickEvents* handler : handlers)
+            {
+                const size_t taskIndex = tasks.size();
+                tasks.push_back(taskGraph.AddTask(
+                    descriptor,
+                    [handler, deltaTime, time]()
+                    {
+                        TickHandler(handler, deltaTime, time);
+                    }));
+
+                // Order the task after the earlier tasks it conflicts with
+                const TickEvents::ParallelTickAccess access = handler->GetParallelTickAccess();
+                for (const Crc32 data : access.m_writes)
+                {
+                    ParallelTickDataAccess& dataAccess = dataAccesses[data];
+                    if (dataAccess.m_hasWriter && dataAccess.m_writer != taskIndex)
+                    {
+                        tasks[dataAccess.m_writer].Precedes(tasks[taskIndex]);
+                    }
+                    for (const size_t reader : dataAccess.m_readers)
+                    {
+                        if (reader != taskIndex)
+                        {
+                            tasks[reader].Precedes(tasks[taskIndex]);
+                        }
+                    }
+                    dataAccess.m_readers.clear();
+                    dataAccess.m_writer = taskIndex;
+                    dataAccess.m_hasWriter = true;
+                }
+                for (const Crc32 data : access.m_reads)
+                {
+                    if (AZStd::find(access.m_writes.begin(), access.m_writes.end(), data) != access.m_writes.end())
+                    {
+                        continue;
+                    }
+                    ParallelTickDataAccess& dataAccess = dataAccesses[data];
+                    if (dataAccess.m_hasWriter)
+                    {
+                        tasks[dataAccess.m_writer].Precedes(tasks[taskIndex]);
+                    }
+                    dataAccess.m_readers.push_back(taskIndex);
+                }
+            }
+
+            // Barrier, the next handlers may read what this bucket wrote
+            TaskGraphEvent finishedEvent{ "TickBus parallel bucket" };
+            taskGraph.SubmitOnExecutor(executor, &finishedEvent);
+            finishedEvent.Wait();
+        }
+    } // namespace
+
+    void DispatchTick(float deltaTime, ScriptTimePoint time, TaskExecutor* executor)
+    {
+        TickBus::Context* context = TickBus::GetContext();
+        if (!context)
+        {
+            return;
+        }
+
+        // Routers can intercept OnTick or stop it from reaching the handlers, which only the bus's own dispatch handles
+        if (!context->m_routing.m_routers.empty())
+        {
+            TickBus::Broadcast(&TickEvents::OnTick, deltaTime, time);
+            return;
+        }
+
+        // Record the tick as a single dispatch, the same as Broadcast does
+        TickBus::DispatchStatisticsPolicy::Scope dispatchStatisticsScope(context->m_dispatchStatistics);
+
+        if (!executor)
+        {
+            TickBus::EnumerateHandlers(
+                [deltaTime, &time](TickEvents* handler)
+                {
+                    TickHandler(handler, deltaTime, time);
+                    return true;
+                });
+            return;
+        }
+
+        // Parallel safe handlers are only gathered here, they tick when the bucket ends. The bus can't change in between,
+        // as no handler code runs until then.
+        TickHandlerList parallelHandlers;
+        int parallelTickOrder = 0;
+        TickBus::EnumerateHandlers(
+            [deltaTime, &time, executor, &parallelHandlers, &parallelTickOrder](TickEvents* handler)
+            {
+                const bool isParallelSafe = handler->IsTickParallelSafe();
+                const int tickOrder = handler->GetTickOrder();
+                if (!parallelHandlers.empty() && (!isParallelSafe || tickOrder != parallelTickOrder))
+                {
+                    TickParallelHandlers(parallelHandlers, deltaTime, time, *executor);
+                    parallelHandlers.clear();
+                }
+
+                if (isParallelSafe)
+                {
+                    parallelTickOrder = tickOrder;
+                    parallelHandlers.push_back(handler);
+                }
+                else
+                {
+                    TickHandler(handler, deltaTime, time);
+                }
+                return true;
+            });
+
+        if (!parallelHandlers.empty())
+        {
+            TickParallelHandlers(parallelHandlers, deltaTime, time, *executor);
+        }
+    }
+} // namespace AZ
@@ -14,12 +14,16 @@
 #pragma once
 
 #include <AzCore/Component/ComponentBus.h>
+#include <AzCore/Math/Crc.h>
 #include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/span.h>
 #include <AzCore/std/parallel/mutex.h> // For TickBus thread events.
 #include <AzCore/Script/ScriptTimePoint.h>
 
 namespace AZ
 {
+    class TaskExecutor;
+
     /**
      * Values to help you set when a particular handler is notified of ticks.
      */
@@ -131,6 +135,40 @@ namespace AZ
             return m_tickOrder;
         }
 
+        /**
+         * Describes the shared data a parallel safe handler accesses in OnTick.
+         * The ids are arbitrary, handlers that touch the same data just have to agree on them (for example AZ_CRC_CE("Transforms")).
+         */
+        struct ParallelTickAccess
+        {
+            AZStd::span<const Crc32> m_reads; ///< Data OnTick only reads.
+            AZStd::span<const Crc32> m_writes; ///< Data OnTick modifies, a write implies a read.
+        };
+
+        /**
+         * Specifies whether OnTick can run on a task worker thread, concurrently with the other parallel safe handlers
+         * that have the same tick order and are connected next to it.
+         * A parallel safe handler must not connect or disconnect TickBus handlers, broadcast on the TickBus, or call
+         * buses that aren't thread safe from OnTick. TickBus::QueueFunction can be used to defer such work to the next tick.
+         * Handlers that aren't parallel safe always tick on the main thread, after all parallel handlers before them finished.
+         * @return true if OnTick is safe to run in parallel.
+         */
+        virtual bool    IsTickParallelSafe()
+        {
+            return false;
+        }
+
+        /**
+         * Returns the data OnTick of a parallel safe handler accesses. Handlers whose accesses conflict (at least one of
+         * them writes the same data) tick one after the other, in connection order. Handlers that don't declare any
+         * access run fully concurrent with the rest of their bucket.
+         * The returned spans must stay valid until the tick returns.
+         */
+        virtual ParallelTickAccess GetParallelTickAccess()
+        {
+            return {};
+        }
+
     protected:
         // Only the component application is allowed to issue ticks.
         friend class ComponentApplication;
@@ -147,6 +185,17 @@ namespace AZ
      * The events are defined in the AZ::TickEvents class.
      */
     typedef AZ::EBus<TickEvents>    TickBus;
+
+    /**
+     * Sends OnTick to all TickBus handlers, in tick order.
+     * Consecutive parallel safe handlers with the same tick order are ticked as a task graph on the executor, which
+     * is waited on before the next handler or bucket ticks. Every handler is timed in its own profiler scope.
+     * While a TickBus router is connected, the tick is sent with TickBus::Broadcast instead so the routers see it.
+     * @param deltaTime The delta (in seconds) from the previous tick and the current time.
+     * @param time The current time.
+     * @param executor Executor for the parallel handlers, when nullptr all handlers tick serially on the calling thread.
+     */
+    AZCORE_API void DispatchTick(float deltaTime, ScriptTimePoint time, TaskExecutor* executor);
     
     /**
      * Interface for AZ::TickRequestBus, which components use to make tick-related 
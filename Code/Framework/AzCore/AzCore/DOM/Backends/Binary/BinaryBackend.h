@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/DOM/Backends/Binary/BinarySerializationUtils.h>
+#include <AzCore/DOM/DomBackend.h>
+#include <AzCore/IO/ByteContainerStream.h>
+
+namespace AZ::Dom
+{
+    //! A DOM backend for serializing and deserializing a compact binary format.
+    //! \see Binary::VisitSerializedBinary for a description of the format.
+    class BinaryBackend final : public Backend
+    {
+    public:
+        Visitor::Result ReadFromBuffer(const char* buffer, size_t size, AZ::Dom::Lifetime lifetime, Visitor& visitor) override
+        {
+            return Binary::VisitSerializedBinary({ buffer, size }, lifetime, visitor);
+        }
+
+        Visitor::Result ReadFromBufferInPlace(char* buffer, AZStd::optional<size_t> size, Visitor& visitor) override
+        {
+            // The binary format may contain null characters, so the size can't be deduced from the buffer.
+            if (!size.has_value())
+            {
+                return AZ::Failure(VisitorError(VisitorErrorCode::InvalidData, "The size of a binary DOM buffer must be provided"));
+            }
+            // Strings are never modified while reading, so reading in place is the same as reading a persistent buffer.
+            return Binary::VisitSerializedBinary({ buffer, size.value() }, Lifetime::Persistent, visitor);
+        }
+
+        Visitor::Result WriteToBuffer(AZStd::string& buffer, WriteCallback callback) override
+        {
+            AZ::IO::ByteContainerStream<AZStd::string> stream{ &buffer };
+            AZStd::unique_ptr<Visitor> visitor = Binary::CreateBinaryStreamWriter(stream);
+            return callback(*visitor);
+        }
+    };
+} // namespace AZ::Dom
@@ -0,0 +1,493 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/DOM/Backends/Binary/BinarySerializationUtils.h>
+
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+
+namespace AZ::Dom::Binary
+{
+    //
+    // class BinaryStreamWriter
+    //
+    // Visitor that writes the binary DOM format to a stream
+    class BinaryStreamWriter final : public Visitor
+    {
+    public:
+        explicit BinaryStreamWriter(AZ::IO::GenericStream& stream)
+            : m_stream(stream)
+        {
+            m_cache.reserve(CacheSize);
+            WriteBytes(Signature.data(), Signature.size());
+            WriteByte(FormatVersion);
+        }
+
+        ~BinaryStreamWriter() override
+        {
+            Flush();
+        }
+
+        VisitorFlags GetVisitorFlags() const override
+        {
+            return VisitorFlags::SupportsRawKeys | VisitorFlags::SupportsArrays | VisitorFlags::SupportsObjects |
+                VisitorFlags::SupportsNodes;
+        }
+
+        Result Null() override
+        {
+            WriteTag(Tag::Null);
+            return CheckWrite();
+        }
+
+        Result Bool(bool value) override
+        {
+            WriteTag(value ? Tag::True : Tag::False);
+            return CheckWrite();
+        }
+
+        Result Int64(AZ::s64 value) override
+        {
+            WriteTag(Tag::Int64);
+            // Zigzag encoding keeps small negative numbers small.
+            WriteVarUint((static_cast<AZ::u64>(value) << 1) ^ static_cast<AZ::u64>(value >> 63));
+            return CheckWrite();
+        }
+
+        Result Uint64(AZ::u64 value) override
+        {
+            WriteTag(Tag::Uint64);
+            WriteVarUint(value);
+            return CheckWrite();
+        }
+
+        Result Double(double value) override
+        {
+            WriteTag(Tag::Double);
+            AZ::u64 bits;
+            memcpy(&bits, &value, sizeof(bits));
+            for (int byteIndex = 0; byteIndex < 8; ++byteIndex)
+            {
+                WriteByte(static_cast<AZ::u8>(bits >> (byteIndex * 8)));
+            }
+            return CheckWrite();
+        }
+
+        Result String(AZStd::string_view value, [[maybe_unused]] Lifetime lifetime) override
+        {
+            WriteTag(Tag::String);
+            WriteVarUint(value.size());
+            WriteBytes(value.data(), value.size());
+            return CheckWrite();
+        }
+
+        Result StartObject() override
+        {
+            WriteTag(Tag::StartObject);
+            return CheckWrite();
+        }
+
+        Result EndObject(AZ::u64 attributeCount) override
+        {
+            WriteTag(Tag::EndObject);
+            WriteVarUint(attributeCount);
+            return CheckWrite();
+        }
+
+        Result Key(AZ::Name key) override
+        {
+            return RawKey(key.GetStringView(), Lifetime::Persistent);
+        }
+
+        Result RawKey(AZStd::string_view key, [[maybe_unused]] Lifetime lifetime) override
+        {
+            WriteTag(Tag::Key);
+            WriteName(key);
+            return CheckWrite();
+        }
+
+        Result StartArray() override
+        {
+            WriteTag(Tag::StartArray);
+            return CheckWrite();
+        }
+
+        Result EndArray(AZ::u64 elementCount) override
+        {
+            WriteTag(Tag::EndArray);
+            WriteVarUint(elementCount);
+            return CheckWrite();
+        }
+
+        Result StartNode(AZ::Name name) override
+        {
+            return RawStartNode(name.GetStringView(), Lifetime::Persistent);
+        }
+
+        Result RawStartNode(AZStd::string_view name, [[maybe_unused]] Lifetime lifetime) override
+        {
+            WriteTag(Tag::StartNode);
+            WriteName(name);
+            return CheckWrite();
+        }
+
+        Result EndNode(AZ::u64 attributeCount, AZ::u64 elementCount) override
+        {
+            WriteTag(Tag::EndNode);
+            WriteVarUint(attributeCount);
+            WriteVarUint(elementCount);
+            return CheckWrite();
+        }
+
+    private:
+        static constexpr size_t CacheSize = 64 * 1024;
+
+        void WriteTag(Tag tag)
+        {
+            WriteByte(static_cast<AZ::u8>(tag));
+        }
+
+        void WriteByte(AZ::u8 value)
+        {
+            if (m_cache.size() == m_cache.capacity())
+            {
+                Flush();
+            }
+            m_cache.push_back(static_cast<char>(value));
+        }
+
+        void WriteVarUint(AZ::u64 value)
+        {
+            while (value >= 0x80)
+            {
+                WriteByte(static_cast<AZ::u8>(value | 0x80));
+                value >>= 7;
+            }
+            WriteByte(static_cast<AZ::u8>(value));
+        }
+
+        void WriteBytes(const char* data, size_t size)
+        {
+            if (m_cache.size() + size > m_cache.capacity())
+            {
+                Flush();
+                if (size > m_cache.capacity())
+                {
+                    // Large strings bypass the cache.
+                    WriteToStream(data, size);
+                    return;
+                }
+            }
+            m_cache.insert(m_cache.end(), data, data + size);
+        }
+
+        void WriteName(AZStd::string_view name)
+        {
+            if (auto it = m_names.find(name); it != m_names.end())
+            {
+                WriteVarUint(static_cast<AZ::u64>(it->second) << 1);
+                return;
+            }
+
+            // The views in m_names point into m_nameStorage, which doesn't move its elements when it grows.
+            const AZ::u32 index = aznumeric_cast<AZ::u32>(m_nameStorage.size());
+            m_nameStorage.emplace_back(name);
+            m_names.emplace(AZStd::string_view(m_nameStorage.back()), index);
+
+            WriteVarUint((static_cast<AZ::u64>(name.size()) << 1) | 1);
+            WriteBytes(name.data(), name.size());
+        }
+
+        void Flush()
+        {
+            if (!m_cache.empty())
+            {
+                WriteToStream(m_cache.data(), m_cache.size());
+                m_cache.clear();
+            }
+        }
+
+        void WriteToStream(const char* data, size_t size)
+        {
+            const AZ::IO::SizeType bytesWritten = m_stream.Write(size, data);
+            if (bytesWritten != size)
+            {
+                AZ_Error("DOM", false, "Failed writing %zu byte(s) to stream, wrote only %llu bytes!", size, bytesWritten);
+                m_writeFailed = true;
+            }
+        }
+
+        Result CheckWrite()
+        {
+            if (m_writeFailed)
+            {
+                return VisitorFailure(VisitorErrorCode::InternalError, "Failed to write binary DOM");
+            }
+            return VisitorSuccess();
+        }
+
+        AZ::IO::GenericStream& m_stream;
+        AZStd::vector<char> m_cache;
+        AZStd::unordered_map<AZStd::string_view, AZ::u32> m_names;
+        AZStd::deque<AZStd::string> m_nameStorage;
+        bool m_writeFailed = false;
+    };
+
+    //
+    // class BinaryReader
+    //
+    // Reads the binary DOM format and forwards the values to a Visitor
+    class BinaryReader final
+    {
+    public:
+        BinaryReader(AZStd::string_view buffer, Lifetime lifetime, Visitor& visitor)
+            : m_buffer(buffer)
+            , m_lifetime(lifetime)
+            , m_visitor(visitor)
+        {
+        }
+
+        Visitor::Result Read()
+        {
+            if (!IsBinaryDom(m_buffer))
+            {
+                return InvalidData("The buffer doesn't start with the binary DOM signature");
+            }
+            m_cursor = Signature.size();
+
+            AZ::u8 version;
+            if (!ReadByte(version) || version != FormatVersion)
+            {
+                return InvalidData("Unsupported binary DOM version");
+            }
+
+            // Read values until the first value, including all of its children, is complete.
+            size_t depth = 0;
+            do
+            {
+                AZ::u8 tag;
+                if (!ReadByte(tag))
+                {
+                    return InvalidData("Unexpected end of the buffer");
+                }
+
+                Visitor::Result result = ReadValue(static_cast<Tag>(tag), depth);
+                if (!result.IsSuccess())
+                {
+                    return result;
+                }
+            } while (depth > 0);
+
+            if (m_cursor != m_buffer.size())
+            {
+                return InvalidData("Unexpected data after the end of the value");
+            }
+            return AZ::Success();
+        }
+
+    private:
+        Visitor::Result ReadValue(Tag tag, size_t& depth)
+        {
+            switch (tag)
+            {
+            case Tag::Null:
+                return m_visitor.Null();
+            case Tag::False:
+                return m_visitor.Bool(false);
+            case Tag::True:
+                return m_visitor.Bool(true);
+            case Tag::Int64:
+                {
+                    AZ::u64 value;
+                    if (!ReadVarUint(value))
+                    {
+                        return InvalidData("Invalid integer");
+                    }
+                    return m_visitor.Int64(static_cast<AZ::s64>(value >> 1) ^ -static_cast<AZ::s64>(value & 1));
+                }
+            case Tag::Uint64:
+                {
+                    AZ::u64 value;
+                    if (!ReadVarUint(value))
+                    {
+                        return InvalidData("Invalid integer");
+                    }
+                    return m_visitor.Uint64(value);
+                }
+            case Tag::Double:
+                {
+                    if (m_buffer.size() - m_cursor < 8)
+                    {
+                        return InvalidData("Invalid double");
+                    }
+                    AZ::u64 bits = 0;
+                    for (int byteIndex = 0; byteIndex < 8; ++byteIndex)
+                    {
+                        bits |= static_cast<AZ::u64>(static_cast<AZ::u8>(m_buffer[m_cursor++])) << (byteIndex * 8);
+                    }
+                    double value;
+                    memcpy(&value, &bits, sizeof(value));
+                    return m_visitor.Double(value);
+                }
+            case Tag::String:
+                {
+                    AZStd::string_view value;
+                    if (!ReadString(value))
+                    {
+                        return InvalidData("Invalid string");
+                    }
+                    return m_visitor.String(value, m_lifetime);
+                }
+            case Tag::Key:
+                {
+                    const AZ::Name* key = ReadName();
+                    if (!key)
+                    {
+                        return InvalidData("Invalid key");
+                    }
+                    return m_visitor.Key(*key);
+                }
+            case Tag::StartObject:
+                ++depth;
+                return m_visitor.StartObject();
+            case Tag::StartArray:
+                ++depth;
+                return m_visitor.StartArray();
+            case Tag::StartNode:
+                {
+                    const AZ::Name* name = ReadName();
+                    if (!name)
+                    {
+                        return InvalidData("Invalid node name");
+                    }
+                    ++depth;
+                    return m_visitor.StartNode(*name);
+                }
+            case Tag::EndObject:
+            case Tag::EndArray:
+                {
+                    AZ::u64 count;
+                    if (depth == 0 || !ReadVarUint(count))
+                    {
+                        return InvalidData("Invalid end of container");
+                    }
+                    --depth;
+                    return tag == Tag::EndObject ? m_visitor.EndObject(count) : m_visitor.EndArray(count);
+                }
+            case Tag::EndNode:
+                {
+                    AZ::u64 attributeCount;
+                    AZ::u64 elementCount;
+                    if (depth == 0 || !ReadVarUint(attributeCount) || !ReadVarUint(elementCount))
+                    {
+                        return InvalidData("Invalid end of node");
+                    }
+                    --depth;
+                    return m_visitor.EndNode(attributeCount, elementCount);
+                }
+            default:
+                return InvalidData(AZStd::string::format("Unknown tag %u", static_cast<unsigned>(tag)));
+            }
+        }
+
+        bool ReadByte(AZ::u8& value)
+        {
+            if (m_cursor >= m_buffer.size())
+            {
+                return false;
+            }
+            value = static_cast<AZ::u8>(m_buffer[m_cursor++]);
+            return true;
+        }
+
+        bool ReadVarUint(AZ::u64& value)
+        {
+            value = 0;
+            for (int shift = 0; shift < 64; shift += 7)
+            {
+                AZ::u8 byte;
+                if (!ReadByte(byte))
+                {
+                    return false;
+                }
+                value |= static_cast<AZ::u64>(byte & 0x7f) << shift;
+                if ((byte & 0x80) == 0)
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        bool ReadString(AZStd::string_view& value)
+        {
+            AZ::u64 size;
+            if (!ReadVarUint(size) || size > m_buffer.size() - m_cursor)
+            {
+                return false;
+            }
+            value = m_buffer.substr(m_cursor, size);
+            m_cursor += size;
+            return true;
+        }
+
+        // Names are only converted to AZ::Name the first time they're encountered.
+        const AZ::Name* ReadName()
+        {
+            AZ::u64 value;
+            if (!ReadVarUint(value))
+            {
+                return nullptr;
+            }
+
+            if ((value & 1) == 0)
+            {
+                const AZ::u64 index = value >> 1;
+                return index < m_names.size() ? &m_names[index] : nullptr;
+            }
+
+            const AZ::u64 size = value >> 1;
+            if (size > m_buffer.size() - m_cursor)
+            {
+                return nullptr;
+            }
+            m_names.emplace_back(m_buffer.substr(m_cursor, size));
+            m_cursor += size;
+            return &m_names.back();
+        }
+
+        static Visitor::Result InvalidData(AZStd::string reason)
+        {
+            return AZ::Failure(VisitorError(VisitorErrorCode::InvalidData, AZStd::move(reason)));
+        }
+
+        AZStd::string_view m_buffer;
+        size_t m_cursor = 0;
+        Lifetime m_lifetime;
+        Visitor& m_visitor;
+        AZStd::deque<AZ::Name> m_names;
+    };
+
+    bool IsBinaryDom(AZStd::string_view buffer)
+    {
+        return buffer.starts_with(Signature);
+    }
+
+    AZStd::unique_ptr<Visitor> CreateBinaryStreamWriter(AZ::IO::GenericStream& stream)
+    {
+        return AZStd::make_unique<BinaryStreamWriter>(stream);
+    }
+
+    Visitor::Result VisitSerializedBinary(AZStd::string_view buffer, Lifetime lifetime, Visitor& visitor)
+    {
+        BinaryReader reader(buffer, lifetime, visitor);
+        return reader.Read();
+    }
+} // namespace AZ::Dom::Binary
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/DOM/DomVisitor.h>
+#include <AzCore/IO/GenericStreams.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/string/string_view.h>
+
+namespace AZ::Dom::Binary
+{
+    //! The binary DOM format is a stream of tagged values that mirrors the Visitor calls used to write it.
+    //! - The buffer starts with the 4 byte signature "ADOM" followed by a single byte with the format version.
+    //! - Every value starts with a single byte \ref Tag.
+    //! - Integers and lengths are stored as LEB128 variable length integers, signed integers are zigzag encoded first.
+    //! - Doubles are stored as 8 bytes in little endian order.
+    //! - Strings are stored as their length followed by the UTF-8 bytes, without a null terminator.
+    //! - Keys and node names are interned. The first time a name is written it's stored as (length << 1) | 1 followed by the
+    //!   bytes of the name, which assigns it the next index. Later uses of the name are stored as index << 1.
+    //! - The end tags of containers are followed by the counts passed to the End calls of the visitor.
+    //! Because strings aren't escaped or terminated, reading a buffer with Lifetime::Persistent passes views into the buffer
+    //! to the visitor without copying them, which makes it cheap to read from memory mapped files.
+
+    //! Signature at the start of every buffer in the binary DOM format.
+    inline constexpr AZStd::string_view Signature = "ADOM";
+    //! The version of the format that's written. Buffers with a different version are rejected.
+    inline constexpr AZ::u8 FormatVersion = 1;
+
+    //! The type of the next value in a buffer.
+    enum class Tag : AZ::u8
+    {
+        Null,
+        False,
+        True,
+        Int64,
+        Uint64,
+        Double,
+        String,
+        Key,
+        StartObject,
+        EndObject,
+        StartArray,
+        EndArray,
+        StartNode,
+        EndNode,
+    };
+
+    //! Returns true if the buffer starts with the signature of the binary DOM format.
+    AZCORE_API bool IsBinaryDom(AZStd::string_view buffer);
+
+    //! Creates a Visitor that will write the binary DOM format to the specified stream.
+    //! Writes are cached and flushed to the stream when the visitor is destroyed.
+    //! \param stream The stream the visitor will write to.
+    //! \return A Visitor that will write to stream when visited.
+    AZCORE_API AZStd::unique_ptr<Visitor> CreateBinaryStreamWriter(AZ::IO::GenericStream& stream);
+
+    //! Reads the binary DOM format from a buffer and applies it to a visitor.
+    //! \param buffer The buffer to read, for instance the contents of a memory mapped file.
+    //! \param lifetime Specifies the lifetime of the buffer. If Lifetime::Persistent is specified, the strings passed to the
+    //! visitor point into the buffer, so it must outlive the values the visitor creates.
+    //! \param visitor The visitor to visit with the buffer's contents.
+    //! \return The aggregate result specifying whether the visitor operations were successful.
+    AZCORE_API Visitor::Result VisitSerializedBinary(AZStd::string_view buffer, Lifetime lifetime, Visitor& visitor);
+} // namespace AZ::Dom::Binary
@@ -46,20 +46,33 @@ namespace AZ::Dom
         {
             desiredKeys.clear();
             Path subPath = path;
-            for (auto it = after.MemberBegin(); it != after.MemberEnd(); ++it)
+            size_t memberIndex = 0;
+            for (auto it = after.MemberBegin(); it != after.MemberEnd(); ++it, ++memberIndex)
             {
                 desiredKeys.insert(it->first.GetHash());
-                subPath.Push(it->first);
-                auto beforeIt = before.FindMember(it->first);
+
+                // Both states are usually derived from the same source and keep their members in the same order,
+                // so check the member at the same index before searching for it.
+                auto beforeIt = before.MemberBegin() + AZStd::min(memberIndex, before.MemberCount());
+                if (beforeIt == before.MemberEnd() || beforeIt->first != it->first)
+                {
+                    beforeIt = before.FindMember(it->first);
+                }
+
                 if (beforeIt == before.MemberEnd())
                 {
+                    subPath.Push(it->first);
                     AddPatch(PatchOperation::AddOperation(subPath, it->second), PatchOperation::RemoveOperation(subPath));
+                    subPath.Pop();
                 }
-                else
+                else if (beforeIt->second != it->second)
                 {
+                    // Members that still share their storage (or are equal scalars) can't produce a patch, skip them
+                    // before paying for a path and a queued comparison.
+                    subPath.Push(it->first);
                     entriesToCompare.emplace(subPath, beforeIt->second, it->second);
+                    subPath.Pop();
                 }
-                subPath.Pop();
             }
 
             for (auto it = before.MemberBegin(); it != before.MemberEnd(); ++it)
@@ -128,7 +141,7 @@ namespace AZ::Dom
                     AddPatch(AZStd::move(addOperation), PatchOperation::RemoveOperation(subPath));
                     subPath.Pop();
                 }
-                else
+                else if (before[i] != after[i])
                 {
                     subPath.Push(PathEntry(i));
                     entriesToCompare.emplace(subPath, before[i], after[i]);
@@ -452,18 +452,14 @@ namespace AZ::Dom
         return AZ::Failure<AZStd::string>("Unable to invert DOM patch, unknown type specified");
     }
 
-    AZ::Outcome<PatchOperation::PathContext, AZStd::string> PatchOperation::LookupPath(
-        Value& rootElement, const Path& path, ExistenceCheckFlags flags)
+    PatchOutcome PatchOperation::ValidatePath(const Value& rootElement, const Path& path, ExistenceCheckFlags flags)
     {
         const bool verifyFullPath = (flags & ExistenceCheckFlags::VerifyFullPath) != ExistenceCheckFlags::DefaultExistenceCheck;
         const bool allowEndOfArray = (flags & ExistenceCheckFlags::AllowEndOfArray) != ExistenceCheckFlags::DefaultExistenceCheck;
 
-        Path target = path;
-        if (target.IsEmpty())
+        if (path.IsEmpty())
         {
-            Value wrapper(Dom::Type::Array);
-            wrapper.ArrayPushBack(rootElement);
-            return AZ::Success<PathContext>({ wrapper, PathEntry(0) });
+            return AZ::Success();
         }
 
         if (verifyFullPath || !allowEndOfArray)
@@ -478,10 +474,13 @@ namespace AZ::Dom
             }
         }
 
-        PathEntry destinationIndex = target[target.Size() - 1];
+        Path target = path;
+        const PathEntry& destinationIndex = path[path.Size() - 1];
         target.Pop();
 
-        Value* targetValue = rootElement.FindMutableChild(target);
+        // Validation only reads the DOM, so containers that are shared with other values aren't detached if the
+        // operation turns out to be invalid.
+        const Value* targetValue = rootElement.FindChild(target);
         if (targetValue == nullptr)
         {
             AZStd::string errorMessage = "Path not found: ";
@@ -526,6 +525,38 @@ namespace AZ::Dom
             }
         }
 
+        return AZ::Success();
+    }
+
+    AZ::Outcome<PatchOperation::PathContext, AZStd::string> PatchOperation::LookupPath(
+        Value& rootElement, const Path& path, ExistenceCheckFlags flags)
+    {
+        if (auto validation = ValidatePath(rootElement, path, flags); !validation.IsSuccess())
+        {
+            return AZ::Failure(validation.TakeError());
+        }
+
+        Path target = path;
+        if (target.IsEmpty())
+        {
+            Value wrapper(Dom::Type::Array);
+            wrapper.ArrayPushBack(rootElement);
+            return AZ::Success<PathContext>({ wrapper, PathEntry(0) });
+        }
+
+        PathEntry destinationIndex = target[target.Size() - 1];
+        target.Pop();
+
+        // Only the containers from the root to the parent of the destination are detached from any values they're
+        // shared with, every other container remains shared.
+        Value* targetValue = rootElement.FindMutableChild(target);
+        if (targetValue == nullptr)
+        {
+            AZStd::string errorMessage = "Path not found: ";
+            target.AppendToString(errorMessage);
+            return AZ::Failure(AZStd::move(errorMessage));
+        }
+
         return AZ::Success<PathContext>({ *targetValue, AZStd::move(destinationIndex) });
     }
 
@@ -586,10 +617,9 @@ namespace AZ::Dom
 
     PatchOutcome PatchOperation::ApplyReplace(Value& rootElement) const
     {
-        auto pathLookup = LookupPath(rootElement, m_domPath, ExistenceCheckFlags::VerifyFullPath);
-        if (!pathLookup.IsSuccess())
+        if (auto validation = ValidatePath(rootElement, m_domPath, ExistenceCheckFlags::VerifyFullPath); !validation.IsSuccess())
         {
-            return AZ::Failure(pathLookup.TakeError());
+            return validation;
         }
 
         rootElement[m_domPath] = GetValue();
@@ -598,19 +628,20 @@ namespace AZ::Dom
 
     PatchOutcome PatchOperation::ApplyCopy(Value& rootElement) const
     {
-        auto sourceLookup = LookupPath(rootElement, GetSourcePath(), ExistenceCheckFlags::VerifyFullPath);
-        if (!sourceLookup.IsSuccess())
+        if (auto validation = ValidatePath(rootElement, GetSourcePath(), ExistenceCheckFlags::VerifyFullPath); !validation.IsSuccess())
         {
-            return AZ::Failure(sourceLookup.TakeError());
+            return validation;
         }
 
-        auto destLookup = LookupPath(rootElement, m_domPath, ExistenceCheckFlags::DefaultExistenceCheck);
-        if (!destLookup.IsSuccess())
+        if (auto validation = ValidatePath(rootElement, m_domPath, ExistenceCheckFlags::DefaultExistenceCheck); !validation.IsSuccess())
         {
-            return AZ::Failure(destLookup.TakeError());
+            return validation;
         }
 
-        rootElement[m_domPath] = rootElement[GetSourcePath()];
+        // Copying the source is shallow, the copy shares its containers with the source until either is modified.
+        const Value& constRootElement = rootElement;
+        Value valueToCopy = *constRootElement.FindChild(GetSourcePath());
+        rootElement[m_domPath] = AZStd::move(valueToCopy);
         return AZ::Success();
     }
 
@@ -622,10 +653,9 @@ namespace AZ::Dom
             return AZ::Failure(sourceLookup.TakeError());
         }
 
-        auto destLookup = LookupPath(rootElement, m_domPath, ExistenceCheckFlags::DefaultExistenceCheck);
-        if (!destLookup.IsSuccess())
+        if (auto validation = ValidatePath(rootElement, m_domPath, ExistenceCheckFlags::DefaultExistenceCheck); !validation.IsSuccess())
         {
-            return AZ::Failure(destLookup.TakeError());
+            return validation;
         }
 
         const PathContext& sourceContext = sourceLookup.GetValue();
@@ -671,13 +701,14 @@ namespace AZ::Dom
 
     PatchOutcome PatchOperation::ApplyTest(Value& rootElement) const
     {
-        auto pathLookup = LookupPath(rootElement, m_domPath, ExistenceCheckFlags::VerifyFullPath);
-        if (!pathLookup.IsSuccess())
+        if (auto validation = ValidatePath(rootElement, m_domPath, ExistenceCheckFlags::VerifyFullPath); !validation.IsSuccess())
         {
-            return AZ::Failure(pathLookup.TakeError());
+            return validation;
         }
 
-        if (!Utils::DeepCompareIsEqual(rootElement[m_domPath], GetValue()))
+        // Test never modifies the DOM, so look up the value without detaching any shared containers.
+        const Value& constRootElement = rootElement;
+        if (!Utils::DeepCompareIsEqual(*constRootElement.FindChild(m_domPath), GetValue()))
         {
             return AZ::Failure<AZStd::string>("Test failed, values don't match");
         }
@@ -98,6 +98,9 @@ namespace AZ::Dom
         // For a given path and target value, removes any EndOfArray entries 
         // and replaces them with the resolved path
         static bool DenormalizePath(Dom::Path& path, const Dom::Value& sourceValue);
+        // Checks that a path can be used with the given existence flags without modifying rootElement.
+        static PatchOutcome ValidatePath(
+            const Value& rootElement, const Path& path, ExistenceCheckFlags existenceCheckFlags = ExistenceCheckFlags::DefaultExistenceCheck);
         static AZ::Outcome<PathContext, AZStd::string> LookupPath(
             Value& rootElement, const Path& path, ExistenceCheckFlags existenceCheckFlags = ExistenceCheckFlags::DefaultExistenceCheck);
 
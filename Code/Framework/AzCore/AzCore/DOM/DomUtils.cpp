@@ -20,6 +20,28 @@ namespace AZ::Dom::Utils
     const AZ::Name PointerValueFieldName = AZ::Name::FromStringLiteral("value", AZ::Interface<AZ::NameDictionary>::Get());
     const AZ::Name PointerTypeFieldName = AZ::Name::FromStringLiteral("pointerType", AZ::Interface<AZ::NameDictionary>::Get());
 
+    namespace
+    {
+        // Finds the member with the given key, checking the member at hintIndex first.
+        // Objects that were copied from the same source (e.g. before and after applying a patch) almost always keep
+        // their members in the same order, so this avoids a linear search per member when comparing large objects.
+        const Value* FindMemberWithHint(const Object::ContainerType& members, const AZ::Name& key, size_t hintIndex)
+        {
+            if (hintIndex < members.size() && members[hintIndex].first == key)
+            {
+                return &members[hintIndex].second;
+            }
+            for (const Object::EntryType& entry : members)
+            {
+                if (entry.first == key)
+                {
+                    return &entry.second;
+                }
+            }
+            return nullptr;
+        }
+    } // namespace
+
     Visitor::Result ReadFromString(Backend& backend, AZStd::string_view string, AZ::Dom::Lifetime lifetime, Visitor& visitor)
     {
         return backend.ReadFromBuffer(string.data(), string.length(), lifetime, visitor);
@@ -268,8 +290,8 @@ namespace AZ::Dom::Utils
                     for (size_t i = 0; i < ourValues.size(); ++i)
                     {
                         const Object::EntryType& lhsChild = ourValues[i];
-                        auto rhsIt = rhs.FindMember(lhsChild.first);
-                        if (rhsIt == rhs.MemberEnd() || !DeepCompareIsEqual(lhsChild.second, rhsIt->second, parameters))
+                        const Value* rhsChild = FindMemberWithHint(theirValues, lhsChild.first, i);
+                        if (rhsChild == nullptr || !DeepCompareIsEqual(lhsChild.second, *rhsChild, parameters))
                         {
                             return false;
                         }
@@ -335,8 +357,8 @@ namespace AZ::Dom::Utils
                     for (size_t i = 0; i < ourProperties.size(); ++i)
                     {
                         const Object::EntryType& lhsChild = ourProperties[i];
-                        auto rhsIt = rhs.FindMember(lhsChild.first);
-                        if (rhsIt == rhs.MemberEnd() || !DeepCompareIsEqual(lhsChild.second, rhsIt->second, parameters))
+                        const Value* rhsChild = FindMemberWithHint(theirProperties, lhsChild.first, i);
+                        if (rhsChild == nullptr || !DeepCompareIsEqual(lhsChild.second, *rhsChild, parameters))
                         {
                             return false;
                         }
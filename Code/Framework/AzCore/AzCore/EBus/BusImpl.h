@@ -67,6 +67,14 @@ namespace AZ
      */
     struct NullBusIdCompare;
 
+    /**
+     * Indicates that EBusTraits::BatchedEventType is not set.
+     * EBuses with batched dispatch must specify EBusTraits::BatchedEventType.
+     */
+    struct NullBatchedEvent
+    {
+    };
+
     namespace Internal
     {
         // Lock guard used when there is a NullMutex on a bus, or during dispatch
@@ -183,6 +191,20 @@ namespace AZ
             static constexpr bool EventQueueingActiveByDefault = Traits::EventQueueingActiveByDefault;
             static constexpr bool EnableQueuedReferences = Traits::EnableQueuedReferences;
 
+            /**
+             * Specifies whether the EBus supports batched dispatch.
+             * Batched events are delivered to each handler as a single span of events
+             * when `<BusName>::ExecuteBatchedEvents()` is called.
+             */
+            static constexpr bool EnableBatchedDispatch = Traits::EnableBatchedDispatch;
+            static constexpr bool DeduplicateBatchedEvents = Traits::DeduplicateBatchedEvents;
+            using BatchedEventType = typename Traits::BatchedEventType;
+
+            /**
+             * Specifies whether the EBus records dispatch statistics.
+             */
+            static constexpr bool EnableDispatchStatistics = Traits::EnableDispatchStatistics;
+
             /**
              * True if the EBus supports more than one address. Otherwise, false.
              */
@@ -342,6 +364,79 @@ namespace AZ
         {
         };
 
+        /**
+         * Data type that is used when an EBus doesn't support batched dispatch.
+         */
+        struct EBusNullBatch
+        {
+        };
+
+        /**
+         * EBus functionality related to batched dispatch of events to all handlers on the EBus.
+         * Batched events are stored in a contiguous buffer and each handler receives
+         * all of them in a single `OnBatchedEvents` call.
+         * @tparam Bus       The EBus type.
+         * @tparam Traits    A class that inherits from EBusTraits and configures the EBus.
+         *                   This parameter may be left unspecified if the `Interface` class
+         *                   inherits from EBusTraits.
+         */
+        template <class Bus, class Traits>
+        struct EBusBroadcastBatch
+        {
+            using BatchedEventType = typename Traits::BatchedEventType;
+
+            /**
+             * Queues an event that is delivered to all handlers on the EBus
+             * the next time ExecuteBatchedEvents() is called.
+             * @param event The event to deliver.
+             */
+            static void QueueBatchedBroadcast(const BatchedEventType& event);
+
+            /**
+             * Delivers the queued batched events.
+             * Broadcast events are delivered first, in one call per handler. Events queued for an address are then delivered
+             * to the handlers at that address, in one call per address and handler, in the order they were queued.
+             * Events that are queued while the batch is delivered are part of the next batch.
+             * Execution will occur on the thread that calls this function.
+             */
+            static void ExecuteBatchedEvents();
+
+            /**
+             * Discards the queued batched events without delivering them.
+             */
+            static void ClearBatchedEvents();
+
+            /**
+             * Returns the number of batched events that are waiting to be delivered.
+             */
+            static size_t BatchedEventCount();
+        };
+
+        /**
+         * EBus functionality related to batched dispatch of events to handlers at specific addresses.
+         * @tparam Bus       The EBus type.
+         * @tparam Traits    A class that inherits from EBusTraits and configures the EBus.
+         *                   This parameter may be left unspecified if the `Interface` class
+         *                   inherits from EBusTraits.
+         */
+        template <class Bus, class Traits>
+        struct EBusEventBatch
+            : public EBusBroadcastBatch<Bus, Traits>
+        {
+            using BusIdType = typename Traits::BusIdType;
+            using BatchedEventType = typename Traits::BatchedEventType;
+
+            /**
+             * Queues an event that is delivered to the handlers at an address
+             * the next time ExecuteBatchedEvents() is called.
+             * If EBusTraits::DeduplicateBatchedEvents is true, the event replaces an event that
+             * is already queued for the address.
+             * @param id    Address ID. Handlers that are connected to this ID will receive the event.
+             * @param event The event to deliver.
+             */
+            static void QueueBatchedEvent(const BusIdType& id, const BatchedEventType& event);
+        };
+
         /**
          * EBus functionality related to the queuing of events and functions.
          * This is specifically for queuing events and functions that will
@@ -612,6 +707,7 @@ namespace AZ
             , public EBusEventer<Bus, Traits>
             , public EBusEventEnumerator<Bus, Traits>
             , public AZStd::conditional_t<Traits::EnableEventQueue, EBusEventQueue<Bus, Traits>, EBusNullQueue>
+            , public AZStd::conditional_t<Traits::EnableBatchedDispatch, EBusEventBatch<Bus, Traits>, EBusNullBatch>
         {
         };
 
@@ -630,6 +726,7 @@ namespace AZ
             , public EBusBroadcaster<Bus, Traits>
             , public EBusBroadcastEnumerator<Bus, Traits>
             , public AZStd::conditional_t<Traits::EnableEventQueue, EBusBroadcastQueue<Bus, Traits>, EBusNullQueue>
+            , public AZStd::conditional_t<Traits::EnableBatchedDispatch, EBusBroadcastBatch<Bus, Traits>, EBusNullBatch>
         {
             using EBusBroadcastEnumerator<Bus, Traits>::FindFirstHandler;
 
@@ -856,7 +953,170 @@ namespace AZ
             Bus::QueueFunction(static_cast<Broadcaster>(&Bus::BroadcastReverse), AZStd::forward<Function>(func), AZStd::forward<InputArgs>(args)...);
         }
 
+        template <class Bus, class Traits>
+        inline void EBusBroadcastBatch<Bus, Traits>::QueueBatchedBroadcast(const BatchedEventType& event)
+        {
+            auto& context = Bus::GetOrCreateContext(false);
+            AZStd::scoped_lock<decltype(context.m_batch.m_batchMutex)> batchLock(context.m_batch.m_batchMutex);
+            context.m_batch.m_broadcastEvents.push_back(event);
+        }
+
+        template <class Bus, class Traits>
+        inline void EBusEventBatch<Bus, Traits>::QueueBatchedEvent(const BusIdType& id, const BatchedEventType& event)
+        {
+            auto& context = Bus::GetOrCreateContext(false);
+            auto& batch = context.m_batch;
+            AZStd::scoped_lock<decltype(batch.m_batchMutex)> batchLock(batch.m_batchMutex);
+            if constexpr (Traits::DeduplicateBatchedEvents)
+            {
+                // The address map stores the index of the pending event for each address
+                auto [addressIt, inserted] = batch.m_addresses.emplace(id, batch.m_addressedEvents.size());
+                if (!inserted)
+                {
+                    batch.m_addressedEvents[addressIt->second].m_event = event;
+                    return;
+                }
+                batch.m_addressedEvents.push_back({ id, event, addressIt->second });
+            }
+            else
+            {
+                // The address map stores the group of each address, groups are numbered in the order the addresses were first seen
+                auto addressIt = batch.m_addresses.emplace(id, batch.m_addresses.size()).first;
+                batch.m_addressedEvents.push_back({ id, event, addressIt->second });
+            }
+        }
+
+        template <class Bus, class Traits>
+        inline void EBusBroadcastBatch<Bus, Traits>::ExecuteBatchedEvents()
+        {
+            auto* context = Bus::GetContext();
+            if (!context)
+            {
+                return;
+            }
+
+            using BatchPolicy = typename Bus::BatchPolicy;
+            using EventSpan = AZStd::span<const BatchedEventType>;
+            auto& batch = context->m_batch;
+
+            // Take the current batch, so that events queued by the handlers are delivered with the next batch
+            typename BatchPolicy::EventContainer broadcastEvents;
+            typename BatchPolicy::AddressedEventContainer addressedEvents;
+            [[maybe_unused]] size_t groupCount = 0;
+            {
+                AZStd::scoped_lock<decltype(batch.m_batchMutex)> batchLock(batch.m_batchMutex);
+                AZStd::swap(broadcastEvents, batch.m_broadcastEvents);
+                AZStd::swap(addressedEvents, batch.m_addressedEvents);
+                if constexpr (Traits::HasId)
+                {
+                    groupCount = batch.m_addresses.size();
+                    batch.m_addresses.clear();
+                }
+            }
+
+            if (!broadcastEvents.empty())
+            {
+                Bus::Broadcast(&Traits::InterfaceType::OnBatchedEvents, EventSpan(broadcastEvents.data(), broadcastEvents.size()));
+                context->m_dispatchStatistics.RecordBatchedEvents(broadcastEvents.size());
+            }
+
+            if constexpr (Traits::HasId)
+            {
+                if (!addressedEvents.empty())
+                {
+                    if constexpr (Traits::DeduplicateBatchedEvents)
+                    {
+                        for (const auto& addressedEvent : addressedEvents)
+                        {
+                            Bus::Event(addressedEvent.m_busId, &Traits::InterfaceType::OnBatchedEvents, EventSpan(&addressedEvent.m_event, 1));
+                        }
+                    }
+                    else
+                    {
+                        // Counting sort the events by address, keeping the order in which they were queued
+                        using IndexContainer = AZStd::vector<size_t, typename Traits::AllocatorType>;
+                        IndexContainer groupOffsets(groupCount + 1, 0);
+                        for (const auto& addressedEvent : addressedEvents)
+                        {
+                            ++groupOffsets[addressedEvent.m_group + 1];
+                        }
+                        for (size_t group = 0; group < groupCount; ++group)
+                        {
+                            groupOffsets[group + 1] += groupOffsets[group];
+                        }
+
+                        IndexContainer sortedIndices(addressedEvents.size());
+                        IndexContainer cursors(groupOffsets.begin(), groupOffsets.end() - 1);
+                        for (size_t eventIndex = 0; eventIndex < addressedEvents.size(); ++eventIndex)
+                        {
+                            sortedIndices[cursors[addressedEvents[eventIndex].m_group]++] = eventIndex;
+                        }
+
+                        typename BatchPolicy::EventContainer groupedEvents;
+                        groupedEvents.reserve(addressedEvents.size());
+                        for (size_t eventIndex : sortedIndices)
+                        {
+                            groupedEvents.push_back(addressedEvents[eventIndex].m_event);
+                        }
+
+                        for (size_t group = 0; group < groupCount; ++group)
+                        {
+                            const size_t first = groupOffsets[group];
+                            const size_t count = groupOffsets[group + 1] - first;
+                            Bus::Event(addressedEvents[sortedIndices[first]].m_busId, &Traits::InterfaceType::OnBatchedEvents,
+                                EventSpan(groupedEvents.data() + first, count));
+                        }
+                    }
+                    context->m_dispatchStatistics.RecordBatchedEvents(addressedEvents.size());
+                }
+            }
+
+            // Hand the buffers back if no new batch was started, so that their memory is reused
+            broadcastEvents.clear();
+            addressedEvents.clear();
+            {
+                AZStd::scoped_lock<decltype(batch.m_batchMutex)> batchLock(batch.m_batchMutex);
+                if (batch.m_broadcastEvents.empty())
+                {
+                    AZStd::swap(broadcastEvents, batch.m_broadcastEvents);
+                }
+                if (batch.m_addressedEvents.empty())
+                {
+                    AZStd::swap(addressedEvents, batch.m_addressedEvents);
+                }
+            }
+        }
+
+        template <class Bus, class Traits>
+        inline void EBusBroadcastBatch<Bus, Traits>::ClearBatchedEvents()
+        {
+            if (auto* context = Bus::GetContext(false))
+            {
+                auto& batch = context->m_batch;
+                AZStd::scoped_lock<decltype(batch.m_batchMutex)> batchLock(batch.m_batchMutex);
+                batch.m_broadcastEvents.clear();
+                batch.m_addressedEvents.clear();
+                if constexpr (Traits::HasId)
+                {
+                    batch.m_addresses.clear();
+                }
+            }
+        }
+
+        template <class Bus, class Traits>
+        inline size_t EBusBroadcastBatch<Bus, Traits>::BatchedEventCount()
+        {
+            if (auto* context = Bus::GetContext(false))
+            {
+                auto& batch = context->m_batch;
+                AZStd::scoped_lock<decltype(batch.m_batchMutex)> batchLock(batch.m_batchMutex);
+                return batch.m_broadcastEvents.size() + batch.m_addressedEvents.size();
+            }
+            return 0;
+        }
+
 #undef EBUS_DO_ROUTING
+#undef EBUS_DISPATCH_STATISTICS
 
         template <class Bus, class Traits>
         template <class Function, class ... InputArgs>
@@ -186,6 +186,42 @@ namespace AZ
          */
         using EventQueueMutexType = NullMutex;
 
+        /**
+         * Specifies whether the EBus supports batched dispatch.
+         * Batched events are queued into a contiguous buffer with `QueueBatchedBroadcast()` or
+         * `QueueBatchedEvent()` and are delivered when `<BusName>::ExecuteBatchedEvents()` is called.
+         * Each handler receives all events queued for it in a single call to the following function,
+         * which the interface must declare.
+         * @code{.cpp}
+         * virtual void OnBatchedEvents(AZStd::span<const BatchedEventType> events);
+         * @endcode
+         * This replaces one virtual call per event and handler with one call per handler, which
+         * helps buses with many handlers that send many events each frame.
+         * By default, batched dispatch is disabled.
+         */
+        static constexpr bool EnableBatchedDispatch = false;
+
+        /**
+         * The payload of a batched event. Must be copyable.
+         * Used only when #EnableBatchedDispatch is true.
+         */
+        using BatchedEventType = NullBatchedEvent;
+
+        /**
+         * Specifies whether a batched event that is queued for an address that already has a pending
+         * batched event replaces the pending event, so that each address receives at most one event per batch.
+         * Batched broadcasts are never deduplicated.
+         * Used only when #EnableBatchedDispatch is true.
+         */
+        static constexpr bool DeduplicateBatchedEvents = false;
+
+        /**
+         * Specifies whether the EBus records how many events it dispatches and how long the dispatches take.
+         * The statistics can be queried with `<BusName>::GetDispatchStatistics()`.
+         * By default, no statistics are recorded.
+         */
+        static constexpr bool EnableDispatchStatistics = false;
+
         /**
          * Enables custom logic to run when a handler connects or
          * disconnects from the EBus.
@@ -523,6 +559,16 @@ namespace AZ
          */
         static const bool EnableEventQueue = ImplTraits::EnableEventQueue;
 
+        /**
+         * Storage for batched events.
+         */
+        using BatchPolicy = EBusBatchPolicy<Traits::EnableBatchedDispatch, ThisType, EventQueueMutexType>;
+
+        /**
+         * Storage for the dispatch statistics.
+         */
+        using DispatchStatisticsPolicy = EBusDispatchStatisticsPolicy<Traits::EnableDispatchStatistics>;
+
         /**
          * Class that implements %EBus routing functionality.
          */
@@ -592,6 +638,8 @@ namespace AZ
             "When you use EBusAddressPolicy::Single or EBusAddressPolicy::ById there is no need to define BusIdOrderCompare!");
         static_assert((BusTraits::AddressPolicy != EBusAddressPolicy::ByIdAndOrdered || !AZStd::is_same<BusIdOrderCompare, NullBusIdCompare>::value),
             "When you use EBusAddressPolicy::ByIdAndOrdered you must define BusIdOrderCompare (ex. using BusIdOrderCompare = AZStd::less<BusIdType>)");
+        static_assert((!BusTraits::EnableBatchedDispatch || !AZStd::is_same<typename BusTraits::BatchedEventType, NullBatchedEvent>::value),
+            "You must provide a BatchedEventType when using EnableBatchedDispatch! (ex. using BatchedEventType = AZ::EntityId;");
         /// @endcond
         /// //////////////////////////////////////////////////////////////////////////
 
@@ -700,6 +748,18 @@ namespace AZ
          */
         static const char* GetName();
 
+        /**
+         * Returns the number of dispatches on the EBus and the time spent in them.
+         * Only recorded when EBusTraits::EnableDispatchStatistics is true. Otherwise all values are 0.
+         * @return The statistics recorded since the EBus was created or since the last ResetDispatchStatistics() call.
+         */
+        static EBusDispatchStatistics GetDispatchStatistics();
+
+        /**
+         * Resets the recorded dispatch statistics to 0.
+         */
+        static void ResetDispatchStatistics();
+
         /// @cond EXCLUDE_DOCS
         class Context : public AZ::Internal::ContextBase
         {
@@ -743,6 +803,8 @@ namespace AZ
             ContextMutexType        m_contextMutex;  ///< Mutex to control access when modifying the context
             QueuePolicy             m_queue;
             RouterPolicy            m_routing;
+            BatchPolicy             m_batch;
+            DispatchStatisticsPolicy m_dispatchStatistics;
 
             Context();
             Context(EBusEnvironment* environment);
@@ -1302,6 +1364,31 @@ AZ_POP_DISABLE_WARNING
         return AZ_FUNCTION_SIGNATURE;
     }
 
+    //=========================================================================
+    // GetDispatchStatistics
+    //=========================================================================
+    template<class Interface, class Traits>
+    EBusDispatchStatistics EBus<Interface, Traits>::GetDispatchStatistics()
+    {
+        if (Context* context = GetContext(false))
+        {
+            return context->m_dispatchStatistics.Get();
+        }
+        return {};
+    }
+
+    //=========================================================================
+    // ResetDispatchStatistics
+    //=========================================================================
+    template<class Interface, class Traits>
+    void EBus<Interface, Traits>::ResetDispatchStatistics()
+    {
+        if (Context* context = GetContext(false))
+        {
+            context->m_dispatchStatistics.Reset();
+        }
+    }
+
     //=========================================================================
     // GetContext
     //=========================================================================
@@ -80,6 +80,10 @@ namespace AZ
         }                                                                                       \
     } while(false)
 
+// Records the dispatch in the EBus dispatch statistics, which is a no-op unless EBusTraits::EnableDispatchStatistics is set
+#define EBUS_DISPATCH_STATISTICS(contextParam) \
+    [[maybe_unused]] typename Bus::DispatchStatisticsPolicy::Scope ebusDispatchStatisticsScope((contextParam).m_dispatchStatistics)
+
         // Default impl, used when there are multiple addresses and multiple handlers
         template <typename Interface, typename Traits, EBusAddressPolicy addressPolicy = Traits::AddressPolicy, EBusHandlerPolicy handlerPolicy = Traits::HandlerPolicy>
         struct EBusContainer
@@ -116,6 +120,7 @@ namespace AZ
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_DISPATCH_STATISTICS(*context);
                         EBUS_DO_ROUTING(*context, &id, false, false);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -159,6 +164,7 @@ namespace AZ
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_DISPATCH_STATISTICS(*context);
                         EBUS_DO_ROUTING(*context, &id, false, false);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -202,6 +208,7 @@ namespace AZ
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_DISPATCH_STATISTICS(*context);
                         EBUS_DO_ROUTING(*context, &id, false, true);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -231,6 +238,7 @@ namespace AZ
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_DISPATCH_STATISTICS(*context);
                         EBUS_DO_ROUTING(*context, &id, false, true);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -263,6 +271,7 @@ namespace AZ
                         EBUS_ASSERT(context, "Internal error: context deleted with bind ptr outstanding.");
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
 
+                        EBUS_DISPATCH_STATISTICS(*context);
                         EBUS_DO_ROUTING(*context, &busPtr->m_busId, false, false);
 
                         auto& handlers = busPtr->m_handlers;
@@ -299,6 +308,7 @@ namespace AZ
                         EBUS_ASSERT(context, "Internal error: context deleted with bind ptr outstanding.");
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
 
+                        EBUS_DISPATCH_STATISTICS(*context);
                         EBUS_DO_ROUTING(*context, &busPtr->m_busId, false, false);
 
                         auto& handlers = busPtr->m_handlers;
@@ -335,6 +345,7 @@ namespace AZ
                         EBUS_ASSERT(context, "Internal error: context deleted with bind ptr outstanding.");
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
 
+                        EBUS_DISPATCH_STATISTICS(*context);
                         EBUS_DO_ROUTING(*context, &busPtr->m_busId, false, true);
 
                         auto& handlers = busPtr->m_handlers;
@@ -357,6 +368,7 @@ namespace AZ
                         EBUS_ASSERT(context, "Internal error: context deleted with bind ptr outstanding.");
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
 
+                        EBUS_DISPATCH_STATISTICS(*context);
                         EBUS_DO_ROUTING(*context, &busPtr->m_busId, false, true);
 
                         auto& handlers = busPtr->m_handlers;
@@ -378,6 +390,7 @@ namespace AZ
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_DISPATCH_STATISTICS(*context);
                         EBUS_DO_ROUTING(*context, nullptr, false, false);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -424,6 +437,7 @@ namespace AZ
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_DISPATCH_STATISTICS(*context);
                         EBUS_DO_ROUTING(*context, nullptr, false, false);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -470,6 +484,7 @@ namespace AZ
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_DISPATCH_STATISTICS(*context);
                         EBUS_DO_ROUTING(*context, nullptr, false, true);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -528,6 +543,7 @@ namespace AZ
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_DISPATCH_STATISTICS(*context);
                         EBUS_DO_ROUTING(*context, nullptr, false, true);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -796,6 +812,7 @@ namespace AZ
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_DISPATCH_STATISTICS(*context);
                         EBUS_DO_ROUTING(*context, &id, false, false);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -813,6 +830,7 @@ namespace AZ
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_DISPATCH_STATISTICS(*context);
                         EBUS_DO_ROUTING(*context, &id, false, false);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -830,6 +848,7 @@ namespace AZ
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_DISPATCH_STATISTICS(*context);
                         EBUS_DO_ROUTING(*context, &id, false, true);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -847,6 +866,7 @@ namespace AZ
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_DISPATCH_STATISTICS(*context);
                         EBUS_DO_ROUTING(*context, &id, false, true);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -867,6 +887,7 @@ namespace AZ
                         EBUS_ASSERT(context, "Internal error: context deleted with bind ptr outstanding.");
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
 
+                        EBUS_DISPATCH_STATISTICS(*context);
                         EBUS_DO_ROUTING(*context, &busPtr->m_busId, false, false);
 
                         if (busPtr->m_interface)
@@ -885,6 +906,7 @@ namespace AZ
                         EBUS_ASSERT(context, "Internal error: context deleted with bind ptr outstanding.");
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
 
+                        EBUS_DISPATCH_STATISTICS(*context);
                         EBUS_DO_ROUTING(*context, &busPtr->m_busId, false, false);
 
                         if (busPtr->m_interface)
@@ -903,6 +925,7 @@ namespace AZ
                         EBUS_ASSERT(context, "Internal error: context deleted with bind ptr outstanding.");
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
 
+                        EBUS_DISPATCH_STATISTICS(*context);
                         EBUS_DO_ROUTING(*context, &busPtr->m_busId, false, true);
 
                         if (busPtr->m_interface)
@@ -921,6 +944,7 @@ namespace AZ
                         EBUS_ASSERT(context, "Internal error: context deleted with bind ptr outstanding.");
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
 
+                        EBUS_DISPATCH_STATISTICS(*context);
                         EBUS_DO_ROUTING(*context, &busPtr->m_busId, false, true);
 
                         if (busPtr->m_interface)
@@ -938,6 +962,7 @@ namespace AZ
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_DISPATCH_STATISTICS(*context);
                         EBUS_DO_ROUTING(*context, nullptr, false, false);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -976,6 +1001,7 @@ namespace AZ
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_DISPATCH_STATISTICS(*context);
                         EBUS_DO_ROUTING(*context, nullptr, false, false);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -1014,6 +1040,7 @@ namespace AZ
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_DISPATCH_STATISTICS(*context);
                         EBUS_DO_ROUTING(*context, nullptr, false, true);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -1070,6 +1097,7 @@ namespace AZ
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_DISPATCH_STATISTICS(*context);
                         EBUS_DO_ROUTING(*context, nullptr, false, true);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -1337,6 +1365,7 @@ namespace AZ
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_DISPATCH_STATISTICS(*context);
                         EBUS_DO_ROUTING(*context, nullptr, false, false);
 
                         auto& handlers = context->m_buses.m_handlers;
@@ -1372,6 +1401,7 @@ namespace AZ
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_DISPATCH_STATISTICS(*context);
                         EBUS_DO_ROUTING(*context, nullptr, false, false);
 
                         auto& handlers = context->m_buses.m_handlers;
@@ -1407,6 +1437,7 @@ namespace AZ
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_DISPATCH_STATISTICS(*context);
                         EBUS_DO_ROUTING(*context, nullptr, false, true);
 
                         auto& handlers = context->m_buses.m_handlers;
@@ -1428,6 +1459,7 @@ namespace AZ
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_DISPATCH_STATISTICS(*context);
                         EBUS_DO_ROUTING(*context, nullptr, false, true);
 
                         auto& handlers = context->m_buses.m_handlers;
@@ -1531,6 +1563,7 @@ namespace AZ
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_DISPATCH_STATISTICS(*context);
                         EBUS_DO_ROUTING(*context, nullptr, false, false);
 
                         auto handler = context->m_buses.m_handler;
@@ -1547,6 +1580,7 @@ namespace AZ
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_DISPATCH_STATISTICS(*context);
                         EBUS_DO_ROUTING(*context, nullptr, false, false);
 
                         auto handler = context->m_buses.m_handler;
@@ -1563,6 +1597,7 @@ namespace AZ
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_DISPATCH_STATISTICS(*context);
                         EBUS_DO_ROUTING(*context, nullptr, false, false);
 
                         auto handler = context->m_buses.m_handler;
@@ -1579,6 +1614,7 @@ namespace AZ
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_DISPATCH_STATISTICS(*context);
                         EBUS_DO_ROUTING(*context, nullptr, false, false);
 
                         auto handler = context->m_buses.m_handler;
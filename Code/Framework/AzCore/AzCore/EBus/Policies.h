@@ -20,6 +20,13 @@
 #include <AzCore/std/containers/intrusive_set.h>
 #include <AzCore/std/parallel/scoped_lock.h>
 
+// Includes for batched dispatch and dispatch statistics.
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+
 
 namespace AZ
 {
@@ -91,6 +98,10 @@ namespace AZ
             template<class Function, class Allocator>
             NullBusMessageCall(Function, const Allocator&) {}
         };
+
+        struct NullBatchAddressMap
+        {
+        };
     } // namespace Internal
 
     /**
@@ -296,6 +307,117 @@ namespace AZ
         }
     };
 
+    template <bool IsEnabled, class Bus, class MutexType>
+    struct EBusBatchPolicy
+    {
+    };
+
+    template <class Bus, class MutexType>
+    struct EBusBatchPolicy<true, Bus, MutexType>
+    {
+        using BatchedEventType = typename Bus::Traits::BatchedEventType;
+        using BusIdType = typename Bus::BusIdType;
+        using AllocatorType = typename Bus::AllocatorType;
+
+        struct AddressedEvent
+        {
+            BusIdType m_busId;
+            BatchedEventType m_event;
+            size_t m_group;
+        };
+
+        using EventContainer = AZStd::vector<BatchedEventType, AllocatorType>;
+        using AddressedEventContainer = AZStd::vector<AddressedEvent, AllocatorType>;
+        using AddressMap = AZStd::conditional_t<Bus::HasId,
+            AZStd::unordered_map<BusIdType, size_t, AZStd::hash<BusIdType>, AZStd::equal_to<BusIdType>, AllocatorType>,
+            AZ::Internal::NullBatchAddressMap>;
+
+        EventContainer              m_broadcastEvents;
+        AddressedEventContainer     m_addressedEvents;
+        AddressMap                  m_addresses;        ///< Group of each address with queued events, or the index of its event when deduplicating.
+        MutexType                   m_batchMutex;       ///< Used to control access to the batch. Make sure you never interlock with the EBus mutex. Otherwise, a deadlock can occur.
+    };
+
+    /// @endcond
+
+    /**
+     * Dispatch statistics of an EBus.
+     * Only recorded when AZ::EBusTraits::EnableDispatchStatistics is true.
+     */
+    struct EBusDispatchStatistics
+    {
+        //! Number of events and broadcasts dispatched on the EBus, including dispatches that deliver batched events.
+        AZ::u64 m_dispatchCount = 0;
+        //! Number of batched events that were delivered.
+        AZ::u64 m_batchedEventCount = 0;
+        //! Time spent dispatching, including the time spent in the handlers.
+        //! Dispatches made by handlers on the same EBus are counted in both the outer and the nested dispatch.
+        AZStd::chrono::nanoseconds m_dispatchTime{};
+    };
+
+    /// @cond EXCLUDE_DOCS
+    template <bool IsEnabled>
+    struct EBusDispatchStatisticsPolicy
+    {
+        struct Scope
+        {
+            explicit Scope(EBusDispatchStatisticsPolicy&) {}
+        };
+
+        void RecordBatchedEvents(size_t) {}
+        EBusDispatchStatistics Get() const { return {}; }
+        void Reset() {}
+    };
+
+    template <>
+    struct EBusDispatchStatisticsPolicy<true>
+    {
+        //! Records a dispatch and its duration
+        struct Scope
+        {
+            explicit Scope(EBusDispatchStatisticsPolicy& statistics)
+                : m_statistics(statistics)
+                , m_start(AZStd::chrono::steady_clock::now())
+            {
+            }
+
+            ~Scope()
+            {
+                const auto elapsed = AZStd::chrono::duration_cast<AZStd::chrono::nanoseconds>(AZStd::chrono::steady_clock::now() - m_start);
+                m_statistics.m_dispatchCount.fetch_add(1, AZStd::memory_order_relaxed);
+                m_statistics.m_dispatchTimeNanoseconds.fetch_add(static_cast<AZ::u64>(elapsed.count()), AZStd::memory_order_relaxed);
+            }
+
+            EBusDispatchStatisticsPolicy& m_statistics;
+            AZStd::chrono::steady_clock::time_point m_start;
+        };
+
+        void RecordBatchedEvents(size_t eventCount)
+        {
+            m_batchedEventCount.fetch_add(eventCount, AZStd::memory_order_relaxed);
+        }
+
+        EBusDispatchStatistics Get() const
+        {
+            EBusDispatchStatistics statistics;
+            statistics.m_dispatchCount = m_dispatchCount.load(AZStd::memory_order_relaxed);
+            statistics.m_batchedEventCount = m_batchedEventCount.load(AZStd::memory_order_relaxed);
+            statistics.m_dispatchTime = AZStd::chrono::nanoseconds(m_dispatchTimeNanoseconds.load(AZStd::memory_order_relaxed));
+            return statistics;
+        }
+
+        void Reset()
+        {
+            m_dispatchCount.store(0, AZStd::memory_order_relaxed);
+            m_batchedEventCount.store(0, AZStd::memory_order_relaxed);
+            m_dispatchTimeNanoseconds.store(0, AZStd::memory_order_relaxed);
+        }
+
+        AZStd::atomic<AZ::u64> m_dispatchCount{ 0 };
+        AZStd::atomic<AZ::u64> m_batchedEventCount{ 0 };
+        AZStd::atomic<AZ::u64> m_dispatchTimeNanoseconds{ 0 };
+    };
+
     /// @endcond
 
     ////////////////////////////////////////////////////////////
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/MappedFile.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/std/utility/move.h>
+
+namespace AZ::IO
+{
+    MappedFile::~MappedFile()
+    {
+        Close();
+    }
+
+    MappedFile::MappedFile(MappedFile&& other)
+        : m_data(other.m_data)
+        , m_size(other.m_size)
+    {
+        other.m_data = nullptr;
+        other.m_size = 0;
+    }
+
+    MappedFile& MappedFile::operator=(MappedFile&& other)
+    {
+        if (this != &other)
+        {
+            Close();
+            m_data = other.m_data;
+            m_size = other.m_size;
+            other.m_data = nullptr;
+            other.m_size = 0;
+        }
+        return *this;
+    }
+
+    bool MappedFile::Open(const char* filePath)
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+
+        Close();
+        if (filePath == nullptr || filePath[0] == '\0')
+        {
+            return false;
+        }
+        return PlatformOpen(filePath);
+    }
+
+    void MappedFile::Close()
+    {
+        if (m_data)
+        {
+            PlatformClose();
+            m_data = nullptr;
+            m_size = 0;
+        }
+    }
+} // namespace AZ::IO
@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/containers/span.h>
+
+namespace AZ::IO
+{
+    /**
+     * Platform independent wrapper for a file that is mapped into the address space of the process.
+     * The mapping is private to the process: pages are loaded from the file on first access and
+     * pages that are written to are copied, so changes are never written back to the file.
+     */
+    class AZCORE_API MappedFile
+    {
+    public:
+        MappedFile() = default;
+        ~MappedFile();
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+        MappedFile(MappedFile&& other);
+        MappedFile& operator=(MappedFile&& other);
+
+        //! Maps the entire file at the path.
+        //! Empty files can't be mapped.
+        //! @return true if the file was mapped.
+        bool Open(const char* filePath);
+        //! Unmaps the file. Pointers into the mapping are invalid afterwards.
+        void Close();
+
+        bool IsOpen() const { return m_data != nullptr; }
+
+        //! The mapped bytes. The start of the mapping is aligned to the page size.
+        AZStd::span<AZStd::byte> GetData() { return { m_data, m_size }; }
+        AZStd::span<const AZStd::byte> GetData() const { return { m_data, m_size }; }
+
+    private:
+        bool PlatformOpen(const char* filePath);
+        void PlatformClose();
+
+        AZStd::byte* m_data = nullptr;
+        size_t m_size = 0;
+    };
+} // namespace AZ::IO
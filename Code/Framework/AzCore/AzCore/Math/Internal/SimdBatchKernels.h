@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/SimdBatch.h>
+
+namespace AZ::Simd::Batch::Internal
+{
+    // The kernels only see plain floats, so the translation units that are compiled for a wider instruction set than the
+    // rest of the engine don't need to include (and instantiate) any of the inline math types.
+
+    //! Row major 3x4 matrix.
+    struct TransformParams
+    {
+        float m_rows[12];
+    };
+
+    struct AabbParams
+    {
+        float m_min[3];
+        float m_max[3];
+    };
+
+    static constexpr size_t FrustumPlaneCount = 6;
+
+    //! Plane equations (normal x, y, z and distance) of the frustum planes.
+    struct FrustumParams
+    {
+        float m_planes[FrustumPlaneCount][4];
+    };
+
+    struct KernelTable
+    {
+        void (*m_transformPoints)(const TransformParams& transform, ConstVector3Soa in, Vector3Soa out, size_t count);
+        void (*m_dot)(ConstVector3Soa a, ConstVector3Soa b, float* out, size_t count);
+        void (*m_length)(ConstVector3Soa in, float* out, size_t count);
+        void (*m_normalizeSafe)(Vector3Soa inout, size_t count, float tolerance);
+        size_t (*m_aabbOverlaps)(const AabbParams& aabb, ConstAabbSoa aabbs, u8* results, size_t count);
+        size_t (*m_frustumCullSpheres)(
+            const FrustumParams& frustum, ConstVector3Soa centers, const float* radii, u8* results, size_t count);
+        size_t (*m_frustumCullAabbs)(const FrustumParams& frustum, ConstAabbSoa aabbs, u8* results, size_t count);
+    };
+
+    const KernelTable& GetVec4Kernels();
+    //! Returns nullptr when the kernels aren't available for the platform. The caller has to check the CPU supports them.
+    const KernelTable* GetAvx2Kernels();
+    const KernelTable* GetAvx512Kernels();
+} // namespace AZ::Simd::Batch::Internal
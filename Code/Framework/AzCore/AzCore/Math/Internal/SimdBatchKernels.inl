@@ -0,0 +1,315 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+// Intentionally no #pragma once, every width includes this into its own translation unit.
+//
+// The kernels are written once against a "lanes" type, which provides:
+//     FloatType, MaskType, ElementCount
+//     Load, Store, Splat, Add, Mul, Madd, Div, Sqrt, Max, CmpGtEq, CmpLtEq, And, Select, ZeroFloat
+//     StoreMask(u8* out, MaskType mask), which writes 0 or 1 per element and returns the number of 1s written.
+// The including translation unit has to define AZ_SIMD_BATCH_TARGET, the function attribute that enables the
+// instruction set the lanes type uses, and include this inside of an anonymous namespace so every width gets its own copy.
+
+#if !defined(AZ_SIMD_BATCH_TARGET)
+#   error AZ_SIMD_BATCH_TARGET has to be defined before including SimdBatchKernels.inl
+#endif
+
+//! Single element fallback, for the elements at the end of the arrays that don't fill a whole vector.
+struct ScalarLanes
+{
+    using FloatType = float;
+    using MaskType = bool;
+    static constexpr size_t ElementCount = 1;
+
+    static FloatType Load(const float* addr) { return *addr; }
+    static void Store(float* addr, FloatType value) { *addr = value; }
+    static FloatType Splat(float value) { return value; }
+    static FloatType ZeroFloat() { return 0.0f; }
+    static FloatType Add(FloatType arg1, FloatType arg2) { return arg1 + arg2; }
+    static FloatType Mul(FloatType arg1, FloatType arg2) { return arg1 * arg2; }
+    static FloatType Madd(FloatType mul1, FloatType mul2, FloatType add) { return mul1 * mul2 + add; }
+    static FloatType Div(FloatType arg1, FloatType arg2) { return arg1 / arg2; }
+    static FloatType Sqrt(FloatType value) { return sqrtf(value); }
+    static FloatType Max(FloatType arg1, FloatType arg2) { return arg1 > arg2 ? arg1 : arg2; }
+    static MaskType CmpGtEq(FloatType arg1, FloatType arg2) { return arg1 >= arg2; }
+    static MaskType CmpLtEq(FloatType arg1, FloatType arg2) { return arg1 <= arg2; }
+    static MaskType And(MaskType arg1, MaskType arg2) { return arg1 && arg2; }
+    static FloatType Select(FloatType arg1, FloatType arg2, MaskType mask) { return mask ? arg1 : arg2; }
+    static size_t StoreMask(u8* out, MaskType mask)
+    {
+        *out = mask ? 1 : 0;
+        return *out;
+    }
+};
+
+// Each kernel has a Lanes function which handles as many elements from begin as fill whole vectors and returns where
+// it stopped, and an entry point which runs it with the wide lanes followed by the scalar lanes for the remainder.
+
+template<class Lanes>
+AZ_SIMD_BATCH_TARGET size_t TransformPointsLanes(
+    const TransformParams& transform, ConstVector3Soa in, Vector3Soa out, size_t begin, size_t count)
+{
+    using FloatType = typename Lanes::FloatType;
+    FloatType rows[12];
+    for (size_t i = 0; i < 12; ++i)
+    {
+        rows[i] = Lanes::Splat(transform.m_rows[i]);
+    }
+
+    size_t index = begin;
+    for (; index + Lanes::ElementCount <= count; index += Lanes::ElementCount)
+    {
+        // Load everything before storing, out is allowed to alias in.
+        const FloatType x = Lanes::Load(in.m_x + index);
+        const FloatType y = Lanes::Load(in.m_y + index);
+        const FloatType z = Lanes::Load(in.m_z + index);
+        Lanes::Store(out.m_x + index, Lanes::Madd(rows[0], x, Lanes::Madd(rows[1], y, Lanes::Madd(rows[2], z, rows[3]))));
+        Lanes::Store(out.m_y + index, Lanes::Madd(rows[4], x, Lanes::Madd(rows[5], y, Lanes::Madd(rows[6], z, rows[7]))));
+        Lanes::Store(out.m_z + index, Lanes::Madd(rows[8], x, Lanes::Madd(rows[9], y, Lanes::Madd(rows[10], z, rows[11]))));
+    }
+    return index;
+}
+
+template<class Lanes>
+AZ_SIMD_BATCH_TARGET void TransformPoints(const TransformParams& transform, ConstVector3Soa in, Vector3Soa out, size_t count)
+{
+    const size_t index = TransformPointsLanes<Lanes>(transform, in, out, 0, count);
+    TransformPointsLanes<ScalarLanes>(transform, in, out, index, count);
+}
+
+template<class Lanes>
+AZ_SIMD_BATCH_TARGET typename Lanes::FloatType LoadDot(ConstVector3Soa a, ConstVector3Soa b, size_t index)
+{
+    return Lanes::Madd(
+        Lanes::Load(a.m_x + index),
+        Lanes::Load(b.m_x + index),
+        Lanes::Madd(
+            Lanes::Load(a.m_y + index),
+            Lanes::Load(b.m_y + index),
+            Lanes::Mul(Lanes::Load(a.m_z + index), Lanes::Load(b.m_z + index))));
+}
+
+template<class Lanes>
+AZ_SIMD_BATCH_TARGET size_t DotLanes(ConstVector3Soa a, ConstVector3Soa b, float* out, size_t begin, size_t count)
+{
+    size_t index = begin;
+    for (; index + Lanes::ElementCount <= count; index += Lanes::ElementCount)
+    {
+        Lanes::Store(out + index, LoadDot<Lanes>(a, b, index));
+    }
+    return index;
+}
+
+template<class Lanes>
+AZ_SIMD_BATCH_TARGET void Dot(ConstVector3Soa a, ConstVector3Soa b, float* out, size_t count)
+{
+    const size_t index = DotLanes<Lanes>(a, b, out, 0, count);
+    DotLanes<ScalarLanes>(a, b, out, index, count);
+}
+
+template<class Lanes>
+AZ_SIMD_BATCH_TARGET size_t LengthLanes(ConstVector3Soa in, float* out, size_t begin, size_t count)
+{
+    size_t index = begin;
+    for (; index + Lanes::ElementCount <= count; index += Lanes::ElementCount)
+    {
+        Lanes::Store(out + index, Lanes::Sqrt(LoadDot<Lanes>(in, in, index)));
+    }
+    return index;
+}
+
+template<class Lanes>
+AZ_SIMD_BATCH_TARGET void Length(ConstVector3Soa in, float* out, size_t count)
+{
+    const size_t index = LengthLanes<Lanes>(in, out, 0, count);
+    LengthLanes<ScalarLanes>(in, out, index, count);
+}
+
+template<class Lanes>
+AZ_SIMD_BATCH_TARGET size_t NormalizeSafeLanes(Vector3Soa inout, float tolerance, size_t begin, size_t count)
+{
+    using FloatType = typename Lanes::FloatType;
+    const FloatType toleranceSq = Lanes::Splat(tolerance * tolerance);
+    const FloatType zero = Lanes::ZeroFloat();
+
+    size_t index = begin;
+    for (; index + Lanes::ElementCount <= count; index += Lanes::ElementCount)
+    {
+        const FloatType x = Lanes::Load(inout.m_x + index);
+        const FloatType y = Lanes::Load(inout.m_y + index);
+        const FloatType z = Lanes::Load(inout.m_z + index);
+        const FloatType lengthSq = Lanes::Madd(x, x, Lanes::Madd(y, y, Lanes::Mul(z, z)));
+        const typename Lanes::MaskType valid = Lanes::CmpGtEq(lengthSq, toleranceSq);
+        const FloatType length = Lanes::Sqrt(lengthSq);
+        Lanes::Store(inout.m_x + index, Lanes::Select(Lanes::Div(x, length), zero, valid));
+        Lanes::Store(inout.m_y + index, Lanes::Select(Lanes::Div(y, length), zero, valid));
+        Lanes::Store(inout.m_z + index, Lanes::Select(Lanes::Div(z, length), zero, valid));
+    }
+    return index;
+}
+
+template<class Lanes>
+AZ_SIMD_BATCH_TARGET void NormalizeSafe(Vector3Soa inout, size_t count, float tolerance)
+{
+    const size_t index = NormalizeSafeLanes<Lanes>(inout, tolerance, 0, count);
+    NormalizeSafeLanes<ScalarLanes>(inout, tolerance, index, count);
+}
+
+template<class Lanes>
+AZ_SIMD_BATCH_TARGET size_t AabbOverlapsLanes(
+    const AabbParams& aabb, ConstAabbSoa aabbs, u8* results, size_t begin, size_t count, size_t& overlapCount)
+{
+    using FloatType = typename Lanes::FloatType;
+    const FloatType minX = Lanes::Splat(aabb.m_min[0]);
+    const FloatType minY = Lanes::Splat(aabb.m_min[1]);
+    const FloatType minZ = Lanes::Splat(aabb.m_min[2]);
+    const FloatType maxX = Lanes::Splat(aabb.m_max[0]);
+    const FloatType maxY = Lanes::Splat(aabb.m_max[1]);
+    const FloatType maxZ = Lanes::Splat(aabb.m_max[2]);
+
+    size_t index = begin;
+    for (; index + Lanes::ElementCount <= count; index += Lanes::ElementCount)
+    {
+        typename Lanes::MaskType overlaps = Lanes::CmpLtEq(minX, Lanes::Load(aabbs.m_max.m_x + index));
+        overlaps = Lanes::And(overlaps, Lanes::CmpLtEq(minY, Lanes::Load(aabbs.m_max.m_y + index)));
+        overlaps = Lanes::And(overlaps, Lanes::CmpLtEq(minZ, Lanes::Load(aabbs.m_max.m_z + index)));
+        overlaps = Lanes::And(overlaps, Lanes::CmpGtEq(maxX, Lanes::Load(aabbs.m_min.m_x + index)));
+        overlaps = Lanes::And(overlaps, Lanes::CmpGtEq(maxY, Lanes::Load(aabbs.m_min.m_y + index)));
+        overlaps = Lanes::And(overlaps, Lanes::CmpGtEq(maxZ, Lanes::Load(aabbs.m_min.m_z + index)));
+        overlapCount += Lanes::StoreMask(results + index, overlaps);
+    }
+    return index;
+}
+
+template<class Lanes>
+AZ_SIMD_BATCH_TARGET size_t AabbOverlaps(const AabbParams& aabb, ConstAabbSoa aabbs, u8* results, size_t count)
+{
+    size_t overlapCount = 0;
+    const size_t index = AabbOverlapsLanes<Lanes>(aabb, aabbs, results, 0, count, overlapCount);
+    AabbOverlapsLanes<ScalarLanes>(aabb, aabbs, results, index, count, overlapCount);
+    return overlapCount;
+}
+
+template<class Lanes>
+AZ_SIMD_BATCH_TARGET size_t FrustumCullSpheresLanes(
+    const FrustumParams& frustum,
+    ConstVector3Soa centers,
+    const float* radii,
+    u8* results,
+    size_t begin,
+    size_t count,
+    size_t& visibleCount)
+{
+    using FloatType = typename Lanes::FloatType;
+    FloatType planes[FrustumPlaneCount][4];
+    for (size_t plane = 0; plane < FrustumPlaneCount; ++plane)
+    {
+        for (size_t component = 0; component < 4; ++component)
+        {
+            planes[plane][component] = Lanes::Splat(frustum.m_planes[plane][component]);
+        }
+    }
+
+    size_t index = begin;
+    for (; index + Lanes::ElementCount <= count; index += Lanes::ElementCount)
+    {
+        const FloatType x = Lanes::Load(centers.m_x + index);
+        const FloatType y = Lanes::Load(centers.m_y + index);
+        const FloatType z = Lanes::Load(centers.m_z + index);
+        // distance >= -radius is the same as distance + radius >= 0, so fold the radius into the plane distance.
+        const FloatType radius = Lanes::Load(radii + index);
+        const FloatType zero = Lanes::ZeroFloat();
+
+        typename Lanes::MaskType visible = Lanes::CmpGtEq(
+            Lanes::Madd(planes[0][0], x, Lanes::Madd(planes[0][1], y, Lanes::Madd(planes[0][2], z, Lanes::Add(planes[0][3], radius)))),
+            zero);
+        for (size_t plane = 1; plane < FrustumPlaneCount; ++plane)
+        {
+            const FloatType distance = Lanes::Madd(
+                planes[plane][0], x, Lanes::Madd(planes[plane][1], y, Lanes::Madd(planes[plane][2], z, Lanes::Add(planes[plane][3], radius))));
+            visible = Lanes::And(visible, Lanes::CmpGtEq(distance, zero));
+        }
+        visibleCount += Lanes::StoreMask(results + index, visible);
+    }
+    return index;
+}
+
+template<class Lanes>
+AZ_SIMD_BATCH_TARGET size_t FrustumCullSpheres(
+    const FrustumParams& frustum, ConstVector3Soa centers, const float* radii, u8* results, size_t count)
+{
+    size_t visibleCount = 0;
+    const size_t index = FrustumCullSpheresLanes<Lanes>(frustum, centers, radii, results, 0, count, visibleCount);
+    FrustumCullSpheresLanes<ScalarLanes>(frustum, centers, radii, results, index, count, visibleCount);
+    return visibleCount;
+}
+
+template<class Lanes>
+AZ_SIMD_BATCH_TARGET size_t FrustumCullAabbsLanes(
+    const FrustumParams& frustum, ConstAabbSoa aabbs, u8* results, size_t begin, size_t count, size_t& visibleCount)
+{
+    using FloatType = typename Lanes::FloatType;
+    FloatType planes[FrustumPlaneCount][4];
+    for (size_t plane = 0; plane < FrustumPlaneCount; ++plane)
+    {
+        for (size_t component = 0; component < 4; ++component)
+        {
+            planes[plane][component] = Lanes::Splat(frustum.m_planes[plane][component]);
+        }
+    }
+
+    size_t index = begin;
+    for (; index + Lanes::ElementCount <= count; index += Lanes::ElementCount)
+    {
+        const FloatType minX = Lanes::Load(aabbs.m_min.m_x + index);
+        const FloatType minY = Lanes::Load(aabbs.m_min.m_y + index);
+        const FloatType minZ = Lanes::Load(aabbs.m_min.m_z + index);
+        const FloatType maxX = Lanes::Load(aabbs.m_max.m_x + index);
+        const FloatType maxY = Lanes::Load(aabbs.m_max.m_y + index);
+        const FloatType maxZ = Lanes::Load(aabbs.m_max.m_z + index);
+        const FloatType zero = Lanes::ZeroFloat();
+
+        typename Lanes::MaskType visible = Lanes::CmpGtEq(zero, zero);
+        for (size_t plane = 0; plane < FrustumPlaneCount; ++plane)
+        {
+            // The corner furthest along the plane normal, which is on the inside of the plane if any part of the box is.
+            // Picking the larger product per axis selects the same corner as Aabb::GetSupport(-normal) without branching.
+            const FloatType distance = Lanes::Add(
+                Lanes::Max(Lanes::Mul(planes[plane][0], minX), Lanes::Mul(planes[plane][0], maxX)),
+                Lanes::Add(
+                    Lanes::Max(Lanes::Mul(planes[plane][1], minY), Lanes::Mul(planes[plane][1], maxY)),
+                    Lanes::Add(Lanes::Max(Lanes::Mul(planes[plane][2], minZ), Lanes::Mul(planes[plane][2], maxZ)), planes[plane][3])));
+            visible = Lanes::And(visible, Lanes::CmpGtEq(distance, zero));
+        }
+        visibleCount += Lanes::StoreMask(results + index, visible);
+    }
+    return index;
+}
+
+template<class Lanes>
+AZ_SIMD_BATCH_TARGET size_t FrustumCullAabbs(const FrustumParams& frustum, ConstAabbSoa aabbs, u8* results, size_t count)
+{
+    size_t visibleCount = 0;
+    const size_t index = FrustumCullAabbsLanes<Lanes>(frustum, aabbs, results, 0, count, visibleCount);
+    FrustumCullAabbsLanes<ScalarLanes>(frustum, aabbs, results, index, count, visibleCount);
+    return visibleCount;
+}
+
+template<class Lanes>
+KernelTable MakeKernelTable()
+{
+    KernelTable table;
+    table.m_transformPoints = &TransformPoints<Lanes>;
+    table.m_dot = &Dot<Lanes>;
+    table.m_length = &Length<Lanes>;
+    table.m_normalizeSafe = &NormalizeSafe<Lanes>;
+    table.m_aabbOverlaps = &AabbOverlaps<Lanes>;
+    table.m_frustumCullSpheres = &FrustumCullSpheres<Lanes>;
+    table.m_frustumCullAabbs = &FrustumCullAabbs<Lanes>;
+    return table;
+}
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/Internal/SimdBatchKernels.h>
+
+// This file is compiled with the baseline instruction set like the rest of AzCore. Only the functions marked with
+// AZ_SIMD_BATCH_TARGET use AVX2, and they are only called after SimdBatch.cpp has checked that the CPU supports it.
+// Don't include any of the inline math headers here, their functions must not be generated with AVX2 enabled.
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+#include <immintrin.h>
+#include <math.h>
+
+#if defined(AZ_COMPILER_MSVC)
+#   define AZ_SIMD_BATCH_TARGET
+#else
+#   define AZ_SIMD_BATCH_TARGET __attribute__((target("avx2,fma,popcnt")))
+#endif
+
+namespace AZ::Simd::Batch::Internal
+{
+    namespace
+    {
+        struct Avx2Lanes
+        {
+            using FloatType = __m256;
+            using MaskType = __m256;
+            static constexpr size_t ElementCount = 8;
+
+            AZ_SIMD_BATCH_TARGET static FloatType Load(const float* addr) { return _mm256_loadu_ps(addr); }
+            AZ_SIMD_BATCH_TARGET static void Store(float* addr, FloatType value) { _mm256_storeu_ps(addr, value); }
+            AZ_SIMD_BATCH_TARGET static FloatType Splat(float value) { return _mm256_set1_ps(value); }
+            AZ_SIMD_BATCH_TARGET static FloatType ZeroFloat() { return _mm256_setzero_ps(); }
+            AZ_SIMD_BATCH_TARGET static FloatType Add(FloatType arg1, FloatType arg2) { return _mm256_add_ps(arg1, arg2); }
+            AZ_SIMD_BATCH_TARGET static FloatType Mul(FloatType arg1, FloatType arg2) { return _mm256_mul_ps(arg1, arg2); }
+            AZ_SIMD_BATCH_TARGET static FloatType Madd(FloatType mul1, FloatType mul2, FloatType add) { return _mm256_fmadd_ps(mul1, mul2, add); }
+            AZ_SIMD_BATCH_TARGET static FloatType Div(FloatType arg1, FloatType arg2) { return _mm256_div_ps(arg1, arg2); }
+            AZ_SIMD_BATCH_TARGET static FloatType Sqrt(FloatType value) { return _mm256_sqrt_ps(value); }
+            AZ_SIMD_BATCH_TARGET static FloatType Max(FloatType arg1, FloatType arg2) { return _mm256_max_ps(arg1, arg2); }
+            AZ_SIMD_BATCH_TARGET static MaskType CmpGtEq(FloatType arg1, FloatType arg2) { return _mm256_cmp_ps(arg1, arg2, _CMP_GE_OQ); }
+            AZ_SIMD_BATCH_TARGET static MaskType CmpLtEq(FloatType arg1, FloatType arg2) { return _mm256_cmp_ps(arg1, arg2, _CMP_LE_OQ); }
+            AZ_SIMD_BATCH_TARGET static MaskType And(MaskType arg1, MaskType arg2) { return _mm256_and_ps(arg1, arg2); }
+            AZ_SIMD_BATCH_TARGET static FloatType Select(FloatType arg1, FloatType arg2, MaskType mask) { return _mm256_blendv_ps(arg2, arg1, mask); }
+
+            AZ_SIMD_BATCH_TARGET static size_t StoreMask(u8* out, MaskType mask)
+            {
+                // Narrow the all bits set lanes down to one byte per lane and keep only the lowest bit of each.
+                const __m256i lanes = _mm256_castps_si256(mask);
+                const __m128i words = _mm_packs_epi32(_mm256_castsi256_si128(lanes), _mm256_extracti128_si256(lanes, 1));
+                const __m128i bytes = _mm_and_si128(_mm_packs_epi16(words, words), _mm_set1_epi8(1));
+                _mm_storel_epi64(reinterpret_cast<__m128i*>(out), bytes);
+                return static_cast<size_t>(_mm_popcnt_u32(static_cast<unsigned int>(_mm256_movemask_ps(mask))));
+            }
+        };
+
+#include <AzCore/Math/Internal/SimdBatchKernels.inl>
+    } // namespace
+
+    const KernelTable* GetAvx2Kernels()
+    {
+        static const KernelTable kernels = MakeKernelTable<Avx2Lanes>();
+        return &kernels;
+    }
+} // namespace AZ::Simd::Batch::Internal
+
+#else
+
+namespace AZ::Simd::Batch::Internal
+{
+    const KernelTable* GetAvx2Kernels()
+    {
+        return nullptr;
+    }
+} // namespace AZ::Simd::Batch::Internal
+
+#endif
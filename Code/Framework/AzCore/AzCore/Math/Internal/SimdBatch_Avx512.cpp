@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/Internal/SimdBatchKernels.h>
+
+// Same as SimdBatch_Avx2.cpp, only the functions marked with AZ_SIMD_BATCH_TARGET use AVX-512, and only after
+// SimdBatch.cpp has checked that the CPU supports it. Only AVX-512F instructions are used.
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+#include <immintrin.h>
+#include <math.h>
+
+#if defined(AZ_COMPILER_MSVC)
+#   define AZ_SIMD_BATCH_TARGET
+#else
+#   define AZ_SIMD_BATCH_TARGET __attribute__((target("avx512f,avx2,fma,popcnt")))
+#endif
+
+namespace AZ::Simd::Batch::Internal
+{
+    namespace
+    {
+        struct Avx512Lanes
+        {
+            using FloatType = __m512;
+            using MaskType = __mmask16;
+            static constexpr size_t ElementCount = 16;
+
+            AZ_SIMD_BATCH_TARGET static FloatType Load(const float* addr) { return _mm512_loadu_ps(addr); }
+            AZ_SIMD_BATCH_TARGET static void Store(float* addr, FloatType value) { _mm512_storeu_ps(addr, value); }
+            AZ_SIMD_BATCH_TARGET static FloatType Splat(float value) { return _mm512_set1_ps(value); }
+            AZ_SIMD_BATCH_TARGET static FloatType ZeroFloat() { return _mm512_setzero_ps(); }
+            AZ_SIMD_BATCH_TARGET static FloatType Add(FloatType arg1, FloatType arg2) { return _mm512_add_ps(arg1, arg2); }
+            AZ_SIMD_BATCH_TARGET static FloatType Mul(FloatType arg1, FloatType arg2) { return _mm512_mul_ps(arg1, arg2); }
+            AZ_SIMD_BATCH_TARGET static FloatType Madd(FloatType mul1, FloatType mul2, FloatType add) { return _mm512_fmadd_ps(mul1, mul2, add); }
+            AZ_SIMD_BATCH_TARGET static FloatType Div(FloatType arg1, FloatType arg2) { return _mm512_div_ps(arg1, arg2); }
+            AZ_SIMD_BATCH_TARGET static FloatType Sqrt(FloatType value) { return _mm512_sqrt_ps(value); }
+            AZ_SIMD_BATCH_TARGET static FloatType Max(FloatType arg1, FloatType arg2) { return _mm512_max_ps(arg1, arg2); }
+            AZ_SIMD_BATCH_TARGET static MaskType CmpGtEq(FloatType arg1, FloatType arg2) { return _mm512_cmp_ps_mask(arg1, arg2, _CMP_GE_OQ); }
+            AZ_SIMD_BATCH_TARGET static MaskType CmpLtEq(FloatType arg1, FloatType arg2) { return _mm512_cmp_ps_mask(arg1, arg2, _CMP_LE_OQ); }
+            AZ_SIMD_BATCH_TARGET static MaskType And(MaskType arg1, MaskType arg2) { return _mm512_kand(arg1, arg2); }
+            AZ_SIMD_BATCH_TARGET static FloatType Select(FloatType arg1, FloatType arg2, MaskType mask) { return _mm512_mask_blend_ps(mask, arg2, arg1); }
+
+            AZ_SIMD_BATCH_TARGET static size_t StoreMask(u8* out, MaskType mask)
+            {
+                // Expand the mask register to one 32 bit lane per element and narrow those down to bytes.
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm512_cvtepi32_epi8(_mm512_maskz_set1_epi32(mask, 1)));
+                return static_cast<size_t>(_mm_popcnt_u32(static_cast<unsigned int>(mask)));
+            }
+        };
+
+#include <AzCore/Math/Internal/SimdBatchKernels.inl>
+    } // namespace
+
+    const KernelTable* GetAvx512Kernels()
+    {
+        static const KernelTable kernels = MakeKernelTable<Avx512Lanes>();
+        return &kernels;
+    }
+} // namespace AZ::Simd::Batch::Internal
+
+#else
+
+namespace AZ::Simd::Batch::Internal
+{
+    const KernelTable* GetAvx512Kernels()
+    {
+        return nullptr;
+    }
+} // namespace AZ::Simd::Batch::Internal
+
+#endif
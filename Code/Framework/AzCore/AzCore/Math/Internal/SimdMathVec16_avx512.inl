@@ -0,0 +1,265 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+namespace AZ
+{
+    namespace Simd
+    {
+        namespace Avx512
+        {
+            // AVX-512F comparisons produce mask registers, while the Vec API represents masks as all bits set lanes.
+            // Only AVX-512F instructions are used here, so the float logic ops go through the integer domain.
+            AZ_MATH_INLINE __m512 MaskToVector(__mmask16 mask)
+            {
+                return _mm512_castsi512_ps(_mm512_maskz_mov_epi32(mask, _mm512_set1_epi32(-1)));
+            }
+
+            AZ_MATH_INLINE __mmask16 VectorToMask(__m512i mask)
+            {
+                return _mm512_cmplt_epi32_mask(mask, _mm512_setzero_si512());
+            }
+        }
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::LoadAligned(const float* __restrict addr)
+        {
+            return _mm512_load_ps(addr);
+        }
+
+        AZ_MATH_INLINE Vec16::Int32Type Vec16::LoadAligned(const int32_t* __restrict addr)
+        {
+            return _mm512_load_si512(addr);
+        }
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::LoadUnaligned(const float* __restrict addr)
+        {
+            return _mm512_loadu_ps(addr);
+        }
+
+        AZ_MATH_INLINE Vec16::Int32Type Vec16::LoadUnaligned(const int32_t* __restrict addr)
+        {
+            return _mm512_loadu_si512(addr);
+        }
+
+        AZ_MATH_INLINE void Vec16::StoreAligned(float* __restrict addr, FloatArgType value)
+        {
+            _mm512_store_ps(addr, value);
+        }
+
+        AZ_MATH_INLINE void Vec16::StoreAligned(int32_t* __restrict addr, Int32ArgType value)
+        {
+            _mm512_store_si512(addr, value);
+        }
+
+        AZ_MATH_INLINE void Vec16::StoreUnaligned(float* __restrict addr, FloatArgType value)
+        {
+            _mm512_storeu_ps(addr, value);
+        }
+
+        AZ_MATH_INLINE void Vec16::StoreUnaligned(int32_t* __restrict addr, Int32ArgType value)
+        {
+            _mm512_storeu_si512(addr, value);
+        }
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::Splat(float value)
+        {
+            return _mm512_set1_ps(value);
+        }
+
+        AZ_MATH_INLINE Vec16::Int32Type Vec16::Splat(int32_t value)
+        {
+            return _mm512_set1_epi32(value);
+        }
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::Add(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm512_add_ps(arg1, arg2);
+        }
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::Sub(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm512_sub_ps(arg1, arg2);
+        }
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::Mul(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm512_mul_ps(arg1, arg2);
+        }
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::Madd(FloatArgType mul1, FloatArgType mul2, FloatArgType add)
+        {
+            return _mm512_fmadd_ps(mul1, mul2, add);
+        }
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::Div(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm512_div_ps(arg1, arg2);
+        }
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::Abs(FloatArgType value)
+        {
+            return CastToFloat(_mm512_and_si512(CastToInt(value), _mm512_set1_epi32(0x7FFFFFFF)));
+        }
+
+        AZ_MATH_INLINE Vec16::Int32Type Vec16::Add(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return _mm512_add_epi32(arg1, arg2);
+        }
+
+        AZ_MATH_INLINE Vec16::Int32Type Vec16::Sub(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return _mm512_sub_epi32(arg1, arg2);
+        }
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::Not(FloatArgType value)
+        {
+            return CastToFloat(_mm512_xor_si512(CastToInt(value), _mm512_set1_epi32(-1)));
+        }
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::And(FloatArgType arg1, FloatArgType arg2)
+        {
+            return CastToFloat(_mm512_and_si512(CastToInt(arg1), CastToInt(arg2)));
+        }
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::AndNot(FloatArgType arg1, FloatArgType arg2)
+        {
+            return CastToFloat(_mm512_andnot_si512(CastToInt(arg1), CastToInt(arg2)));
+        }
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::Or(FloatArgType arg1, FloatArgType arg2)
+        {
+            return CastToFloat(_mm512_or_si512(CastToInt(arg1), CastToInt(arg2)));
+        }
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::Xor(FloatArgType arg1, FloatArgType arg2)
+        {
+            return CastToFloat(_mm512_xor_si512(CastToInt(arg1), CastToInt(arg2)));
+        }
+
+        AZ_MATH_INLINE Vec16::Int32Type Vec16::And(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return _mm512_and_si512(arg1, arg2);
+        }
+
+        AZ_MATH_INLINE Vec16::Int32Type Vec16::Or(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return _mm512_or_si512(arg1, arg2);
+        }
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::Min(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm512_min_ps(arg1, arg2);
+        }
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::Max(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm512_max_ps(arg1, arg2);
+        }
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::Clamp(FloatArgType value, FloatArgType min, FloatArgType max)
+        {
+            return Max(min, Min(value, max));
+        }
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::CmpEq(FloatArgType arg1, FloatArgType arg2)
+        {
+            return Avx512::MaskToVector(_mm512_cmp_ps_mask(arg1, arg2, _CMP_EQ_OQ));
+        }
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::CmpNeq(FloatArgType arg1, FloatArgType arg2)
+        {
+            return Avx512::MaskToVector(_mm512_cmp_ps_mask(arg1, arg2, _CMP_NEQ_UQ));
+        }
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::CmpGt(FloatArgType arg1, FloatArgType arg2)
+        {
+            return Avx512::MaskToVector(_mm512_cmp_ps_mask(arg1, arg2, _CMP_GT_OQ));
+        }
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::CmpGtEq(FloatArgType arg1, FloatArgType arg2)
+        {
+            return Avx512::MaskToVector(_mm512_cmp_ps_mask(arg1, arg2, _CMP_GE_OQ));
+        }
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::CmpLt(FloatArgType arg1, FloatArgType arg2)
+        {
+            return Avx512::MaskToVector(_mm512_cmp_ps_mask(arg1, arg2, _CMP_LT_OQ));
+        }
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::CmpLtEq(FloatArgType arg1, FloatArgType arg2)
+        {
+            return Avx512::MaskToVector(_mm512_cmp_ps_mask(arg1, arg2, _CMP_LE_OQ));
+        }
+
+        AZ_MATH_INLINE Vec16::Int32Type Vec16::CmpEq(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return _mm512_maskz_mov_epi32(_mm512_cmpeq_epi32_mask(arg1, arg2), _mm512_set1_epi32(-1));
+        }
+
+        AZ_MATH_INLINE uint32_t Vec16::ToBitMask(FloatArgType mask)
+        {
+            return static_cast<uint32_t>(Avx512::VectorToMask(CastToInt(mask)));
+        }
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::Select(FloatArgType arg1, FloatArgType arg2, FloatArgType mask)
+        {
+            return _mm512_mask_blend_ps(Avx512::VectorToMask(CastToInt(mask)), arg2, arg1);
+        }
+
+        AZ_MATH_INLINE Vec16::Int32Type Vec16::Select(Int32ArgType arg1, Int32ArgType arg2, Int32ArgType mask)
+        {
+            return _mm512_mask_blend_epi32(Avx512::VectorToMask(mask), arg2, arg1);
+        }
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::Reciprocal(FloatArgType value)
+        {
+            return _mm512_div_ps(_mm512_set1_ps(1.0f), value);
+        }
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::Sqrt(FloatArgType value)
+        {
+            return _mm512_sqrt_ps(value);
+        }
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::SqrtInv(FloatArgType value)
+        {
+            return _mm512_div_ps(_mm512_set1_ps(1.0f), _mm512_sqrt_ps(value));
+        }
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::ConvertToFloat(Int32ArgType value)
+        {
+            return _mm512_cvtepi32_ps(value);
+        }
+
+        AZ_MATH_INLINE Vec16::Int32Type Vec16::ConvertToInt(FloatArgType value)
+        {
+            return _mm512_cvttps_epi32(value);
+        }
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::CastToFloat(Int32ArgType value)
+        {
+            return _mm512_castsi512_ps(value);
+        }
+
+        AZ_MATH_INLINE Vec16::Int32Type Vec16::CastToInt(FloatArgType value)
+        {
+            return _mm512_castps_si512(value);
+        }
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::ZeroFloat()
+        {
+            return _mm512_setzero_ps();
+        }
+
+        AZ_MATH_INLINE Vec16::Int32Type Vec16::ZeroInt()
+        {
+            return _mm512_setzero_si512();
+        }
+    }
+}
@@ -0,0 +1,260 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+// Vec16 emulated with two Vec8 values, for platforms or builds that don't target AVX-512.
+
+namespace AZ
+{
+    namespace Simd
+    {
+        AZ_MATH_INLINE Vec16::FloatType Vec16::LoadAligned(const float* __restrict addr)
+        {
+            return {{ Vec8::LoadAligned(addr), Vec8::LoadAligned(addr + 8) }};
+        }
+
+        AZ_MATH_INLINE Vec16::Int32Type Vec16::LoadAligned(const int32_t* __restrict addr)
+        {
+            return {{ Vec8::LoadAligned(addr), Vec8::LoadAligned(addr + 8) }};
+        }
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::LoadUnaligned(const float* __restrict addr)
+        {
+            return {{ Vec8::LoadUnaligned(addr), Vec8::LoadUnaligned(addr + 8) }};
+        }
+
+        AZ_MATH_INLINE Vec16::Int32Type Vec16::LoadUnaligned(const int32_t* __restrict addr)
+        {
+            return {{ Vec8::LoadUnaligned(addr), Vec8::LoadUnaligned(addr + 8) }};
+        }
+
+        AZ_MATH_INLINE void Vec16::StoreAligned(float* __restrict addr, FloatArgType value)
+        {
+            Vec8::StoreAligned(addr, value.v[0]);
+            Vec8::StoreAligned(addr + 8, value.v[1]);
+        }
+
+        AZ_MATH_INLINE void Vec16::StoreAligned(int32_t* __restrict addr, Int32ArgType value)
+        {
+            Vec8::StoreAligned(addr, value.v[0]);
+            Vec8::StoreAligned(addr + 8, value.v[1]);
+        }
+
+        AZ_MATH_INLINE void Vec16::StoreUnaligned(float* __restrict addr, FloatArgType value)
+        {
+            Vec8::StoreUnaligned(addr, value.v[0]);
+            Vec8::StoreUnaligned(addr + 8, value.v[1]);
+        }
+
+        AZ_MATH_INLINE void Vec16::StoreUnaligned(int32_t* __restrict addr, Int32ArgType value)
+        {
+            Vec8::StoreUnaligned(addr, value.v[0]);
+            Vec8::StoreUnaligned(addr + 8, value.v[1]);
+        }
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::Splat(float value)
+        {
+            const Vec8::FloatType half = Vec8::Splat(value);
+            return {{ half, half }};
+        }
+
+        AZ_MATH_INLINE Vec16::Int32Type Vec16::Splat(int32_t value)
+        {
+            const Vec8::Int32Type half = Vec8::Splat(value);
+            return {{ half, half }};
+        }
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::Add(FloatArgType arg1, FloatArgType arg2)
+        {
+            return {{ Vec8::Add(arg1.v[0], arg2.v[0]), Vec8::Add(arg1.v[1], arg2.v[1]) }};
+        }
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::Sub(FloatArgType arg1, FloatArgType arg2)
+        {
+            return {{ Vec8::Sub(arg1.v[0], arg2.v[0]), Vec8::Sub(arg1.v[1], arg2.v[1]) }};
+        }
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::Mul(FloatArgType arg1, FloatArgType arg2)
+        {
+            return {{ Vec8::Mul(arg1.v[0], arg2.v[0]), Vec8::Mul(arg1.v[1], arg2.v[1]) }};
+        }
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::Madd(FloatArgType mul1, FloatArgType mul2, FloatArgType add)
+        {
+            return {{ Vec8::Madd(mul1.v[0], mul2.v[0], add.v[0]), Vec8::Madd(mul1.v[1], mul2.v[1], add.v[1]) }};
+        }
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::Div(FloatArgType arg1, FloatArgType arg2)
+        {
+            return {{ Vec8::Div(arg1.v[0], arg2.v[0]), Vec8::Div(arg1.v[1], arg2.v[1]) }};
+        }
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::Abs(FloatArgType value)
+        {
+            return {{ Vec8::Abs(value.v[0]), Vec8::Abs(value.v[1]) }};
+        }
+
+        AZ_MATH_INLINE Vec16::Int32Type Vec16::Add(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return {{ Vec8::Add(arg1.v[0], arg2.v[0]), Vec8::Add(arg1.v[1], arg2.v[1]) }};
+        }
+
+        AZ_MATH_INLINE Vec16::Int32Type Vec16::Sub(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return {{ Vec8::Sub(arg1.v[0], arg2.v[0]), Vec8::Sub(arg1.v[1], arg2.v[1]) }};
+        }
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::Not(FloatArgType value)
+        {
+            return {{ Vec8::Not(value.v[0]), Vec8::Not(value.v[1]) }};
+        }
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::And(FloatArgType arg1, FloatArgType arg2)
+        {
+            return {{ Vec8::And(arg1.v[0], arg2.v[0]), Vec8::And(arg1.v[1], arg2.v[1]) }};
+        }
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::AndNot(FloatArgType arg1, FloatArgType arg2)
+        {
+            return {{ Vec8::AndNot(arg1.v[0], arg2.v[0]), Vec8::AndNot(arg1.v[1], arg2.v[1]) }};
+        }
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::Or(FloatArgType arg1, FloatArgType arg2)
+        {
+            return {{ Vec8::Or(arg1.v[0], arg2.v[0]), Vec8::Or(arg1.v[1], arg2.v[1]) }};
+        }
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::Xor(FloatArgType arg1, FloatArgType arg2)
+        {
+            return {{ Vec8::Xor(arg1.v[0], arg2.v[0]), Vec8::Xor(arg1.v[1], arg2.v[1]) }};
+        }
+
+        AZ_MATH_INLINE Vec16::Int32Type Vec16::And(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return {{ Vec8::And(arg1.v[0], arg2.v[0]), Vec8::And(arg1.v[1], arg2.v[1]) }};
+        }
+
+        AZ_MATH_INLINE Vec16::Int32Type Vec16::Or(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return {{ Vec8::Or(arg1.v[0], arg2.v[0]), Vec8::Or(arg1.v[1], arg2.v[1]) }};
+        }
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::Min(FloatArgType arg1, FloatArgType arg2)
+        {
+            return {{ Vec8::Min(arg1.v[0], arg2.v[0]), Vec8::Min(arg1.v[1], arg2.v[1]) }};
+        }
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::Max(FloatArgType arg1, FloatArgType arg2)
+        {
+            return {{ Vec8::Max(arg1.v[0], arg2.v[0]), Vec8::Max(arg1.v[1], arg2.v[1]) }};
+        }
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::Clamp(FloatArgType value, FloatArgType min, FloatArgType max)
+        {
+            return {{ Vec8::Clamp(value.v[0], min.v[0], max.v[0]), Vec8::Clamp(value.v[1], min.v[1], max.v[1]) }};
+        }
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::CmpEq(FloatArgType arg1, FloatArgType arg2)
+        {
+            return {{ Vec8::CmpEq(arg1.v[0], arg2.v[0]), Vec8::CmpEq(arg1.v[1], arg2.v[1]) }};
+        }
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::CmpNeq(FloatArgType arg1, FloatArgType arg2)
+        {
+            return {{ Vec8::CmpNeq(arg1.v[0], arg2.v[0]), Vec8::CmpNeq(arg1.v[1], arg2.v[1]) }};
+        }
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::CmpGt(FloatArgType arg1, FloatArgType arg2)
+        {
+            return {{ Vec8::CmpGt(arg1.v[0], arg2.v[0]), Vec8::CmpGt(arg1.v[1], arg2.v[1]) }};
+        }
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::CmpGtEq(FloatArgType arg1, FloatArgType arg2)
+        {
+            return {{ Vec8::CmpGtEq(arg1.v[0], arg2.v[0]), Vec8::CmpGtEq(arg1.v[1], arg2.v[1]) }};
+        }
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::CmpLt(FloatArgType arg1, FloatArgType arg2)
+        {
+            return {{ Vec8::CmpLt(arg1.v[0], arg2.v[0]), Vec8::CmpLt(arg1.v[1], arg2.v[1]) }};
+        }
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::CmpLtEq(FloatArgType arg1, FloatArgType arg2)
+        {
+            return {{ Vec8::CmpLtEq(arg1.v[0], arg2.v[0]), Vec8::CmpLtEq(arg1.v[1], arg2.v[1]) }};
+        }
+
+        AZ_MATH_INLINE Vec16::Int32Type Vec16::CmpEq(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return {{ Vec8::CmpEq(arg1.v[0], arg2.v[0]), Vec8::CmpEq(arg1.v[1], arg2.v[1]) }};
+        }
+
+        AZ_MATH_INLINE uint32_t Vec16::ToBitMask(FloatArgType mask)
+        {
+            return Vec8::ToBitMask(mask.v[0]) | (Vec8::ToBitMask(mask.v[1]) << 8);
+        }
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::Select(FloatArgType arg1, FloatArgType arg2, FloatArgType mask)
+        {
+            return {{ Vec8::Select(arg1.v[0], arg2.v[0], mask.v[0]), Vec8::Select(arg1.v[1], arg2.v[1], mask.v[1]) }};
+        }
+
+        AZ_MATH_INLINE Vec16::Int32Type Vec16::Select(Int32ArgType arg1, Int32ArgType arg2, Int32ArgType mask)
+        {
+            return {{ Vec8::Select(arg1.v[0], arg2.v[0], mask.v[0]), Vec8::Select(arg1.v[1], arg2.v[1], mask.v[1]) }};
+        }
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::Reciprocal(FloatArgType value)
+        {
+            return {{ Vec8::Reciprocal(value.v[0]), Vec8::Reciprocal(value.v[1]) }};
+        }
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::Sqrt(FloatArgType value)
+        {
+            return {{ Vec8::Sqrt(value.v[0]), Vec8::Sqrt(value.v[1]) }};
+        }
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::SqrtInv(FloatArgType value)
+        {
+            return {{ Vec8::SqrtInv(value.v[0]), Vec8::SqrtInv(value.v[1]) }};
+        }
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::ConvertToFloat(Int32ArgType value)
+        {
+            return {{ Vec8::ConvertToFloat(value.v[0]), Vec8::ConvertToFloat(value.v[1]) }};
+        }
+
+        AZ_MATH_INLINE Vec16::Int32Type Vec16::ConvertToInt(FloatArgType value)
+        {
+            return {{ Vec8::ConvertToInt(value.v[0]), Vec8::ConvertToInt(value.v[1]) }};
+        }
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::CastToFloat(Int32ArgType value)
+        {
+            return {{ Vec8::CastToFloat(value.v[0]), Vec8::CastToFloat(value.v[1]) }};
+        }
+
+        AZ_MATH_INLINE Vec16::Int32Type Vec16::CastToInt(FloatArgType value)
+        {
+            return {{ Vec8::CastToInt(value.v[0]), Vec8::CastToInt(value.v[1]) }};
+        }
+
+        AZ_MATH_INLINE Vec16::FloatType Vec16::ZeroFloat()
+        {
+            const Vec8::FloatType half = Vec8::ZeroFloat();
+            return {{ half, half }};
+        }
+
+        AZ_MATH_INLINE Vec16::Int32Type Vec16::ZeroInt()
+        {
+            const Vec8::Int32Type half = Vec8::ZeroInt();
+            return {{ half, half }};
+        }
+    }
+}
@@ -0,0 +1,239 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/SimdBatch.h>
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Frustum.h>
+#include <AzCore/Math/Matrix3x4.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/Math/Internal/SimdBatchKernels.h>
+#include <AzCore/std/parallel/atomic.h>
+
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE && defined(AZ_COMPILER_MSVC)
+#include <intrin.h>
+#endif
+
+#define AZ_SIMD_BATCH_TARGET
+
+namespace AZ::Simd::Batch
+{
+    namespace Internal
+    {
+        namespace
+        {
+            //! The platform 4-wide SIMD, which is available everywhere.
+            struct Vec4Lanes
+            {
+                using FloatType = Vec4::FloatType;
+                using MaskType = Vec4::FloatType;
+                using FloatArgType = Vec4::FloatArgType;
+                static constexpr size_t ElementCount = 4;
+
+                static FloatType Load(const float* addr) { return Vec4::LoadUnaligned(addr); }
+                static void Store(float* addr, FloatArgType value) { Vec4::StoreUnaligned(addr, value); }
+                static FloatType Splat(float value) { return Vec4::Splat(value); }
+                static FloatType ZeroFloat() { return Vec4::ZeroFloat(); }
+                static FloatType Add(FloatArgType arg1, FloatArgType arg2) { return Vec4::Add(arg1, arg2); }
+                static FloatType Mul(FloatArgType arg1, FloatArgType arg2) { return Vec4::Mul(arg1, arg2); }
+                static FloatType Madd(FloatArgType mul1, FloatArgType mul2, FloatArgType add) { return Vec4::Madd(mul1, mul2, add); }
+                static FloatType Div(FloatArgType arg1, FloatArgType arg2) { return Vec4::Div(arg1, arg2); }
+                static FloatType Sqrt(FloatArgType value) { return Vec4::Sqrt(value); }
+                static FloatType Max(FloatArgType arg1, FloatArgType arg2) { return Vec4::Max(arg1, arg2); }
+                static MaskType CmpGtEq(FloatArgType arg1, FloatArgType arg2) { return Vec4::CmpGtEq(arg1, arg2); }
+                static MaskType CmpLtEq(FloatArgType arg1, FloatArgType arg2) { return Vec4::CmpLtEq(arg1, arg2); }
+                static MaskType And(FloatArgType arg1, FloatArgType arg2) { return Vec4::And(arg1, arg2); }
+                static FloatType Select(FloatArgType arg1, FloatArgType arg2, FloatArgType mask) { return Vec4::Select(arg1, arg2, mask); }
+
+                static size_t StoreMask(u8* out, FloatArgType mask)
+                {
+                    alignas(16) int32_t lanes[ElementCount];
+                    Vec4::StoreAligned(lanes, Vec4::CastToInt(mask));
+                    size_t count = 0;
+                    for (size_t i = 0; i < ElementCount; ++i)
+                    {
+                        out[i] = static_cast<u8>(lanes[i] & 1);
+                        count += out[i];
+                    }
+                    return count;
+                }
+            };
+
+#include <AzCore/Math/Internal/SimdBatchKernels.inl>
+        } // namespace
+
+        const KernelTable& GetVec4Kernels()
+        {
+            static const KernelTable kernels = MakeKernelTable<Vec4Lanes>();
+            return kernels;
+        }
+    } // namespace Internal
+
+    namespace
+    {
+        Width DetectSupportedWidth()
+        {
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+#if defined(AZ_COMPILER_MSVC)
+            int info[4];
+            __cpuid(info, 0);
+            if (info[0] < 7)
+            {
+                return Width::Vec4;
+            }
+            __cpuid(info, 1);
+            const bool hasFma = (info[2] & (1 << 12)) != 0;
+            const bool hasPopcnt = (info[2] & (1 << 23)) != 0;
+            const bool hasOsxsave = (info[2] & (1 << 27)) != 0;
+            if (!hasFma || !hasPopcnt || !hasOsxsave)
+            {
+                return Width::Vec4;
+            }
+            // The OS has to save the wider registers on context switches as well.
+            const unsigned long long enabledState = _xgetbv(0);
+            constexpr unsigned long long avxState = 0x6; // XMM and YMM
+            constexpr unsigned long long avx512State = 0xE6; // XMM, YMM, opmask and ZMM
+            __cpuidex(info, 7, 0);
+            const bool hasAvx2 = (info[1] & (1 << 5)) != 0;
+            const bool hasAvx512f = (info[1] & (1 << 16)) != 0;
+            if (hasAvx2 && hasAvx512f && (enabledState & avx512State) == avx512State)
+            {
+                return Width::Vec16;
+            }
+            if (hasAvx2 && (enabledState & avxState) == avxState)
+            {
+                return Width::Vec8;
+            }
+#else
+            // These also check that the OS saves the wider registers.
+            __builtin_cpu_init();
+            const bool hasAvx2 =
+                __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma") && __builtin_cpu_supports("popcnt");
+            if (hasAvx2 && __builtin_cpu_supports("avx512f"))
+            {
+                return Width::Vec16;
+            }
+            if (hasAvx2)
+            {
+                return Width::Vec8;
+            }
+#endif
+#endif
+            return Width::Vec4;
+        }
+
+        const Internal::KernelTable* GetKernelsForWidth(Width width)
+        {
+            const Internal::KernelTable* kernels = nullptr;
+            switch (width)
+            {
+            case Width::Vec16:
+                kernels = Internal::GetAvx512Kernels();
+                break;
+            case Width::Vec8:
+                kernels = Internal::GetAvx2Kernels();
+                break;
+            default:
+                break;
+            }
+            return kernels ? kernels : &Internal::GetVec4Kernels();
+        }
+
+        struct DispatchState
+        {
+            DispatchState()
+                : m_supportedWidth(DetectSupportedWidth())
+                , m_activeWidth(m_supportedWidth)
+                , m_kernels(GetKernelsForWidth(m_supportedWidth))
+            {
+            }
+
+            const Width m_supportedWidth;
+            AZStd::atomic<Width> m_activeWidth;
+            AZStd::atomic<const Internal::KernelTable*> m_kernels;
+        };
+
+        DispatchState& GetDispatchState()
+        {
+            static DispatchState state;
+            return state;
+        }
+
+        const Internal::KernelTable& GetKernels()
+        {
+            return *GetDispatchState().m_kernels.load(AZStd::memory_order_relaxed);
+        }
+
+        Internal::FrustumParams GetFrustumParams(const Frustum& frustum)
+        {
+            Internal::FrustumParams params;
+            for (Frustum::PlaneId plane = Frustum::PlaneId::Near; plane < Frustum::PlaneId::MAX; ++plane)
+            {
+                frustum.GetPlane(plane).GetPlaneEquationCoefficients().StoreToFloat4(params.m_planes[plane]);
+            }
+            return params;
+        }
+    } // namespace
+
+    Width GetSupportedWidth()
+    {
+        return GetDispatchState().m_supportedWidth;
+    }
+
+    Width GetActiveWidth()
+    {
+        return GetDispatchState().m_activeWidth.load(AZStd::memory_order_relaxed);
+    }
+
+    void SetActiveWidth(Width width)
+    {
+        DispatchState& state = GetDispatchState();
+        const Width activeWidth = static_cast<u8>(width) < static_cast<u8>(state.m_supportedWidth) ? width : state.m_supportedWidth;
+        state.m_activeWidth.store(activeWidth, AZStd::memory_order_relaxed);
+        state.m_kernels.store(GetKernelsForWidth(activeWidth), AZStd::memory_order_relaxed);
+    }
+
+    void TransformPoints(const Transform& transform, ConstVector3Soa in, Vector3Soa out, size_t count)
+    {
+        Internal::TransformParams params;
+        Matrix3x4::CreateFromTransform(transform).StoreToRowMajorFloat12(params.m_rows);
+        GetKernels().m_transformPoints(params, in, out, count);
+    }
+
+    void Dot(ConstVector3Soa a, ConstVector3Soa b, float* out, size_t count)
+    {
+        GetKernels().m_dot(a, b, out, count);
+    }
+
+    void Length(ConstVector3Soa in, float* out, size_t count)
+    {
+        GetKernels().m_length(in, out, count);
+    }
+
+    void NormalizeSafe(Vector3Soa inout, size_t count, float tolerance)
+    {
+        GetKernels().m_normalizeSafe(inout, count, tolerance);
+    }
+
+    size_t AabbOverlaps(const Aabb& aabb, ConstAabbSoa aabbs, u8* results, size_t count)
+    {
+        Internal::AabbParams params;
+        aabb.GetMin().StoreToFloat3(params.m_min);
+        aabb.GetMax().StoreToFloat3(params.m_max);
+        return GetKernels().m_aabbOverlaps(params, aabbs, results, count);
+    }
+
+    size_t FrustumCullSpheres(const Frustum& frustum, ConstVector3Soa centers, const float* radii, u8* results, size_t count)
+    {
+        return GetKernels().m_frustumCullSpheres(GetFrustumParams(frustum), centers, radii, results, count);
+    }
+
+    size_t FrustumCullAabbs(const Frustum& frustum, ConstAabbSoa aabbs, u8* results, size_t count)
+    {
+        return GetKernels().m_frustumCullAabbs(GetFrustumParams(frustum), aabbs, results, count);
+    }
+} // namespace AZ::Simd::Batch
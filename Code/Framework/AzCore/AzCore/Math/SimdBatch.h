@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+
+namespace AZ
+{
+    class Aabb;
+    class Frustum;
+    class Transform;
+
+    //! Batched versions of hot Vector3, Transform, Aabb and Frustum operations, working on structure of arrays data.
+    //! Every call processes a whole array, using the widest vector instructions the CPU supports (AVX-512, AVX2 or the
+    //! 4-wide platform SIMD), chosen once at runtime. This lets builds that only target the baseline instruction set
+    //! still use the wide registers on machines that have them.
+    //! Results are identical to the single element operations up to floating point rounding, so callers don't need to
+    //! care which width ends up being used.
+    namespace Simd::Batch
+    {
+        //! Number of floats processed per instruction.
+        enum class Width : u8
+        {
+            Vec4 = 4,
+            Vec8 = 8,
+            Vec16 = 16
+        };
+
+        //! Structure of arrays view of Vector3 data. Each array holds one component for all elements.
+        struct Vector3Soa
+        {
+            float* m_x = nullptr;
+            float* m_y = nullptr;
+            float* m_z = nullptr;
+        };
+
+        struct ConstVector3Soa
+        {
+            ConstVector3Soa() = default;
+            ConstVector3Soa(const float* x, const float* y, const float* z)
+                : m_x(x), m_y(y), m_z(z)
+            {
+            }
+            ConstVector3Soa(const Vector3Soa& soa)
+                : m_x(soa.m_x), m_y(soa.m_y), m_z(soa.m_z)
+            {
+            }
+
+            const float* m_x = nullptr;
+            const float* m_y = nullptr;
+            const float* m_z = nullptr;
+        };
+
+        //! Structure of arrays view of Aabb data.
+        struct ConstAabbSoa
+        {
+            ConstVector3Soa m_min;
+            ConstVector3Soa m_max;
+        };
+
+        //! The widest width the CPU running this process supports.
+        AZCORE_API Width GetSupportedWidth();
+        //! The width that is currently used by the batch operations. Defaults to the supported width.
+        AZCORE_API Width GetActiveWidth();
+        //! Overrides the width used by the batch operations, mainly to compare the paths against each other.
+        //! Widths above the supported width are clamped to it. Not thread safe with batch operations running concurrently.
+        AZCORE_API void SetActiveWidth(Width width);
+
+        //! out[i] = transform.TransformPoint(in[i]). out may alias in.
+        AZCORE_API void TransformPoints(const Transform& transform, ConstVector3Soa in, Vector3Soa out, size_t count);
+        //! out[i] = a[i].Dot(b[i]).
+        AZCORE_API void Dot(ConstVector3Soa a, ConstVector3Soa b, float* out, size_t count);
+        //! out[i] = in[i].GetLength().
+        AZCORE_API void Length(ConstVector3Soa in, float* out, size_t count);
+        //! Normalizes the vectors in place. Vectors shorter than tolerance are set to zero, matching Vector3::GetNormalizedSafe.
+        AZCORE_API void NormalizeSafe(Vector3Soa inout, size_t count, float tolerance);
+
+        //! results[i] = aabb.Overlaps(aabbs[i]) ? 1 : 0. Returns the number of overlapping aabbs.
+        AZCORE_API size_t AabbOverlaps(const Aabb& aabb, ConstAabbSoa aabbs, u8* results, size_t count);
+
+        //! results[i] = 1 when the sphere is not fully outside of the frustum, i.e. Frustum::IntersectSphere doesn't return
+        //! IntersectResult::Exterior, 0 otherwise. Returns the number of visible spheres.
+        AZCORE_API size_t FrustumCullSpheres(
+            const Frustum& frustum, ConstVector3Soa centers, const float* radii, u8* results, size_t count);
+        //! results[i] = 1 when the aabb is not fully outside of the frustum, i.e. Frustum::IntersectAabb doesn't return
+        //! IntersectResult::Exterior, 0 otherwise. Returns the number of visible aabbs.
+        AZCORE_API size_t FrustumCullAabbs(const Frustum& frustum, ConstAabbSoa aabbs, u8* results, size_t count);
+    } // namespace Simd::Batch
+} // namespace AZ
@@ -21,6 +21,7 @@
 
 #include <AzCore/Platform.h>
 
+#include <AzCore/std/algorithm.h>
 #include <AzCore/std/parallel/lock.h>
 #include <AzCore/std/containers/array.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
@@ -34,6 +35,24 @@ namespace AZ
     }
     AZ_CONSOLEFREEFUNC(sys_DumpAllocators, AZ::ConsoleFunctorFlags::Null, "Print memory allocator statistics.");
 
+    static void OnOSPageHugePagesChanged(const int& hugePages)
+    {
+        OSPageAllocatorConfig config = AllocatorManager::Instance().GetOSPageAllocatorConfig();
+        config.m_hugePages = static_cast<OSPageAllocatorConfig::HugePages>(AZStd::clamp(hugePages, 0, 2));
+        AllocatorManager::Instance().SetOSPageAllocatorConfig(config);
+    }
+    AZ_CVAR(int, sys_osPageHugePages, 0, OnOSPageHugePagesChanged, AZ::ConsoleFunctorFlags::Null,
+        "Back the pages of the system allocator with huge pages. 0: disabled, 1: transparent huge pages, 2: hugetlbfs pool.");
+
+    static void OnOSPageNumaLocalChanged(const bool& numaLocal)
+    {
+        OSPageAllocatorConfig config = AllocatorManager::Instance().GetOSPageAllocatorConfig();
+        config.m_numaLocal = numaLocal;
+        AllocatorManager::Instance().SetOSPageAllocatorConfig(config);
+    }
+    AZ_CVAR(bool, sys_osPageNumaLocal, false, OnOSPageNumaLocalChanged, AZ::ConsoleFunctorFlags::Null,
+        "Bind the pages of the system allocator to the NUMA node of the thread that requests them.");
+
     // Provides a range of allocations to dump. The min value is inclusive and the max value is exclusive
     // Therefore the range is [min, max)
     struct AllocationDumpRange
@@ -729,7 +748,7 @@ namespace AZ
 
         memset(m_dumpInfo, 0, sizeof(m_dumpInfo));
 
-        AZ_Printf(AZ::Debug::NoWindow, "Index,Name,Used KiB,Reserved KiB,Consumed KiB,Parent Allocator\n");
+        AZ_Printf(AZ::Debug::NoWindow, "Index,Name,Used KiB,Reserved KiB,Consumed KiB,Peak KiB,Parent Allocator\n");
 
         for (int i = 0; i < m_numAllocators; i++)
         {
@@ -738,6 +757,7 @@ namespace AZ
             size_t usedBytes = allocator->NumAllocatedBytes();
             size_t reservedBytes = allocator->Capacity();
             size_t consumedBytes = reservedBytes;
+            size_t highWaterBytes = AZStd::max(allocator->GetAllocatedBytesHighWaterMark(), usedBytes);
             const char* parentName = "";
             if (auto childAllocatorSchema = azrtti_cast<AZ::ChildAllocatorSchemaBase*>(allocator);
                 childAllocatorSchema != nullptr)
@@ -755,18 +775,43 @@ namespace AZ
             m_dumpInfo[i].m_consumed = consumedBytes;
             AZ_Printf(
                 AZ::Debug::NoWindow,
-                "%d,%s,%.2f,%.2f,%.2f,%s\n",
+                "%d,%s,%.2f,%.2f,%.2f,%.2f,%s\n",
                 i,
                 name,
                 usedBytes / 1024.0f,
                 reservedBytes / 1024.0f,
                 consumedBytes / 1024.0f,
+                highWaterBytes / 1024.0f,
                 parentName);
         }
 
-        AZ_Printf(AZ::Debug::NoWindow, "-,Totals,%.2f,%.2f,%.2f,\n", totalUsedBytes / 1024.0f, totalReservedBytes / 1024.0f, totalConsumedBytes / 1024.0f);
+        AZ_Printf(AZ::Debug::NoWindow, "-,Totals,%.2f,%.2f,%.2f,-,\n", totalUsedBytes / 1024.0f, totalReservedBytes / 1024.0f, totalConsumedBytes / 1024.0f);
         AZ_Printf(AZ::Debug::NoWindow, "%d allocators active\n", m_numAllocators);
+
+        const OSPageAllocatorStats pageStats = GetOSPageAllocatorStats();
+        AZ_Printf(AZ::Debug::NoWindow, "OS pages: %zu arenas, %.2f KiB reserved, %.2f KiB allocated, %.2f KiB NUMA local, %.1f%% arena hit rate\n",
+            pageStats.m_arenaCount, pageStats.m_reservedBytes / 1024.0f, pageStats.m_allocatedBytes / 1024.0f,
+            pageStats.m_numaLocalBytes / 1024.0f, pageStats.GetArenaHitRate() * 100.0f);
+        AZ_Printf(AZ::Debug::NoWindow, "OS pages: %llu minor page faults, %llu major page faults, %.2f KiB in huge pages\n",
+            static_cast<unsigned long long>(pageStats.m_minorPageFaults), static_cast<unsigned long long>(pageStats.m_majorPageFaults),
+            pageStats.m_hugePageBytes / 1024.0f);
     }
+
+    void AllocatorManager::SetOSPageAllocatorConfig(const OSPageAllocatorConfig& config)
+    {
+        OSPageAllocator::SetConfig(config);
+    }
+
+    OSPageAllocatorConfig AllocatorManager::GetOSPageAllocatorConfig() const
+    {
+        return OSPageAllocator::GetConfig();
+    }
+
+    OSPageAllocatorStats AllocatorManager::GetOSPageAllocatorStats() const
+    {
+        return OSPageAllocator::GetStats();
+    }
+
     void AllocatorManager::GetAllocatorStats(size_t& allocatedBytes, size_t& capacityBytes, AZStd::vector<AllocatorStats>* outStats)
     {
         allocatedBytes = 0;
@@ -790,7 +835,9 @@ namespace AZ
                     auto parentAllocator = childAllocatorSchema->GetParentAllocator();
                     parentName = parentAllocator != nullptr ? parentAllocator->GetName() : "";
                 }
-                outStats->emplace(outStats->end(), allocator->GetName(), parentName, allocator->NumAllocatedBytes(), allocator->Capacity());
+                const size_t allocatorBytes = allocator->NumAllocatedBytes();
+                const size_t highWaterBytes = AZStd::max(allocator->GetAllocatedBytesHighWaterMark(), allocatorBytes);
+                outStats->emplace(outStats->end(), allocator->GetName(), parentName, allocatorBytes, allocator->Capacity(), highWaterBytes);
             }
         }
     }
@@ -9,6 +9,7 @@
 
 #include <AzCore/base.h>
 #include <AzCore/Memory/AllocationRecords.h>
+#include <AzCore/Memory/OSPageAllocator.h>
 #include <AzCore/std/algorithm.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/string/string.h>
@@ -96,6 +97,13 @@ namespace AZ
         void SetTrackingForAllocator(AZStd::string_view allocatorName, AZ::Debug::AllocationRecords::Mode recordMode);
         bool RemoveTrackingForAllocator(AZStd::string_view allocatorName);
 
+        /// Configures how the HphaSchema gets pages from the OS, e.g. huge page arenas bound to the local NUMA node.
+        /// Only pages that are requested after this call use the new configuration, so it's best set before the allocators grow.
+        void SetOSPageAllocatorConfig(const OSPageAllocatorConfig& config);
+        OSPageAllocatorConfig GetOSPageAllocatorConfig() const;
+        /// Returns the arena usage, hit rate, page fault counts and huge page usage of the OS page allocator.
+        OSPageAllocatorStats GetOSPageAllocatorStats() const;
+
         struct DumpInfo
         {
             // Must contain only POD types
@@ -107,17 +115,20 @@ namespace AZ
 
         struct AllocatorStats
         {
-            AllocatorStats(const char* name, const char* parentName, size_t allocatedBytes, size_t capacityBytes)
+            AllocatorStats(const char* name, const char* parentName, size_t allocatedBytes, size_t capacityBytes, size_t highWaterBytes = 0)
                 : m_name(name)
                 , m_parentName(parentName)
                 , m_allocatedBytes(allocatedBytes)
                 , m_capacityBytes(capacityBytes)
+                , m_highWaterBytes(highWaterBytes)
             {}
 
             AZStd::string m_name;
             AZStd::string m_parentName;
             size_t m_allocatedBytes;
             size_t m_capacityBytes;
+            //! Highest number of allocated bytes, for allocators that track it. Otherwise the same as m_allocatedBytes.
+            size_t m_highWaterBytes;
         };
 
         void GetAllocatorStats(size_t& usedBytes, size_t& reservedBytes, AZStd::vector<AllocatorStats>* outStats = nullptr);
@@ -0,0 +1,527 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Memory/FrameArenaAllocator.h>
+
+#include <AzCore/Memory/OSPageAllocator.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/thread.h>
+
+namespace AZ
+{
+    namespace FrameArenaAllocatorInternal
+    {
+        // Memory released by a frame reset is overwritten with this value in debug builds
+        static constexpr int ReleasedMemoryMarkValue = 0xfa;
+
+        // Unique id of each allocator instance, so a thread's cached arena is never used with another allocator
+        // that was created at the address of a destroyed one
+        static AZStd::atomic<u64> s_nextInstanceId{ 1 };
+
+        struct ThreadArenaCache
+        {
+            const FrameArenaAllocator* m_allocator = nullptr;
+            u64 m_instanceId = 0;
+            void* m_arena = nullptr;
+        };
+
+        // The arena of the last FrameArenaAllocator the thread used, which is almost always the AllocatorInstance
+        static thread_local ThreadArenaCache t_threadArenaCache;
+
+        static char* AlignPointerUp(char* ptr, size_t alignment)
+        {
+            return reinterpret_cast<char*>(AZ_SIZE_ALIGN_UP(reinterpret_cast<uintptr_t>(ptr), alignment));
+        }
+    } // namespace FrameArenaAllocatorInternal
+
+    //! Stored in front of every allocation.
+    struct FrameArenaAllocator::AllocationHeader
+    {
+        u64 m_byteSize;
+        //! Frame the allocation was made in, used to detect memory that is used after its frame ended.
+        u32 m_frameIndex;
+        //! Offset from the start of the SystemAllocator block for allocations over the thread frame budget, 0 otherwise.
+        u32 m_fallbackOffset;
+    };
+
+    //! Pages and bump pointer of a single thread. Only the owning thread allocates from it, the allocator reads the
+    //! statistics. The arena lives at the start of its first page, which is kept until the allocator is destroyed.
+    struct FrameArenaAllocator::ThreadArena
+    {
+        struct Page
+        {
+            Page* m_next;
+            size_t m_size;
+        };
+
+        //! Allocation that is too large for a page, released when the arena starts a new frame.
+        struct LargeBlock
+        {
+            LargeBlock* m_next;
+            size_t m_size;
+        };
+
+        static constexpr size_t PageHeaderSize = AZ_SIZE_ALIGN_UP(sizeof(Page), alignof(AllocationHeader));
+        static constexpr size_t LargeBlockHeaderSize = AZ_SIZE_ALIGN_UP(sizeof(LargeBlock), alignof(AllocationHeader));
+        static constexpr size_t AllocatedPageSize = AZ_SIZE_ALIGN_UP(PageSize, AZ_PAGE_SIZE);
+
+        ThreadArena(Page* firstPage, AZStd::thread_id threadId, u32 frameIndex, u32 garbageCollectIndex)
+            : m_threadId(threadId)
+            , m_firstPage(firstPage)
+            , m_garbageCollectIndex(garbageCollectIndex)
+            , m_frameIndex(frameIndex)
+        {
+            Rewind();
+        }
+
+        char* GetPageBegin(Page* page) const
+        {
+            if (page == m_firstPage)
+            {
+                // the arena itself is stored in the first page
+                return reinterpret_cast<char*>(page) + AZ_SIZE_ALIGN_UP(PageHeaderSize + sizeof(ThreadArena), alignof(AllocationHeader));
+            }
+            return reinterpret_cast<char*>(page) + PageHeaderSize;
+        }
+
+        char* GetPageEnd(Page* page) const
+        {
+            return reinterpret_cast<char*>(page) + page->m_size;
+        }
+
+        void Rewind()
+        {
+            m_currentPage = m_firstPage;
+            m_cursor = GetPageBegin(m_firstPage);
+            m_end = GetPageEnd(m_firstPage);
+            m_lastAllocation = nullptr;
+            m_lastAllocationStart = nullptr;
+            m_usedBytes.store(0, AZStd::memory_order_relaxed);
+        }
+
+        //! Releases the memory of the previous frame.
+        void BeginFrame(u32 frameIndex, u32 garbageCollectIndex)
+        {
+            ReleaseLargeBlocks();
+
+#if defined(AZ_DEBUG_BUILD)
+            for (Page* page = m_firstPage; page; page = page->m_next)
+            {
+                char* end = page == m_currentPage ? m_cursor : GetPageEnd(page);
+                memset(GetPageBegin(page), FrameArenaAllocatorInternal::ReleasedMemoryMarkValue, end - GetPageBegin(page));
+                if (page == m_currentPage)
+                {
+                    break;
+                }
+            }
+#endif
+
+            if (m_garbageCollectIndex != garbageCollectIndex)
+            {
+                ReleasePages(m_firstPage->m_next);
+                m_firstPage->m_next = nullptr;
+                m_garbageCollectIndex = garbageCollectIndex;
+            }
+
+            Rewind();
+            m_frameIndex.store(frameIndex, AZStd::memory_order_relaxed);
+        }
+
+        //! Returns the address of the allocation, with room for the AllocationHeader in front of it, or nullptr if the
+        //! pages are out of memory.
+        char* Allocate(size_t byteSize, size_t alignment)
+        {
+            using namespace FrameArenaAllocatorInternal;
+
+            for (;;)
+            {
+                char* address = AlignPointerUp(m_cursor + sizeof(AllocationHeader), alignment);
+                if (address + byteSize <= m_end)
+                {
+                    m_usedBytes.store(
+                        m_usedBytes.load(AZStd::memory_order_relaxed) + (address + byteSize - m_cursor), AZStd::memory_order_relaxed);
+                    m_lastAllocationStart = m_cursor;
+                    m_lastAllocation = address;
+                    m_cursor = address + byteSize;
+                    return address;
+                }
+
+                // Move on to the next page, the remainder of the current one is wasted for this frame
+                if (!m_currentPage->m_next)
+                {
+                    Page* page = static_cast<Page*>(OSPageAllocator::Allocate(AllocatedPageSize, AZ_PAGE_SIZE));
+                    if (!page)
+                    {
+                        return nullptr;
+                    }
+                    page->m_next = nullptr;
+                    page->m_size = AllocatedPageSize;
+                    m_currentPage->m_next = page;
+                }
+                m_currentPage = m_currentPage->m_next;
+                m_cursor = GetPageBegin(m_currentPage);
+                m_end = GetPageEnd(m_currentPage);
+                m_lastAllocation = nullptr;
+                m_lastAllocationStart = nullptr;
+            }
+        }
+
+        //! Allocates a dedicated block for a single allocation.
+        char* AllocateLarge(size_t byteSize, size_t alignment)
+        {
+            using namespace FrameArenaAllocatorInternal;
+
+            const size_t blockSize = AZ_SIZE_ALIGN_UP(LargeBlockHeaderSize + sizeof(AllocationHeader) + alignment + byteSize, AZ_PAGE_SIZE);
+            LargeBlock* block = static_cast<LargeBlock*>(OSPageAllocator::Allocate(blockSize, AZ_PAGE_SIZE));
+            if (!block)
+            {
+                return nullptr;
+            }
+            block->m_next = m_largeBlocks;
+            block->m_size = blockSize;
+            m_largeBlocks = block;
+
+            m_usedBytes.store(m_usedBytes.load(AZStd::memory_order_relaxed) + blockSize, AZStd::memory_order_relaxed);
+            return AlignPointerUp(reinterpret_cast<char*>(block) + LargeBlockHeaderSize + sizeof(AllocationHeader), alignment);
+        }
+
+        //! Returns the memory of the last allocation to the page, if address is the last allocation.
+        bool TryRewind(char* address)
+        {
+            if (address != m_lastAllocation)
+            {
+                return false;
+            }
+            m_usedBytes.store(m_usedBytes.load(AZStd::memory_order_relaxed) - (m_cursor - m_lastAllocationStart), AZStd::memory_order_relaxed);
+            m_cursor = m_lastAllocationStart;
+            m_lastAllocation = nullptr;
+            m_lastAllocationStart = nullptr;
+            return true;
+        }
+
+        //! Grows or shrinks the last allocation in place, if address is the last allocation and the page has room.
+        bool TryResize(char* address, size_t newSize)
+        {
+            if (address != m_lastAllocation || address + newSize > m_end)
+            {
+                return false;
+            }
+            char* newCursor = address + newSize;
+            m_usedBytes.store(m_usedBytes.load(AZStd::memory_order_relaxed) + (newCursor - m_cursor), AZStd::memory_order_relaxed);
+            m_cursor = newCursor;
+            return true;
+        }
+
+        void ReleaseLargeBlocks()
+        {
+            while (m_largeBlocks)
+            {
+                LargeBlock* next = m_largeBlocks->m_next;
+                OSPageAllocator::Free(m_largeBlocks, m_largeBlocks->m_size);
+                m_largeBlocks = next;
+            }
+        }
+
+        static void ReleasePages(Page* page)
+        {
+            while (page)
+            {
+                Page* next = page->m_next;
+                OSPageAllocator::Free(page, page->m_size);
+                page = next;
+            }
+        }
+
+        ThreadArena* m_next = nullptr;
+        AZStd::thread_id m_threadId;
+
+        Page* m_firstPage;
+        Page* m_currentPage = nullptr;
+        char* m_cursor = nullptr;
+        char* m_end = nullptr;
+        // Start and end of the last allocation, so it can be rewound or resized in place
+        char* m_lastAllocationStart = nullptr;
+        char* m_lastAllocation = nullptr;
+        LargeBlock* m_largeBlocks = nullptr;
+        u32 m_garbageCollectIndex;
+
+        // Read by other threads for statistics
+        AZStd::atomic<u32> m_frameIndex;
+        AZStd::atomic<size_t> m_usedBytes{ 0 };
+    };
+
+    AZ_TYPE_INFO_WITH_NAME_IMPL(FrameArenaAllocator, "FrameArenaAllocator", "{3E1C6C1B-8F4B-4B8E-9D0A-6C1E5B7F2A43}");
+    AZ_RTTI_NO_TYPE_INFO_IMPL(FrameArenaAllocator, AllocatorBase);
+
+    FrameArenaAllocator::FrameArenaAllocator()
+        : m_instanceId(FrameArenaAllocatorInternal::s_nextInstanceId++)
+    {
+        AllocatorInstance<SystemAllocator>::Get();
+        PostCreate();
+    }
+
+    FrameArenaAllocator::~FrameArenaAllocator()
+    {
+        PreDestroy();
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_arenasMutex);
+        while (m_arenas)
+        {
+            ThreadArena* arena = m_arenas;
+            m_arenas = arena->m_next;
+
+            ThreadArena::Page* firstPage = arena->m_firstPage;
+            arena->ReleaseLargeBlocks();
+            ThreadArena::ReleasePages(firstPage->m_next);
+            arena->~ThreadArena();
+            OSPageAllocator::Free(firstPage, firstPage->m_size);
+        }
+    }
+
+    AllocatorDebugConfig FrameArenaAllocator::GetDebugConfig()
+    {
+        // Allocations are released in bulk by ResetFrame, individual records would all be reported as leaks
+        return AllocatorDebugConfig().ExcludeFromDebugging();
+    }
+
+    void FrameArenaAllocator::ResetFrame()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_arenasMutex);
+
+        // Threads release their pages the next time they allocate, only the statistics are updated here
+        const u32 frameIndex = m_frameIndex.load(AZStd::memory_order_relaxed);
+        size_type frameBytes = 0;
+        for (const ThreadArena* arena = m_arenas; arena; arena = arena->m_next)
+        {
+            if (arena->m_frameIndex.load(AZStd::memory_order_relaxed) == frameIndex)
+            {
+                frameBytes += arena->m_usedBytes.load(AZStd::memory_order_relaxed);
+            }
+        }
+
+        if (frameBytes > m_highWaterBytes.load(AZStd::memory_order_relaxed))
+        {
+            m_highWaterBytes.store(frameBytes, AZStd::memory_order_relaxed);
+        }
+
+        m_frameIndex.store(frameIndex + 1, AZStd::memory_order_release);
+    }
+
+    u32 FrameArenaAllocator::GetFrameIndex() const
+    {
+        return m_frameIndex.load(AZStd::memory_order_acquire);
+    }
+
+    void FrameArenaAllocator::SetThreadFrameBudget(size_type budget)
+    {
+        m_threadFrameBudget.store(budget, AZStd::memory_order_relaxed);
+    }
+
+    auto FrameArenaAllocator::FindThreadArena() const -> ThreadArena*
+    {
+        using namespace FrameArenaAllocatorInternal;
+        if (t_threadArenaCache.m_allocator == this && t_threadArenaCache.m_instanceId == m_instanceId)
+        {
+            return static_cast<ThreadArena*>(t_threadArenaCache.m_arena);
+        }
+        return nullptr;
+    }
+
+    auto FrameArenaAllocator::GetThreadArena() -> ThreadArena&
+    {
+        using namespace FrameArenaAllocatorInternal;
+
+        ThreadArena* arena = FindThreadArena();
+        if (!arena)
+        {
+            const AZStd::thread_id threadId = AZStd::this_thread::get_id();
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_arenasMutex);
+            for (arena = m_arenas; arena; arena = arena->m_next)
+            {
+                if (arena->m_threadId == threadId)
+                {
+                    break;
+                }
+            }
+
+            if (!arena)
+            {
+                void* firstPage = OSPageAllocator::Allocate(ThreadArena::AllocatedPageSize, AZ_PAGE_SIZE);
+                AZ_Assert(firstPage, "FrameArenaAllocator: Failed to allocate the first page of a thread arena");
+                ThreadArena::Page* page = static_cast<ThreadArena::Page*>(firstPage);
+                page->m_next = nullptr;
+                page->m_size = ThreadArena::AllocatedPageSize;
+
+                arena = new (reinterpret_cast<char*>(page) + ThreadArena::PageHeaderSize) ThreadArena(
+                    page, threadId, m_frameIndex.load(AZStd::memory_order_acquire), m_garbageCollectIndex.load(AZStd::memory_order_relaxed));
+                arena->m_next = m_arenas;
+                m_arenas = arena;
+            }
+
+            t_threadArenaCache.m_allocator = this;
+            t_threadArenaCache.m_instanceId = m_instanceId;
+            t_threadArenaCache.m_arena = arena;
+        }
+
+        // The first allocation of a new frame releases the memory of the previous one
+        const u32 frameIndex = m_frameIndex.load(AZStd::memory_order_acquire);
+        if (arena->m_frameIndex.load(AZStd::memory_order_relaxed) != frameIndex)
+        {
+            arena->BeginFrame(frameIndex, m_garbageCollectIndex.load(AZStd::memory_order_relaxed));
+        }
+        return *arena;
+    }
+
+    AllocateAddress FrameArenaAllocator::allocate(size_type byteSize, align_type alignment)
+    {
+        if (byteSize == 0)
+        {
+            return AllocateAddress{};
+        }
+
+        AZ_Assert((alignment & (alignment - 1)) == 0, "Alignment must be power of 2!");
+        alignment = AZStd::max<align_type>(alignment, alignof(AllocationHeader));
+
+        ThreadArena& arena = GetThreadArena();
+        const u32 frameIndex = arena.m_frameIndex.load(AZStd::memory_order_relaxed);
+
+        char* address = nullptr;
+        if (arena.m_usedBytes.load(AZStd::memory_order_relaxed) + byteSize <= m_threadFrameBudget.load(AZStd::memory_order_relaxed))
+        {
+            if (byteSize + alignment + sizeof(AllocationHeader) > PageSize / 4)
+            {
+                address = arena.AllocateLarge(byteSize, alignment);
+            }
+            else
+            {
+                address = arena.Allocate(byteSize, alignment);
+            }
+        }
+
+        u32 fallbackOffset = 0;
+        if (!address)
+        {
+            // Over budget or out of pages, use a regular allocation that deallocate returns to the SystemAllocator
+            AZ_WarningOnce("FrameArenaAllocator", false,
+                "A thread exceeded the frame budget of %zu bytes or ran out of pages, is FrameArenaAllocator::ResetFrame being called? "
+                "Allocations fall back to the SystemAllocator.", m_threadFrameBudget.load(AZStd::memory_order_relaxed));
+
+            const size_type headerSize = AZ_SIZE_ALIGN_UP(sizeof(AllocationHeader), alignment);
+            char* block = static_cast<char*>(AllocatorInstance<SystemAllocator>::Get().allocate(headerSize + byteSize, alignment));
+            if (!block)
+            {
+                return AllocateAddress{};
+            }
+            address = block + headerSize;
+            fallbackOffset = static_cast<u32>(headerSize);
+        }
+
+        AllocationHeader* header = reinterpret_cast<AllocationHeader*>(address) - 1;
+        header->m_byteSize = byteSize;
+        header->m_frameIndex = frameIndex;
+        header->m_fallbackOffset = fallbackOffset;
+        return AllocateAddress(address, byteSize);
+    }
+
+    auto FrameArenaAllocator::deallocate(pointer ptr, [[maybe_unused]] size_type byteSize, [[maybe_unused]] align_type alignment) -> size_type
+    {
+        if (!ptr)
+        {
+            return 0;
+        }
+
+        const AllocationHeader* header = static_cast<const AllocationHeader*>(ptr) - 1;
+        AZ_Assert(header->m_frameIndex == GetFrameIndex(),
+            "FrameArenaAllocator: Memory allocated in frame %u was deallocated in frame %u. Frame allocations must not outlive their frame.",
+            header->m_frameIndex, GetFrameIndex());
+
+        const size_type allocatedSize = header->m_byteSize;
+        if (header->m_fallbackOffset != 0)
+        {
+            AllocatorInstance<SystemAllocator>::Get().deallocate(static_cast<char*>(ptr) - header->m_fallbackOffset);
+        }
+        else if (ThreadArena* arena = FindThreadArena())
+        {
+            // The memory is released by the next frame reset, but temporaries that are freed in the reverse order they
+            // were allocated in can reuse it right away
+            arena->TryRewind(static_cast<char*>(ptr));
+        }
+        return allocatedSize;
+    }
+
+    AllocateAddress FrameArenaAllocator::reallocate(pointer ptr, size_type newSize, align_type newAlignment)
+    {
+        if (!ptr)
+        {
+            return allocate(newSize, newAlignment);
+        }
+        if (newSize == 0)
+        {
+            deallocate(ptr);
+            return AllocateAddress{};
+        }
+
+        AllocationHeader* header = static_cast<AllocationHeader*>(ptr) - 1;
+        AZ_Assert(header->m_frameIndex == GetFrameIndex(),
+            "FrameArenaAllocator: Memory allocated in frame %u was reallocated in frame %u. Frame allocations must not outlive their frame.",
+            header->m_frameIndex, GetFrameIndex());
+
+        if (header->m_fallbackOffset == 0)
+        {
+            ThreadArena* arena = FindThreadArena();
+            if (arena && arena->TryResize(static_cast<char*>(ptr), newSize))
+            {
+                header->m_byteSize = newSize;
+                return AllocateAddress(ptr, newSize);
+            }
+        }
+
+        const size_type oldSize = header->m_byteSize;
+        AllocateAddress newAddress = allocate(newSize, newAlignment);
+        if (newAddress)
+        {
+            memcpy(newAddress.GetAddress(), ptr, AZStd::min(oldSize, newSize));
+            deallocate(ptr);
+        }
+        return newAddress;
+    }
+
+    auto FrameArenaAllocator::get_allocated_size(pointer ptr, [[maybe_unused]] align_type alignment) const -> size_type
+    {
+        return ptr ? static_cast<const AllocationHeader*>(ptr)[-1].m_byteSize : 0;
+    }
+
+    void FrameArenaAllocator::GarbageCollect()
+    {
+        m_garbageCollectIndex.fetch_add(1, AZStd::memory_order_relaxed);
+    }
+
+    auto FrameArenaAllocator::NumAllocatedBytes() const -> size_type
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_arenasMutex);
+
+        const u32 frameIndex = m_frameIndex.load(AZStd::memory_order_relaxed);
+        size_type allocatedBytes = 0;
+        for (const ThreadArena* arena = m_arenas; arena; arena = arena->m_next)
+        {
+            if (arena->m_frameIndex.load(AZStd::memory_order_relaxed) == frameIndex)
+            {
+                allocatedBytes += arena->m_usedBytes.load(AZStd::memory_order_relaxed);
+            }
+        }
+        return allocatedBytes;
+    }
+
+    auto FrameArenaAllocator::GetAllocatedBytesHighWaterMark() const -> size_type
+    {
+        return AZStd::max(m_highWaterBytes.load(AZStd::memory_order_relaxed), NumAllocatedBytes());
+    }
+} // namespace AZ
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Memory/AllocatorBase.h>
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace AZ
+{
+    /**
+     * Frame arena allocator
+     * Linear allocator for temporaries that only live for a single frame, like culling work lists and draw lists.
+     * Every thread bump allocates from its own pages, so allocating doesn't take any locks and deallocating is (almost) free.
+     * All memory is released wholesale by ResetFrame, which the ComponentApplication calls at the start of each tick.
+     * Pages are kept between frames, so after the first few frames no memory is requested from the OS.
+     *
+     * IMPORTANT: memory from this allocator must not be used after the frame it was allocated in. Containers using it
+     * have to be destroyed, or emptied with set_capacity(0)/leak_and_reset(), before the next call to ResetFrame.
+     * Debug builds assert when an allocation from a previous frame is deallocated or reallocated, and overwrite
+     * released memory with a fill pattern.
+     *
+     * Usage: AZStd::vector<T, AZ::AZStdAlloc<AZ::FrameArenaAllocator>>
+     */
+    class AZCORE_API FrameArenaAllocator
+        : public AllocatorBase
+    {
+    public:
+        AZ_TYPE_INFO_WITH_NAME_DECL_API(AZCORE_API, FrameArenaAllocator);
+        AZ_RTTI_NO_TYPE_INFO_DECL();
+
+        //! Size of the pages the threads allocate from. Larger allocations get a dedicated block that is released on reset.
+        static constexpr size_type PageSize = 64 * 1024;
+        //! When a thread allocates more than this in a single frame, further allocations fall back to the SystemAllocator.
+        //! This bounds the memory use of applications that never call ResetFrame.
+        static constexpr size_type DefaultThreadFrameBudget = 256 * 1024 * 1024;
+
+        FrameArenaAllocator();
+        ~FrameArenaAllocator() override;
+
+        //! Releases all allocations of the current frame, on all threads, and starts a new frame.
+        //! Must be called from a sync point where no other thread is using memory from this allocator.
+        void ResetFrame();
+
+        //! Returns the number of times ResetFrame has been called.
+        u32 GetFrameIndex() const;
+
+        void SetThreadFrameBudget(size_type budget);
+
+        //////////////////////////////////////////////////////////////////////////
+        // IAllocator
+        AllocateAddress allocate(size_type byteSize, align_type alignment) override;
+        size_type deallocate(pointer ptr, size_type byteSize = 0, align_type alignment = 0) override;
+        AllocateAddress reallocate(pointer ptr, size_type newSize, align_type newAlignment) override;
+        size_type get_allocated_size(pointer ptr, align_type alignment = 1) const override;
+        //! Releases the pages that are not in use. Threads release their pages the next time they allocate in a new frame.
+        void GarbageCollect() override;
+
+        size_type NumAllocatedBytes() const override;
+        size_type GetAllocatedBytesHighWaterMark() const override;
+        AllocatorDebugConfig GetDebugConfig() override;
+        //////////////////////////////////////////////////////////////////////////
+
+        AZ_DISABLE_COPY_MOVE(FrameArenaAllocator);
+
+    private:
+        struct ThreadArena;
+        struct AllocationHeader;
+
+        ThreadArena& GetThreadArena();
+        ThreadArena* FindThreadArena() const;
+
+        // Singly linked list of the arenas of all threads that allocated from this allocator, only appended to
+        ThreadArena* m_arenas = nullptr;
+        mutable AZStd::mutex m_arenasMutex;
+
+        const u64 m_instanceId;
+        AZStd::atomic<u32> m_frameIndex{ 0 };
+        AZStd::atomic<u32> m_garbageCollectIndex{ 0 };
+        AZStd::atomic<size_type> m_threadFrameBudget{ DefaultThreadFrameBudget };
+        AZStd::atomic<size_type> m_highWaterBytes{ 0 };
+    };
+    AZ_TYPE_INFO_WITH_NAME_DECL_EXT_API(AZCORE_API, FrameArenaAllocator);
+
+    typedef AZStdAlloc<FrameArenaAllocator> FrameArenaStdAllocator;
+} // namespace AZ
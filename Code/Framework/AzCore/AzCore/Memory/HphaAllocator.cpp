@@ -12,6 +12,7 @@
 
 #include <AzCore/Math/Random.h>
 #include <AzCore/Memory/OSAllocator.h> // required by certain platforms
+#include <AzCore/Memory/OSPageAllocator.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/parallel/lock.h>
 #include <AzCore/std/containers/intrusive_list.h>
@@ -953,7 +954,7 @@ namespace AZ
         size_t  GetUnAllocatedMemory(bool isPrint) const;
 
         void*   SystemAlloc(size_t size, size_t align);
-        void    SystemFree(void* ptr);
+        void    SystemFree(void* ptr, size_t size);
 
         const size_t m_treePageSize;
         const size_t m_treePageAlignment;
@@ -1182,7 +1183,7 @@ namespace AZ
     void HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::bucket_system_free(void* ptr)
     {
         HPPA_ASSERT(ptr);
-        SystemFree(ptr);
+        SystemFree(ptr, m_poolPageSize);
         mTotalCapacitySizeBuckets -= m_poolPageSize;
     }
 
@@ -1489,11 +1490,10 @@ namespace AZ
     void HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::tree_system_free(void* ptr, size_t size)
     {
         HPPA_ASSERT(ptr);
-        (void)size;
 
         size_t allocSize = AZ::SizeAlignUp(size, OS_VIRTUAL_PAGE_SIZE);
         mTotalCapacitySizeTree -= allocSize;
-        SystemFree(ptr);
+        SystemFree(ptr, size);
     }
 
     template<bool DebugAllocatorEnable>
@@ -2268,7 +2268,7 @@ namespace AZ
     void* HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::SystemAlloc(size_t size, size_t align)
     {
         AZ_Assert(align % OS_VIRTUAL_PAGE_SIZE == 0, "Invalid allocation/page alignment %d should be a multiple of %d!", size, OS_VIRTUAL_PAGE_SIZE);
-        return AZ_OS_MALLOC(size, align);
+        return OSPageAllocator::Allocate(size, align);
     }
 
     //=========================================================================
@@ -2276,9 +2276,9 @@ namespace AZ
     // [2/22/2011]
     //=========================================================================
     template<bool DebugAllocatorEnable>
-    void HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::SystemFree(void* ptr)
+    void HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::SystemFree(void* ptr, size_t size)
     {
-        AZ_OS_FREE(ptr);
+        OSPageAllocator::Free(ptr, size);
     }
 
     template<bool DebugAllocatorEnable>
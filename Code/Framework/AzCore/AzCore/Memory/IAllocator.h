@@ -218,6 +218,12 @@ namespace AZ
             return 0;
         }
 
+        /// Returns the highest value NumAllocatedBytes reached, or 0 if the allocator doesn't track it.
+        virtual size_type GetAllocatedBytesHighWaterMark() const
+        {
+            return 0;
+        }
+
         /// Returns the capacity of the Allocator in bytes. If the return value is 0 the Capacity is undefined (usually depends on another
         /// allocator)
         //AZ_DEPRECATED_MESSAGE("Use max_size instead, which matches the STD interface")
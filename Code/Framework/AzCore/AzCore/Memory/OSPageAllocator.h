@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/base.h>
+
+namespace AZ
+{
+    //! Controls how the OS page allocator gets memory from the OS.
+    //! Platforms that don't support an option fall back to regular aligned OS allocations.
+    struct OSPageAllocatorConfig
+    {
+        enum class HugePages : u8
+        {
+            Disabled,    //!< Use the default OS page size.
+            Transparent, //!< Reserve arenas aligned to huge pages and advise the OS to back them with transparent huge pages.
+            Explicit     //!< Reserve arenas from the OS huge page pool (hugetlbfs). Falls back to Transparent if the pool is exhausted.
+        };
+
+        HugePages m_hugePages = HugePages::Disabled;
+        //! Bind arenas to the NUMA node of the thread that first requests memory from them.
+        bool m_numaLocal = false;
+        //! Size of the address range reserved per arena. Rounded up to the huge page size.
+        //! Requests larger than half an arena bypass the arenas and go to the OS directly.
+        size_t m_arenaSize = 64 * 1024 * 1024;
+    };
+
+    //! Statistics of the OS page allocator.
+    struct OSPageAllocatorStats
+    {
+        size_t m_arenaCount = 0;
+        //! Address space reserved by the arenas.
+        size_t m_reservedBytes = 0;
+        //! Bytes handed out from the arenas.
+        size_t m_allocatedBytes = 0;
+        //! Bytes handed out from the arenas that are on the NUMA node of the thread that requested them.
+        size_t m_numaLocalBytes = 0;
+        //! Number of requests that were served from an existing arena.
+        u64 m_arenaHits = 0;
+        //! Number of requests that needed a new arena or were sent directly to the OS.
+        u64 m_arenaMisses = 0;
+        //! Process wide page fault counts, as reported by the OS.
+        u64 m_minorPageFaults = 0;
+        u64 m_majorPageFaults = 0;
+        //! Process wide amount of anonymous memory backed by huge pages, as reported by the OS.
+        size_t m_hugePageBytes = 0;
+
+        float GetArenaHitRate() const
+        {
+            const u64 total = m_arenaHits + m_arenaMisses;
+            return total > 0 ? static_cast<float>(m_arenaHits) / static_cast<float>(total) : 0.0f;
+        }
+    };
+
+    //! Page level allocator used by the HphaSchema to get memory from the OS.
+    //! Allocations are multiples of AZ_PAGE_SIZE. Depending on the configuration these are sub-allocated from large arenas
+    //! that are backed by huge pages and/or bound to a NUMA node, which reduces TLB pressure and remote memory traffic.
+    //! The configuration is owned by the AllocatorManager. Changing it only affects arenas that are reserved afterwards.
+    namespace OSPageAllocator
+    {
+        AZCORE_API void* Allocate(size_t byteSize, size_t alignment);
+        //! byteSize has to match the size that was passed to Allocate.
+        AZCORE_API void Free(void* ptr, size_t byteSize);
+
+        AZCORE_API void SetConfig(const OSPageAllocatorConfig& config);
+        AZCORE_API OSPageAllocatorConfig GetConfig();
+
+        AZCORE_API OSPageAllocatorStats GetStats();
+    } // namespace OSPageAllocator
+} // namespace AZ
@@ -380,6 +380,7 @@ namespace AZ
         ThreadPoolSchema::SetThreadPoolData m_threadPoolSetter;
 
         // Fox X64 we push/pop pages using the m_mutex to sync. Pages are
+        // first cached in the page magazine of each thread and only move to/from m_freePages in batches.
         using FreePagesType = Bucket::PageListType;
         FreePagesType m_freePages;
         AZStd::vector<ThreadPoolData*, AZStd::stateless_allocator> m_threads; ///< Array with all separate thread data. Used to traverse end free elements.
@@ -406,8 +407,18 @@ namespace AZ
             ThreadPoolSchemaImpl::Page::FakeNodeLF,
             AZStd::lock_free_intrusive_stack_base_hook<ThreadPoolSchemaImpl::Page::FakeNodeLF>>;
 
+        /**
+         * Magazine of empty pages cached by this thread. Pages freed by the thread are kept here and handed out again
+         * without taking the shared lock. Only when the magazine runs empty or overflows, pages are moved from/to the
+         * shared free page list in batches, so the lock is taken once every few page operations instead of every time.
+         */
+        static constexpr size_t PageMagazineCapacity = 8;
+        static constexpr size_t PageMagazineBatchSize = PageMagazineCapacity / 2;
+
         AllocatorType m_allocator;
         FreedElementsStack m_freedElements;
+        ThreadPoolSchemaImpl::Page* m_pageMagazine[PageMagazineCapacity] = {};
+        size_t m_pageMagazineSize = 0;
     };
 } // namespace AZ
 
@@ -1056,6 +1067,9 @@ namespace AZ
         AZStd::lock_guard<AZStd::recursive_mutex> lock(m_mutex);
         if (!m_threads.empty())
         {
+            /// reset the variable for the owner thread, pages released while destroying the thread data go to the shared list.
+            m_threadPoolSetter(nullptr);
+
             for (ThreadPoolData*& threadData : m_threads)
             {
                 if (threadData)
@@ -1068,8 +1082,12 @@ namespace AZ
                 }
             }
 
-            /// reset the variable for the owner thread.
-            m_threadPoolSetter(nullptr);
+            while (!m_freePages.empty())
+            {
+                Page* page = &m_freePages.front();
+                m_freePages.pop_front();
+                FreePage(page);
+            }
         }
     }
 
@@ -1163,26 +1181,28 @@ namespace AZ
     //=========================================================================
     AZ_INLINE ThreadPoolSchemaImpl::Page* ThreadPoolSchemaImpl::PopFreePage()
     {
-        Page* page;
+        // Pages are only requested by the allocator of the calling thread, so the thread data always exists here.
+        ThreadPoolData* threadData = m_threadPoolGetter();
+        if (threadData->m_pageMagazineSize == 0)
         {
+            // Refill the magazine with a batch of pages from the shared list
             AZStd::lock_guard<AZStd::recursive_mutex> lock(m_mutex);
-            if (m_freePages.empty())
-            {
-                page = nullptr;
-            }
-            else
+            while (threadData->m_pageMagazineSize < ThreadPoolData::PageMagazineBatchSize && !m_freePages.empty())
             {
-                page = &m_freePages.front();
+                threadData->m_pageMagazine[threadData->m_pageMagazineSize++] = &m_freePages.front();
                 m_freePages.pop_front();
             }
         }
-        if (page)
+
+        Page* page = nullptr;
+        if (threadData->m_pageMagazineSize > 0)
         {
+            page = threadData->m_pageMagazine[--threadData->m_pageMagazineSize];
 #ifdef AZ_DEBUG_BUILD
             AZ_Assert(page->m_threadData == 0, "If we stored the free page properly we should have null here!");
 #endif
             // store the current thread data, used when we free elements
-            page->m_threadData = m_threadPoolGetter();
+            page->m_threadData = threadData;
         }
         return page;
     }
@@ -1196,8 +1216,25 @@ namespace AZ
 #ifdef AZ_DEBUG_BUILD
         page->m_threadData = 0;
 #endif
+        // Pages can be released by threads that never allocated from this pool (e.g. during garbage collection),
+        // those go straight to the shared list.
+        ThreadPoolData* threadData = m_threadPoolGetter();
+        if (threadData && threadData->m_pageMagazineSize < ThreadPoolData::PageMagazineCapacity)
+        {
+            threadData->m_pageMagazine[threadData->m_pageMagazineSize++] = page;
+            return;
+        }
+
         {
             AZStd::lock_guard<AZStd::recursive_mutex> lock(m_mutex);
+            if (threadData)
+            {
+                // The magazine is full, return a batch of pages so the next frees don't immediately overflow again
+                while (threadData->m_pageMagazineSize > ThreadPoolData::PageMagazineCapacity - ThreadPoolData::PageMagazineBatchSize)
+                {
+                    m_freePages.push_front(*threadData->m_pageMagazine[--threadData->m_pageMagazineSize]);
+                }
+            }
             m_freePages.push_front(*page);
         }
     }
@@ -1220,6 +1257,14 @@ namespace AZ
                 threadData->m_allocator.GarbageCollect();
             }
         }
+        // Only the magazine of the calling thread can be emptied safely, other threads access theirs without locking.
+        if (ThreadPoolData* callerThreadData = m_threadPoolGetter(); callerThreadData)
+        {
+            while (callerThreadData->m_pageMagazineSize > 0)
+            {
+                m_freePages.push_front(*callerThreadData->m_pageMagazine[--callerThreadData->m_pageMagazineSize]);
+            }
+        }
         while (!m_freePages.empty())
         {
             Page* page = &m_freePages.front();
@@ -1266,6 +1311,12 @@ namespace AZ
         {
             m_allocator.DeAllocate(fakeLFNode);
         }
+
+        // release the cached empty pages
+        while (m_pageMagazineSize > 0)
+        {
+            m_allocator.m_allocator->FreePage(m_pageMagazine[--m_pageMagazineSize]);
+        }
     }
 
 } // namespace AZ
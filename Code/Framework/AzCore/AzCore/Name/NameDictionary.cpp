@@ -25,8 +25,129 @@ namespace AZ
         // Pointer which indicated that the NameDictonary associated with the AZ::Interface
         // was created by the Create function below
         static AZ::EnvironmentVariable<AZStd::unique_ptr<AZ::NameDictionary>> s_staticNameDictionary;
+
+        // Marks a lookup table slot whose name was removed. Lookups continue probing past it.
+        static Internal::NameData* const TombstoneNameData = reinterpret_cast<Internal::NameData*>(uintptr_t{ 1 });
     }
 
+    class NameDictionary::LookupTable
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(LookupTable, AZ::OSAllocator);
+
+        static constexpr size_t InitialCapacity = 1024;
+
+        explicit LookupTable(size_t capacity)
+            : m_slots(reinterpret_cast<AZStd::atomic<Internal::NameData*>*>(
+                  AZ::AllocatorInstance<AZ::OSAllocator>::Get().Allocate(sizeof(AZStd::atomic<Internal::NameData*>) * capacity,
+                      alignof(AZStd::atomic<Internal::NameData*>))))
+            , m_mask(capacity - 1)
+        {
+            AZ_Assert((capacity & m_mask) == 0, "Name lookup table capacity must be a power of two.");
+            for (size_t i = 0; i < capacity; ++i)
+            {
+                new (&m_slots[i]) AZStd::atomic<Internal::NameData*>(nullptr);
+            }
+        }
+
+        ~LookupTable()
+        {
+            AZ::AllocatorInstance<AZ::OSAllocator>::Get().DeAllocate(m_slots);
+        }
+
+        AZ_DISABLE_COPY_MOVE(LookupTable);
+
+        //! Can be called without locking, as long as the caller is in a read epoch
+        Internal::NameData* Find(Name::Hash hash) const
+        {
+            for (size_t index = hash & m_mask;; index = (index + 1) & m_mask)
+            {
+                Internal::NameData* nameData = m_slots[index].load(AZStd::memory_order_acquire);
+                if (nameData == nullptr)
+                {
+                    return nullptr;
+                }
+                if (nameData != NameDictionaryInternal::TombstoneNameData && nameData->GetHash() == hash)
+                {
+                    return nameData;
+                }
+            }
+        }
+
+        //! Returns false if the table needs to be rebuilt before the name data can be added
+        bool Insert(Internal::NameData* nameData)
+        {
+            // Keep the load, including tombstones, at or below 50% so lookups always hit an empty slot quickly
+            if ((m_usedSlotCount + 1) * 2 > Capacity())
+            {
+                return false;
+            }
+
+            for (size_t index = nameData->GetHash() & m_mask;; index = (index + 1) & m_mask)
+            {
+                Internal::NameData* current = m_slots[index].load(AZStd::memory_order_relaxed);
+                if (current == nullptr || current == NameDictionaryInternal::TombstoneNameData)
+                {
+                    m_usedSlotCount += current == nullptr ? 1 : 0;
+                    ++m_nameCount;
+                    m_slots[index].store(nameData, AZStd::memory_order_release);
+                    return true;
+                }
+            }
+        }
+
+        void Remove(Name::Hash hash)
+        {
+            for (size_t index = hash & m_mask;; index = (index + 1) & m_mask)
+            {
+                Internal::NameData* current = m_slots[index].load(AZStd::memory_order_relaxed);
+                if (current == nullptr)
+                {
+                    return;
+                }
+                if (current != NameDictionaryInternal::TombstoneNameData && current->GetHash() == hash)
+                {
+                    --m_nameCount;
+                    m_slots[index].store(NameDictionaryInternal::TombstoneNameData, AZStd::memory_order_release);
+                    return;
+                }
+            }
+        }
+
+        //! Creates a copy of this table without tombstones, sized to fit at least one more name
+        LookupTable* Rebuild() const
+        {
+            size_t capacity = InitialCapacity;
+            while ((m_nameCount + 1) * 4 > capacity)
+            {
+                capacity *= 2;
+            }
+
+            LookupTable* table = aznew LookupTable(capacity);
+            for (size_t i = 0; i <= m_mask; ++i)
+            {
+                Internal::NameData* nameData = m_slots[i].load(AZStd::memory_order_relaxed);
+                if (nameData != nullptr && nameData != NameDictionaryInternal::TombstoneNameData)
+                {
+                    table->Insert(nameData);
+                }
+            }
+            return table;
+        }
+
+        size_t Capacity() const
+        {
+            return m_mask + 1;
+        }
+
+    private:
+        AZStd::atomic<Internal::NameData*>* m_slots;
+        size_t m_mask;
+        // Only accessed by the writer that holds the unique lock
+        size_t m_usedSlotCount = 0;
+        size_t m_nameCount = 0;
+    };
+
     void NameDictionary::Create()
     {
         using namespace NameDictionaryInternal;
@@ -92,6 +213,8 @@ namespace AZ
         // This prevents our list head from being destroyed from a module that has shut down its AZ::Environment and
         // invalidating our list.
         m_deferredHead.m_linkedToDictionary = true;
+
+        m_lookupTable.store(aznew LookupTable(LookupTable::InitialCapacity), AZStd::memory_order_release);
     }
     
     NameDictionary::~NameDictionary()
@@ -125,27 +248,67 @@ namespace AZ
         }
 
         AZ_Assert(!leaksDetected, "AZ::NameDictionary still has active name references. See debug output for the list of leaked names.");
+
+        // No readers can be active anymore, so everything that was retired can be deleted right away
+        m_reclaimer.Reclaim();
+        delete m_lookupTable.load();
     }
 
     Name NameDictionary::FindName(Name::Hash hash) const
     {
-        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        EpochReclaimer::ReadGuard readGuard(m_reclaimer);
+
+        Internal::NameData* nameData = m_lookupTable.load(AZStd::memory_order_acquire)->Find(hash);
+        if (nameData == nullptr)
+        {
+            return Name();
+        }
 
-        // The NameData m_useCount check is to avoid a multithread race condition
+        // Only take a reference while the use count is above 0, to avoid a multithread race condition
         // where thread B is in NameData::release and reduces the m_useCount to 0
         // and this thread(thread A) construct a Name using that NameData pointer
         // causing the m_useCount to go back up to 1.
         // If thread A continues along and releases the NameData again, before thread B can run
         // the the m_useCount can be reduced to 0 and multiple threads can be in the
         // NameData::release `if (m_useCount.fetch_sub(1) == 1)` block
-        if (auto iter = m_dictionary.find(hash);
-            iter != m_dictionary.end() && iter->second.m_nameData->m_useCount > 0)
+        // A use count of -1 means the name data is being removed, but it's only deleted after this epoch ends.
+        int32_t useCount = nameData->m_useCount.load();
+        while (useCount > 0)
         {
-            return Name(iter->second.m_nameData);
+            if (nameData->m_useCount.compare_exchange_weak(useCount, useCount + 1))
+            {
+                Name name(nameData);
+                // The Name holds its own reference now, so dropping the temporary one can't release the name data
+                nameData->m_useCount.fetch_sub(1);
+                return name;
+            }
         }
         return Name();
     }
 
+    void NameDictionary::AddToLookupTable(Internal::NameData* nameData)
+    {
+        LookupTable* table = m_lookupTable.load(AZStd::memory_order_relaxed);
+        if (!table->Insert(nameData))
+        {
+            // Readers might still be probing the old table, so it's retired rather than deleted
+            LookupTable* newTable = table->Rebuild();
+            newTable->Insert(nameData);
+            m_lookupTable.store(newTable, AZStd::memory_order_release);
+            m_reclaimer.Retire(table);
+        }
+    }
+
+    void NameDictionary::RemoveFromLookupTable(Name::Hash hash)
+    {
+        m_lookupTable.load(AZStd::memory_order_relaxed)->Remove(hash);
+    }
+
+    void NameDictionary::RetireNameData(Internal::NameData* nameData)
+    {
+        m_reclaimer.Retire(nameData);
+    }
+
     void NameDictionary::LoadLiteral(Name& nameLiteral)
     {
         if (nameLiteral.m_data == nullptr)
@@ -227,7 +390,7 @@ namespace AZ
         Name::Hash hash = CalcHash(nameString);
 
         // If we find the same name with the same hash, just return it. 
-        // This path is faster than the loop below because FindName() takes a shared_lock whereas the
+        // This path is faster than the loop below because FindName() doesn't lock whereas the
         // loop requires a unique_lock to modify the dictionary.
         Name name = FindName(hash);
         if (name.GetStringView() == nameString)
@@ -249,7 +412,10 @@ namespace AZ
                 nameData->m_hashCollision = collisionDetected;
                 // Piecewise construct to prevent creating a temporary ScopedNameDataWrapper that destructs
                 m_dictionary.emplace(AZStd::piecewise_construct, AZStd::forward_as_tuple(hash), AZStd::forward_as_tuple(*this, nameData));
-                return Name(nameData);
+                // Take the reference before the name data becomes visible to lock free lookups
+                Name name(nameData);
+                AddToLookupTable(nameData);
+                return name;
             }
             // Found the desired entry, return it
             else if (iter->second.m_nameData->GetName() == nameString)
@@ -312,7 +478,9 @@ namespace AZ
         if (nameData->m_useCount.compare_exchange_strong(expectedRefCount, -1))
         {
             m_dictionary.erase(nameData->GetHash());
-            delete nameData;
+            // Lock free lookups might still be looking at the name data, so it can't be deleted right away
+            RemoveFromLookupTable(nameData->GetHash());
+            RetireNameData(nameData);
         }
 
         ReportStats();
@@ -9,12 +9,15 @@
 #pragma once
 
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/string/string_view.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/shared_mutex.h>
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/Memory/OSAllocator.h>
 #include <AzCore/Name/Name.h>
+#include <AzCore/Threading/EpochReclaimer.h>
 
 namespace UnitTest
 {
@@ -43,6 +46,11 @@ namespace AZ
     //! Benchmarks have shown that creating a new Name object can be quite slow when the name doesn't
     //! already exist in the NameDictionary, but is comparable to creating an AZStd::string for names
     //! that already exist.
+    //!
+    //! Looking up existing names doesn't take any locks. Lookups go through an open-addressed table that
+    //! mirrors the dictionary and is read without locking. Only adding and removing names lock the dictionary.
+    //! Name data and tables that are removed are only deleted once no reader can still be looking at them,
+    //! which is tracked with epochs.
     class AZCORE_API NameDictionary final
     {
     public:
@@ -112,6 +120,20 @@ namespace AZ
         //! Unloads the data with all deferred names registered using LoadDeferredName.
         void UnloadDeferredNames();
 
+        //! Open-addressed hash table from Name hash to NameData that can be read without locking.
+        //! Only modified while holding a unique lock on m_sharedMutex.
+        class LookupTable;
+
+        //! Number of retired entries that are collected before waiting on readers to delete them.
+        static constexpr size_t RetiredBatchSize = 64;
+
+        //! Adds or removes the name data from the lookup table. Requires a unique lock on m_sharedMutex.
+        void AddToLookupTable(Internal::NameData* nameData);
+        void RemoveFromLookupTable(Name::Hash hash);
+        //! Deletes the name data once all readers that could have seen it have left.
+        //! Requires a unique lock on m_sharedMutex.
+        void RetireNameData(Internal::NameData* nameData);
+
         //! Wrapper structure around a NameData pointer
         //! Which sets the Internal::NameData::m_nameDictionary pointer to this name dictionary
         //! instance on construction and to nullptr on destruction
@@ -130,6 +152,11 @@ namespace AZ
         AZStd::unordered_map<Name::Hash, ScopedNameDataWrapper> m_dictionary;
         mutable AZStd::shared_mutex m_sharedMutex;
 
+        AZStd::atomic<LookupTable*> m_lookupTable{ nullptr };
+        //! Defers deleting removed name data and replaced tables until lock free readers are done with them.
+        //! Retiring requires a unique lock on m_sharedMutex.
+        EpochReclaimer m_reclaimer{ RetiredBatchSize };
+
         //! A fixed Name used as the head of a linked list of Name literals.
         //! These literals can be static and have lifecycles not coupled to the name dictionary,
         //! so we keep track of them here to ensure their name data gets correctly cleaned up
@@ -177,6 +177,38 @@ namespace AZ
         static JsonSerializationResult::ResultCode Load(
             void* object, const Uuid& objectType, const rapidjson::Value& root, JsonDeserializerSettings& settings);
 
+        //! Loads the data from the provided json text into the supplied object while the text is being parsed, without first
+        //! parsing it into a document. Values that need random access, such as containers and pointers, are still collected
+        //! into a document before they're loaded, so peak memory is bound by the largest of those values instead of the full text.
+        //! Because loading starts before the entire text has been parsed, a json syntax error may leave the object partially loaded.
+        //! @param object Object where the data will be loaded into.
+        //! @param jsonText The json text to read from.
+        //! @param settings Optional additional settings to control the way the text is deserialized.
+        template<typename T>
+        static JsonSerializationResult::ResultCode LoadStreaming(
+            T& object, AZStd::string_view jsonText, const JsonDeserializerSettings& settings = JsonDeserializerSettings{});
+        //! Loads the data from the provided json text into the supplied object while the text is being parsed.
+        //! @param object Object where the data will be loaded into.
+        //! @param jsonText The json text to read from.
+        //! @param settings Additional settings to control the way the text is deserialized.
+        template<typename T>
+        static JsonSerializationResult::ResultCode LoadStreaming(T& object, AZStd::string_view jsonText, JsonDeserializerSettings& settings);
+        //! Loads the data from the provided json text into the supplied object while the text is being parsed.
+        //! @param object Pointer to the object where the data will be loaded into.
+        //! @param objectType Type id of the object passed in.
+        //! @param jsonText The json text to read from.
+        //! @param settings Optional additional settings to control the way the text is deserialized.
+        static JsonSerializationResult::ResultCode LoadStreaming(
+            void* object, const Uuid& objectType, AZStd::string_view jsonText,
+            const JsonDeserializerSettings& settings = JsonDeserializerSettings{});
+        //! Loads the data from the provided json text into the supplied object while the text is being parsed.
+        //! @param object Pointer to the object where the data will be loaded into.
+        //! @param objectType Type id of the object passed in.
+        //! @param jsonText The json text to read from.
+        //! @param settings Additional settings to control the way the text is deserialized.
+        static JsonSerializationResult::ResultCode LoadStreaming(
+            void* object, const Uuid& objectType, AZStd::string_view jsonText, JsonDeserializerSettings& settings);
+
         //! Loads the type id from the provided input.
         //! Note: it's not recommended to use this function (frequently) as it requires users of the json file to have knowledge of the internal
         //!     type structure and is therefore harder to use.
@@ -359,6 +391,20 @@ namespace AZ
         return Load(&object, azrtti_typeid(object), root, settings);
     }
 
+    template<typename T>
+    JsonSerializationResult::ResultCode JsonSerialization::LoadStreaming(
+        T& object, AZStd::string_view jsonText, const JsonDeserializerSettings& settings)
+    {
+        return LoadStreaming(&object, azrtti_typeid(object), jsonText, settings);
+    }
+
+    template<typename T>
+    JsonSerializationResult::ResultCode JsonSerialization::LoadStreaming(
+        T& object, AZStd::string_view jsonText, JsonDeserializerSettings& settings)
+    {
+        return LoadStreaming(&object, azrtti_typeid(object), jsonText, settings);
+    }
+
     template<typename T>
     JsonSerializationResult::ResultCode JsonSerialization::Store(
         rapidjson::Value& output, rapidjson::Document::AllocatorType& allocator, const T& object, const JsonSerializerSettings& settings)
@@ -0,0 +1,503 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/JSON/document.h>
+#include <AzCore/JSON/error/en.h>
+#include <AzCore/JSON/memorystream.h>
+#include <AzCore/JSON/reader.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Serialization/Json/BaseJsonSerializer.h>
+#include <AzCore/Serialization/Json/JsonDeserializer.h>
+#include <AzCore/Serialization/Json/JsonStreamingDeserializer.h>
+#include <AzCore/Serialization/Json/RegistrationContext.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+
+namespace AZ
+{
+    //! Receives the tokens from the json reader and routes them to the object that's being loaded.
+    //! Objects of reflected classes are filled in member by member. Any other value is captured into a list of tokens until
+    //! it's complete, after which the tokens are turned into a document and loaded through the JsonDeserializer.
+    class JsonStreamingDeserializer::ReadHandler
+        : public rapidjson::BaseReaderHandler<rapidjson::UTF8<>, ReadHandler>
+    {
+    public:
+        ReadHandler(void* object, const Uuid& typeId, JsonDeserializerContext& context)
+            : m_context(context)
+        {
+            m_target.m_object = object;
+            m_target.m_typeId = typeId;
+        }
+
+        bool IsComplete() const { return m_state == State::Complete; }
+        JsonSerializationResult::ResultCode GetResult() const { return m_result; }
+
+        bool Null() { return Value(Token{ TokenType::Null }); }
+        bool Bool(bool value) { return Value(Token{ value ? TokenType::True : TokenType::False }); }
+        bool Int(int value) { Token token{ TokenType::Int }; token.m_int = value; return Value(token); }
+        bool Uint(unsigned value) { Token token{ TokenType::Uint }; token.m_uint = value; return Value(token); }
+        bool Int64(int64_t value) { Token token{ TokenType::Int64 }; token.m_int = value; return Value(token); }
+        bool Uint64(uint64_t value) { Token token{ TokenType::Uint64 }; token.m_uint = value; return Value(token); }
+        bool Double(double value) { Token token{ TokenType::Double }; token.m_double = value; return Value(token); }
+        bool String(const char* value, rapidjson::SizeType length, [[maybe_unused]] bool copy)
+        {
+            return Value(StoreString(TokenType::String, value, length));
+        }
+        bool StartArray() { return Value(Token{ TokenType::StartArray }); }
+        bool EndArray(rapidjson::SizeType elementCount)
+        {
+            Token token{ TokenType::EndArray };
+            token.m_length = elementCount;
+            return Value(token);
+        }
+        bool StartObject() { return Value(Token{ TokenType::StartObject }); }
+        bool Key(const char* name, rapidjson::SizeType length, [[maybe_unused]] bool copy);
+        bool EndObject(rapidjson::SizeType memberCount);
+
+    private:
+        enum class State : u8
+        {
+            Value, // The next token starts the value for m_target.
+            Member, // The next token is either a member name or the end of the class object on the top of the stack.
+            Skip, // Tokens are ignored until the current value is complete.
+            Capture, // Tokens are stored until the current value is complete.
+            Complete // The root value has been loaded.
+        };
+
+        enum class TokenType : u8
+        {
+            Null,
+            False,
+            True,
+            Int,
+            Uint,
+            Int64,
+            Uint64,
+            Double,
+            String,
+            Key,
+            StartObject,
+            EndObject,
+            StartArray,
+            EndArray
+        };
+
+        struct Token
+        {
+            explicit Token(TokenType type)
+                : m_type(type)
+                , m_uint(0)
+            {
+            }
+
+            TokenType m_type;
+            union
+            {
+                int64_t m_int;
+                uint64_t m_uint;
+                double m_double;
+                size_t m_stringOffset;
+            };
+            rapidjson::SizeType m_length{ 0 };
+        };
+
+        struct Target
+        {
+            void* m_object{ nullptr };
+            //! The element in the parent class that's being loaded or null for the root object.
+            const SerializeContext::ClassElement* m_element{ nullptr };
+            Uuid m_typeId;
+        };
+
+        struct ClassFrame
+        {
+            void* m_object;
+            const SerializeContext::ClassData* m_classData;
+            JsonSerializationResult::ResultCode m_result{ JsonSerializationResult::Tasks::ReadField };
+            size_t m_numLoads{ 0 };
+            bool m_hasMembers{ false };
+        };
+
+        //! Replays the captured tokens into a document.
+        class TokenGenerator
+        {
+        public:
+            TokenGenerator(const AZStd::vector<Token>& tokens, const AZStd::vector<char>& strings)
+                : m_tokens(tokens)
+                , m_strings(strings)
+            {
+            }
+
+            bool operator()(rapidjson::Document& document);
+
+        private:
+            const AZStd::vector<Token>& m_tokens;
+            const AZStd::vector<char>& m_strings;
+        };
+
+        bool Value(const Token& token);
+        bool CaptureToken(const Token& token);
+        bool SkipToken(const Token& token);
+        bool LoadCapturedValue();
+        bool FinishValue(JsonSerializationResult::ResultCode result);
+        Token StoreString(TokenType type, const char* value, rapidjson::SizeType length);
+
+        //! Returns the class data if the type can be loaded member by member, otherwise null. This is only the case for classes
+        //! that JsonDeserializer::Load would send to JsonDeserializer::LoadClass.
+        const SerializeContext::ClassData* GetStreamableClassData(const Uuid& typeId) const;
+
+        JsonDeserializerContext& m_context;
+        AZStd::vector<ClassFrame> m_classStack;
+        AZStd::vector<Token> m_capturedTokens;
+        AZStd::vector<char> m_capturedStrings;
+        Target m_target;
+        JsonSerializationResult::ResultCode m_result{ JsonSerializationResult::Tasks::ReadField };
+        size_t m_depth{ 0 };
+        State m_state{ State::Value };
+    };
+
+    bool JsonStreamingDeserializer::ReadHandler::Key(const char* name, rapidjson::SizeType length, [[maybe_unused]] bool copy)
+    {
+        using namespace JsonSerializationResult;
+
+        if (m_state != State::Member)
+        {
+            return Value(StoreString(TokenType::Key, name, length));
+        }
+
+        ClassFrame& frame = m_classStack.back();
+        if (!frame.m_hasMembers)
+        {
+            frame.m_hasMembers = true;
+            // Compatibility with Reflection Serialize - it expects this callback before reading into a C++ class.
+            if (frame.m_classData->m_eventHandler)
+            {
+                frame.m_classData->m_eventHandler->OnWriteBegin(frame.m_object);
+            }
+        }
+
+        AZStd::string_view memberName(name, length);
+        if (memberName == JsonSerialization::TypeIdFieldIdentifier)
+        {
+            m_state = State::Skip;
+            m_depth = 0;
+            return true;
+        }
+
+        JsonDeserializer::ElementDataResult foundElementData = JsonDeserializer::FindElementByNameCrc(
+            *m_context.GetSerializeContext(), frame.m_object, *frame.m_classData, Crc32(memberName));
+        m_context.PushPath(memberName);
+        if (foundElementData.m_found)
+        {
+            m_target.m_object = foundElementData.m_data;
+            m_target.m_element = foundElementData.m_info;
+            m_target.m_typeId = foundElementData.m_info->m_typeId;
+            m_state = State::Value;
+        }
+        else
+        {
+            frame.m_result.Combine(m_context.Report(Tasks::ReadField, Outcomes::Skipped,
+                "Skipping field as there's no matching variable in the target."));
+            m_context.PopPath();
+            m_state = State::Skip;
+            m_depth = 0;
+        }
+        return true;
+    }
+
+    bool JsonStreamingDeserializer::ReadHandler::EndObject(rapidjson::SizeType memberCount)
+    {
+        using namespace JsonSerializationResult;
+
+        if (m_state != State::Member)
+        {
+            Token token{ TokenType::EndObject };
+            token.m_length = memberCount;
+            return Value(token);
+        }
+
+        ClassFrame frame = m_classStack.back();
+        m_classStack.pop_back();
+
+        if (!frame.m_hasMembers)
+        {
+            return FinishValue(m_context.Report(Tasks::ReadField, Outcomes::DefaultsUsed, "Value has an explicit default."));
+        }
+
+        size_t elementCount = JsonDeserializer::CountElements(*m_context.GetSerializeContext(), *frame.m_classData);
+        if (elementCount > frame.m_numLoads)
+        {
+            frame.m_result.Combine(ResultCode(Tasks::ReadField, frame.m_numLoads == 0 ? Outcomes::DefaultsUsed : Outcomes::PartialDefaults));
+        }
+
+        // Compatibility with Reflection Serialize - it expects this callback after reading into a C++ class.
+        if (frame.m_classData->m_eventHandler)
+        {
+            frame.m_classData->m_eventHandler->OnWriteEnd(frame.m_object);
+        }
+
+        return FinishValue(frame.m_result);
+    }
+
+    bool JsonStreamingDeserializer::ReadHandler::Value(const Token& token)
+    {
+        switch (m_state)
+        {
+        case State::Value:
+            if (token.m_type == TokenType::StartObject)
+            {
+                bool isPointer = m_target.m_element &&
+                    (m_target.m_element->m_flags & SerializeContext::ClassElement::Flags::FLG_POINTER);
+                const SerializeContext::ClassData* classData = isPointer ? nullptr : GetStreamableClassData(m_target.m_typeId);
+                if (classData)
+                {
+                    m_classStack.push_back(ClassFrame{ m_target.m_object, classData });
+                    m_state = State::Member;
+                    return true;
+                }
+            }
+            m_state = State::Capture;
+            m_depth = 0;
+            return CaptureToken(token);
+        case State::Skip:
+            return SkipToken(token);
+        case State::Capture:
+            return CaptureToken(token);
+        case State::Member:
+            AZ_Assert(false, "The json reader provided a value where a member name was expected.");
+            return false;
+        case State::Complete:
+            // The reader reports an error for any value after the root value, so this can't be reached for valid json.
+            return false;
+        default:
+            return false;
+        }
+    }
+
+    bool JsonStreamingDeserializer::ReadHandler::CaptureToken(const Token& token)
+    {
+        m_capturedTokens.push_back(token);
+        switch (token.m_type)
+        {
+        case TokenType::StartObject:
+        case TokenType::StartArray:
+            ++m_depth;
+            return true;
+        case TokenType::EndObject:
+        case TokenType::EndArray:
+            --m_depth;
+            break;
+        case TokenType::Key:
+            return true;
+        default:
+            break;
+        }
+        return m_depth == 0 ? LoadCapturedValue() : true;
+    }
+
+    bool JsonStreamingDeserializer::ReadHandler::SkipToken(const Token& token)
+    {
+        switch (token.m_type)
+        {
+        case TokenType::StartObject:
+        case TokenType::StartArray:
+            ++m_depth;
+            return true;
+        case TokenType::EndObject:
+        case TokenType::EndArray:
+            --m_depth;
+            break;
+        case TokenType::Key:
+            return true;
+        default:
+            break;
+        }
+        if (m_depth == 0)
+        {
+            m_state = State::Member;
+        }
+        return true;
+    }
+
+    bool JsonStreamingDeserializer::ReadHandler::LoadCapturedValue()
+    {
+        using namespace JsonSerializationResult;
+
+        JsonSerializationResult::ResultCode result(Tasks::ReadField);
+        {
+            rapidjson::Document document;
+            TokenGenerator generator(m_capturedTokens, m_capturedStrings);
+            document.Populate(generator);
+            if (m_target.m_element)
+            {
+                result = JsonDeserializer::LoadWithClassElement(m_target.m_object, document, *m_target.m_element, m_context);
+            }
+            else
+            {
+                result = JsonDeserializer::Load(m_target.m_object, m_target.m_typeId, document, false,
+                    JsonDeserializer::UseTypeDeserializer::Yes, m_context);
+            }
+        }
+        // The buffers keep their capacity, so memory use is bounded by the largest captured value.
+        m_capturedTokens.clear();
+        m_capturedStrings.clear();
+        return FinishValue(result);
+    }
+
+    bool JsonStreamingDeserializer::ReadHandler::FinishValue(JsonSerializationResult::ResultCode result)
+    {
+        using namespace JsonSerializationResult;
+
+        if (m_classStack.empty())
+        {
+            m_result = result;
+            m_state = State::Complete;
+            // Stop the reader if loading was halted, as the remainder of the root value no longer needs to be read.
+            return result.GetProcessing() != Processing::Halted;
+        }
+
+        if (result.GetProcessing() == Processing::Halted)
+        {
+            // Unwind the same way nested calls to JsonDeserializer::LoadClass would, without calling OnWriteEnd.
+            ResultCode reportedResult = m_context.Report(result, "Loading of element has failed.");
+            m_context.PopPath();
+            m_classStack.pop_back();
+            return FinishValue(reportedResult);
+        }
+
+        ClassFrame& parent = m_classStack.back();
+        parent.m_result.Combine(result);
+        if (result.GetProcessing() != Processing::Altered)
+        {
+            parent.m_numLoads++;
+        }
+        m_context.PopPath();
+        m_state = State::Member;
+        return true;
+    }
+
+    auto JsonStreamingDeserializer::ReadHandler::StoreString(TokenType type, const char* value, rapidjson::SizeType length) -> Token
+    {
+        Token token{ type };
+        if (m_state == State::Capture || m_state == State::Value)
+        {
+            token.m_stringOffset = m_capturedStrings.size();
+            m_capturedStrings.insert(m_capturedStrings.end(), value, value + length);
+        }
+        token.m_length = length;
+        return token;
+    }
+
+    const SerializeContext::ClassData* JsonStreamingDeserializer::ReadHandler::GetStreamableClassData(const Uuid& typeId) const
+    {
+        if (m_context.GetRegistrationContext()->GetSerializerForType(typeId))
+        {
+            return nullptr;
+        }
+
+        const SerializeContext::ClassData* classData = m_context.GetSerializeContext()->FindClassData(typeId);
+        if (!classData || classData->m_container)
+        {
+            return nullptr;
+        }
+        if (classData->m_azRtti)
+        {
+            if (classData->m_azRtti->GetGenericTypeId() != typeId ||
+                (classData->m_azRtti->GetTypeTraits() & AZ::TypeTraits::is_enum) == AZ::TypeTraits::is_enum)
+            {
+                return nullptr;
+            }
+        }
+        return classData;
+    }
+
+    bool JsonStreamingDeserializer::ReadHandler::TokenGenerator::operator()(rapidjson::Document& document)
+    {
+        for (const Token& token : m_tokens)
+        {
+            bool result = true;
+            switch (token.m_type)
+            {
+            case TokenType::Null:
+                result = document.Null();
+                break;
+            case TokenType::False:
+                result = document.Bool(false);
+                break;
+            case TokenType::True:
+                result = document.Bool(true);
+                break;
+            case TokenType::Int:
+                result = document.Int(static_cast<int>(token.m_int));
+                break;
+            case TokenType::Uint:
+                result = document.Uint(static_cast<unsigned>(token.m_uint));
+                break;
+            case TokenType::Int64:
+                result = document.Int64(token.m_int);
+                break;
+            case TokenType::Uint64:
+                result = document.Uint64(token.m_uint);
+                break;
+            case TokenType::Double:
+                result = document.Double(token.m_double);
+                break;
+            case TokenType::String:
+                result = document.String(m_strings.data() + token.m_stringOffset, token.m_length, true);
+                break;
+            case TokenType::Key:
+                result = document.Key(m_strings.data() + token.m_stringOffset, token.m_length, true);
+                break;
+            case TokenType::StartObject:
+                result = document.StartObject();
+                break;
+            case TokenType::EndObject:
+                result = document.EndObject(token.m_length);
+                break;
+            case TokenType::StartArray:
+                result = document.StartArray();
+                break;
+            case TokenType::EndArray:
+                result = document.EndArray(token.m_length);
+                break;
+            }
+            if (!result)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    JsonSerializationResult::ResultCode JsonStreamingDeserializer::Load(
+        void* object, const Uuid& typeId, AZStd::string_view jsonText, JsonDeserializerContext& context)
+    {
+        using namespace JsonSerializationResult;
+
+        if (!object)
+        {
+            return context.Report(Tasks::ReadField, Outcomes::Catastrophic,
+                "Target object for Json Serialization is pointing to nothing during loading.");
+        }
+
+        ReadHandler handler(object, typeId, context);
+        rapidjson::MemoryStream stream(jsonText.data(), jsonText.size());
+        rapidjson::Reader reader;
+        rapidjson::ParseResult parseResult = reader.Parse<rapidjson::kParseCommentsFlag>(stream, handler);
+
+        // Unlike JsonSerialization::Load, which only starts once the entire document has been parsed, errors in the json text
+        // can be found after parts of the object have already been loaded.
+        if (parseResult.IsError() && !(handler.IsComplete() && parseResult.Code() == rapidjson::kParseErrorTermination))
+        {
+            return context.Report(Tasks::ReadField, Outcomes::Catastrophic,
+                AZStd::string::format("JSON parse error at offset %zu: %s", parseResult.Offset(),
+                    rapidjson::GetParseError_En(parseResult.Code())));
+        }
+        return handler.GetResult();
+    }
+} // namespace AZ
@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Serialization/Json/JsonSerialization.h>
+#include <AzCore/std/string/string_view.h>
+
+namespace AZ
+{
+    struct Uuid;
+    class JsonDeserializerContext;
+
+    //! Deserializes json text straight into the target object while the text is being parsed, instead of first parsing
+    //! the entire text into a document.
+    //! Classes that are loaded through their SerializeContext reflection are filled in field by field as the parser reads them.
+    //! Values that are handled by a registered BaseJsonSerializer, such as containers, pointers and enums, require random
+    //! access to their json, so only those values are collected into a document and passed to the JsonDeserializer.
+    //! This limits the peak memory to the largest of those values, instead of the document for the entire text.
+    class AZCORE_API JsonStreamingDeserializer final
+    {
+        friend class JsonSerialization;
+
+    private:
+        class ReadHandler;
+
+        JsonStreamingDeserializer() = delete;
+        ~JsonStreamingDeserializer() = delete;
+        JsonStreamingDeserializer& operator=(const JsonStreamingDeserializer& rhs) = delete;
+        JsonStreamingDeserializer& operator=(JsonStreamingDeserializer&& rhs) = delete;
+        JsonStreamingDeserializer(const JsonStreamingDeserializer& rhs) = delete;
+        JsonStreamingDeserializer(JsonStreamingDeserializer&& rhs) = delete;
+
+        static JsonSerializationResult::ResultCode Load(
+            void* object, const Uuid& typeId, AZStd::string_view jsonText, JsonDeserializerContext& context);
+    };
+} // namespace AZ
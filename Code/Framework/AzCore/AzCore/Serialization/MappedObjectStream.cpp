@@ -0,0 +1,856 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Serialization/MappedObjectStream.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/IO/ByteContainerStream.h>
+#include <AzCore/IO/GenericStreams.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/hash.h>
+#include <AzCore/std/sort.h>
+
+namespace AZ
+{
+    namespace ObjectStreamInternal
+    {
+        namespace
+        {
+            // Layout of a stream in the mapped format. All offsets are from the start of the stream.
+            //
+            //  MappedStreamHeader
+            //  MappedRootEntry[m_rootCount]      Root objects in the order they were written
+            //  u64[m_relocationCount]            Offsets of the pointers in the object images
+            //  Object images                     Each image is aligned to its natural alignment
+            //  Unmapped root stream              ST_BINARY object stream with the roots that can't be mapped
+            //
+            // Pointers in the object images hold the offset of the image they point to, or 0 for null.
+            static constexpr u32 s_mappedStreamVersion = 1;
+            static constexpr u32 s_byteOrderMark = 0x01020304;
+            static constexpr u64 s_unmappedRootOffset = ~u64(0);
+            static constexpr size_t s_maxImageAlignment = 64;
+
+            struct MappedStreamHeader
+            {
+                u8 m_tag;
+                u8 m_pointerSize;
+                u16 m_reserved;
+                u32 m_byteOrderMark;
+                u32 m_version;
+                u32 m_reserved2;
+                u64 m_size;
+                u64 m_rootCount;
+                u64 m_rootTableOffset;
+                u64 m_relocationCount;
+                u64 m_relocationTableOffset;
+                u64 m_unmappedRootStreamOffset;
+                u64 m_unmappedRootStreamSize;
+            };
+
+            struct MappedRootEntry
+            {
+                Uuid m_typeId;
+                u64 m_layoutHash;
+                u64 m_offset;
+            };
+
+            static_assert(AZStd::is_trivially_copyable_v<MappedStreamHeader>, "The stream header is copied byte by byte");
+            static_assert(AZStd::is_trivially_copyable_v<MappedRootEntry>, "The root entries are copied byte by byte");
+
+            // The largest power of two that divides the size of the class is at least its alignment
+            size_t GetImageAlignment(size_t classSize)
+            {
+                return AZStd::min(classSize & (~classSize + 1), s_maxImageAlignment);
+            }
+
+            //! A pointer field of a class, including the fields of its base classes and members stored by value
+            struct PointerField
+            {
+                size_t m_offset;
+                const SerializeContext::ClassData* m_classData;
+                IRttiHelper* m_azRtti;
+            };
+
+            //! Derives the memory layout of reflected classes and caches the results
+            class MappedLayout
+            {
+            public:
+                explicit MappedLayout(SerializeContext& sc)
+                    : m_sc(sc)
+                {
+                }
+
+                //! Returns true if instances of the class can be stored as memory images
+                bool IsMappable(const SerializeContext::ClassData& classData)
+                {
+                    auto it = m_isMappable.find(&classData);
+                    if (it == m_isMappable.end())
+                    {
+                        AZStd::vector<const SerializeContext::ClassData*> visiting;
+                        it = m_isMappable.emplace(&classData, IsMappableImpl(classData, visiting)).first;
+                    }
+                    return it->second;
+                }
+
+                //! Returns true if the instance, including the objects it points to, can be stored as memory images
+                bool IsMappableInstance(const void* instance, const SerializeContext::ClassData& classData)
+                {
+                    if (!IsMappable(classData))
+                    {
+                        return false;
+                    }
+                    for (const PointerField& field : GetPointerFields(classData))
+                    {
+                        const void* pointee = *reinterpret_cast<const void* const*>(reinterpret_cast<const char*>(instance) + field.m_offset);
+                        if (pointee)
+                        {
+                            // Only objects of the exact type of the field are mapped, derived objects need the regular path
+                            if (field.m_azRtti && field.m_azRtti->GetActualUuid(pointee) != field.m_classData->m_typeId)
+                            {
+                                return false;
+                            }
+                            if (!IsMappableInstance(pointee, *field.m_classData))
+                            {
+                                return false;
+                            }
+                        }
+                    }
+                    return true;
+                }
+
+                //! Hash of the reflected layout of the class, used to detect streams that were saved with a different layout
+                u64 GetLayoutHash(const SerializeContext::ClassData& classData)
+                {
+                    auto it = m_layoutHashes.find(&classData);
+                    if (it == m_layoutHashes.end())
+                    {
+                        AZStd::vector<const SerializeContext::ClassData*> visiting;
+                        it = m_layoutHashes.emplace(&classData, static_cast<u64>(ComputeLayoutHash(classData, visiting))).first;
+                    }
+                    return it->second;
+                }
+
+                const AZStd::vector<PointerField>& GetPointerFields(const SerializeContext::ClassData& classData)
+                {
+                    auto it = m_pointerFields.find(&classData);
+                    if (it == m_pointerFields.end())
+                    {
+                        AZStd::vector<PointerField> pointerFields;
+                        CollectPointerFields(classData, 0, pointerFields);
+                        it = m_pointerFields.emplace(&classData, AZStd::move(pointerFields)).first;
+                    }
+                    return it->second;
+                }
+
+                const SerializeContext::ClassData* GetElementClassData(
+                    const SerializeContext::ClassData& classData, const SerializeContext::ClassElement& element) const
+                {
+                    if (element.m_genericClassInfo)
+                    {
+                        return element.m_genericClassInfo->GetClassData();
+                    }
+                    return m_sc.FindClassData(element.m_typeId, &classData, element.m_nameCrc);
+                }
+
+                SerializeContext& GetSerializeContext() { return m_sc; }
+
+            private:
+                bool IsMappableImpl(const SerializeContext::ClassData& classData, AZStd::vector<const SerializeContext::ClassData*>& visiting)
+                {
+                    // Classes that point to themselves are checked once
+                    if (AZStd::find(visiting.begin(), visiting.end(), &classData) != visiting.end())
+                    {
+                        return true;
+                    }
+
+                    if (!classData.m_isTriviallyCopyable || classData.m_classSize == 0 || !classData.m_factory || classData.IsDeprecated())
+                    {
+                        return false;
+                    }
+                    // The regular path calls into these for each object, which can't be done for objects that are used in place
+                    if (classData.m_container || classData.m_eventHandler || classData.m_doSave ||
+                        classData.FindAttribute(SerializeContextAttributes::ObjectStreamWriteElementOverride))
+                    {
+                        return false;
+                    }
+
+                    visiting.push_back(&classData);
+                    bool isMappable = true;
+                    for (const SerializeContext::ClassElement& element : classData.m_elements)
+                    {
+                        const SerializeContext::ClassData* elementClassData = GetElementClassData(classData, element);
+                        if ((element.m_flags & SerializeContext::ClassElement::FLG_DYNAMIC_FIELD) || !elementClassData)
+                        {
+                            isMappable = false;
+                        }
+                        else if ((element.m_flags & SerializeContext::ClassElement::FLG_POINTER) || !elementClassData->m_elements.empty())
+                        {
+                            isMappable = IsMappableImpl(*elementClassData, visiting);
+                        }
+                        else
+                        {
+                            isMappable = !elementClassData->m_container && !elementClassData->m_eventHandler && !elementClassData->m_doSave &&
+                                !elementClassData->FindAttribute(SerializeContextAttributes::ObjectStreamWriteElementOverride);
+                        }
+
+                        if (!isMappable)
+                        {
+                            break;
+                        }
+                    }
+                    visiting.pop_back();
+                    return isMappable;
+                }
+
+                size_t ComputeLayoutHash(const SerializeContext::ClassData& classData, AZStd::vector<const SerializeContext::ClassData*>& visiting)
+                {
+                    size_t hash = 0;
+                    AZStd::hash_combine(hash, classData.m_typeId, classData.m_version, classData.m_classSize);
+                    if (AZStd::find(visiting.begin(), visiting.end(), &classData) != visiting.end())
+                    {
+                        return hash;
+                    }
+
+                    visiting.push_back(&classData);
+                    for (const SerializeContext::ClassElement& element : classData.m_elements)
+                    {
+                        AZStd::hash_combine(hash, static_cast<u32>(element.m_nameCrc), element.m_typeId, element.m_offset, element.m_dataSize, element.m_flags);
+                        if (const SerializeContext::ClassData* elementClassData = GetElementClassData(classData, element))
+                        {
+                            AZStd::hash_combine(hash, ComputeLayoutHash(*elementClassData, visiting));
+                        }
+                    }
+                    visiting.pop_back();
+                    return hash;
+                }
+
+                void CollectPointerFields(const SerializeContext::ClassData& classData, size_t offset, AZStd::vector<PointerField>& pointerFields)
+                {
+                    for (const SerializeContext::ClassElement& element : classData.m_elements)
+                    {
+                        const SerializeContext::ClassData* elementClassData = GetElementClassData(classData, element);
+                        if (!elementClassData)
+                        {
+                            continue;
+                        }
+
+                        if (element.m_flags & SerializeContext::ClassElement::FLG_POINTER)
+                        {
+                            pointerFields.push_back({ offset + element.m_offset, elementClassData, element.m_azRtti });
+                        }
+                        else
+                        {
+                            CollectPointerFields(*elementClassData, offset + element.m_offset, pointerFields);
+                        }
+                    }
+                }
+
+                SerializeContext& m_sc;
+                AZStd::unordered_map<const SerializeContext::ClassData*, bool> m_isMappable;
+                AZStd::unordered_map<const SerializeContext::ClassData*, u64> m_layoutHashes;
+                AZStd::unordered_map<const SerializeContext::ClassData*, AZStd::vector<PointerField>> m_pointerFields;
+            };
+
+            //! Validated view of a stream in the mapped format
+            class MappedStreamReader
+            {
+            public:
+                bool Parse(AZStd::span<const AZStd::byte> data, MappedLayout& layout)
+                {
+                    if (data.size() < sizeof(MappedStreamHeader))
+                    {
+                        AZ_Error("Serialize", false, "Mapped object stream is truncated.");
+                        return false;
+                    }
+
+                    memcpy(&m_header, data.data(), sizeof(m_header));
+                    if (m_header.m_tag != s_mappedStreamTag || m_header.m_byteOrderMark != s_byteOrderMark || m_header.m_pointerSize != sizeof(void*))
+                    {
+                        AZ_Error("Serialize", false, "Mapped object stream was saved for a platform with a different memory layout.");
+                        return false;
+                    }
+                    if (m_header.m_version > s_mappedStreamVersion)
+                    {
+                        AZ_Error("Serialize", false, "Mapped object stream is a newer version than supported. Supported version: %u, stream version: %u",
+                            s_mappedStreamVersion, m_header.m_version);
+                        return false;
+                    }
+
+                    const u64 size = m_header.m_size;
+                    if (size > data.size() ||
+                        !IsRangeValid(m_header.m_rootTableOffset, m_header.m_rootCount, sizeof(MappedRootEntry), size) ||
+                        !IsRangeValid(m_header.m_relocationTableOffset, m_header.m_relocationCount, sizeof(u64), size) ||
+                        !IsRangeValid(m_header.m_unmappedRootStreamOffset, m_header.m_unmappedRootStreamSize, 1, size))
+                    {
+                        AZ_Error("Serialize", false, "Mapped object stream is truncated or corrupted.");
+                        return false;
+                    }
+                    m_data = data.first(size);
+
+                    // The tables precede the object images, so relocating the pointers in the images can't change them
+                    m_imagesOffset = SizeAlignUp(m_header.m_relocationTableOffset + m_header.m_relocationCount * sizeof(u64), s_maxImageAlignment);
+                    m_imagesEnd = m_header.m_unmappedRootStreamOffset;
+                    if (m_header.m_rootTableOffset < sizeof(MappedStreamHeader) ||
+                        m_header.m_rootTableOffset + m_header.m_rootCount * sizeof(MappedRootEntry) > m_header.m_relocationTableOffset ||
+                        m_imagesOffset > m_imagesEnd)
+                    {
+                        AZ_Error("Serialize", false, "Mapped object stream is truncated or corrupted.");
+                        return false;
+                    }
+
+                    // Walk the images that are reachable from the roots to find the pointers that need to be relocated
+                    AZStd::vector<AZStd::pair<u64, const SerializeContext::ClassData*>> pendingImages;
+                    for (u64 rootIndex = 0; rootIndex < m_header.m_rootCount; ++rootIndex)
+                    {
+                        const MappedRootEntry root = GetRoot(rootIndex);
+                        if (root.m_offset == s_unmappedRootOffset)
+                        {
+                            continue;
+                        }
+
+                        const SerializeContext::ClassData* classData = layout.GetSerializeContext().FindClassData(root.m_typeId);
+                        if (!classData)
+                        {
+                            AZ_Error("Serialize", false, "Mapped object stream contains class %s, which isn't reflected to the SerializeContext.",
+                                root.m_typeId.ToFixedString().c_str());
+                            return false;
+                        }
+                        if (!layout.IsMappable(*classData) || layout.GetLayoutHash(*classData) != root.m_layoutHash)
+                        {
+                            AZ_Error("Serialize", false, "The layout of class %s has changed since the mapped object stream was saved. The stream needs to be saved again.",
+                                classData->m_name);
+                            return false;
+                        }
+                        if (!IsImageValid(root.m_offset, *classData))
+                        {
+                            AZ_Error("Serialize", false, "Mapped object stream is truncated or corrupted.");
+                            return false;
+                        }
+                        pendingImages.emplace_back(root.m_offset, classData);
+                    }
+
+                    // Every image is written once, an image that is reached twice means the pointers form a cycle
+                    AZStd::unordered_set<u64> visitedImages;
+                    AZStd::vector<u64> pointerSlots;
+                    while (!pendingImages.empty())
+                    {
+                        const auto [offset, classData] = pendingImages.back();
+                        pendingImages.pop_back();
+                        if (!visitedImages.insert(offset).second)
+                        {
+                            AZ_Error("Serialize", false, "Mapped object stream is truncated or corrupted.");
+                            return false;
+                        }
+
+                        for (const PointerField& field : layout.GetPointerFields(*classData))
+                        {
+                            const u64 slot = offset + field.m_offset;
+                            const u64 pointeeOffset = ReadPointerSlot(slot);
+                            if (pointeeOffset == 0)
+                            {
+                                continue;
+                            }
+                            if (!IsImageValid(pointeeOffset, *field.m_classData))
+                            {
+                                AZ_Error("Serialize", false, "Mapped object stream is truncated or corrupted.");
+                                return false;
+                            }
+                            pointerSlots.push_back(slot);
+                            pendingImages.emplace_back(pointeeOffset, field.m_classData);
+                        }
+                    }
+
+                    // The relocation table has to list exactly the pointers of the images, each of them once
+                    if (pointerSlots.size() != m_header.m_relocationCount)
+                    {
+                        AZ_Error("Serialize", false, "Mapped object stream is truncated or corrupted.");
+                        return false;
+                    }
+                    AZStd::vector<u64> relocations;
+                    relocations.reserve(pointerSlots.size());
+                    for (u64 relocationIndex = 0; relocationIndex < m_header.m_relocationCount; ++relocationIndex)
+                    {
+                        const u64 slot = GetRelocation(relocationIndex);
+                        if (!IsImageRangeValid(slot, sizeof(void*)) || (slot % sizeof(void*)) != 0)
+                        {
+                            AZ_Error("Serialize", false, "Mapped object stream is truncated or corrupted.");
+                            return false;
+                        }
+                        relocations.push_back(slot);
+                    }
+                    AZStd::sort(relocations.begin(), relocations.end());
+                    AZStd::sort(pointerSlots.begin(), pointerSlots.end());
+                    if (relocations != pointerSlots)
+                    {
+                        AZ_Error("Serialize", false, "Mapped object stream is truncated or corrupted.");
+                        return false;
+                    }
+                    return true;
+                }
+
+                MappedRootEntry GetRoot(u64 rootIndex) const
+                {
+                    MappedRootEntry root;
+                    memcpy(&root, m_data.data() + m_header.m_rootTableOffset + rootIndex * sizeof(MappedRootEntry), sizeof(root));
+                    return root;
+                }
+
+                u64 GetRelocation(u64 relocationIndex) const
+                {
+                    u64 slot;
+                    memcpy(&slot, m_data.data() + m_header.m_relocationTableOffset + relocationIndex * sizeof(u64), sizeof(slot));
+                    return slot;
+                }
+
+                u64 ReadPointerSlot(u64 slot) const
+                {
+                    uintptr_t value;
+                    memcpy(&value, m_data.data() + slot, sizeof(value));
+                    return static_cast<u64>(value);
+                }
+
+                //! Returns true if an image of the class fits in the object images and is aligned the way the writer aligns it
+                bool IsImageValid(u64 offset, const SerializeContext::ClassData& classData) const
+                {
+                    return IsImageRangeValid(offset, classData.m_classSize) && (offset % GetImageAlignment(classData.m_classSize)) == 0;
+                }
+
+                bool IsImageRangeValid(u64 offset, u64 size) const
+                {
+                    return offset >= m_imagesOffset && IsRangeValid(offset - m_imagesOffset, 1, size, m_imagesEnd - m_imagesOffset);
+                }
+
+                AZStd::span<const AZStd::byte> GetUnmappedRootStream() const
+                {
+                    return m_data.subspan(m_header.m_unmappedRootStreamOffset, m_header.m_unmappedRootStreamSize);
+                }
+
+                const MappedStreamHeader& GetHeader() const { return m_header; }
+
+            private:
+                static bool IsRangeValid(u64 offset, u64 count, u64 elementSize, u64 size)
+                {
+                    return offset <= size && count <= (size - offset) / elementSize;
+                }
+
+                MappedStreamHeader m_header;
+                AZStd::span<const AZStd::byte> m_data;
+                u64 m_imagesOffset = 0;
+                u64 m_imagesEnd = 0;
+            };
+
+            //! Copies an object image into an object that is owned by the caller, creating the objects it points to
+            bool CopyImage(const MappedStreamReader& reader, AZStd::span<const AZStd::byte> data, u64 offset,
+                const SerializeContext::ClassData& classData, void* destination, MappedLayout& layout)
+            {
+                const AZStd::vector<PointerField>& pointerFields = layout.GetPointerFields(classData);
+                char* destinationBytes = reinterpret_cast<char*>(destination);
+
+                // Release the objects the constructor has created, as the regular path does
+                for (const PointerField& field : pointerFields)
+                {
+                    if (void* pointee = *reinterpret_cast<void**>(destinationBytes + field.m_offset))
+                    {
+                        field.m_classData->m_factory->Destroy(pointee);
+                    }
+                }
+
+                memcpy(destination, data.data() + offset, classData.m_classSize);
+
+                bool result = true;
+                for (const PointerField& field : pointerFields)
+                {
+                    void*& pointer = *reinterpret_cast<void**>(destinationBytes + field.m_offset);
+                    pointer = nullptr;
+
+                    const u64 pointeeOffset = reader.ReadPointerSlot(offset + field.m_offset);
+                    if (pointeeOffset == 0)
+                    {
+                        continue;
+                    }
+                    if (!reader.IsImageValid(pointeeOffset, *field.m_classData))
+                    {
+                        AZ_Error("Serialize", false, "Mapped object stream is truncated or corrupted.");
+                        result = false;
+                        continue;
+                    }
+
+                    pointer = field.m_classData->m_factory->Create(field.m_classData->m_name);
+                    result = CopyImage(reader, data, pointeeOffset, *field.m_classData, pointer, layout) && result;
+                }
+                return result;
+            }
+
+            /**
+             * Writer for DataStream::ST_BINARY_MAPPED.
+             * Roots of mappable classes are stored as memory images, all other roots are written to an embedded ST_BINARY stream.
+             */
+            class MappedObjectStreamWriter
+                : public ObjectStream
+            {
+            public:
+                AZ_CLASS_ALLOCATOR(MappedObjectStreamWriter, SystemAllocator);
+
+                MappedObjectStreamWriter(IO::GenericStream* stream, SerializeContext& sc)
+                    : ObjectStream(&sc)
+                    , m_stream(stream)
+                    , m_layout(sc)
+                    , m_unmappedRootStream(&m_unmappedRootBuffer)
+                {
+                    SetType(ST_BINARY_MAPPED);
+                }
+
+                bool WriteClass(const void* classPtr, const Uuid& classId, const SerializeContext::ClassData* classData) override
+                {
+                    if (!classData)
+                    {
+                        classData = m_sc->FindClassData(classId);
+                        if (!classData)
+                        {
+                            AZ_Error("Serialize", false, "Class %s is not registered with the serializer!", classId.ToFixedString().c_str());
+                            return false;
+                        }
+                    }
+
+                    MappedRootEntry root;
+                    root.m_typeId = classId;
+                    if (m_layout.IsMappableInstance(classPtr, *classData))
+                    {
+                        root.m_layoutHash = m_layout.GetLayoutHash(*classData);
+                        root.m_offset = AppendImage(classPtr, *classData);
+                    }
+                    else
+                    {
+                        if (!m_unmappedRootObjectStream)
+                        {
+                            m_unmappedRootObjectStream = ObjectStream::Create(&m_unmappedRootStream, *m_sc, ST_BINARY);
+                            if (!m_unmappedRootObjectStream)
+                            {
+                                return false;
+                            }
+                        }
+                        if (!m_unmappedRootObjectStream->WriteClass(classPtr, classId, classData))
+                        {
+                            return false;
+                        }
+                        root.m_layoutHash = 0;
+                        root.m_offset = s_unmappedRootOffset;
+                    }
+                    m_roots.push_back(root);
+                    return true;
+                }
+
+                bool Finalize() override
+                {
+                    bool result = true;
+                    if (m_unmappedRootObjectStream)
+                    {
+                        result = m_unmappedRootObjectStream->Finalize();
+                        m_unmappedRootObjectStream = nullptr;
+                    }
+
+                    MappedStreamHeader header{};
+                    header.m_tag = s_mappedStreamTag;
+                    header.m_pointerSize = static_cast<u8>(sizeof(void*));
+                    header.m_byteOrderMark = s_byteOrderMark;
+                    header.m_version = s_mappedStreamVersion;
+                    header.m_rootCount = m_roots.size();
+                    header.m_rootTableOffset = SizeAlignUp(sizeof(MappedStreamHeader), alignof(u64));
+                    header.m_relocationCount = m_relocations.size();
+                    header.m_relocationTableOffset = SizeAlignUp(header.m_rootTableOffset + m_roots.size() * sizeof(MappedRootEntry), alignof(u64));
+                    const u64 imagesOffset = SizeAlignUp(header.m_relocationTableOffset + m_relocations.size() * sizeof(u64), s_maxImageAlignment);
+                    header.m_unmappedRootStreamOffset = imagesOffset + m_images.size();
+                    header.m_unmappedRootStreamSize = m_unmappedRootBuffer.size();
+                    header.m_size = header.m_unmappedRootStreamOffset + header.m_unmappedRootStreamSize;
+
+                    // Image offsets become stream offsets
+                    for (MappedRootEntry& root : m_roots)
+                    {
+                        if (root.m_offset != s_unmappedRootOffset)
+                        {
+                            root.m_offset += imagesOffset;
+                        }
+                    }
+                    for (u64& slot : m_relocations)
+                    {
+                        uintptr_t pointeeOffset;
+                        memcpy(&pointeeOffset, m_images.data() + slot, sizeof(pointeeOffset));
+                        pointeeOffset += static_cast<uintptr_t>(imagesOffset);
+                        memcpy(m_images.data() + slot, &pointeeOffset, sizeof(pointeeOffset));
+                        slot += imagesOffset;
+                    }
+
+                    u64 position = 0;
+                    result = Write(position, &header, sizeof(header)) && result;
+                    result = WritePadding(position, header.m_rootTableOffset) && result;
+                    result = Write(position, m_roots.data(), m_roots.size() * sizeof(MappedRootEntry)) && result;
+                    result = WritePadding(position, header.m_relocationTableOffset) && result;
+                    result = Write(position, m_relocations.data(), m_relocations.size() * sizeof(u64)) && result;
+                    result = WritePadding(position, imagesOffset) && result;
+                    result = Write(position, m_images.data(), m_images.size()) && result;
+                    result = Write(position, m_unmappedRootBuffer.data(), m_unmappedRootBuffer.size()) && result;
+
+                    delete this;
+                    return result;
+                }
+
+            private:
+                //! Appends the image of an object and the objects it points to. Returns the offset of the image.
+                u64 AppendImage(const void* object, const SerializeContext::ClassData& classData)
+                {
+                    const size_t offset = SizeAlignUp(m_images.size(), GetImageAlignment(classData.m_classSize));
+                    m_images.resize(offset + classData.m_classSize);
+
+                    if (classData.m_serializer)
+                    {
+                        memcpy(m_images.data() + offset, object, classData.m_classSize);
+                    }
+                    else
+                    {
+                        // Fields that aren't reflected keep their default values, as they do in the regular path
+                        const AZStd::vector<AZStd::byte>& defaultImage = GetDefaultImage(classData);
+                        memcpy(m_images.data() + offset, defaultImage.data(), classData.m_classSize);
+                        CopyFields(object, classData, offset, 0);
+                    }
+                    return offset;
+                }
+
+                void CopyFields(const void* object, const SerializeContext::ClassData& classData, size_t imageOffset, size_t fieldOffset)
+                {
+                    const char* objectBytes = reinterpret_cast<const char*>(object);
+                    for (const SerializeContext::ClassElement& element : classData.m_elements)
+                    {
+                        const SerializeContext::ClassData* elementClassData = m_layout.GetElementClassData(classData, element);
+                        const size_t elementOffset = fieldOffset + element.m_offset;
+                        if (element.m_flags & SerializeContext::ClassElement::FLG_POINTER)
+                        {
+                            const void* pointee = *reinterpret_cast<const void* const*>(objectBytes + elementOffset);
+                            uintptr_t pointeeOffset = 0;
+                            if (pointee)
+                            {
+                                pointeeOffset = static_cast<uintptr_t>(AppendImage(pointee, *elementClassData));
+                                m_relocations.push_back(imageOffset + elementOffset);
+                            }
+                            memcpy(m_images.data() + imageOffset + elementOffset, &pointeeOffset, sizeof(pointeeOffset));
+                        }
+                        else if (!elementClassData->m_elements.empty())
+                        {
+                            CopyFields(object, *elementClassData, imageOffset, elementOffset);
+                        }
+                        else if (elementClassData->m_serializer)
+                        {
+                            memcpy(m_images.data() + imageOffset + elementOffset, objectBytes + elementOffset, element.m_dataSize);
+                        }
+                    }
+                }
+
+                const AZStd::vector<AZStd::byte>& GetDefaultImage(const SerializeContext::ClassData& classData)
+                {
+                    auto it = m_defaultImages.find(classData.m_typeId);
+                    if (it == m_defaultImages.end())
+                    {
+                        AZStd::vector<AZStd::byte> defaultImage(classData.m_classSize);
+                        void* defaultObject = classData.m_factory->Create(classData.m_name);
+                        memcpy(defaultImage.data(), defaultObject, classData.m_classSize);
+                        classData.m_factory->Destroy(defaultObject);
+                        it = m_defaultImages.emplace(classData.m_typeId, AZStd::move(defaultImage)).first;
+                    }
+                    return it->second;
+                }
+
+                bool Write(u64& position, const void* data, size_t size)
+                {
+                    if (size == 0)
+                    {
+                        return true;
+                    }
+                    position += size;
+                    return m_stream->Write(size, data) == size;
+                }
+
+                bool WritePadding(u64& position, u64 targetPosition)
+                {
+                    static constexpr AZStd::byte padding[s_maxImageAlignment] = {};
+                    AZ_Assert(targetPosition >= position && targetPosition - position <= s_maxImageAlignment, "Invalid mapped object stream padding.");
+                    return Write(position, padding, static_cast<size_t>(targetPosition - position));
+                }
+
+                IO::GenericStream* m_stream;
+                MappedLayout m_layout;
+                AZStd::vector<MappedRootEntry> m_roots;
+                AZStd::vector<u64> m_relocations;
+                AZStd::vector<AZStd::byte> m_images;
+                AZStd::unordered_map<Uuid, AZStd::vector<AZStd::byte>> m_defaultImages;
+                AZStd::vector<char> m_unmappedRootBuffer;
+                IO::ByteContainerStream<AZStd::vector<char>> m_unmappedRootStream;
+                ObjectStream* m_unmappedRootObjectStream = nullptr;
+            };
+        } // namespace
+
+        ObjectStream* CreateMappedObjectStream(IO::GenericStream* stream, SerializeContext& sc)
+        {
+            return aznew MappedObjectStreamWriter(stream, sc);
+        }
+
+        bool LoadMappedObjectStream(AZStd::span<const AZStd::byte> data, SerializeContext& sc, const ObjectStream::ClassReadyCB& readyCB,
+            const ObjectStream::FilterDescriptor& filterDesc, const ObjectStream::InplaceLoadRootInfoCB& inplaceLoadRootInfoCB)
+        {
+            AZ_PROFILE_FUNCTION(AzCore);
+
+            MappedLayout layout(sc);
+            MappedStreamReader reader;
+            if (!reader.Parse(data, layout))
+            {
+                return false;
+            }
+
+            // Load the unmapped roots first, so all roots can be handed over in the order they were written
+            struct LoadedRoot
+            {
+                void* m_object;
+                Uuid m_typeId;
+            };
+            AZStd::vector<LoadedRoot> unmappedRoots;
+            bool result = true;
+            const AZStd::span<const AZStd::byte> unmappedRootStream = reader.GetUnmappedRootStream();
+            if (!unmappedRootStream.empty())
+            {
+                ObjectStream::ClassReadyCB collectRoot;
+                if (readyCB)
+                {
+                    collectRoot = [&unmappedRoots](void* classPtr, const Uuid& classId, SerializeContext*)
+                    {
+                        unmappedRoots.push_back({ classPtr, classId });
+                    };
+                }
+                IO::MemoryStream stream(unmappedRootStream.data(), unmappedRootStream.size());
+                result = ObjectStream::LoadBlocking(&stream, sc, collectRoot, filterDesc, inplaceLoadRootInfoCB);
+            }
+
+            size_t unmappedRootIndex = 0;
+            for (u64 rootIndex = 0; rootIndex < reader.GetHeader().m_rootCount; ++rootIndex)
+            {
+                const MappedRootEntry root = reader.GetRoot(rootIndex);
+                if (root.m_offset == s_unmappedRootOffset)
+                {
+                    if (readyCB && unmappedRootIndex < unmappedRoots.size())
+                    {
+                        const LoadedRoot& loadedRoot = unmappedRoots[unmappedRootIndex++];
+                        readyCB(loadedRoot.m_object, loadedRoot.m_typeId, &sc);
+                    }
+                    continue;
+                }
+
+                const SerializeContext::ClassData* classData = sc.FindClassData(root.m_typeId);
+                void* object = nullptr;
+                if (inplaceLoadRootInfoCB)
+                {
+                    inplaceLoadRootInfoCB(&object, nullptr, root.m_typeId, &sc);
+                }
+                if (!object)
+                {
+                    if (!readyCB)
+                    {
+                        AZ_Error("Serialize", false, "Root element address is nullptr and a ClassReadyCB was not provided to the LoadBlocking call."
+                            " Loading of the root element of type %s will halt.", classData->m_name);
+                        return false;
+                    }
+                    object = classData->m_factory->Create(classData->m_name);
+                }
+
+                result = CopyImage(reader, data, root.m_offset, *classData, object, layout) && result;
+                if (readyCB)
+                {
+                    readyCB(object, root.m_typeId, &sc);
+                }
+            }
+
+            // Hand over any remaining roots so their ownership isn't lost
+            for (; unmappedRootIndex < unmappedRoots.size(); ++unmappedRootIndex)
+            {
+                readyCB(unmappedRoots[unmappedRootIndex].m_object, unmappedRoots[unmappedRootIndex].m_typeId, &sc);
+            }
+            return result;
+        }
+    } // namespace ObjectStreamInternal
+
+    bool MappedObjectStream::Open(const char* filePath, SerializeContext& sc)
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+
+        Close();
+        if (!m_file.Open(filePath))
+        {
+            AZ_Error("Serialize", false, "Failed to map object stream '%s'.", filePath);
+            return false;
+        }
+
+        ObjectStreamInternal::MappedLayout layout(sc);
+        ObjectStreamInternal::MappedStreamReader reader;
+        if (!reader.Parse(m_file.GetData(), layout))
+        {
+            Close();
+            return false;
+        }
+
+        // Read the roots before any of the stream is modified
+        AZStd::byte* base = m_file.GetData().data();
+        m_roots.reserve(reader.GetHeader().m_rootCount);
+        for (u64 rootIndex = 0; rootIndex < reader.GetHeader().m_rootCount; ++rootIndex)
+        {
+            const ObjectStreamInternal::MappedRootEntry entry = reader.GetRoot(rootIndex);
+            Root& root = m_roots.emplace_back();
+            root.m_typeId = entry.m_typeId;
+            if (entry.m_offset != ObjectStreamInternal::s_unmappedRootOffset)
+            {
+                root.m_object = base + entry.m_offset;
+            }
+        }
+
+        // Relocate the pointers in the images, which makes the pages with pointers private to the process
+        for (u64 relocationIndex = 0; relocationIndex < reader.GetHeader().m_relocationCount; ++relocationIndex)
+        {
+            const u64 slot = reader.GetRelocation(relocationIndex);
+            const uintptr_t pointer = reinterpret_cast<uintptr_t>(base) + static_cast<uintptr_t>(reader.ReadPointerSlot(slot));
+            memcpy(base + slot, &pointer, sizeof(pointer));
+        }
+
+        m_unmappedRootStream = reader.GetUnmappedRootStream();
+        m_sc = &sc;
+        return true;
+    }
+
+    void MappedObjectStream::Close()
+    {
+        m_roots.clear();
+        m_unmappedRootStream = {};
+        m_sc = nullptr;
+        m_file.Close();
+    }
+
+    const Uuid& MappedObjectStream::GetRootTypeId(size_t rootIndex) const
+    {
+        AZ_Assert(rootIndex < m_roots.size(), "Root index %zu is out of range, the stream has %zu roots.", rootIndex, m_roots.size());
+        return m_roots[rootIndex].m_typeId;
+    }
+
+    const void* MappedObjectStream::GetMappedRoot(size_t rootIndex) const
+    {
+        return rootIndex < m_roots.size() ? m_roots[rootIndex].m_object : nullptr;
+    }
+
+    bool MappedObjectStream::LoadUnmappedRoots(const ObjectStream::ClassReadyCB& readyCB, const ObjectStream::FilterDescriptor& filterDesc)
+    {
+        if (m_unmappedRootStream.empty())
+        {
+            return true;
+        }
+        IO::MemoryStream stream(m_unmappedRootStream.data(), m_unmappedRootStream.size());
+        return ObjectStream::LoadBlocking(&stream, *m_sc, readyCB, filterDesc);
+    }
+} // namespace AZ
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/IO/MappedFile.h>
+#include <AzCore/Serialization/ObjectStream.h>
+#include <AzCore/std/containers/vector.h>
+
+/**
+ * MappedObjectStream reads object streams that were saved with DataStream::ST_BINARY_MAPPED in place.
+ *
+ * The mapped format stores root objects of trivially copyable classes as memory images, laid out by the
+ * class reflection in the SerializeContext. Pointers between the images are stored as offsets and listed in
+ * a relocation table, so the images are position independent. When the stream is opened, the file is memory
+ * mapped and the pointers are relocated, after which the root objects are used directly from the mapping
+ * without being deserialized or copied.
+ *
+ * Root objects of other classes are stored in an embedded ST_BINARY object stream and are loaded through
+ * the regular ObjectStream path.
+ *
+ * Streams in the mapped format can also be loaded with ObjectStream::LoadBlocking, which copies the images
+ * into objects that are owned by the caller.
+ */
+
+namespace AZ
+{
+    class AZCORE_API MappedObjectStream
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(MappedObjectStream, SystemAllocator);
+
+        MappedObjectStream() = default;
+        ~MappedObjectStream() = default;
+
+        MappedObjectStream(const MappedObjectStream&) = delete;
+        MappedObjectStream& operator=(const MappedObjectStream&) = delete;
+
+        //! Maps the stream file and relocates the mapped root objects.
+        //! Fails if the file isn't in the mapped format, was saved on a platform with a different memory layout or
+        //! if the reflected layout of a mapped class has changed since the file was saved.
+        //! @param filePath Path of the file to map.
+        //! @param sc SerializeContext that has the classes of the root objects reflected. It must outlive the stream.
+        bool Open(const char* filePath, SerializeContext& sc);
+        //! Unmaps the file. Pointers to mapped root objects are invalid afterwards.
+        void Close();
+
+        bool IsOpen() const { return m_file.IsOpen(); }
+
+        //! Returns the number of root objects, in the order in which they were written.
+        size_t GetRootCount() const { return m_roots.size(); }
+        //! Returns the class id of a root object.
+        const Uuid& GetRootTypeId(size_t rootIndex) const;
+        //! Returns the root object if it's mapped, or null if it's stored in the embedded object stream.
+        const void* GetMappedRoot(size_t rootIndex) const;
+        //! Returns the root object if it's mapped and its class is T, otherwise null.
+        template<class T>
+        const T* GetMappedRoot(size_t rootIndex) const;
+
+        //! Loads the root objects that aren't mapped through the regular ObjectStream path.
+        //! Ownership of the loaded objects is passed to the caller through readyCB.
+        bool LoadUnmappedRoots(const ObjectStream::ClassReadyCB& readyCB, const ObjectStream::FilterDescriptor& filterDesc = ObjectStream::FilterDescriptor());
+
+    private:
+        struct Root
+        {
+            Uuid m_typeId;
+            const void* m_object = nullptr;
+        };
+
+        IO::MappedFile m_file;
+        AZStd::vector<Root> m_roots;
+        AZStd::span<const AZStd::byte> m_unmappedRootStream;
+        SerializeContext* m_sc = nullptr;
+    };
+
+    template<class T>
+    const T* MappedObjectStream::GetMappedRoot(size_t rootIndex) const
+    {
+        if (rootIndex < m_roots.size() && m_roots[rootIndex].m_typeId == AzTypeInfo<T>::Uuid())
+        {
+            return reinterpret_cast<const T*>(m_roots[rootIndex].m_object);
+        }
+        return nullptr;
+    }
+
+    /// @cond EXCLUDE_DOCS
+    namespace ObjectStreamInternal
+    {
+        //! First byte of a stream in the mapped format.
+        static constexpr u8 s_mappedStreamTag = 'M';
+
+        //! Creates the writer for DataStream::ST_BINARY_MAPPED.
+        ObjectStream* CreateMappedObjectStream(IO::GenericStream* stream, SerializeContext& sc);
+
+        //! Loads a stream in the mapped format by copying the mapped root objects.
+        //! Used by ObjectStream::LoadBlocking.
+        bool LoadMappedObjectStream(AZStd::span<const AZStd::byte> data, SerializeContext& sc, const ObjectStream::ClassReadyCB& readyCB,
+            const ObjectStream::FilterDescriptor& filterDesc, const ObjectStream::InplaceLoadRootInfoCB& inplaceLoadRootInfoCB);
+    } // namespace ObjectStreamInternal
+    /// @endcond
+} // namespace AZ
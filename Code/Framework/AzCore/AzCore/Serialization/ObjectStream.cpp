@@ -9,6 +9,7 @@
 #include <AzCore/RTTI/AttributeReader.h>
 #include <AzCore/Asset/AssetSerializer.h>
 #include <AzCore/Serialization/ObjectStream.h>
+#include <AzCore/Serialization/MappedObjectStream.h>
 #include <AzCore/Serialization/DataOverlayInstanceMsgs.h>
 #include <AzCore/Serialization/DataOverlayProviderMsgs.h>
 #include <AzCore/Serialization/DynamicSerializableField.h>
@@ -2126,9 +2127,26 @@ namespace AZ
                             m_jsonDoc = nullptr;
                         }
                     }
+                    else if (streamTag == s_mappedStreamTag)
+                    {
+                        SetType(ST_BINARY_MAPPED);
+                        AZStd::vector<AZStd::byte> memoryBuffer;
+                        memoryBuffer.resize_no_construct(static_cast<size_t>(len - m_stream->GetCurPos() + sizeof(streamTag)));
+                        memoryBuffer[0] = static_cast<AZStd::byte>(streamTag);
+                        const size_t bytesToRead = memoryBuffer.size() - sizeof(streamTag);
+                        if (m_stream->Read(bytesToRead, memoryBuffer.data() + sizeof(streamTag)) == bytesToRead)
+                        {
+                            result = LoadMappedObjectStream(memoryBuffer, *m_sc, m_readyCB, m_filterDesc, m_inplaceLoadInfoCB) && result;
+                        }
+                        else
+                        {
+                            m_errorLogger.ReportError("Failed to read the mapped object stream. Load aborted!");
+                            result = false;
+                        }
+                    }
                     else
                     {
-                        m_errorLogger.ReportError("Unknown stream tag (first byte): '\\0' binary, '<' xml or '{' json!");
+                        m_errorLogger.ReportError("Unknown stream tag (first byte): '\\0' binary, '<' xml, '{' json or 'M' mapped binary!");
                         // this is considered a "fatal" error since the entire stream is unreadable.
                         result = false;
                     }
@@ -2218,6 +2236,10 @@ namespace AZ
     /*static*/ ObjectStream* ObjectStream::Create(IO::GenericStream* stream, SerializeContext& sc, DataStream::StreamType fmt)
     {
         AZ_Assert(stream != nullptr, "You are trying to serialize to a NULL stream!");
+        if (fmt == ST_BINARY_MAPPED)
+        {
+            return ObjectStreamInternal::CreateMappedObjectStream(stream, sc);
+        }
         ObjectStreamInternal::ObjectStreamImpl* objStream = aznew ObjectStreamInternal::ObjectStreamImpl(stream, &sc, ClassReadyCB(), CompletionCB(), FilterDescriptor(), ObjectStreamInternal::ObjectStreamImpl::OPF_SAVING, InplaceLoadRootInfoCB());
         objStream->SetType(fmt);
         bool result = objStream->Start();
@@ -69,6 +69,7 @@ namespace AZ
             ST_XML,
             ST_JSON,
             ST_BINARY,
+            ST_BINARY_MAPPED, // Memory images of trivially copyable root objects, see MappedObjectStream.
             ST_MAX // insert new types before this.
         };
 
@@ -975,6 +975,8 @@ namespace AZ::Serialize
 
         Edit::ClassData* m_editData;         ///< Edit data for the class display.
         ClassElementArray   m_elements;         ///< Sub elements. If this is not empty m_serializer should be NULL (there is no point to have sub-elements, if we can serialize the entire class).
+        size_t              m_classSize{};      ///< sizeof the class. 0 if the class wasn't reflected from a C++ type.
+        bool                m_isTriviallyCopyable{}; ///< True if instances of the class can be copied byte by byte (AZStd::is_trivially_copyable).
 
         // A collection of single-node upgrades to apply during serialization
         // The map is keyed by the version the upgrades are converting from
@@ -2049,6 +2051,8 @@ namespace AZ
                 factory, deprecatedNameVisitor,
                 GetRttiHelper<T>(), &AnyTypeInfoConcept<T>::CreateAny, AZStd::move(createAnyActionHandler));
             AddClassData<T, TBaseClasses...>(&builder.m_classData->second);
+            builder.m_classData->second.m_classSize = sizeof(T);
+            builder.m_classData->second.m_isTriviallyCopyable = AZStd::is_trivially_copyable_v<T>;
 
             return builder;
         }
@@ -2615,6 +2619,8 @@ namespace AZ::Serialize
         {
             return AnyTypeInfoConcept<T>::GetAnyActionHandler(serializeContext);
         });
+        createdClassData.m_classSize = sizeof(T);
+        createdClassData.m_isTriviallyCopyable = AZStd::is_trivially_copyable_v<T>;
         return createdClassData;
     }
 }
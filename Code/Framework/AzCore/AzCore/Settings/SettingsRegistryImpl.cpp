@@ -18,10 +18,12 @@
 #include <AzCore/Serialization/Json/StackedString.h>
 #include <AzCore/Serialization/Locale.h>
 #include <AzCore/Settings/SettingsRegistryImpl.h>
+#include <AzCore/std/algorithm.h>
 #include <AzCore/std/sort.h>
 #include <AzCore/std/parallel/scoped_lock.h>
 #include <AzCore/std/ranges/ranges_algorithm.h>
 #include <AzCore/std/ranges/split_view.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 
 namespace AZ::SettingsRegistryImplInternal
 {
@@ -49,10 +51,186 @@ namespace AZ::SettingsRegistryImplInternal
 
         return Type::NoType;
     }
+
+    [[nodiscard]] AZ::SettingsRegistryInterface::SettingsType GetSettingsType(const rapidjson::Value* value)
+    {
+        using SettingsType = AZ::SettingsRegistryInterface::SettingsType;
+        using Signedness = AZ::SettingsRegistryInterface::Signedness;
+        if (value == nullptr)
+        {
+            return { AZ::SettingsRegistryInterface::Type::NoType, Signedness::None };
+        }
+
+        SettingsType type;
+        type.m_type = RapidjsonToSettingsRegistryType(*value);
+        if (value->IsInt64())
+        {
+            type.m_signedness = Signedness::Signed;
+        }
+        else if (value->IsUint64())
+        {
+            type.m_signedness = Signedness::Unsigned;
+        }
+        return type;
+    }
+
+    template<typename T>
+    bool GetValue(T& result, const rapidjson::Value* value)
+    {
+        if constexpr (AZStd::is_same_v<T, bool>)
+        {
+            if (value && value->IsBool())
+            {
+                result = value->GetBool();
+                return true;
+            }
+        }
+        else if constexpr (AZStd::is_same_v<T, AZ::s64>)
+        {
+            if (value && value->IsInt64())
+            {
+                result = value->GetInt64();
+                return true;
+            }
+        }
+        else if constexpr (AZStd::is_same_v<T, AZ::u64>)
+        {
+            if (value && value->IsUint64())
+            {
+                result = value->GetUint64();
+                return true;
+            }
+        }
+        else if constexpr (AZStd::is_same_v<T, double>)
+        {
+            if (value && value->IsDouble())
+            {
+                result = value->GetDouble();
+                return true;
+            }
+        }
+        else if constexpr (AZStd::is_same_v<T, AZStd::string> || AZStd::is_same_v<T, AZ::SettingsRegistryInterface::FixedValueString>)
+        {
+            if (value && value->IsString())
+            {
+                result.append(value->GetString(), value->GetStringLength());
+                return true;
+            }
+        }
+        else
+        {
+            static_assert(!AZStd::is_same_v<T,T>, "SettingsRegistryImpl::GetValueInternal called with unsupported type.");
+        }
+        return false;
+    }
+
+    [[nodiscard]] AZStd::string_view GetTokenName(const rapidjson::Pointer::Token& token)
+    {
+        return AZStd::string_view(token.name, token.length);
+    }
 }
 
 namespace AZ
 {
+    struct SettingsRegistryImpl::Snapshot
+    {
+        AZ_CLASS_ALLOCATOR(Snapshot, AZ::OSAllocator);
+
+        using PartitionPtr = AZStd::shared_ptr<const rapidjson::Document>;
+        struct Member
+        {
+            AZStd::string m_name;
+            PartitionPtr m_partition;
+        };
+        struct Entry
+        {
+            AZStd::string m_name;
+            //! Set if the top level value isn't an object.
+            PartitionPtr m_partition;
+            //! Otherwise each member of the top level object has its own partition. Sorted by name.
+            AZStd::vector<Member> m_members;
+        };
+
+        static PartitionPtr MakePartition(const rapidjson::Value& value)
+        {
+            auto partition = AZStd::make_shared<rapidjson::Document>();
+            partition->CopyFrom(value, partition->GetAllocator());
+            return partition;
+        }
+
+        template<typename Container>
+        static auto FindByName(Container& container, AZStd::string_view name)
+        {
+            auto it = AZStd::lower_bound(container.begin(), container.end(), name,
+                [](const auto& element, AZStd::string_view searchName) { return AZStd::string_view(element.m_name) < searchName; });
+            return (it != container.end() && AZStd::string_view(it->m_name) == name) ? it : container.end();
+        }
+
+        template<typename Container>
+        static void SortByName(Container& container)
+        {
+            // Stable so that a duplicated name resolves to the first member, matching rapidjson::Value::FindMember
+            AZStd::stable_sort(container.begin(), container.end(),
+                [](const auto& lhs, const auto& rhs) { return lhs.m_name < rhs.m_name; });
+        }
+
+        static void SetMembers(Entry& entry, const rapidjson::Value& value)
+        {
+            entry.m_members.clear();
+            entry.m_members.reserve(value.MemberCount());
+            for (auto member = value.MemberBegin(); member != value.MemberEnd(); ++member)
+            {
+                entry.m_members.push_back({ AZStd::string(member->name.GetString(), member->name.GetStringLength()),
+                    MakePartition(member->value) });
+            }
+            SortByName(entry.m_members);
+        }
+
+        static Entry MakeEntry(AZStd::string_view name, const rapidjson::Value& value)
+        {
+            Entry entry;
+            entry.m_name = name;
+            if (value.IsObject())
+            {
+                SetMembers(entry, value);
+            }
+            else
+            {
+                entry.m_partition = MakePartition(value);
+            }
+            return entry;
+        }
+
+        void Build(const rapidjson::Value& settings)
+        {
+            m_entries.clear();
+            if (settings.IsObject())
+            {
+                m_entries.reserve(settings.MemberCount());
+                for (auto member = settings.MemberBegin(); member != settings.MemberEnd(); ++member)
+                {
+                    m_entries.push_back(MakeEntry(AZStd::string_view(member->name.GetString(), member->name.GetStringLength()),
+                        member->value));
+                }
+                SortByName(m_entries);
+            }
+        }
+
+        AZStd::vector<Entry> m_entries;
+        AZ::u64 m_version{};
+    };
+
+    SettingsRegistryImpl::KeyHandle::KeyHandle(AZStd::string_view path)
+        // rapidjson::Pointer asserts that the supplied string is not nullptr even if the supplied size is 0
+        : m_pointer(path.empty() ? "" : path.data(), path.size())
+    {
+    }
+
+    bool SettingsRegistryImpl::KeyHandle::IsValid() const
+    {
+        return m_pointer.IsValid();
+    }
+
     SettingsRegistryImpl::ScopedMergeEvent::ScopedMergeEvent(SettingsRegistryImpl& settingsRegistry,
         MergeEventArgs mergeEventArgs)
         : m_settingsRegistry{ settingsRegistry }
@@ -114,6 +292,7 @@ namespace AZ
                 static_assert(!AZStd::is_same_v<T, T>, "SettingsRegistryImpl::SetValueInternal called with unsupported type.");
             }
 
+            PublishSnapshot(pointer);
             return true;
         }
         return false;
@@ -132,55 +311,60 @@ namespace AZ
         rapidjson::Pointer pointer(path.data(), path.length());
         if (pointer.IsValid())
         {
-            AZStd::scoped_lock lock(LockForReading());
-
-            const rapidjson::Value* value = pointer.Get(m_settings);
-            if constexpr (AZStd::is_same_v<T, bool>)
-            {
-                if (value && value->IsBool())
-                {
-                    result = value->GetBool();
-                    return true;
-                }
-            }
-            else if constexpr (AZStd::is_same_v<T, s64>)
+            if (m_snapshot.load(AZStd::memory_order_relaxed) != nullptr)
             {
-                if (value && value->IsInt64())
+                EpochReclaimer::ReadGuard readGuard(m_snapshotReclaimer);
+                if (const Snapshot* snapshot = m_snapshot.load(AZStd::memory_order_acquire); snapshot != nullptr)
                 {
-                    result = value->GetInt64();
-                    return true;
-                }
-            }
-            else if constexpr (AZStd::is_same_v<T, u64>)
-            {
-                if (value && value->IsUint64())
-                {
-                    result = value->GetUint64();
-                    return true;
+                    const rapidjson::Value* value{};
+                    const Snapshot::PartitionPtr* partition{};
+                    if (SnapshotLookup lookup = FindInSnapshot(*snapshot, pointer, value, partition); lookup != SnapshotLookup::Unresolved)
+                    {
+                        return SettingsRegistryImplInternal::GetValue(result, value);
+                    }
                 }
             }
-            else if constexpr (AZStd::is_same_v<T, double>)
+
+            AZStd::scoped_lock lock(LockForReading());
+            return SettingsRegistryImplInternal::GetValue(result, pointer.Get(m_settings));
+        }
+        return false;
+    }
+
+    template<typename T>
+    bool SettingsRegistryImpl::GetValueInternal(T& result, KeyHandle& key) const
+    {
+        if (!key.IsValid())
+        {
+            return false;
+        }
+
+        if (m_snapshot.load(AZStd::memory_order_relaxed) != nullptr)
+        {
+            // The handle keeps the partition of the cached node alive, so it can be read without entering a read epoch
+            if (key.m_registry == this && key.m_version == m_snapshotVersion.load(AZStd::memory_order_acquire))
             {
-                if (value && value->IsDouble())
-                {
-                    result = value->GetDouble();
-                    return true;
-                }
+                return SettingsRegistryImplInternal::GetValue(result, key.m_value);
             }
-            else if constexpr (AZStd::is_same_v<T, AZStd::string> || AZStd::is_same_v<T, SettingsRegistryInterface::FixedValueString>)
+
+            EpochReclaimer::ReadGuard readGuard(m_snapshotReclaimer);
+            if (const Snapshot* snapshot = m_snapshot.load(AZStd::memory_order_acquire); snapshot != nullptr)
             {
-                if (value && value->IsString())
+                const rapidjson::Value* value{};
+                const Snapshot::PartitionPtr* partition{};
+                if (SnapshotLookup lookup = FindInSnapshot(*snapshot, key.m_pointer, value, partition); lookup != SnapshotLookup::Unresolved)
                 {
-                    result.append(value->GetString(), value->GetStringLength());
-                    return true;
+                    key.m_registry = this;
+                    key.m_version = snapshot->m_version;
+                    key.m_partition = lookup == SnapshotLookup::Found ? *partition : nullptr;
+                    key.m_value = lookup == SnapshotLookup::Found ? value : nullptr;
+                    return SettingsRegistryImplInternal::GetValue(result, key.m_value);
                 }
             }
-            else
-            {
-                static_assert(!AZStd::is_same_v<T,T>, "SettingsRegistryImpl::GetValueInternal called with unsupported type.");
-            }
         }
-        return false;
+
+        AZStd::scoped_lock lock(LockForReading());
+        return SettingsRegistryImplInternal::GetValue(result, key.m_pointer.Get(m_settings));
     }
 
     SettingsRegistryImpl::SettingsRegistryImpl()
@@ -196,7 +380,10 @@ namespace AZ
         m_useFileIo = useFileIo;
     }
 
-    SettingsRegistryImpl::~SettingsRegistryImpl() = default;
+    SettingsRegistryImpl::~SettingsRegistryImpl()
+    {
+        delete m_snapshot.load();
+    }
 
     void SettingsRegistryImpl::SetContext(SerializeContext* context)
     {
@@ -405,6 +592,20 @@ namespace AZ
         rapidjson::Pointer pointer(path.data(), path.length());
         if (pointer.IsValid())
         {
+            if (m_snapshot.load(AZStd::memory_order_relaxed) != nullptr)
+            {
+                EpochReclaimer::ReadGuard readGuard(m_snapshotReclaimer);
+                if (const Snapshot* snapshot = m_snapshot.load(AZStd::memory_order_acquire); snapshot != nullptr)
+                {
+                    const rapidjson::Value* value{};
+                    const Snapshot::PartitionPtr* partition{};
+                    if (SnapshotLookup lookup = FindInSnapshot(*snapshot, pointer, value, partition); lookup != SnapshotLookup::Unresolved)
+                    {
+                        return SettingsRegistryImplInternal::GetSettingsType(value);
+                    }
+                }
+            }
+
             AZStd::scoped_lock lock(LockForReading());
             return GetTypeNoLock(path);
         }
@@ -423,20 +624,7 @@ namespace AZ
         rapidjson::Pointer pointer(path.data(), path.length());
         if (pointer.IsValid())
         {
-            if (const rapidjson::Value* value = pointer.Get(m_settings); value != nullptr)
-            {
-                SettingsType type;
-                type.m_type = SettingsRegistryImplInternal::RapidjsonToSettingsRegistryType(*value);
-                if (value->IsInt64())
-                {
-                    type.m_signedness = Signedness::Signed;
-                }
-                else if (value->IsUint64())
-                {
-                    type.m_signedness = Signedness::Unsigned;
-                }
-                return type;
-            }
+            return SettingsRegistryImplInternal::GetSettingsType(pointer.Get(m_settings));
         }
         return { Type::NoType, Signedness::None };
     }
@@ -472,6 +660,36 @@ namespace AZ
         return GetValueInternal(result, path);
     }
 
+    bool SettingsRegistryImpl::Get(bool& result, KeyHandle& key) const
+    {
+        return GetValueInternal(result, key);
+    }
+
+    bool SettingsRegistryImpl::Get(s64& result, KeyHandle& key) const
+    {
+        return GetValueInternal(result, key);
+    }
+
+    bool SettingsRegistryImpl::Get(u64& result, KeyHandle& key) const
+    {
+        return GetValueInternal(result, key);
+    }
+
+    bool SettingsRegistryImpl::Get(double& result, KeyHandle& key) const
+    {
+        return GetValueInternal(result, key);
+    }
+
+    bool SettingsRegistryImpl::Get(AZStd::string& result, KeyHandle& key) const
+    {
+        return GetValueInternal(result, key);
+    }
+
+    bool SettingsRegistryImpl::Get(FixedValueString& result, KeyHandle& key) const
+    {
+        return GetValueInternal(result, key);
+    }
+
     bool SettingsRegistryImpl::GetObject(void* result, AZ::Uuid resultTypeID, AZStd::string_view path) const
     {
         if (path.empty())
@@ -485,6 +703,36 @@ namespace AZ
         rapidjson::Pointer pointer(path.data(), path.length());
         if (pointer.IsValid())
         {
+            if (m_snapshot.load(AZStd::memory_order_relaxed) != nullptr)
+            {
+                // Hold on to the partition so the value can be loaded outside of the read epoch
+                Snapshot::PartitionPtr partitionRef;
+                const rapidjson::Value* value{};
+                SnapshotLookup lookup = SnapshotLookup::Unresolved;
+                {
+                    EpochReclaimer::ReadGuard readGuard(m_snapshotReclaimer);
+                    if (const Snapshot* snapshot = m_snapshot.load(AZStd::memory_order_acquire); snapshot != nullptr)
+                    {
+                        const Snapshot::PartitionPtr* partition{};
+                        lookup = FindInSnapshot(*snapshot, pointer, value, partition);
+                        if (lookup == SnapshotLookup::Found)
+                        {
+                            partitionRef = *partition;
+                        }
+                    }
+                }
+
+                if (lookup == SnapshotLookup::Missing)
+                {
+                    return false;
+                }
+                if (lookup == SnapshotLookup::Found)
+                {
+                    JsonSerializationResult::ResultCode jsonResult = JsonSerialization::Load(result, resultTypeID, *value, m_deserializationSettings);
+                    return jsonResult.GetProcessing() != JsonSerializationResult::Processing::Halted;
+                }
+            }
+
             AZStd::scoped_lock lock(LockForReading());
             const rapidjson::Value* value = pointer.Get(m_settings);
             if (value)
@@ -575,6 +823,7 @@ namespace AZ
                     rapidjson::Value& setting = pointer.Create(m_settings, m_settings.GetAllocator());
                     setting = AZStd::move(store);
                     anchorType = GetTypeNoLock(path);
+                    PublishSnapshot(pointer);
                 }
                 SignalNotifier(path, anchorType);
                 return true;
@@ -602,6 +851,10 @@ namespace AZ
         {
             AZStd::scoped_lock lock(LockForWriting());
             removeSuccess = pointerPath.Erase(m_settings);
+            if (removeSuccess)
+            {
+                PublishSnapshot(pointerPath);
+            }
         }
 
         // The removal type is Type::NoType
@@ -1436,6 +1689,8 @@ namespace AZ
             // Merge the @jsonPatchPostImport object after the imports have been resolved into the Settings Registry
             JsonSerializationResult::ResultCode patchResult =
                 JsonSerialization::ApplyPatch(anchorRoot, m_settings.GetAllocator(), jsonPatchPostImport, mergeApproach, applyPatchSettings);
+            // A failed patch can still have partially modified the settings
+            PublishSnapshot(anchorPath);
             if (patchResult.GetProcessing() != JsonSerializationResult::Processing::Completed)
             {
                 mergeResult.Combine(MergeSettingsReturnCode::Failure);
@@ -1474,6 +1729,150 @@ namespace AZ
         m_useFileIo = useFileIo;
     }
 
+    void SettingsRegistryImpl::SetSnapshotMode(bool enable)
+    {
+        AZStd::scoped_lock lock(LockForWriting());
+        Snapshot* previous = m_snapshot.load(AZStd::memory_order_relaxed);
+        if (enable && previous == nullptr)
+        {
+            auto snapshot = aznew Snapshot;
+            snapshot->Build(m_settings);
+            snapshot->m_version = m_snapshotVersion.load(AZStd::memory_order_relaxed) + 1;
+            m_snapshot.store(snapshot, AZStd::memory_order_release);
+            m_snapshotVersion.store(snapshot->m_version, AZStd::memory_order_release);
+        }
+        else if (!enable && previous != nullptr)
+        {
+            m_snapshot.store(nullptr, AZStd::memory_order_release);
+            m_snapshotReclaimer.Retire(previous);
+            m_snapshotReclaimer.Reclaim();
+        }
+    }
+
+    bool SettingsRegistryImpl::IsSnapshotModeEnabled() const
+    {
+        return m_snapshot.load(AZStd::memory_order_acquire) != nullptr;
+    }
+
+    AZ::u64 SettingsRegistryImpl::GetSnapshotVersion() const
+    {
+        return m_snapshotVersion.load(AZStd::memory_order_acquire);
+    }
+
+    auto SettingsRegistryImpl::FindInSnapshot(const Snapshot& snapshot, const rapidjson::Pointer& pointer,
+        const rapidjson::Value*& value, const Snapshot::PartitionPtr*& partition) const -> SnapshotLookup
+    {
+        using SettingsRegistryImplInternal::GetTokenName;
+
+        const size_t tokenCount = pointer.GetTokenCount();
+        if (tokenCount == 0)
+        {
+            return SnapshotLookup::Unresolved;
+        }
+
+        const rapidjson::Pointer::Token* tokens = pointer.GetTokens();
+        auto entry = Snapshot::FindByName(snapshot.m_entries, GetTokenName(tokens[0]));
+        if (entry == snapshot.m_entries.end())
+        {
+            return SnapshotLookup::Missing;
+        }
+
+        size_t resolvedTokenCount = 1;
+        partition = &entry->m_partition;
+        if (!entry->m_partition)
+        {
+            // The top level object itself isn't stored in a single partition
+            if (tokenCount == 1)
+            {
+                return SnapshotLookup::Unresolved;
+            }
+
+            auto member = Snapshot::FindByName(entry->m_members, GetTokenName(tokens[1]));
+            if (member == entry->m_members.end())
+            {
+                return SnapshotLookup::Missing;
+            }
+            resolvedTokenCount = 2;
+            partition = &member->m_partition;
+        }
+
+        // The pointer only references the tokens, so the remaining path isn't parsed again
+        value = rapidjson::Pointer(tokens + resolvedTokenCount, tokenCount - resolvedTokenCount).Get(**partition);
+        return value != nullptr ? SnapshotLookup::Found : SnapshotLookup::Missing;
+    }
+
+    void SettingsRegistryImpl::PublishSnapshot(const rapidjson::Pointer& modifiedPointer)
+    {
+        using SettingsRegistryImplInternal::GetTokenName;
+
+        Snapshot* previous = m_snapshot.load(AZStd::memory_order_relaxed);
+        if (previous == nullptr)
+        {
+            return;
+        }
+
+        auto snapshot = aznew Snapshot;
+        const size_t tokenCount = modifiedPointer.GetTokenCount();
+        if (tokenCount == 0 || !m_settings.IsObject())
+        {
+            snapshot->Build(m_settings);
+        }
+        else
+        {
+            // Only copy the partitions that can contain the modified value, the others are shared with the previous snapshot
+            snapshot->m_entries = previous->m_entries;
+            const rapidjson::Pointer::Token* tokens = modifiedPointer.GetTokens();
+            const AZStd::string_view name = GetTokenName(tokens[0]);
+            auto entry = Snapshot::FindByName(snapshot->m_entries, name);
+            auto settingsMember = m_settings.FindMember(rapidjson::Value(rapidjson::StringRef(tokens[0].name, tokens[0].length)));
+
+            if (settingsMember == m_settings.MemberEnd())
+            {
+                if (entry != snapshot->m_entries.end())
+                {
+                    snapshot->m_entries.erase(entry);
+                }
+            }
+            else if (entry == snapshot->m_entries.end())
+            {
+                snapshot->m_entries.push_back(Snapshot::MakeEntry(name, settingsMember->value));
+                Snapshot::SortByName(snapshot->m_entries);
+            }
+            else if (tokenCount >= 2 && !entry->m_partition && settingsMember->value.IsObject())
+            {
+                const AZStd::string_view memberName = GetTokenName(tokens[1]);
+                auto member = Snapshot::FindByName(entry->m_members, memberName);
+                const rapidjson::Value& object = settingsMember->value;
+                auto objectMember = object.FindMember(rapidjson::Value(rapidjson::StringRef(tokens[1].name, tokens[1].length)));
+                if (objectMember == object.MemberEnd())
+                {
+                    if (member != entry->m_members.end())
+                    {
+                        entry->m_members.erase(member);
+                    }
+                }
+                else if (member != entry->m_members.end())
+                {
+                    member->m_partition = Snapshot::MakePartition(objectMember->value);
+                }
+                else
+                {
+                    entry->m_members.push_back({ AZStd::string(memberName), Snapshot::MakePartition(objectMember->value) });
+                    Snapshot::SortByName(entry->m_members);
+                }
+            }
+            else
+            {
+                *entry = Snapshot::MakeEntry(name, settingsMember->value);
+            }
+        }
+
+        snapshot->m_version = previous->m_version + 1;
+        m_snapshot.store(snapshot, AZStd::memory_order_release);
+        m_snapshotVersion.store(snapshot->m_version, AZStd::memory_order_release);
+        m_snapshotReclaimer.Retire(previous);
+    }
+
     AZStd::scoped_lock<AZStd::recursive_mutex> SettingsRegistryImpl::LockForWriting() const
     {
         // ensure that we aren't actively iterating over this data that is about to be
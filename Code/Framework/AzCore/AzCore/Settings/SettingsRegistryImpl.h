@@ -14,10 +14,13 @@
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/Serialization/Json/JsonSerialization.h>
 #include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/Threading/EpochReclaimer.h>
 #include <AzCore/std/containers/fixed_vector.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/parallel/scoped_lock.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
 
 namespace AZ
 {
@@ -32,7 +35,33 @@ namespace AZ
         AZ_RTTI(AZ::SettingsRegistryImpl, "{E9C34190-F888-48CA-83C9-9F24B4E21D72}", AZ::SettingsRegistryInterface);
 
         static constexpr size_t MaxRegistryFolderEntries = 128;
-        
+
+        //! A JSON pointer that is parsed once and caches the node it resolved to.
+        //! Passing a KeyHandle to Get instead of a path skips parsing the path on each call, and while
+        //! snapshot mode is enabled the cached node is reused until the registry publishes a new snapshot.
+        //! A KeyHandle updates its cache while being read, so a single handle shouldn't be used by multiple
+        //! threads at the same time. Use a handle per thread instead.
+        class KeyHandle
+        {
+        public:
+            KeyHandle() = default;
+            explicit KeyHandle(AZStd::string_view path);
+
+            //! Returns true if the path supplied on construction is a valid JSON pointer.
+            [[nodiscard]] bool IsValid() const;
+
+        private:
+            friend class SettingsRegistryImpl;
+
+            rapidjson::Pointer m_pointer;
+            //! Registry and snapshot version the cached node was resolved against.
+            const SettingsRegistryImpl* m_registry{};
+            AZ::u64 m_version{};
+            //! Keeps the snapshot partition containing m_value alive.
+            AZStd::shared_ptr<const rapidjson::Document> m_partition;
+            const rapidjson::Value* m_value{};
+        };
+
         SettingsRegistryImpl();
         //! @param useFileIo - If true attempt to redirect
         //! file read operations through the FileIOBase instance first before falling back to SystemFile
@@ -65,6 +94,13 @@ namespace AZ
         bool Get(SettingsRegistryInterface::FixedValueString& result, AZStd::string_view path) const override;
         bool GetObject(void* result, AZ::Uuid resultTypeID, AZStd::string_view path) const override;
 
+        bool Get(bool& result, KeyHandle& key) const;
+        bool Get(s64& result, KeyHandle& key) const;
+        bool Get(u64& result, KeyHandle& key) const;
+        bool Get(double& result, KeyHandle& key) const;
+        bool Get(AZStd::string& result, KeyHandle& key) const;
+        bool Get(SettingsRegistryInterface::FixedValueString& result, KeyHandle& key) const;
+
         bool Set(AZStd::string_view path, bool value) override;
         bool Set(AZStd::string_view path, s64 value) override;
         bool Set(AZStd::string_view path, u64 value) override;
@@ -88,6 +124,15 @@ namespace AZ
 
         void SetUseFileIO(bool useFileIo) override;
 
+        //! Enables or disables snapshot mode.
+        //! In snapshot mode Get, GetObject and GetType read from an immutable copy of the settings without locking.
+        //! Every modification publishes a new snapshot, so this is meant to be enabled once merging
+        //! the settings at startup is done and the registry is mostly read from.
+        void SetSnapshotMode(bool enable);
+        [[nodiscard]] bool IsSnapshotModeEnabled() const;
+        //! Returns the version of the latest published snapshot. The version increases with every published snapshot.
+        [[nodiscard]] AZ::u64 GetSnapshotVersion() const;
+
     private:
         using TagList = AZStd::fixed_vector<size_t, Specializations::MaxCount + 1>;
         struct RegistryFile
@@ -125,6 +170,32 @@ namespace AZ
 
         void SignalNotifier(AZStd::string_view jsonPath, SettingsType type);
 
+        //! Immutable copy of the settings that is read without locking while snapshot mode is enabled.
+        //! The settings are split into partitions, one for each member of a top level object and one for every
+        //! other top level value. Partitions are shared between snapshots, so publishing a snapshot after a
+        //! modification only copies the partitions that were touched.
+        struct Snapshot;
+        enum class SnapshotLookup
+        {
+            Found,
+            Missing,
+            //! The path can't be resolved within a single partition and has to be read from m_settings.
+            Unresolved
+        };
+
+        //! Number of replaced snapshots that are collected before waiting on readers to delete them.
+        static constexpr size_t RetiredSnapshotBatchSize = 16;
+
+        //! Looks up the value at the pointer in the current snapshot. Must be called in a read epoch.
+        SnapshotLookup FindInSnapshot(const Snapshot& snapshot, const rapidjson::Pointer& pointer,
+            const rapidjson::Value*& value, const AZStd::shared_ptr<const rapidjson::Document>*& partition) const;
+        //! Publishes a new snapshot that reflects a modification of the settings at the pointer.
+        //! Requires the settings mutex to be locked for writing.
+        void PublishSnapshot(const rapidjson::Pointer& modifiedPointer);
+
+        template<typename T>
+        bool GetValueInternal(T& result, KeyHandle& key) const;
+
         //! Locks the m_settingMutex but also checks to make sure that someone is not currently
         //! visiting/iterating over the registry, which is invalid if you're about to modify it
         AZStd::scoped_lock<AZStd::recursive_mutex> LockForWriting() const;
@@ -155,6 +226,12 @@ namespace AZ
         AZStd::atomic_int m_signalCount{};
 
         rapidjson::Document m_settings;
+
+        //! Latest snapshot of m_settings. Only set while snapshot mode is enabled.
+        AZStd::atomic<Snapshot*> m_snapshot{ nullptr };
+        AZStd::atomic<AZ::u64> m_snapshotVersion{ 0 };
+        //! Deletes replaced snapshots once readers are done with them. Retiring is protected by m_settingMutex
+        EpochReclaimer m_snapshotReclaimer{ RetiredSnapshotBatchSize };
         JsonSerializerSettings m_serializationSettings;
         JsonDeserializerSettings m_deserializationSettings;
         //! If set to true, then the JSON Patch/JSON Merge Patch operations
@@ -145,6 +145,10 @@ namespace AZ::Internal
 
         uint8_t GetPriorityNumber() const noexcept;
 
+        TaskAffinity GetAffinity() const noexcept;
+
+        uint32_t GetCpuMask() const noexcept;
+
     private:
         friend class CompiledTaskGraph;
         friend class TaskWorker;
@@ -71,6 +71,16 @@ namespace AZ::Internal
         return static_cast<uint8_t>(m_descriptor.priority);
     }
 
+    inline TaskAffinity Task::GetAffinity() const noexcept
+    {
+        return m_descriptor.affinity;
+    }
+
+    inline uint32_t Task::GetCpuMask() const noexcept
+    {
+        return m_descriptor.cpuMask;
+    }
+
     inline void Task::Link(Task& other)
     {
         ++m_outboundLinkCount;
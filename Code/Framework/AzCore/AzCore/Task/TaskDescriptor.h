@@ -25,6 +25,19 @@ namespace AZ
         PRIORITY_COUNT = 4,
     };
 
+    // Placement hint used when a task becomes ready to run. Tasks can always be stolen by idle workers regardless of the
+    // hint, unless they're restricted through a cpuMask.
+    enum class TaskAffinity : uint8_t
+    {
+        // Tasks made ready by a worker thread (e.g. successors of a finished task) are pushed to that worker's local
+        // queue so they run while the data they share with their predecessor is still in cache. Tasks submitted from
+        // other threads are distributed across the workers.
+        LOCAL = 0, // Default
+        // Tasks are always distributed across the workers. Use this for large fan-outs of long running tasks where
+        // waiting for idle workers to steal the work from a single worker would delay the start of the branches.
+        SPREAD = 1,
+    };
+
     // All submitted tasks are associated with a TaskDescriptor which defines the priority, affinitization,
     // and tracking of the task resource utilization.
     //
@@ -42,8 +55,13 @@ namespace AZ
         // that were queued before it provided they had not yet started
         TaskPriority priority = TaskPriority::MEDIUM;
 
+        // Hint for where the task is queued when it becomes ready to run. This doesn't restrict where the task runs.
+        TaskAffinity affinity = TaskAffinity::LOCAL;
+
         // EXPERTS ONLY. A bitmask that restricts tasks of this kind to run only on cores
-        // corresponding to a set bit. 0 is synonymous with all bits set
+        // corresponding to a set bit. 0 is synonymous with all bits set.
+        // Bit N corresponds to task worker N (modulo 32), which is the worker affinitized to core N if workers are
+        // affinitized. Restricted tasks are never stolen by other workers.
         uint32_t cpuMask = 0;
     };
 }
@@ -9,6 +9,7 @@
 #include <AzCore/Task/TaskExecutor.h>
 #include <AzCore/Task/TaskGraph.h>
 
+#include <AzCore/std/containers/deque.h>
 #include <AzCore/std/containers/queue.h>
 #include <AzCore/std/parallel/binary_semaphore.h>
 #include <AzCore/std/parallel/exponential_backoff.h>
@@ -122,7 +123,7 @@ namespace AZ
             TaskQueue& operator=(const TaskQueue&) = delete;
 
             void Enqueue(Task* task);
-            Task* TryDequeue();
+            Task* TryDequeue(uint8_t priority);
 
         private:
             QueueStatus m_status[PriorityLevelCount] = {};
@@ -169,32 +170,124 @@ namespace AZ
             }
         }
 
-        Task* TaskQueue::TryDequeue()
+        Task* TaskQueue::TryDequeue(uint8_t priority)
         {
-            for (size_t priority = 0; priority != PriorityLevelCount; ++priority)
+            QueueStatus& status = m_status[priority];
+            while (true)
             {
-                QueueStatus& status = m_status[priority];
-                while (true)
+                uint16_t head = status.head.load();
+                uint16_t tail = status.tail.load();
+                if (head == tail)
                 {
-                    uint16_t head = status.head.load();
-                    uint16_t tail = status.tail.load();
-                    if (head == tail)
-                    {
-                        // Queue empty
-                        break;
-                    }
-                    else
+                    // Queue empty
+                    return nullptr;
+                }
+                else
+                {
+                    Task* task = m_queues[priority][head];
+                    if (status.head.compare_exchange_weak(head, head + 1))
                     {
-                        Task* task = m_queues[priority][status.head];
-                        if (status.head.compare_exchange_weak(head, head + 1))
-                        {
-                            return task;
-                        }
+                        return task;
                     }
                 }
             }
+        }
+
+        // The work stealing deque is a fixed capacity Chase-Lev deque holding tasks of a single priority level.
+        // Only the worker owning the deque pushes and pops tasks, which happens at the bottom of the deque (LIFO) so
+        // that successors of a task run while the data they share with their predecessor is still in cache. Other
+        // workers steal from the top of the deque (FIFO), which hands out the oldest pending branches of a graph
+        // first. Only a steal racing with the owner for the last remaining task needs to be resolved with a CAS.
+        class WorkStealingDeque final
+        {
+        public:
+            // Must be a power of two. When the deque is full tasks are pushed to the worker's TaskQueue instead.
+            constexpr static int64_t Capacity = 4096;
+
+            WorkStealingDeque() = default;
+            WorkStealingDeque(const WorkStealingDeque&) = delete;
+            WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+            // Only called by the owning worker. Returns false if the deque is full
+            bool Push(Task* task);
+            // Only called by the owning worker
+            Task* Pop();
+            // Can be called from any thread
+            Task* Steal();
+
+        private:
+            constexpr static int64_t IndexMask = Capacity - 1;
+
+            AZStd::atomic<int64_t> m_top = 0;
+            AZStd::atomic<int64_t> m_bottom = 0;
+            AZStd::atomic<Task*> m_tasks[Capacity] = {};
+        };
 
-            return nullptr;
+        bool WorkStealingDeque::Push(Task* task)
+        {
+            int64_t bottom = m_bottom.load(AZStd::memory_order_relaxed);
+            int64_t top = m_top.load(AZStd::memory_order_acquire);
+            if (bottom - top >= Capacity)
+            {
+                return false;
+            }
+
+            m_tasks[bottom & IndexMask].store(task, AZStd::memory_order_relaxed);
+            // Publish the task before advertising the new bottom to thieves
+            AZStd::atomic_thread_fence(AZStd::memory_order_release);
+            m_bottom.store(bottom + 1, AZStd::memory_order_relaxed);
+            return true;
+        }
+
+        Task* WorkStealingDeque::Pop()
+        {
+            int64_t bottom = m_bottom.load(AZStd::memory_order_relaxed) - 1;
+            m_bottom.store(bottom, AZStd::memory_order_relaxed);
+            // The reservation of the bottom slot has to be visible to thieves before the top is read
+            AZStd::atomic_thread_fence(AZStd::memory_order_seq_cst);
+            int64_t top = m_top.load(AZStd::memory_order_relaxed);
+
+            if (top > bottom)
+            {
+                // Deque was empty, restore the bottom
+                m_bottom.store(bottom + 1, AZStd::memory_order_relaxed);
+                return nullptr;
+            }
+
+            Task* task = m_tasks[bottom & IndexMask].load(AZStd::memory_order_relaxed);
+            if (top == bottom)
+            {
+                // Last task in the deque, race any thieves for it
+                if (!m_top.compare_exchange_strong(top, top + 1, AZStd::memory_order_seq_cst, AZStd::memory_order_relaxed))
+                {
+                    task = nullptr;
+                }
+                m_bottom.store(bottom + 1, AZStd::memory_order_relaxed);
+            }
+            return task;
+        }
+
+        Task* WorkStealingDeque::Steal()
+        {
+            while (true)
+            {
+                int64_t top = m_top.load(AZStd::memory_order_acquire);
+                AZStd::atomic_thread_fence(AZStd::memory_order_seq_cst);
+                int64_t bottom = m_bottom.load(AZStd::memory_order_acquire);
+
+                if (top >= bottom)
+                {
+                    return nullptr;
+                }
+
+                Task* task = m_tasks[top & IndexMask].load(AZStd::memory_order_relaxed);
+                if (m_top.compare_exchange_strong(top, top + 1, AZStd::memory_order_seq_cst, AZStd::memory_order_relaxed))
+                {
+                    return task;
+                }
+
+                // Lost the race against the owner or another thief, try again while there are tasks left
+            }
         }
 
         class TaskWorker
@@ -202,9 +295,12 @@ namespace AZ
         public:
             static thread_local TaskWorker* t_worker;
 
+            constexpr static uint8_t PriorityLevelCount = TaskQueue::PriorityLevelCount;
+
             void Spawn(::AZ::TaskExecutor& executor, uint32_t id, AZStd::semaphore& initSemaphore, bool affinitize)
             {
                 m_executor = &executor;
+                m_id = id;
 
                 m_threadName = AZStd::string::format("TaskWorker %u", id);
                 AZStd::thread_desc desc = {};
@@ -228,6 +324,9 @@ namespace AZ
             void Disable()
             {
                 m_enabled = false;
+
+                // Tasks left in the local deques can only make progress if another worker steals them
+                m_executor->WakeOne(m_id + 1);
             }
 
             void Enable()
@@ -247,11 +346,54 @@ namespace AZ
                 m_thread.join();
             }
 
+            // Queue a task submitted by a thread other than this worker. The task can be stolen by other workers.
             void Enqueue(Task* task)
             {
                 m_queue.Enqueue(task);
 
-                m_semaphore.release();
+                if (!Wake())
+                {
+                    // This worker is busy, let an idle worker steal the task instead
+                    m_executor->WakeOne(m_id + 1);
+                }
+            }
+
+            // Queue a task that is restricted to this worker. Pinned tasks are never stolen.
+            void EnqueuePinned(Task* task)
+            {
+                {
+                    AZStd::scoped_lock<AZStd::mutex> lock(m_pinnedMutex);
+                    m_pinnedTasks[task->GetPriorityNumber()].push_back(task);
+                }
+                ++m_pinnedCount;
+
+                // The pinned count has to be visible before checking if this worker is asleep
+                AZStd::atomic_thread_fence(AZStd::memory_order_seq_cst);
+                Wake();
+            }
+
+            // Push a task made ready by this worker to its local deque. Must be called from this worker's thread.
+            void PushLocal(Task* task)
+            {
+                if (!m_deques[task->GetPriorityNumber()].Push(task))
+                {
+                    m_queue.Enqueue(task);
+                }
+
+                // Any idle worker can steal the task while this worker is busy
+                m_executor->WakeOne(m_id + 1);
+            }
+
+            // Returns true if the worker was asleep and has been woken up
+            bool Wake()
+            {
+                if (m_sleeping.load() && m_sleeping.exchange(false))
+                {
+                    --m_executor->m_sleepingWorkers;
+                    m_semaphore.release();
+                    return true;
+                }
+                return false;
             }
 
             const char* GetThreadName() {return m_threadName.c_str();}
@@ -259,47 +401,138 @@ namespace AZ
         private:
             void Run()
             {
-                while (m_active)
+                while (m_active.load(AZStd::memory_order_acquire))
                 {
-                    m_semaphore.acquire();
+                    Task* task = FindTask();
+                    if (!task)
+                    {
+                        // Advertise that this worker is going to sleep before looking for work one last time. A task
+                        // submitted in the meantime is either found by the second search or the submitter wakes this worker.
+                        m_sleeping = true;
+                        ++m_executor->m_sleepingWorkers;
+                        AZStd::atomic_thread_fence(AZStd::memory_order_seq_cst);
+
+                        task = FindTask();
+                        if (!task)
+                        {
+                            m_semaphore.acquire();
+                            continue;
+                        }
+
+                        if (m_sleeping.exchange(false))
+                        {
+                            --m_executor->m_sleepingWorkers;
+                        }
+                        // else a submitter already woke this worker and the next acquire of the semaphore returns
+                        // immediately, which costs an extra search for work but is otherwise harmless.
+                    }
+
+                    Execute(task);
+                }
+            }
 
-                    if (!m_active)
+            void Execute(Task* task)
+            {
+                task->Invoke();
+                // Decrement counts for all task successors
+                for (size_t j = 0; j != task->m_outboundLinkCount; ++j)
+                {
+                    Task* successor = task->m_graph->m_successors[task->m_successorOffset + j];
+                    if (--successor->m_dependencyCount == 0)
                     {
-                        return;
+                        m_executor->Submit(*successor);
+                    }
+                }
+
+                bool isRetained = task->m_graph->m_parent != nullptr;
+                if (task->m_graph->Release(m_executor->GetEventTracker()) == (isRetained ? 1u : 0u))
+                {
+                    m_executor->ReleaseGraph();
+                }
+            }
+
+            // Work owned by this worker is searched first, from the highest to the lowest priority. Only when this worker
+            // has nothing left to do, the queues of the other workers are searched, again from the highest priority down.
+            Task* FindTask()
+            {
+                for (uint8_t priority = 0; priority != PriorityLevelCount; ++priority)
+                {
+                    if (Task* task = TryDequeuePinned(priority); task)
+                    {
+                        return task;
+                    }
+                    if (Task* task = m_deques[priority].Pop(); task)
+                    {
+                        return task;
                     }
+                    if (Task* task = m_queue.TryDequeue(priority); task)
+                    {
+                        return task;
+                    }
+                }
 
-                    Task* task = m_queue.TryDequeue();
-                    while (task)
+                const uint32_t workerCount = m_executor->m_threadCount;
+                // Rotate the first victim so thieves spread out over the other workers instead of all hammering the same one
+                const uint32_t firstVictim = m_id + 1 + (m_stealRotation++ % workerCount);
+                for (uint8_t priority = 0; priority != PriorityLevelCount; ++priority)
+                {
+                    for (uint32_t i = 0; i != workerCount; ++i)
                     {
-                        task->Invoke();
-                        // Decrement counts for all task successors
-                        for (size_t j = 0; j != task->m_outboundLinkCount; ++j)
+                        TaskWorker& victim = m_executor->m_workers[(firstVictim + i) % workerCount];
+                        if (&victim == this)
                         {
-                            Task* successor = task->m_graph->m_successors[task->m_successorOffset + j];
-                            if (--successor->m_dependencyCount == 0)
-                            {
-                                m_executor->Submit(*successor);
-                            }
+                            continue;
                         }
-
-                        bool isRetained = task->m_graph->m_parent != nullptr;
-                        if (task->m_graph->Release(m_executor->GetEventTracker()) == (isRetained ? 1u : 0u))
+                        if (Task* task = victim.m_deques[priority].Steal(); task)
                         {
-                            m_executor->ReleaseGraph();
+                            return task;
+                        }
+                        if (Task* task = victim.m_queue.TryDequeue(priority); task)
+                        {
+                            return task;
                         }
-
-                        task = m_queue.TryDequeue();
                     }
                 }
+
+                return nullptr;
+            }
+
+            Task* TryDequeuePinned(uint8_t priority)
+            {
+                if (m_pinnedCount.load(AZStd::memory_order_acquire) == 0)
+                {
+                    return nullptr;
+                }
+
+                AZStd::scoped_lock<AZStd::mutex> lock(m_pinnedMutex);
+                AZStd::deque<Task*>& tasks = m_pinnedTasks[priority];
+                if (tasks.empty())
+                {
+                    return nullptr;
+                }
+                Task* task = tasks.front();
+                tasks.pop_front();
+                --m_pinnedCount;
+                return task;
             }
 
             AZStd::thread m_thread;
             AZStd::atomic<bool> m_active;
             AZStd::atomic<bool> m_enabled = true;
+            AZStd::atomic<bool> m_sleeping = false;
             AZStd::binary_semaphore m_semaphore;
 
             ::AZ::TaskExecutor* m_executor;
+            uint32_t m_id = 0;
+            uint32_t m_stealRotation = 0;
+            // Tasks made ready by this worker, one deque per priority level
+            WorkStealingDeque m_deques[PriorityLevelCount];
+            // Tasks submitted by other threads
             TaskQueue m_queue;
+            // Tasks restricted to this worker through their cpuMask. These are rare so a lock is acceptable here.
+            AZStd::mutex m_pinnedMutex;
+            AZStd::deque<Task*> m_pinnedTasks[PriorityLevelCount];
+            AZStd::atomic<uint32_t> m_pinnedCount = 0;
             AZStd::string m_threadName;
             friend class ::AZ::TaskExecutor;
         };
@@ -380,9 +613,14 @@ namespace AZ
 
         AZStd::semaphore initSemaphore;
 
+        // All workers need to exist before any of them starts running, as idle workers steal from their siblings
         for (uint32_t i = 0; i != m_threadCount; ++i)
         {
             new (m_workers + i) Internal::TaskWorker{};
+        }
+
+        for (uint32_t i = 0; i != m_threadCount; ++i)
+        {
             m_workers[i].Spawn(*this, i, initSemaphore, false);
         }
 
@@ -397,6 +635,10 @@ namespace AZ
         for (size_t i = 0; i != m_threadCount; ++i)
         {
             m_workers[i].Join();
+        }
+
+        for (size_t i = 0; i != m_threadCount; ++i)
+        {
             m_workers[i].~TaskWorker();
         }
 
@@ -451,9 +693,20 @@ namespace AZ
 
     void TaskExecutor::Submit(Internal::Task& task)
     {
-        // TODO: Something more sophisticated is likely needed here.
-        // First, we are completely ignoring affinity.
-        // Second, some heuristics on core availability will help distribute work more effectively
+        if (uint32_t cpuMask = task.GetCpuMask(); cpuMask != 0)
+        {
+            SubmitPinned(task, cpuMask);
+            return;
+        }
+
+        // Tasks made ready by a worker are kept local to that worker, idle workers steal them if the worker is busy
+        Internal::TaskWorker* worker = GetTaskWorker();
+        if (worker && worker->Enabled() && task.GetAffinity() == TaskAffinity::LOCAL)
+        {
+            worker->PushLocal(&task);
+            return;
+        }
+
         uint32_t nextWorker = ++m_lastSubmission % m_threadCount;
         while (!m_workers[nextWorker].Enabled())
         {
@@ -465,6 +718,59 @@ namespace AZ
         m_workers[nextWorker].Enqueue(&task);
     }
 
+    void TaskExecutor::SubmitPinned(Internal::Task& task, uint32_t cpuMask)
+    {
+        constexpr uint32_t MaskBitCount = 32;
+        auto isEligible = [cpuMask](uint32_t workerIndex)
+        {
+            return (cpuMask & (1u << (workerIndex % MaskBitCount))) != 0;
+        };
+
+        // Prefer an enabled worker, but fall back to a disabled one as pinned tasks can't run anywhere else
+        uint32_t firstWorker = ++m_lastSubmission % m_threadCount;
+        uint32_t fallbackWorker = m_threadCount;
+        for (uint32_t i = 0; i != m_threadCount; ++i)
+        {
+            uint32_t workerIndex = (firstWorker + i) % m_threadCount;
+            if (isEligible(workerIndex))
+            {
+                if (m_workers[workerIndex].Enabled())
+                {
+                    m_workers[workerIndex].EnqueuePinned(&task);
+                    return;
+                }
+                fallbackWorker = fallbackWorker == m_threadCount ? workerIndex : fallbackWorker;
+            }
+        }
+
+        if (fallbackWorker != m_threadCount)
+        {
+            m_workers[fallbackWorker].EnqueuePinned(&task);
+            return;
+        }
+
+        AZ_Warning("TaskExecutor", false, "Task cpuMask 0x%x doesn't match any of the %u task workers, ignoring the mask.", cpuMask, m_threadCount);
+        m_workers[firstWorker].Enqueue(&task);
+    }
+
+    void TaskExecutor::WakeOne(uint32_t firstCandidate)
+    {
+        // The task that's being advertised has to be visible before checking if any workers are asleep
+        AZStd::atomic_thread_fence(AZStd::memory_order_seq_cst);
+        if (m_sleepingWorkers.load() == 0)
+        {
+            return;
+        }
+
+        for (uint32_t i = 0; i != m_threadCount; ++i)
+        {
+            if (m_workers[(firstCandidate + i) % m_threadCount].Wake())
+            {
+                return;
+            }
+        }
+    }
+
     void TaskExecutor::ReleaseGraph()
     {
         --m_graphsRemaining;
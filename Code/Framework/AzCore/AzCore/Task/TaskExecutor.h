@@ -147,9 +147,15 @@ namespace AZ
         void ReleaseGraph();
         void ReactivateTaskWorker();
 
+        // Queue a task on one of the workers selected by the cpuMask
+        void SubmitPinned(Internal::Task& task, uint32_t cpuMask);
+        // Wake up a single sleeping worker, if any, so it can steal newly queued work
+        void WakeOne(uint32_t firstCandidate);
+
         Internal::TaskWorker* m_workers;
         uint32_t m_threadCount = 0;
         AZStd::atomic<uint32_t> m_lastSubmission;
+        AZStd::atomic<uint32_t> m_sleepingWorkers = 0;
         AZStd::atomic<uint64_t> m_graphsRemaining;
 
         // Implement basic CompiledTaskGraph event breadcrumbs to help debug
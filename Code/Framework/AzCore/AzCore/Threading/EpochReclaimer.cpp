@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Threading/EpochReclaimer.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/parallel/thread.h>
+
+namespace AZ
+{
+    namespace EpochReclaimerInternal
+    {
+        // Threads are assigned reader slots round robin the first time they read, the same slot is used for every reclaimer
+        static AZStd::atomic<uint32_t> s_nextReaderSlot{ 0 };
+        static thread_local uint32_t t_readerSlot = AZStd::numeric_limits<uint32_t>::max();
+    }
+
+    EpochReclaimer::EpochReclaimer(size_t batchSize)
+        : m_batchSize(batchSize)
+    {
+    }
+
+    EpochReclaimer::~EpochReclaimer()
+    {
+        for (const RetiredObject& retired : m_retired)
+        {
+            retired.m_deleter(retired.m_object);
+        }
+    }
+
+    void EpochReclaimer::Reclaim()
+    {
+        // Everything that was retired is already unreachable. Readers that enter after the epoch is advanced
+        // can't find it anymore, so only readers registered under the previous epoch need to finish.
+        const uint64_t epoch = m_epoch.load();
+        m_epoch.store(epoch + 1);
+        const uint32_t parity = static_cast<uint32_t>(epoch & 1);
+        for (ReaderSlot& slot : m_readerSlots)
+        {
+            while (slot.m_activeReaders[parity].load(AZStd::memory_order_acquire) != 0)
+            {
+                // Reads are short, so the readers will be done soon
+                AZStd::this_thread::yield();
+            }
+        }
+
+        for (const RetiredObject& retired : m_retired)
+        {
+            retired.m_deleter(retired.m_object);
+        }
+        m_retired.clear();
+    }
+
+    AZStd::atomic<uint32_t>& EpochReclaimer::EnterReadEpoch() const
+    {
+        using namespace EpochReclaimerInternal;
+        if (t_readerSlot == AZStd::numeric_limits<uint32_t>::max())
+        {
+            t_readerSlot = s_nextReaderSlot.fetch_add(1, AZStd::memory_order_relaxed) % ReaderSlotCount;
+        }
+        ReaderSlot& slot = m_readerSlots[t_readerSlot];
+
+        while (true)
+        {
+            const uint64_t epoch = m_epoch.load();
+            AZStd::atomic<uint32_t>& activeReaders = slot.m_activeReaders[epoch & 1];
+            activeReaders.fetch_add(1);
+            // If the epoch moved on before the reader was registered, the reclaimer might not have seen this reader.
+            if (m_epoch.load() == epoch)
+            {
+                return activeReaders;
+            }
+            activeReaders.fetch_sub(1, AZStd::memory_order_release);
+        }
+    }
+
+    void EpochReclaimer::RetireObject(void* object, void (*deleter)(void*))
+    {
+        m_retired.push_back(RetiredObject{ object, deleter });
+        if (m_retired.size() >= m_batchSize)
+        {
+            Reclaim();
+        }
+    }
+}
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+
+namespace AZ
+{
+    //! @class EpochReclaimer
+    //! Defers deleting objects that lock free readers may still be using until those readers are done.
+    //! Readers hold a ReadGuard while they use shared objects. Writers unlink an object so new readers can't reach it, then
+    //! retire it. Retired objects are deleted in batches, once every reader that entered before the batch was collected has left.
+    //! Readers register in per-thread counter slots, so entering a read doesn't contend on a single shared counter.
+    //! Retire and Reclaim must be serialized by the owner, typically under the lock its writers already take.
+    class AZCORE_API EpochReclaimer
+    {
+    public:
+
+        //! Marks the calling thread as reading for the lifetime of the guard.
+        class ReadGuard
+        {
+        public:
+            explicit ReadGuard(const EpochReclaimer& reclaimer);
+            ~ReadGuard();
+
+        private:
+            AZ_DISABLE_COPY_MOVE(ReadGuard);
+
+            AZStd::atomic<uint32_t>& m_activeReaders;
+        };
+
+        //! @param batchSize number of retired objects that are collected before waiting on readers to delete them
+        explicit EpochReclaimer(size_t batchSize);
+
+        //! Deletes everything that is still retired, no readers may be active anymore.
+        ~EpochReclaimer();
+
+        //! Deletes the object once all readers that could have seen it have left, reclaiming the batch when it is full.
+        //! The object must already be unreachable for new readers.
+        //! @param object the object to delete, using its class allocator if it has one
+        template<typename T>
+        void Retire(T* object);
+
+        //! Waits for the readers that entered before now to leave and deletes everything that was retired.
+        void Reclaim();
+
+        //! Returns the number of objects that are retired and not deleted yet.
+        size_t GetRetiredCount() const;
+
+    private:
+
+        AZ_DISABLE_COPY_MOVE(EpochReclaimer);
+
+        //! Counters of the readers that are active in the current and previous epoch.
+        struct ReaderSlot
+        {
+            AZStd::atomic<uint32_t> m_activeReaders[2] = {};
+            // Keep each slot on its own cache line
+            char m_padding[64 - 2 * sizeof(AZStd::atomic<uint32_t>)];
+        };
+        static constexpr size_t ReaderSlotCount = 64;
+
+        struct RetiredObject
+        {
+            void* m_object;
+            void (*m_deleter)(void*);
+        };
+
+        //! Registers a reader in the calling thread's slot and returns its counter.
+        AZStd::atomic<uint32_t>& EnterReadEpoch() const;
+        void RetireObject(void* object, void (*deleter)(void*));
+
+        AZStd::atomic<uint64_t> m_epoch{ 0 };
+        mutable ReaderSlot m_readerSlots[ReaderSlotCount];
+        AZStd::vector<RetiredObject> m_retired;
+        size_t m_batchSize;
+    };
+
+    inline EpochReclaimer::ReadGuard::ReadGuard(const EpochReclaimer& reclaimer)
+        : m_activeReaders(reclaimer.EnterReadEpoch())
+    {
+    }
+
+    inline EpochReclaimer::ReadGuard::~ReadGuard()
+    {
+        m_activeReaders.fetch_sub(1, AZStd::memory_order_release);
+    }
+
+    template<typename T>
+    inline void EpochReclaimer::Retire(T* object)
+    {
+        RetireObject(object, [](void* retired)
+        {
+            delete static_cast<T*>(retired);
+        });
+    }
+
+    inline size_t EpochReclaimer::GetRetiredCount() const
+    {
+        return m_retired.size();
+    }
+}
@@ -48,6 +48,8 @@ set(FILES
     Component/Entity.h
     Component/EntityBus.cpp
     Component/EntityBus.h
+    Component/EntityDirectory.cpp
+    Component/EntityDirectory.h
     Component/EntityId.h
     Component/EntityIdSerializer.cpp
     Component/EntityIdSerializer.h
@@ -126,6 +128,9 @@ set(FILES
     DOM/DomComparison.h
     DOM/DomPrefixTree.h
     DOM/DomPrefixTree.inl
+    DOM/Backends/Binary/BinaryBackend.h
+    DOM/Backends/Binary/BinarySerializationUtils.cpp
+    DOM/Backends/Binary/BinarySerializationUtils.h
     DOM/Backends/JSON/JsonBackend.h
     DOM/Backends/JSON/JsonSerializationUtils.cpp
     DOM/Backends/JSON/JsonSerializationUtils.h
@@ -180,6 +185,8 @@ set(FILES
     IO/IStreamerTypes.cpp
     IO/GenericStreams.cpp
     IO/GenericStreams.h
+    IO/MappedFile.cpp
+    IO/MappedFile.h
     IO/OpenMode.h
     IO/OpenMode.cpp
     IO/Path/Path.cpp
@@ -303,6 +310,10 @@ set(FILES
     Math/Hemisphere.h
     Math/Hemisphere.inl
     Math/Internal/MathTypes.h
+    Math/Internal/SimdBatch_Avx2.cpp
+    Math/Internal/SimdBatch_Avx512.cpp
+    Math/Internal/SimdBatchKernels.h
+    Math/Internal/SimdBatchKernels.inl
     Math/Internal/SimdMathVec1_neon.inl
     Math/Internal/SimdMathVec1_scalar.inl
     Math/Internal/SimdMathVec1_sse.inl
@@ -315,6 +326,10 @@ set(FILES
     Math/Internal/SimdMathVec4_neon.inl
     Math/Internal/SimdMathVec4_scalar.inl
     Math/Internal/SimdMathVec4_sse.inl
+    Math/Internal/SimdMathVec8_avx.inl
+    Math/Internal/SimdMathVec8_simd.inl
+    Math/Internal/SimdMathVec16_avx512.inl
+    Math/Internal/SimdMathVec16_simd.inl
     Math/Internal/SimdMathCommon_neon.inl
     Math/Internal/SimdMathCommon_neonDouble.inl
     Math/Internal/SimdMathCommon_neonQuad.inl
@@ -375,11 +390,15 @@ set(FILES
     Math/ShapeIntersection.cpp
     Math/ShapeIntersection.h
     Math/ShapeIntersection.inl
+    Math/SimdBatch.cpp
+    Math/SimdBatch.h
     Math/SimdMath.h
     Math/SimdMathVec1.h
     Math/SimdMathVec2.h
     Math/SimdMathVec3.h
     Math/SimdMathVec4.h
+    Math/SimdMathVec8.h
+    Math/SimdMathVec16.h
     Math/Sha1.h
     Math/Spline.cpp
     Math/Spline.h
@@ -431,6 +450,8 @@ set(FILES
     Memory/ChildAllocatorSchema.h
     Memory/Config.h
     Memory/dlmalloc.inl
+    Memory/FrameArenaAllocator.cpp
+    Memory/FrameArenaAllocator.h
     Memory/HphaAllocator.cpp
     Memory/HphaAllocator.h
     Memory/IAllocator.h
@@ -441,6 +462,7 @@ set(FILES
     Memory/NewAndDelete.inl
     Memory/OSAllocator.cpp
     Memory/OSAllocator.h
+    Memory/OSPageAllocator.h
     Memory/PoolAllocator.cpp
     Memory/PoolAllocator.h
     Memory/SimpleSchemaAllocator.h
@@ -582,6 +604,8 @@ set(FILES
     Serialization/SerializationUtils.cpp
     Serialization/ObjectStream.cpp
     Serialization/ObjectStream.h
+    Serialization/MappedObjectStream.cpp
+    Serialization/MappedObjectStream.h
     Serialization/PointerObject.h
     Serialization/PointerObject.cpp
     Serialization/SerializeContext.cpp
@@ -625,6 +649,8 @@ set(FILES
     Serialization/Json/JsonSerializationSettings.h
     Serialization/Json/JsonSerializer.h
     Serialization/Json/JsonSerializer.cpp
+    Serialization/Json/JsonStreamingDeserializer.h
+    Serialization/Json/JsonStreamingDeserializer.cpp
     Serialization/Json/JsonStringConversionUtils.h
     Serialization/Json/JsonSystemComponent.h
     Serialization/Json/JsonSystemComponent.cpp
@@ -717,6 +743,8 @@ set(FILES
     Task/TaskGraph.inl
     Task/TaskGraphSystemComponent.h
     Task/TaskGraphSystemComponent.cpp
+    Threading/EpochReclaimer.h
+    Threading/EpochReclaimer.cpp
     Threading/ThreadSafeDeque.h
     Threading/ThreadSafeDeque.inl
     Threading/ThreadSafeObject.h
@@ -742,3 +770,12 @@ set(FILES
     XML/rapidxml_print.h
     XML/rapidxml_utils.h
 )
+
+# Prevent the following files from being grouped in UNITY builds
+# The batch kernels are instantiated once per width from the same inline file, and the wide ones must not share a
+# translation unit with code that is compiled for the baseline instruction set.
+set(SKIP_UNITY_BUILD_INCLUSION_FILES
+    Math/SimdBatch.cpp
+    Math/Internal/SimdBatch_Avx2.cpp
+    Math/Internal/SimdBatch_Avx512.cpp
+)
@@ -40,6 +40,7 @@ set(FILES
     ../Common/Default/AzCore/IO/Streamer/StreamerContext_Default.h
     ../Common/UnixLike/AzCore/IO/AnsiTerminalUtils_UnixLike.cpp
     ../Common/UnixLike/AzCore/IO/FileIO_UnixLike.cpp
+    ../Common/UnixLike/AzCore/IO/MappedFile_UnixLike.cpp
     ../Common/UnixLike/AzCore/IO/SystemFile_UnixLike.cpp
     ../Common/UnixLike/AzCore/IO/Internal/SystemFileUtils_UnixLike.h
     ../Common/UnixLike/AzCore/IO/Internal/SystemFileUtils_UnixLike.cpp
@@ -50,6 +51,7 @@ set(FILES
     AzCore/IPC/SharedMemory_Platform.h
     ../Common/UnixLike/AzCore/Memory/OSAllocator_UnixLike.h
     AzCore/Memory/OSAllocator_Platform.h
+    ../Common/Default/AzCore/Memory/OSPageAllocator_Default.cpp
     ../Common/Default/AzCore/Module/Internal/ModuleManagerSearchPathTool_Default.cpp
     AzCore/Math/Internal/MathTypes_Android.h
     AzCore/Math/Random_Platform.h
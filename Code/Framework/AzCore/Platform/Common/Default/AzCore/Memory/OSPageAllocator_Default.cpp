@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/Memory/OSAllocator_Platform.h>
+#include <AzCore/Memory/OSPageAllocator.h>
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/spin_mutex.h>
+
+namespace AZ::OSPageAllocator
+{
+    // Huge page arenas and NUMA binding aren't supported on this platform, so pages come directly from the OS and the
+    // configuration is only stored.
+    namespace
+    {
+        struct State
+        {
+            AZStd::spin_mutex m_mutex;
+            OSPageAllocatorConfig m_config;
+        };
+
+        State& GetState()
+        {
+            static State s_state;
+            return s_state;
+        }
+    } // namespace
+
+    void* Allocate(size_t byteSize, size_t alignment)
+    {
+        return AZ_OS_MALLOC(byteSize, alignment);
+    }
+
+    void Free(void* ptr, [[maybe_unused]] size_t byteSize)
+    {
+        AZ_OS_FREE(ptr);
+    }
+
+    void SetConfig(const OSPageAllocatorConfig& config)
+    {
+        State& state = GetState();
+        AZStd::lock_guard<AZStd::spin_mutex> lock(state.m_mutex);
+        state.m_config = config;
+    }
+
+    OSPageAllocatorConfig GetConfig()
+    {
+        State& state = GetState();
+        AZStd::lock_guard<AZStd::spin_mutex> lock(state.m_mutex);
+        return state.m_config;
+    }
+
+    OSPageAllocatorStats GetStats()
+    {
+        return OSPageAllocatorStats{};
+    }
+} // namespace AZ::OSPageAllocator
@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/MappedFile.h>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+namespace AZ::IO
+{
+    bool MappedFile::PlatformOpen(const char* filePath)
+    {
+        int fileDescriptor = open(filePath, O_RDONLY | O_CLOEXEC);
+        if (fileDescriptor == -1)
+        {
+            return false;
+        }
+
+        struct stat fileStat;
+        if (fstat(fileDescriptor, &fileStat) != 0 || fileStat.st_size <= 0)
+        {
+            close(fileDescriptor);
+            return false;
+        }
+
+        const size_t size = static_cast<size_t>(fileStat.st_size);
+        // A writable private mapping so the content can be patched in place without changing the file
+        void* data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fileDescriptor, 0);
+        // The mapping keeps its own reference to the file
+        close(fileDescriptor);
+        if (data == MAP_FAILED)
+        {
+            return false;
+        }
+
+        m_data = reinterpret_cast<AZStd::byte*>(data);
+        m_size = size;
+        return true;
+    }
+
+    void MappedFile::PlatformClose()
+    {
+        munmap(m_data, m_size);
+    }
+} // namespace AZ::IO
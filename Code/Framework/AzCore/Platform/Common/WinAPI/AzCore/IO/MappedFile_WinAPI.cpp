@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/MappedFile.h>
+#include <AzCore/IO/Path/Path_fwd.h>
+#include <AzCore/std/string/conversions.h>
+#include <AzCore/std/string/fixed_string.h>
+
+#include <AzCore/PlatformIncl.h>
+
+namespace AZ::IO
+{
+    bool MappedFile::PlatformOpen(const char* filePath)
+    {
+        AZStd::fixed_wstring<MaxPathLength> filePathW;
+        if (!AZStd::to_wstring(filePathW, filePath))
+        {
+            return false;
+        }
+
+        HANDLE file = CreateFileW(filePathW.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            return false;
+        }
+
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart <= 0)
+        {
+            CloseHandle(file);
+            return false;
+        }
+
+        // A copy-on-write mapping so the content can be patched in place without changing the file
+        HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+        // The view keeps its own references to the file and the mapping
+        CloseHandle(file);
+        if (mapping == nullptr)
+        {
+            return false;
+        }
+
+        void* data = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+        CloseHandle(mapping);
+        if (data == nullptr)
+        {
+            return false;
+        }
+
+        m_data = reinterpret_cast<AZStd::byte*>(data);
+        m_size = static_cast<size_t>(fileSize.QuadPart);
+        return true;
+    }
+
+    void MappedFile::PlatformClose()
+    {
+        UnmapViewOfFile(m_data);
+    }
+} // namespace AZ::IO
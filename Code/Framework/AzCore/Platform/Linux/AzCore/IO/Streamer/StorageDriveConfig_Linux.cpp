@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/Streamer/StorageDrive.h>
+#include <AzCore/IO/Streamer/StorageDrive_Linux.h>
+#include <AzCore/IO/Streamer/StorageDriveConfig_Linux.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+
+namespace AZ::IO
+{
+    AZStd::shared_ptr<StreamStackEntry> LinuxStorageDriveConfig::AddStreamStackEntry(
+        [[maybe_unused]] const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent)
+    {
+        if (StorageDriveLinux::IsSupported())
+        {
+            StorageDriveLinux::ConstructionOptions options;
+            options.m_hasSeekPenalty = m_hasSeekPenalty;
+            options.m_enableRegisteredFiles = m_enableRegisteredFiles;
+            options.m_minimalReporting = m_minimalReporting;
+
+            auto stackEntry = AZStd::make_shared<StorageDriveLinux>(
+                m_maxFileHandles, m_maxMetaDataCache, m_queueDepth, m_overcommit, m_fixedBufferSize, options);
+            if (stackEntry->IsValid())
+            {
+                stackEntry->SetNext(AZStd::move(parent));
+                return stackEntry;
+            }
+        }
+
+        // io_uring isn't available on older kernels and is frequently blocked in containers, so fall back to the generic
+        // drive, which reads one request at a time. Like the generic drive configuration this has to be the last node.
+        AZ_Warning("Streamer", false, "io_uring isn't available. Falling back to the generic storage drive.\n");
+        return AZStd::make_shared<StorageDrive>(m_maxFileHandles);
+    }
+
+    void LinuxStorageDriveConfig::Reflect(ReflectContext* context)
+    {
+        if (auto serializeContext = azrtti_cast<SerializeContext*>(context); serializeContext != nullptr)
+        {
+            serializeContext->Class<LinuxStorageDriveConfig, IStreamerStackConfig>()
+                ->Version(1)
+                ->Field("MaxFileHandles", &LinuxStorageDriveConfig::m_maxFileHandles)
+                ->Field("MaxMetaDataCache", &LinuxStorageDriveConfig::m_maxMetaDataCache)
+                ->Field("QueueDepth", &LinuxStorageDriveConfig::m_queueDepth)
+                ->Field("Overcommit", &LinuxStorageDriveConfig::m_overcommit)
+                ->Field("FixedBufferSize", &LinuxStorageDriveConfig::m_fixedBufferSize)
+                ->Field("EnableRegisteredFiles", &LinuxStorageDriveConfig::m_enableRegisteredFiles)
+                ->Field("HasSeekPenalty", &LinuxStorageDriveConfig::m_hasSeekPenalty)
+                ->Field("MinimalReporting", &LinuxStorageDriveConfig::m_minimalReporting);
+        }
+    }
+} // namespace AZ::IO
@@ -0,0 +1,1262 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <cstring>
+#include <errno.h>
+#include <fcntl.h>
+#include <linux/io_uring.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/IO/Streamer/StorageDrive_Linux.h>
+#include <AzCore/std/typetraits/decay.h>
+
+namespace AZ::IO
+{
+    namespace IoUring
+    {
+        // The system calls are used directly instead of through liburing to avoid an additional 3rd party dependency.
+        // Only the small subset needed for reading is wrapped here.
+        static int Setup(u32 entries, io_uring_params* params)
+        {
+            return aznumeric_cast<int>(::syscall(__NR_io_uring_setup, entries, params));
+        }
+
+        static int Enter(int ringFd, u32 toSubmit, u32 minComplete, u32 flags)
+        {
+            return aznumeric_cast<int>(::syscall(__NR_io_uring_enter, ringFd, toSubmit, minComplete, flags, nullptr, 0));
+        }
+
+        static int Register(int ringFd, u32 opcode, const void* arg, u32 numArgs)
+        {
+            return aznumeric_cast<int>(::syscall(__NR_io_uring_register, ringFd, opcode, arg, numArgs));
+        }
+
+        // The ring indices are shared with the kernel so they need to be accessed with acquire/release semantics.
+        static u32 LoadAcquire(const u32* value)
+        {
+            return __atomic_load_n(value, __ATOMIC_ACQUIRE);
+        }
+
+        static void StoreRelease(u32* value, u32 newValue)
+        {
+            __atomic_store_n(value, newValue, __ATOMIC_RELEASE);
+        }
+
+        template<typename T>
+        static T* Offset(void* base, u32 offset)
+        {
+            return reinterpret_cast<T*>(reinterpret_cast<u8*>(base) + offset);
+        }
+    } // namespace IoUring
+
+    const AZStd::chrono::microseconds StorageDriveLinux::s_averageSeekTime =
+        AZStd::chrono::milliseconds(9) + // Common average seek time for desktop hdd drives.
+        AZStd::chrono::milliseconds(3); // Rotational latency for a 7200RPM disk
+
+    //
+    // ConstructionOptions
+    //
+
+    StorageDriveLinux::ConstructionOptions::ConstructionOptions()
+        : m_hasSeekPenalty(true)
+        , m_enableRegisteredFiles(true)
+        , m_minimalReporting(false)
+    {}
+
+    //
+    // StorageDriveLinux
+    //
+
+    StorageDriveLinux::StorageDriveLinux(u32 maxFileHandles, u32 maxMetaDataCacheEntries, u32 queueDepth, s32 overCommit,
+        u32 fixedBufferSize, ConstructionOptions options)
+        : StreamStackEntry("Storage drive (io_uring)")
+        , m_fileCache_recentlyUsed(AZStd::max(maxFileHandles, 1u))
+        , m_metaDataCache_recentlyUsed(maxMetaDataCacheEntries)
+        , m_maxFileHandles(AZStd::max(maxFileHandles, 1u))
+        , m_queueDepth(queueDepth)
+        , m_fixedBufferSize(fixedBufferSize)
+        , m_overCommit(overCommit)
+        , m_constructionOptions(options)
+    {
+        if (m_queueDepth == 0)
+        {
+            m_queueDepth = 32;
+            AZ_Warning("StorageDriveLinux", false,
+                "Received a queue depth of 0 for %s. Picking a depth of %u instead.\n", m_name.c_str(), m_queueDepth);
+        }
+        // Read slots are tracked with a 16-bit counter.
+        m_queueDepth = AZStd::min(m_queueDepth, u32{ AZStd::numeric_limits<u16>::max() });
+
+        // Make sure that the overCommit isn't so small that no slots are ever reported.
+        if (aznumeric_cast<s32>(m_queueDepth) + m_overCommit <= 0)
+        {
+            AZ_Error("StorageDriveLinux", false,
+                "Received overcommit (%i) for %s that subtracts more than the queue depth (%u). Setting combined count to 1.\n",
+                m_overCommit, m_name.c_str(), m_queueDepth);
+            m_overCommit = 1 - aznumeric_cast<s32>(m_queueDepth);
+        }
+
+        // Add initial dummy values to the stats to avoid division by zero later on and avoid needing branches.
+        m_readSizeAverage.PushEntry(1);
+        m_readTimeAverage.PushEntry(AZStd::chrono::microseconds(1));
+
+        m_fileCache_paths.resize(m_maxFileHandles);
+        m_fileCache_handles.resize(m_maxFileHandles, InvalidFileDescriptor);
+        m_fileCache_activeReads.resize(m_maxFileHandles, 0);
+
+        m_metaDataCache_paths.resize(maxMetaDataCacheEntries);
+        m_metaDataCache_fileSize.resize(maxMetaDataCacheEntries);
+
+        m_readSlots.resize(m_queueDepth);
+        m_readSlots_active.resize(m_queueDepth, false);
+
+        if (CreateRing())
+        {
+            if (!m_constructionOptions.m_minimalReporting)
+            {
+                AZ_Printf("Streamer", "%s created with a queue depth of %u.\n", m_name.c_str(), m_queueDepth);
+            }
+        }
+        else
+        {
+            AZ_Error("StorageDriveLinux", false, "Failed to create io_uring for %s (error: %i).\n", m_name.c_str(), errno);
+        }
+    }
+
+    StorageDriveLinux::~StorageDriveLinux()
+    {
+        AZ_Assert(m_activeReads_Count == 0, "%s is being destroyed while there are still %u reads in flight.",
+            m_name.c_str(), m_activeReads_Count);
+
+        StopCompletionThread();
+        for (u32 i = 0; i < m_maxFileHandles; ++i)
+        {
+            if (m_fileCache_handles[i] != InvalidFileDescriptor)
+            {
+                ::close(m_fileCache_handles[i]);
+            }
+        }
+        DestroyRing();
+
+        if (m_fixedBuffers)
+        {
+            azfree(m_fixedBuffers, AZ::SystemAllocator);
+        }
+
+        if (!m_constructionOptions.m_minimalReporting)
+        {
+            AZ_Printf("Streamer", "%s destroyed.\n", m_name.c_str());
+        }
+    }
+
+    bool StorageDriveLinux::IsSupported()
+    {
+        io_uring_params params{};
+        int ringFd = IoUring::Setup(1, &params);
+        if (ringFd < 0)
+        {
+            return false;
+        }
+        ::close(ringFd);
+        return true;
+    }
+
+    bool StorageDriveLinux::IsValid() const
+    {
+        return m_ring.m_fd != InvalidFileDescriptor;
+    }
+
+    bool StorageDriveLinux::CreateRing()
+    {
+        // Reserve additional submission entries for cancel requests so they can always be queued.
+        io_uring_params params{};
+        int ringFd = IoUring::Setup(m_queueDepth * 2, &params);
+        if (ringFd < 0)
+        {
+            return false;
+        }
+        m_ring.m_fd = ringFd;
+        m_ring.m_sqEntries = params.sq_entries;
+
+        m_ring.m_sqRingSize = params.sq_off.array + params.sq_entries * sizeof(u32);
+        m_ring.m_cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        const bool singleMap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        if (singleMap)
+        {
+            m_ring.m_sqRingSize = AZStd::max(m_ring.m_sqRingSize, m_ring.m_cqRingSize);
+            m_ring.m_cqRingSize = m_ring.m_sqRingSize;
+        }
+
+        m_ring.m_sqRingMemory = ::mmap(nullptr, m_ring.m_sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+            ringFd, IORING_OFF_SQ_RING);
+        if (m_ring.m_sqRingMemory == MAP_FAILED)
+        {
+            m_ring.m_sqRingMemory = nullptr;
+            DestroyRing();
+            return false;
+        }
+
+        if (singleMap)
+        {
+            m_ring.m_cqRingMemory = m_ring.m_sqRingMemory;
+        }
+        else
+        {
+            m_ring.m_cqRingMemory = ::mmap(nullptr, m_ring.m_cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                ringFd, IORING_OFF_CQ_RING);
+            if (m_ring.m_cqRingMemory == MAP_FAILED)
+            {
+                m_ring.m_cqRingMemory = nullptr;
+                DestroyRing();
+                return false;
+            }
+        }
+
+        m_ring.m_sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+        void* sqes = ::mmap(nullptr, m_ring.m_sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFd, IORING_OFF_SQES);
+        if (sqes == MAP_FAILED)
+        {
+            DestroyRing();
+            return false;
+        }
+        m_ring.m_sqes = reinterpret_cast<io_uring_sqe*>(sqes);
+
+        m_ring.m_sqHead = IoUring::Offset<u32>(m_ring.m_sqRingMemory, params.sq_off.head);
+        m_ring.m_sqTail = IoUring::Offset<u32>(m_ring.m_sqRingMemory, params.sq_off.tail);
+        m_ring.m_sqMask = IoUring::Offset<u32>(m_ring.m_sqRingMemory, params.sq_off.ring_mask);
+        m_ring.m_sqArray = IoUring::Offset<u32>(m_ring.m_sqRingMemory, params.sq_off.array);
+        m_ring.m_cqHead = IoUring::Offset<u32>(m_ring.m_cqRingMemory, params.cq_off.head);
+        m_ring.m_cqTail = IoUring::Offset<u32>(m_ring.m_cqRingMemory, params.cq_off.tail);
+        m_ring.m_cqMask = IoUring::Offset<u32>(m_ring.m_cqRingMemory, params.cq_off.ring_mask);
+        m_ring.m_cqes = IoUring::Offset<io_uring_cqe>(m_ring.m_cqRingMemory, params.cq_off.cqes);
+
+        // The event is signaled by the kernel for every completion and is used to wake up the scheduler thread.
+        m_completionEventFd = ::eventfd(0, EFD_CLOEXEC);
+        if (m_completionEventFd < 0 || IoUring::Register(ringFd, IORING_REGISTER_EVENTFD, &m_completionEventFd, 1) < 0)
+        {
+            DestroyRing();
+            return false;
+        }
+
+        if (m_constructionOptions.m_enableRegisteredFiles)
+        {
+            // Register a sparse table so file handles can be swapped in and out as the file cache changes.
+            AZStd::vector<int> sparseFiles(m_maxFileHandles, InvalidFileDescriptor);
+            m_usesRegisteredFiles = IoUring::Register(ringFd, IORING_REGISTER_FILES, sparseFiles.data(), m_maxFileHandles) >= 0;
+            AZ_Warning("StorageDriveLinux", m_usesRegisteredFiles || m_constructionOptions.m_minimalReporting,
+                "Unable to register files with io_uring for %s (error: %i). Regular file descriptors will be used.\n",
+                m_name.c_str(), errno);
+        }
+
+        if (m_fixedBufferSize > 0)
+        {
+            constexpr size_t PageSize = 4_kib;
+            const size_t bufferSize = AZ_SIZE_ALIGN_UP(size_t{ m_fixedBufferSize }, PageSize);
+            m_fixedBufferSize = aznumeric_cast<u32>(bufferSize);
+            m_fixedBuffers = reinterpret_cast<u8*>(azmalloc(bufferSize * m_queueDepth, PageSize, AZ::SystemAllocator));
+
+            AZStd::vector<iovec> buffers(m_queueDepth);
+            for (u32 i = 0; i < m_queueDepth; ++i)
+            {
+                buffers[i].iov_base = m_fixedBuffers + (i * bufferSize);
+                buffers[i].iov_len = bufferSize;
+            }
+            // Registering buffers pins the memory, which can fail if the process' locked memory limit is too low.
+            m_usesFixedBuffers = IoUring::Register(ringFd, IORING_REGISTER_BUFFERS, buffers.data(), m_queueDepth) >= 0;
+            if (!m_usesFixedBuffers)
+            {
+                AZ_Warning("StorageDriveLinux", m_constructionOptions.m_minimalReporting,
+                    "Unable to register %u fixed buffers of %u bytes with io_uring for %s (error: %i). Reads will go directly to the "
+                    "output buffers.\n", m_queueDepth, m_fixedBufferSize, m_name.c_str(), errno);
+                azfree(m_fixedBuffers, AZ::SystemAllocator);
+                m_fixedBuffers = nullptr;
+                m_fixedBufferSize = 0;
+            }
+        }
+
+        return true;
+    }
+
+    void StorageDriveLinux::DestroyRing()
+    {
+        if (m_ring.m_sqes)
+        {
+            ::munmap(m_ring.m_sqes, m_ring.m_sqesSize);
+        }
+        if (m_ring.m_cqRingMemory && m_ring.m_cqRingMemory != m_ring.m_sqRingMemory)
+        {
+            ::munmap(m_ring.m_cqRingMemory, m_ring.m_cqRingSize);
+        }
+        if (m_ring.m_sqRingMemory)
+        {
+            ::munmap(m_ring.m_sqRingMemory, m_ring.m_sqRingSize);
+        }
+        if (m_ring.m_fd != InvalidFileDescriptor)
+        {
+            ::close(m_ring.m_fd);
+        }
+        if (m_completionEventFd != InvalidFileDescriptor)
+        {
+            ::close(m_completionEventFd);
+            m_completionEventFd = InvalidFileDescriptor;
+        }
+        m_ring = Ring{};
+    }
+
+    io_uring_sqe* StorageDriveLinux::GetSubmissionEntry()
+    {
+        u32 tail = *m_ring.m_sqTail;
+        if (tail - IoUring::LoadAcquire(m_ring.m_sqHead) >= m_ring.m_sqEntries)
+        {
+            // The submission queue is full, so hand the queued entries to the kernel to make room.
+            SubmitPending();
+            if (tail - IoUring::LoadAcquire(m_ring.m_sqHead) >= m_ring.m_sqEntries)
+            {
+                return nullptr;
+            }
+        }
+
+        io_uring_sqe* entry = &m_ring.m_sqes[tail & *m_ring.m_sqMask];
+        ::memset(entry, 0, sizeof(io_uring_sqe));
+        return entry;
+    }
+
+    void StorageDriveLinux::PublishSubmissionEntry()
+    {
+        // The kernel can pick up the entry as soon as the tail moves, so the tail is only advanced once the entry is filled in.
+        u32 tail = *m_ring.m_sqTail;
+        u32 index = tail & *m_ring.m_sqMask;
+        m_ring.m_sqArray[index] = index;
+        IoUring::StoreRelease(m_ring.m_sqTail, tail + 1);
+        m_ring.m_pendingSubmissions++;
+    }
+
+    void StorageDriveLinux::SubmitPending()
+    {
+        while (m_ring.m_pendingSubmissions > 0)
+        {
+            AZ_PROFILE_SCOPE(AzCore, "StorageDriveLinux::SubmitPending io_uring_enter");
+            int result = IoUring::Enter(m_ring.m_fd, m_ring.m_pendingSubmissions, 0, 0);
+            if (result >= 0)
+            {
+                m_ring.m_pendingSubmissions -= AZStd::min(m_ring.m_pendingSubmissions, aznumeric_cast<u32>(result));
+                if (result == 0)
+                {
+                    break;
+                }
+            }
+            else if (errno != EINTR)
+            {
+                // EAGAIN and EBUSY mean the kernel is temporarily out of resources or the completion queue needs to be drained
+                // first. The entries remain in the queue and will be submitted the next time around.
+                AZ_Error("StorageDriveLinux", errno == EAGAIN || errno == EBUSY,
+                    "io_uring_enter failed for %s with error %i.\n", m_name.c_str(), errno);
+                break;
+            }
+        }
+    }
+
+    void StorageDriveLinux::StartCompletionThread()
+    {
+        if (!m_completionThreadActive)
+        {
+            m_completionThreadActive = true;
+
+            AZStd::thread_desc threadDesc;
+            threadDesc.m_name = "IO io_uring completion";
+            m_completionThread = AZStd::thread(
+                threadDesc,
+                [this]()
+                {
+                    u64 signalCount = 0;
+                    while (m_completionThreadActive)
+                    {
+                        if (::read(m_completionEventFd, &signalCount, sizeof(signalCount)) == sizeof(signalCount) &&
+                            m_completionThreadActive)
+                        {
+                            m_context->WakeUpSchedulingThread();
+                        }
+                    }
+                });
+        }
+    }
+
+    void StorageDriveLinux::StopCompletionThread()
+    {
+        if (m_completionThreadActive)
+        {
+            m_completionThreadActive = false;
+            u64 signal = 1;
+            [[maybe_unused]] auto result = ::write(m_completionEventFd, &signal, sizeof(signal));
+            m_completionThread.join();
+        }
+    }
+
+    void StorageDriveLinux::PrepareRequest(FileRequest* request)
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+        AZ_Assert(request, "PrepareRequest was provided a null request.");
+
+        if (AZStd::holds_alternative<Requests::ReadRequestData>(request->GetCommand()))
+        {
+            auto& readRequest = AZStd::get<Requests::ReadRequestData>(request->GetCommand());
+
+            FileRequest* read = m_context->GetNewInternalRequest();
+            read->CreateRead(request, readRequest.m_output, readRequest.m_outputSize, readRequest.m_path,
+                readRequest.m_offset, readRequest.m_size);
+            m_context->PushPreparedRequest(read);
+            return;
+        }
+        StreamStackEntry::PrepareRequest(request);
+    }
+
+    void StorageDriveLinux::QueueRequest(FileRequest* request)
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+        AZ_Assert(request, "QueueRequest was provided a null request.");
+
+        AZStd::visit([this, request](auto&& args)
+        {
+            using Command = AZStd::decay_t<decltype(args)>;
+            if constexpr (AZStd::is_same_v<Command, Requests::ReadData>)
+            {
+                m_pendingReadRequests.push_back(request);
+                return;
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::FileExistsCheckData> ||
+                AZStd::is_same_v<Command, Requests::FileMetaDataRetrievalData>)
+            {
+                m_pendingRequests.push_back(request);
+                return;
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::CancelData>)
+            {
+                if (CancelRequest(request, args.m_target))
+                {
+                    // Only forward if this isn't part of the request chain, otherwise the storage device should
+                    // be the last step as it doesn't forward any (sub)requests.
+                    return;
+                }
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::FlushData>)
+            {
+                FlushCache(args.m_path);
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::FlushAllData>)
+            {
+                FlushEntireCache();
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::ReportData>)
+            {
+                Report(args);
+            }
+            StreamStackEntry::QueueRequest(request);
+        }, request->GetCommand());
+    }
+
+    bool StorageDriveLinux::ExecuteRequests()
+    {
+        bool hasFinalizedReads = FinalizeReads();
+
+        // Queue as many read requests as possible in order to maximize throughput.
+        bool hasQueuedReads = false;
+        while (!m_pendingReadRequests.empty())
+        {
+            FileRequest* request = m_pendingReadRequests.front();
+            if (ReadRequest(request))
+            {
+                m_pendingReadRequests.pop_front();
+                hasQueuedReads = true;
+            }
+            else
+            {
+                break;
+            }
+        }
+        // Hand all reads to the kernel with a single system call.
+        SubmitPending();
+
+        if (hasQueuedReads)
+        {
+            StreamStackEntry::ExecuteRequests();
+            return true;
+        }
+
+        // Pick up one other synchronous request if no read requests were issued.
+        bool hasWorked = false;
+        if (!m_pendingRequests.empty())
+        {
+            FileRequest* request = m_pendingRequests.front();
+            hasWorked = AZStd::visit(
+                [this, request](auto&& args)
+                {
+                    using Command = AZStd::decay_t<decltype(args)>;
+                    if constexpr (AZStd::is_same_v<Command, Requests::FileExistsCheckData>)
+                    {
+                        FileExistsRequest(request);
+                        m_pendingRequests.pop_front();
+                        return true;
+                    }
+                    else if constexpr (AZStd::is_same_v<Command, Requests::FileMetaDataRetrievalData>)
+                    {
+                        FileMetaDataRetrievalRequest(request);
+                        m_pendingRequests.pop_front();
+                        return true;
+                    }
+                    else
+                    {
+                        AZ_Assert(false, "A request was added to StorageDriveLinux's pending queue that isn't supported.");
+                        return false;
+                    }
+                },
+                request->GetCommand());
+        }
+        return StreamStackEntry::ExecuteRequests() || hasFinalizedReads || hasWorked;
+    }
+
+    void StorageDriveLinux::UpdateStatus(Status& status) const
+    {
+        StreamStackEntry::UpdateStatus(status);
+        status.m_numAvailableSlots = AZStd::min(status.m_numAvailableSlots, CalculateNumAvailableSlots());
+        status.m_isIdle = status.m_isIdle && m_pendingReadRequests.empty() && m_pendingRequests.empty() && (m_activeReads_Count == 0);
+    }
+
+    void StorageDriveLinux::UpdateCompletionEstimates(AZStd::chrono::steady_clock::time_point now,
+        AZStd::vector<FileRequest*>& internalPending, StreamerContext::PreparedQueue::iterator pendingBegin,
+        StreamerContext::PreparedQueue::iterator pendingEnd)
+    {
+        StreamStackEntry::UpdateCompletionEstimates(now, internalPending, pendingBegin, pendingEnd);
+
+        const RequestPath* activeFile = nullptr;
+        if (m_activeCacheSlot != InvalidFileCacheIndex)
+        {
+            activeFile = &m_fileCache_paths[m_activeCacheSlot];
+        }
+        u64 activeOffset = m_activeOffset;
+
+        // The read time average is recorded over periods where reads were in flight, so it already reflects the throughput that's
+        // achieved with the current queue depth. Reads that are in flight are estimated based on the remaining bytes to read.
+        u64 totalBytesRead = m_readSizeAverage.GetTotal();
+        double totalReadTime = aznumeric_caster(m_readTimeAverage.GetTotal().count());
+        AZStd::chrono::steady_clock::time_point earliestSlot = AZStd::chrono::steady_clock::time_point::max();
+        for (u32 i = 0; i < m_queueDepth; ++i)
+        {
+            if (m_readSlots_active[i])
+            {
+                const ReadSlot& read = m_readSlots[i];
+                auto readCommand = AZStd::get_if<Requests::ReadData>(&read.m_request->GetCommand());
+                AZ_Assert(readCommand, "Request currently reading doesn't contain a read command.");
+                u64 remaining = readCommand->m_size - read.m_bytesRead;
+                AZStd::chrono::steady_clock::time_point endTime =
+                    read.m_startTime + Statistic::TimeValue(aznumeric_cast<u64>((remaining * totalReadTime) / totalBytesRead));
+                endTime = AZStd::max(endTime, now);
+                earliestSlot = AZStd::min(earliestSlot, endTime);
+                read.m_request->SetEstimatedCompletion(endTime);
+            }
+        }
+        if (earliestSlot != AZStd::chrono::steady_clock::time_point::max())
+        {
+            now = earliestSlot;
+        }
+
+        // Estimate requests in this stack entry.
+        for (FileRequest* request : m_pendingReadRequests)
+        {
+            EstimateCompletionTimeForRequest(request, now, activeFile, activeOffset);
+        }
+        for (FileRequest* request : m_pendingRequests)
+        {
+            EstimateCompletionTimeForRequest(request, now, activeFile, activeOffset);
+        }
+
+        // Estimate internally pending requests. Because this call will go from the top of the stack to the bottom,
+        // but estimation is calculated from the bottom to the top, this list should be processed in reverse order.
+        for (auto requestIt = internalPending.rbegin(); requestIt != internalPending.rend(); ++requestIt)
+        {
+            EstimateCompletionTimeForRequest(*requestIt, now, activeFile, activeOffset);
+        }
+
+        // Estimate pending requests that have not been queued yet.
+        for (auto requestIt = pendingBegin; requestIt != pendingEnd; ++requestIt)
+        {
+            EstimateCompletionTimeForRequest(*requestIt, now, activeFile, activeOffset);
+        }
+    }
+
+    void StorageDriveLinux::EstimateCompletionTimeForRequest(FileRequest* request, AZStd::chrono::steady_clock::time_point& startTime,
+        const RequestPath*& activeFile, u64& activeOffset) const
+    {
+        u64 readSize = 0;
+        u64 offset = 0;
+        const RequestPath* targetFile = nullptr;
+
+        AZStd::visit([&](auto&& args)
+        {
+            using Command = AZStd::decay_t<decltype(args)>;
+            if constexpr (AZStd::is_same_v<Command, Requests::ReadData>)
+            {
+                targetFile = &args.m_path;
+                readSize = args.m_size;
+                offset = args.m_offset;
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::CompressedReadData>)
+            {
+                targetFile = &args.m_compressionInfo.m_archiveFilename;
+                readSize = args.m_compressionInfo.m_compressedSize;
+                offset = args.m_compressionInfo.m_offset;
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::FileExistsCheckData>)
+            {
+                readSize = 0;
+                AZStd::chrono::microseconds getFileExistsTimeAverage = m_getFileExistsTimeAverage.CalculateAverage();
+                startTime += getFileExistsTimeAverage;
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::FileMetaDataRetrievalData>)
+            {
+                readSize = 0;
+                AZStd::chrono::microseconds getFileMetaDataTimeAverage = m_getFileMetaDataRetrievalTimeAverage.CalculateAverage();
+                startTime += getFileMetaDataTimeAverage;
+            }
+        }, request->GetCommand());
+
+        if (readSize > 0)
+        {
+            if (activeFile && activeFile != targetFile)
+            {
+                if (FindInFileHandleCache(*targetFile) == InvalidFileCacheIndex)
+                {
+                    AZStd::chrono::microseconds fileOpenCloseTimeAverage = m_fileOpenCloseTimeAverage.CalculateAverage();
+                    startTime += fileOpenCloseTimeAverage;
+                }
+                activeOffset = std::numeric_limits<u64>::max();
+            }
+
+            if (activeOffset != offset && m_constructionOptions.m_hasSeekPenalty)
+            {
+                startTime += s_averageSeekTime;
+            }
+
+            u64 totalBytesRead = m_readSizeAverage.GetTotal();
+            double totalReadTime = aznumeric_caster(m_readTimeAverage.GetTotal().count());
+            startTime += Statistic::TimeValue(aznumeric_cast<u64>((readSize * totalReadTime) / totalBytesRead));
+            activeOffset = offset + readSize;
+        }
+        request->SetEstimatedCompletion(startTime);
+    }
+
+    s32 StorageDriveLinux::CalculateNumAvailableSlots() const
+    {
+        return (m_overCommit + aznumeric_cast<s32>(m_queueDepth)) - aznumeric_cast<s32>(m_pendingReadRequests.size()) -
+            aznumeric_cast<s32>(m_pendingRequests.size()) - m_activeReads_Count;
+    }
+
+    auto StorageDriveLinux::OpenFile(u32& cacheSlot, FileRequest* request, const Requests::ReadData& data) -> OpenFileResult
+    {
+        // If the file is already opened for use, use that file handle and update it's last touched time.
+        u32 cacheIndex = FindInFileHandleCache(data.m_path);
+        if (cacheIndex != InvalidFileCacheIndex)
+        {
+            AZ_Assert(m_fileCache_handles[cacheIndex] != InvalidFileDescriptor,
+                "Found the file '%s' in cache, but file handle is invalid.\n", data.m_path.GetRelativePath());
+            m_fileCache_recentlyUsed.Touch(cacheIndex);
+            cacheSlot = cacheIndex;
+            return OpenFileResult::FileOpened;
+        }
+
+        // If the file is not already found in the cache, attempt to claim an available cache entry.
+        cacheIndex = FindAvailableFileHandleCacheIndex();
+        if (cacheIndex == InvalidFileCacheIndex)
+        {
+            // No files ready to be evicted.
+            return OpenFileResult::CacheFull;
+        }
+
+        int file = InvalidFileDescriptor;
+        {
+            AZ_PROFILE_SCOPE(AzCore, "StorageDriveLinux::ReadRequest OpenFile %s", m_name.c_str());
+            TIMED_AVERAGE_WINDOW_SCOPE(m_fileOpenCloseTimeAverage);
+
+            file = ::open(data.m_path.GetAbsolutePathCStr(), O_RDONLY | O_CLOEXEC);
+            if (file == InvalidFileDescriptor)
+            {
+                // Failed to open the file, so let the next entry in the stack try.
+                StreamStackEntry::QueueRequest(request);
+                return OpenFileResult::RequestForwarded;
+            }
+
+            CloseFile(cacheIndex);
+        }
+
+        if (m_usesRegisteredFiles)
+        {
+            io_uring_files_update update{};
+            update.offset = cacheIndex;
+            update.fds = reinterpret_cast<u64>(&file);
+            if (IoUring::Register(m_ring.m_fd, IORING_REGISTER_FILES_UPDATE, &update, 1) < 0)
+            {
+                AZ_Error("StorageDriveLinux", false, "Failed to register '%s' with io_uring (error: %i).\n",
+                    data.m_path.GetRelativePath(), errno);
+                ::close(file);
+                StreamStackEntry::QueueRequest(request);
+                return OpenFileResult::RequestForwarded;
+            }
+        }
+
+        m_fileCache_recentlyUsed.TouchLeastRecentlyUsed();
+
+        // Fill the cache entry with data about the new file.
+        m_fileCache_handles[cacheIndex] = file;
+        m_fileCache_activeReads[cacheIndex] = 0;
+        m_fileCache_paths[cacheIndex] = data.m_path;
+
+        cacheSlot = cacheIndex;
+        return OpenFileResult::FileOpened;
+    }
+
+    void StorageDriveLinux::CloseFile(u32 cacheSlot)
+    {
+        int& file = m_fileCache_handles[cacheSlot];
+        if (file != InvalidFileDescriptor)
+        {
+            AZ_Assert(m_fileCache_activeReads[cacheSlot] == 0, "Closing '%s' but it has %u active reads\n",
+                m_fileCache_paths[cacheSlot].GetRelativePath(), m_fileCache_activeReads[cacheSlot]);
+            if (m_usesRegisteredFiles)
+            {
+                int removed = InvalidFileDescriptor;
+                io_uring_files_update update{};
+                update.offset = cacheSlot;
+                update.fds = reinterpret_cast<u64>(&removed);
+                IoUring::Register(m_ring.m_fd, IORING_REGISTER_FILES_UPDATE, &update, 1);
+            }
+            ::close(file);
+            file = InvalidFileDescriptor;
+        }
+    }
+
+    bool StorageDriveLinux::ReadRequest(FileRequest* request)
+    {
+        AZ_PROFILE_SCOPE(AzCore, "StorageDriveLinux::ReadRequest %s", m_name.c_str());
+
+        if (m_activeReads_Count >= m_queueDepth)
+        {
+            return false;
+        }
+
+        auto data = AZStd::get_if<Requests::ReadData>(&request->GetCommand());
+        AZ_Assert(data, "Read request in StorageDriveLinux doesn't contain read data.");
+
+        u32 fileCacheSlot = InvalidFileCacheIndex;
+        switch (OpenFile(fileCacheSlot, request, *data))
+        {
+        case OpenFileResult::FileOpened:
+            break;
+        case OpenFileResult::RequestForwarded:
+            return true;
+        case OpenFileResult::CacheFull:
+            return false;
+        default:
+            AZ_Assert(false, "Unsupported OpenFileRequest returned.");
+        }
+
+        StartCompletionThread();
+
+        u32 readSlot = FindAvailableReadSlot();
+        AZ_Assert(readSlot != InvalidReadSlotIndex, "Active read count indicates there's a read slot available, but no read slot was found.");
+
+        ReadSlot& slot = m_readSlots[readSlot];
+        slot.m_request = request;
+        slot.m_bytesRead = 0;
+        slot.m_fileHandleIndex = fileCacheSlot;
+        slot.m_usesFixedBuffer = m_usesFixedBuffers && data->m_size <= m_fixedBufferSize;
+        slot.m_isCanceled = false;
+
+        auto now = AZStd::chrono::steady_clock::now();
+        if (m_activeReads_Count++ == 0)
+        {
+            m_activeReads_startTime = now;
+        }
+        slot.m_startTime = now;
+        m_readSlots_active[readSlot] = true;
+        m_fileCache_activeReads[fileCacheSlot]++;
+        m_readsInFlightAverage.PushEntry(m_activeReads_Count);
+
+        QueueRead(readSlot);
+
+        m_activeCacheSlot = fileCacheSlot;
+        m_activeOffset = data->m_offset + data->m_size;
+        return true;
+    }
+
+    void StorageDriveLinux::QueueRead(u32 readSlot)
+    {
+        ReadSlot& slot = m_readSlots[readSlot];
+        auto data = AZStd::get_if<Requests::ReadData>(&slot.m_request->GetCommand());
+        AZ_Assert(data, "Read slot in StorageDriveLinux doesn't contain read data.");
+
+        // The kernel caps single reads to just under 2GB so larger reads will complete partially and the remainder is
+        // queued again once the first part completes.
+        constexpr u64 MaxReadSize = 0x7ffff000;
+        u64 readSize = AZStd::min(data->m_size - slot.m_bytesRead, MaxReadSize);
+
+        io_uring_sqe* entry = GetSubmissionEntry();
+        AZ_Assert(entry, "Submission queue for %s is full even though a read slot was available.", m_name.c_str());
+        if (slot.m_usesFixedBuffer)
+        {
+            entry->opcode = IORING_OP_READ_FIXED;
+            entry->addr = reinterpret_cast<u64>(m_fixedBuffers + (size_t{ readSlot } * m_fixedBufferSize) + slot.m_bytesRead);
+            entry->buf_index = aznumeric_cast<u16>(readSlot);
+        }
+        else
+        {
+            entry->opcode = IORING_OP_READ;
+            entry->addr = reinterpret_cast<u64>(reinterpret_cast<u8*>(data->m_output) + slot.m_bytesRead);
+        }
+        if (m_usesRegisteredFiles)
+        {
+            entry->fd = aznumeric_cast<s32>(slot.m_fileHandleIndex);
+            entry->flags = IOSQE_FIXED_FILE;
+        }
+        else
+        {
+            entry->fd = m_fileCache_handles[slot.m_fileHandleIndex];
+        }
+        entry->off = data->m_offset + slot.m_bytesRead;
+        entry->len = aznumeric_cast<u32>(readSize);
+        entry->user_data = readSlot;
+        PublishSubmissionEntry();
+    }
+
+    bool StorageDriveLinux::CancelRequest(FileRequest* cancelRequest, FileRequestPtr& target)
+    {
+        bool ownsRequestChain = false;
+        for (auto it = m_pendingReadRequests.begin(); it != m_pendingReadRequests.end();)
+        {
+            if ((*it)->WorksOn(target))
+            {
+                (*it)->SetStatus(IStreamerTypes::RequestStatus::Canceled);
+                m_context->MarkRequestAsCompleted(*it);
+                it = m_pendingReadRequests.erase(it);
+                ownsRequestChain = true;
+            }
+            else
+            {
+                ++it;
+            }
+        }
+
+        // Pending requests have been accounted for, now address any reads in flight and ask the kernel to cancel them.
+        // The canceled reads will show up in the completion queue with -ECANCELED, unless they already completed.
+        for (u32 readSlot = 0; readSlot < m_queueDepth; ++readSlot)
+        {
+            ReadSlot& slot = m_readSlots[readSlot];
+            if (m_readSlots_active[readSlot] && !slot.m_isCanceled && slot.m_request->WorksOn(target))
+            {
+                ownsRequestChain = true;
+                slot.m_isCanceled = true;
+                if (io_uring_sqe* entry = GetSubmissionEntry(); entry != nullptr)
+                {
+                    entry->opcode = IORING_OP_ASYNC_CANCEL;
+                    entry->fd = -1;
+                    entry->addr = readSlot;
+                    entry->user_data = InternalUserData;
+                    PublishSubmissionEntry();
+                }
+            }
+        }
+        SubmitPending();
+
+        if (ownsRequestChain)
+        {
+            cancelRequest->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(cancelRequest);
+        }
+
+        return ownsRequestChain;
+    }
+
+    void StorageDriveLinux::FileExistsRequest(FileRequest* request)
+    {
+        auto& fileExists = AZStd::get<Requests::FileExistsCheckData>(request->GetCommand());
+
+        AZ_PROFILE_SCOPE(AzCore, "StorageDriveLinux::FileExistsRequest %s : %s",
+            m_name.c_str(), fileExists.m_path.GetRelativePath());
+        TIMED_AVERAGE_WINDOW_SCOPE(m_getFileExistsTimeAverage);
+
+        u32 cacheIndex = FindInFileHandleCache(fileExists.m_path);
+        if (cacheIndex != InvalidFileCacheIndex)
+        {
+            fileExists.m_found = true;
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+            return;
+        }
+
+        cacheIndex = FindInMetaDataCache(fileExists.m_path);
+        if (cacheIndex != InvalidMetaDataCacheIndex)
+        {
+            fileExists.m_found = true;
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+            m_metaDataCache_recentlyUsed.Touch(cacheIndex);
+            return;
+        }
+
+        struct stat fileStats;
+        if (::stat(fileExists.m_path.GetAbsolutePathCStr(), &fileStats) == 0 && S_ISREG(fileStats.st_mode))
+        {
+            // Store the size as it's very likely the size will be requested next or the file will be opened.
+            cacheIndex = m_metaDataCache_recentlyUsed.TouchLeastRecentlyUsed();
+            m_metaDataCache_paths[cacheIndex] = fileExists.m_path;
+            m_metaDataCache_fileSize[cacheIndex] = aznumeric_caster(fileStats.st_size);
+            fileExists.m_found = true;
+
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+            return;
+        }
+
+        StreamStackEntry::QueueRequest(request);
+    }
+
+    void StorageDriveLinux::FileMetaDataRetrievalRequest(FileRequest* request)
+    {
+        auto& command = AZStd::get<Requests::FileMetaDataRetrievalData>(request->GetCommand());
+
+        AZ_PROFILE_SCOPE(AzCore, "StorageDriveLinux::FileMetaDataRetrievalRequest %s : %s",
+            m_name.c_str(), command.m_path.GetRelativePath());
+        TIMED_AVERAGE_WINDOW_SCOPE(m_getFileMetaDataRetrievalTimeAverage);
+
+        u32 cacheIndex = FindInMetaDataCache(command.m_path);
+        if (cacheIndex != InvalidMetaDataCacheIndex)
+        {
+            command.m_fileSize = m_metaDataCache_fileSize[cacheIndex];
+            command.m_found = true;
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+            m_metaDataCache_recentlyUsed.Touch(cacheIndex);
+            return;
+        }
+
+        struct stat fileStats;
+        cacheIndex = FindInFileHandleCache(command.m_path);
+        if (cacheIndex != InvalidFileCacheIndex)
+        {
+            AZ_Assert(m_fileCache_handles[cacheIndex] != InvalidFileDescriptor,
+                "File path '%s' doesn't have an associated file handle.", m_fileCache_paths[cacheIndex].GetRelativePath());
+            if (::fstat(m_fileCache_handles[cacheIndex], &fileStats) != 0)
+            {
+                StreamStackEntry::QueueRequest(request);
+                return;
+            }
+        }
+        else if (::stat(command.m_path.GetAbsolutePathCStr(), &fileStats) != 0 || !S_ISREG(fileStats.st_mode))
+        {
+            StreamStackEntry::QueueRequest(request);
+            return;
+        }
+
+        command.m_fileSize = aznumeric_caster(fileStats.st_size);
+        command.m_found = true;
+
+        cacheIndex = m_metaDataCache_recentlyUsed.TouchLeastRecentlyUsed();
+        m_metaDataCache_paths[cacheIndex] = command.m_path;
+        m_metaDataCache_fileSize[cacheIndex] = command.m_fileSize;
+
+        request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+        m_context->MarkRequestAsCompleted(request);
+    }
+
+    void StorageDriveLinux::FlushCache(const RequestPath& filePath)
+    {
+        // Clear file handle from cache.
+        {
+            u32 cacheIndex = FindInFileHandleCache(filePath);
+            if (cacheIndex != InvalidFileCacheIndex)
+            {
+                CloseFile(cacheIndex);
+                m_fileCache_activeReads[cacheIndex] = 0;
+                m_fileCache_recentlyUsed.Flush(cacheIndex);
+                m_fileCache_paths[cacheIndex].Clear();
+            }
+        }
+
+        // Clear file meta data from cache.
+        {
+            u32 cacheIndex = FindInMetaDataCache(filePath);
+            if (cacheIndex != InvalidMetaDataCacheIndex)
+            {
+                m_metaDataCache_paths[cacheIndex].Clear();
+                m_metaDataCache_fileSize[cacheIndex] = 0;
+                m_metaDataCache_recentlyUsed.Flush(cacheIndex);
+            }
+        }
+    }
+
+    void StorageDriveLinux::FlushEntireCache()
+    {
+        // Clear file handle cache
+        for (u32 cacheIndex = 0; cacheIndex < m_maxFileHandles; ++cacheIndex)
+        {
+            CloseFile(cacheIndex);
+            m_fileCache_activeReads[cacheIndex] = 0;
+            m_fileCache_paths[cacheIndex].Clear();
+        }
+        m_fileCache_recentlyUsed.FlushAll();
+
+        // Clear meta data cache
+        m_metaDataCache_recentlyUsed.FlushAll();
+        auto metaDataCacheSize = m_metaDataCache_paths.size();
+        m_metaDataCache_paths.clear();
+        m_metaDataCache_fileSize.clear();
+        m_metaDataCache_paths.resize(metaDataCacheSize);
+        m_metaDataCache_fileSize.resize(metaDataCacheSize);
+    }
+
+    bool StorageDriveLinux::FinalizeReads()
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+
+        if (m_activeReads_Count == 0)
+        {
+            return false;
+        }
+
+        bool hasWorked = false;
+        u32 head = *m_ring.m_cqHead;
+        u32 tail = IoUring::LoadAcquire(m_ring.m_cqTail);
+        while (head != tail)
+        {
+            const io_uring_cqe& completion = m_ring.m_cqes[head & *m_ring.m_cqMask];
+            u64 userData = completion.user_data;
+            s32 result = completion.res;
+            ++head;
+
+            if (userData != InternalUserData)
+            {
+                FinalizeSingleRequest(aznumeric_cast<u32>(userData), result);
+                hasWorked = true;
+            }
+
+            // Release the entries as soon as possible so the kernel doesn't run out of completion entries.
+            if (head == tail)
+            {
+                IoUring::StoreRelease(m_ring.m_cqHead, head);
+                tail = IoUring::LoadAcquire(m_ring.m_cqTail);
+            }
+        }
+        // Partial reads may have queued follow up reads.
+        SubmitPending();
+        return hasWorked;
+    }
+
+    void StorageDriveLinux::FinalizeSingleRequest(u32 readSlot, s32 result)
+    {
+        AZ_Assert(readSlot < m_queueDepth && m_readSlots_active[readSlot],
+            "Completion received for read slot %u in %s, but the slot isn't active.", readSlot, m_name.c_str());
+        ReadSlot& slot = m_readSlots[readSlot];
+
+        auto readCommand = AZStd::get_if<Requests::ReadData>(&slot.m_request->GetCommand());
+        AZ_Assert(readCommand != nullptr, "Request stored with the read slot did not contain a read request.");
+
+        if (result > 0)
+        {
+            slot.m_bytesRead += result;
+            m_activeReads_ByteCount += result;
+            if (slot.m_bytesRead < readCommand->m_size && !slot.m_isCanceled)
+            {
+                // The kernel returned less than requested, so queue up the remainder in the same slot.
+                QueueRead(readSlot);
+                return;
+            }
+        }
+
+        if (--m_activeReads_Count == 0)
+        {
+            // Update read stats now that the queue has been drained.
+            m_readSizeAverage.PushEntry(m_activeReads_ByteCount);
+            m_readTimeAverage.PushEntry(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(
+                AZStd::chrono::steady_clock::now() - m_activeReads_startTime));
+
+            m_activeReads_ByteCount = 0;
+        }
+
+        bool isComplete = slot.m_bytesRead >= readCommand->m_size;
+        if (slot.m_usesFixedBuffer && isComplete)
+        {
+            ::memcpy(readCommand->m_output, m_fixedBuffers + (size_t{ readSlot } * m_fixedBufferSize), readCommand->m_size);
+        }
+        AZ_Error("StorageDriveLinux", result >= 0 || result == -ECANCELED, "Reading '%s' failed with error %i.\n",
+            readCommand->m_path.GetRelativePath(), -result);
+
+        slot.m_request->SetStatus(
+            isComplete
+                ? IStreamerTypes::RequestStatus::Completed
+                : (slot.m_isCanceled || result == -ECANCELED)
+                    ? IStreamerTypes::RequestStatus::Canceled
+                    : IStreamerTypes::RequestStatus::Failed
+        );
+        m_context->MarkRequestAsCompleted(slot.m_request);
+
+        m_fileCache_activeReads[slot.m_fileHandleIndex]--;
+        m_readSlots_active[readSlot] = false;
+        slot = ReadSlot{};
+    }
+
+    u32 StorageDriveLinux::FindInFileHandleCache(const RequestPath& filePath) const
+    {
+        size_t numFiles = m_fileCache_paths.size();
+        for (size_t i = 0; i < numFiles; ++i)
+        {
+            if (m_fileCache_paths[i] == filePath)
+            {
+                return aznumeric_caster(i);
+            }
+        }
+        return InvalidFileCacheIndex;
+    }
+
+    u32 StorageDriveLinux::FindAvailableFileHandleCacheIndex()
+    {
+        u32 cacheIndex = m_fileCache_recentlyUsed.GetLeastRecentlyUsed();
+        if (m_fileCache_activeReads[cacheIndex] == 0)
+        {
+            return cacheIndex;
+        }
+        return InvalidFileCacheIndex;
+    }
+
+    u32 StorageDriveLinux::FindAvailableReadSlot() const
+    {
+        for (u32 i = 0; i < m_queueDepth; ++i)
+        {
+            if (!m_readSlots_active[i])
+            {
+                return i;
+            }
+        }
+        return InvalidReadSlotIndex;
+    }
+
+    u32 StorageDriveLinux::FindInMetaDataCache(const RequestPath& filePath) const
+    {
+        size_t numFiles = m_metaDataCache_paths.size();
+        for (size_t i = 0; i < numFiles; ++i)
+        {
+            if (m_metaDataCache_paths[i] == filePath)
+            {
+                return aznumeric_caster(i);
+            }
+        }
+        return InvalidMetaDataCacheIndex;
+    }
+
+    void StorageDriveLinux::CollectStatistics(AZStd::vector<Statistic>& statistics) const
+    {
+        if (m_readSizeAverage.GetTotal() > 1) // A default value is always added.
+        {
+            using DoubleSeconds = AZStd::chrono::duration<double>;
+
+            u64 totalBytesRead = m_readSizeAverage.GetTotal();
+            double totalReadTimeSec = AZStd::chrono::duration_cast<DoubleSeconds>(m_readTimeAverage.GetTotal()).count();
+            statistics.push_back(Statistic::CreateBytesPerSecond(m_name, "Read Speed", totalBytesRead / totalReadTimeSec,
+                "The average read speed this drive achieved while reads were in flight. This is the maximum achievable speed for "
+                "reading from disk with the configured queue depth. If this is lower than expected it may indicate that there's an "
+                "overhead from the operating system, other applications are using the same drive or the queue depth is too low to "
+                "saturate the drive."));
+            statistics.push_back(Statistic::CreateFloat(m_name, "Reads in flight", m_readsInFlightAverage.CalculateAverage(),
+                "The average number of reads that were in flight when a new read was submitted. If this is close to the queue depth "
+                "the queue depth can be increased, if this is close to 1 the scheduler isn't providing enough requests to benefit from "
+                "parallel reads."));
+            statistics.push_back(Statistic::CreateTimeRange(
+                m_name, "File Open & Close", m_fileOpenCloseTimeAverage.CalculateAverage(), m_fileOpenCloseTimeAverage.GetMinimum(),
+                m_fileOpenCloseTimeAverage.GetMaximum(),
+                "The average amount of time needed to open and close file handles. This is a fixed cost from the operating "
+                "system. This can be mitigated running from archives."));
+            statistics.push_back(Statistic::CreateTimeRange(
+                m_name, "Get file exists", m_getFileExistsTimeAverage.CalculateAverage(),
+                m_getFileExistsTimeAverage.GetMinimum(), m_getFileExistsTimeAverage.GetMaximum(),
+                "The average amount of time needed to check if a file exists. This is a fixed cost from the operating "
+                "system. This can be mitigated running from archives."));
+            statistics.push_back(Statistic::CreateTimeRange(
+                m_name, "Get file meta data", m_getFileMetaDataRetrievalTimeAverage.CalculateAverage(),
+                m_getFileMetaDataRetrievalTimeAverage.GetMinimum(), m_getFileMetaDataRetrievalTimeAverage.GetMaximum(),
+                "The average amount of time in microseconds needed to retrieve file information. This is a fixed cost from the operating "
+                "system. This can be mitigated running from archives."));
+            statistics.push_back(Statistic::CreateInteger(m_name, "Available slots", CalculateNumAvailableSlots(),
+                "The total number of available slots to queue requests on. The lower this number, the more active this node is. A small "
+                "number is ideal as it means there are a few requests available for immediate processing next once a request "
+                "completes. If this is value is often negative then increasing the over-commit value, but keep in mind that too many "
+                "over-committed reduces the ability of scheduler to order requests."));
+        }
+        StreamStackEntry::CollectStatistics(statistics);
+    }
+
+    void StorageDriveLinux::Report(const Requests::ReportData& data) const
+    {
+        switch (data.m_reportType)
+        {
+        case IStreamerTypes::ReportType::Config:
+            data.m_output.push_back(Statistic::CreateInteger(
+                m_name, "Max file handles", m_maxFileHandles,
+                "The maximum number of file handles this drive node will cache. Increasing this will allow files that are read "
+                "multiple times to be processed faster. It's recommended to have this set to at least the largest number of archives "
+                "that can be in use at the same time."));
+            data.m_output.push_back(Statistic::CreateInteger(
+                m_name, "Max meta data cache", m_metaDataCache_paths.size(),
+                "The maximum number of meta data like file sizes this drive node will cache."));
+            data.m_output.push_back(Statistic::CreateInteger(
+                m_name, "Queue depth", m_queueDepth, "The maximum number of reads that are in flight at the same time."));
+            data.m_output.push_back(Statistic::CreateInteger(
+                m_name, "Overcommit", m_overCommit,
+                "The number of additional requests this node will accept. Higher numbers means that drives don't have to wait for the "
+                "scheduler to provide new request to process and the next request can immediately start reading. If this value is too "
+                "high though it will negatively impact the scheduler's ability to order and prioritize requests, which can lead to "
+                "poorer hardware and software cache performance and slower cancellations, among others."));
+            data.m_output.push_back(Statistic::CreateByteSize(
+                m_name, "Fixed buffer size", m_usesFixedBuffers ? m_fixedBufferSize : 0,
+                "The size of the registered buffer per read slot. Reads up to this size are read into memory that's already mapped "
+                "by the kernel and then copied to the output. A size of zero means fixed buffers are disabled."));
+            data.m_output.push_back(Statistic::CreateBoolean(
+                m_name, "Registered files", m_usesRegisteredFiles,
+                "Whether or not files are registered with io_uring, which avoids looking up file descriptors for every read."));
+            data.m_output.push_back(Statistic::CreateBoolean(
+                m_name, "Has seek penalty", m_constructionOptions.m_hasSeekPenalty,
+                "Whether or not the hardware has a penalty for seeking. This refers to drives that need to physically position a read "
+                "head to retrieve data, which can cause additional seek times for non-consecutive reads. This does not refer to seeks "
+                "impacting hardware cache performance."));
+            data.m_output.push_back(Statistic::CreateBoolean(
+                m_name, "Minimal reporting", m_constructionOptions.m_minimalReporting,
+                "Whether or not this node only reports issues or reports all information."));
+            data.m_output.push_back(Statistic::CreateReferenceString(
+                m_name, "Next node", m_next ? AZStd::string_view(m_next->GetName()) : AZStd::string_view("<None>"),
+                "The name of the node that follows this node or none."));
+            break;
+        case IStreamerTypes::ReportType::FileLocks:
+            for (u32 i = 0; i < m_maxFileHandles; ++i)
+            {
+                if (m_fileCache_handles[i] != InvalidFileDescriptor)
+                {
+                    data.m_output.push_back(Statistic::CreatePersistentString(
+                        m_name, "File lock", m_fileCache_paths[i].GetRelativePath().Native()));
+                }
+            }
+            break;
+        default:
+            break;
+        }
+    }
+} // namespace AZ::IO
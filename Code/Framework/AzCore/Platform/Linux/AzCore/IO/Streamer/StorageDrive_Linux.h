@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/IO/Streamer/RecentlyUsedIndex.h>
+#include <AzCore/IO/Streamer/RequestPath.h>
+#include <AzCore/IO/Streamer/Statistics.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration.h>
+#include <AzCore/IO/Streamer/StreamStackEntry.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/thread.h>
+
+struct io_uring_sqe;
+struct io_uring_cqe;
+
+namespace AZ::IO::Requests
+{
+    struct ReadData;
+    struct ReportData;
+}
+
+namespace AZ::IO
+{
+    //! Storage drive for Linux that uses io_uring to keep multiple reads in flight at the same time.
+    //! Files are registered with the ring so the kernel doesn't need to look up the file descriptor for every
+    //! read and optionally reads that fit are serviced from a set of registered (fixed) buffers, which avoids
+    //! the kernel needing to map the destination pages for every request.
+    class AZCORE_API StorageDriveLinux
+        : public StreamStackEntry
+    {
+    public:
+        struct AZCORE_API ConstructionOptions
+        {
+            ConstructionOptions();
+
+            //! Whether or not the device has a cost for seeking, such as happens on platter disks. This
+            //! will be accounted for when predicting file reads.
+            u8 m_hasSeekPenalty : 1;
+            //! Register opened files with the ring. This avoids file descriptor lookups in the kernel for every
+            //! read. If the kernel doesn't support registered files, regular file descriptors will be used instead.
+            u8 m_enableRegisteredFiles : 1;
+            //! If true, only information that's explicitly requested or issues are reported. If false, status information
+            //! such as when drives are created and destroyed is reported as well.
+            u8 m_minimalReporting : 1;
+        };
+
+        //! Creates an instance of a storage device that uses io_uring for reading.
+        //! @param maxFileHandles The maximum number of file handles that are cached. Only a small number are needed when
+        //!     running from archives, but it's recommended that a larger number are kept open when reading from loose files.
+        //! @param maxMetaDataCacheEntries The maximum number of files to keep meta data, such as the file size, to cache. Only
+        //!     a small number are needed when running from archives, but it's recommended that a larger number are kept open
+        //!     when reading from loose files.
+        //! @param queueDepth The maximum number of reads that will be in flight at the same time.
+        //! @param overCommit The number of additional slots that will be reported as available. This makes sure that there are
+        //!     always a few requests pending to avoid starvation. An over-commit that is too large can negatively impact the
+        //!     scheduler's ability to re-order requests for optimal read order.
+        //! @param fixedBufferSize The size of the registered buffer per read slot. Reads that are at most this size are read
+        //!     into the registered buffer and copied to the final destination afterwards. Use 0 to disable fixed buffers.
+        //! @param options Additional configuration options. See ConstructionOptions for more details.
+        StorageDriveLinux(u32 maxFileHandles, u32 maxMetaDataCacheEntries, u32 queueDepth, s32 overCommit, u32 fixedBufferSize,
+            ConstructionOptions options);
+        ~StorageDriveLinux() override;
+
+        AZ_DISABLE_COPY_MOVE(StorageDriveLinux);
+
+        //! Checks if the running kernel supports io_uring and if the process is allowed to use it. Containers and
+        //! sandboxes frequently block the io_uring system calls, in which case the generic StorageDrive should be used.
+        static bool IsSupported();
+
+        //! Returns true if the ring was successfully created. If this returns false the drive can't be used.
+        bool IsValid() const;
+
+        void PrepareRequest(FileRequest* request) override;
+        void QueueRequest(FileRequest* request) override;
+        bool ExecuteRequests() override;
+
+        void UpdateStatus(Status& status) const override;
+        void UpdateCompletionEstimates(AZStd::chrono::steady_clock::time_point now, AZStd::vector<FileRequest*>& internalPending,
+            StreamerContext::PreparedQueue::iterator pendingBegin, StreamerContext::PreparedQueue::iterator pendingEnd) override;
+
+        void CollectStatistics(AZStd::vector<Statistic>& statistics) const override;
+
+    protected:
+        using RecentlyUsedFileIndex = RecentlyUsedIndex<u32>;
+        using RecentlyUsedMetaIndex = RecentlyUsedIndex<u32>;
+        static const AZStd::chrono::microseconds s_averageSeekTime;
+
+        inline static constexpr u32 InvalidFileCacheIndex = AZStd::numeric_limits<u32>::max();
+        inline static constexpr u32 InvalidReadSlotIndex = AZStd::numeric_limits<u32>::max();
+        inline static constexpr u32 InvalidMetaDataCacheIndex = AZStd::numeric_limits<u32>::max();
+        inline static constexpr int InvalidFileDescriptor = -1;
+        //! User data used for submissions that don't belong to a read slot, such as cancel requests.
+        inline static constexpr u64 InternalUserData = AZStd::numeric_limits<u64>::max();
+
+        //! Thin wrapper around the memory shared between the kernel and this drive.
+        struct Ring
+        {
+            // Submission queue
+            u32* m_sqHead{ nullptr };
+            u32* m_sqTail{ nullptr };
+            u32* m_sqMask{ nullptr };
+            u32* m_sqArray{ nullptr };
+            io_uring_sqe* m_sqes{ nullptr };
+            // Completion queue
+            u32* m_cqHead{ nullptr };
+            u32* m_cqTail{ nullptr };
+            u32* m_cqMask{ nullptr };
+            io_uring_cqe* m_cqes{ nullptr };
+
+            void* m_sqRingMemory{ nullptr };
+            void* m_cqRingMemory{ nullptr };
+            size_t m_sqRingSize{ 0 };
+            size_t m_cqRingSize{ 0 };
+            size_t m_sqesSize{ 0 };
+            u32 m_sqEntries{ 0 };
+            u32 m_pendingSubmissions{ 0 };
+            int m_fd{ InvalidFileDescriptor };
+        };
+
+        struct ReadSlot
+        {
+            AZStd::chrono::steady_clock::time_point m_startTime;
+            FileRequest* m_request{ nullptr };
+            //! The number of bytes read so far. Reads can complete partially in which case the remainder is resubmitted.
+            u64 m_bytesRead{ 0 };
+            u32 m_fileHandleIndex{ InvalidFileCacheIndex };
+            bool m_usesFixedBuffer{ false };
+            bool m_isCanceled{ false };
+        };
+
+        enum class OpenFileResult
+        {
+            FileOpened,
+            RequestForwarded,
+            CacheFull
+        };
+
+        bool CreateRing();
+        void DestroyRing();
+        //! Returns a cleared entry at the tail of the submission queue, or null if the queue is full.
+        //! The entry isn't visible to the kernel until it's filled in and PublishSubmissionEntry is called.
+        io_uring_sqe* GetSubmissionEntry();
+        void PublishSubmissionEntry();
+        void SubmitPending();
+        void StartCompletionThread();
+        void StopCompletionThread();
+
+        OpenFileResult OpenFile(u32& cacheSlot, FileRequest* request, const Requests::ReadData& data);
+        void CloseFile(u32 cacheSlot);
+        bool ReadRequest(FileRequest* request);
+        void QueueRead(u32 readSlot);
+        bool CancelRequest(FileRequest* cancelRequest, FileRequestPtr& target);
+        void FileExistsRequest(FileRequest* request);
+        void FileMetaDataRetrievalRequest(FileRequest* request);
+        u32 FindInFileHandleCache(const RequestPath& filePath) const;
+        u32 FindAvailableFileHandleCacheIndex();
+        u32 FindAvailableReadSlot() const;
+        u32 FindInMetaDataCache(const RequestPath& filePath) const;
+
+        void EstimateCompletionTimeForRequest(FileRequest* request, AZStd::chrono::steady_clock::time_point& startTime,
+            const RequestPath*& activeFile, u64& activeOffset) const;
+        s32 CalculateNumAvailableSlots() const;
+
+        void FlushCache(const RequestPath& filePath);
+        void FlushEntireCache();
+
+        bool FinalizeReads();
+        void FinalizeSingleRequest(u32 readSlot, s32 result);
+
+        void Report(const Requests::ReportData& data) const;
+
+        TimedAverageWindow<s_statisticsWindowSize> m_fileOpenCloseTimeAverage;
+        TimedAverageWindow<s_statisticsWindowSize> m_getFileExistsTimeAverage;
+        TimedAverageWindow<s_statisticsWindowSize> m_getFileMetaDataRetrievalTimeAverage;
+        TimedAverageWindow<s_statisticsWindowSize> m_readTimeAverage;
+        AverageWindow<u64, float, s_statisticsWindowSize> m_readSizeAverage;
+        AverageWindow<u64, float, s_statisticsWindowSize> m_readsInFlightAverage;
+        AZStd::chrono::steady_clock::time_point m_activeReads_startTime;
+
+        AZStd::deque<FileRequest*> m_pendingReadRequests;
+        AZStd::deque<FileRequest*> m_pendingRequests;
+
+        AZStd::vector<ReadSlot> m_readSlots;
+        AZStd::vector<bool> m_readSlots_active;
+        //! Memory for the registered buffers. Each read slot owns a block of m_fixedBufferSize bytes.
+        u8* m_fixedBuffers{ nullptr };
+
+        RecentlyUsedFileIndex m_fileCache_recentlyUsed;
+        AZStd::vector<RequestPath> m_fileCache_paths;
+        AZStd::vector<int> m_fileCache_handles;
+        AZStd::vector<u16> m_fileCache_activeReads;
+
+        RecentlyUsedMetaIndex m_metaDataCache_recentlyUsed;
+        AZStd::vector<RequestPath> m_metaDataCache_paths;
+        AZStd::vector<u64> m_metaDataCache_fileSize;
+
+        Ring m_ring;
+        AZStd::thread m_completionThread;
+        AZStd::atomic_bool m_completionThreadActive{ false };
+        int m_completionEventFd{ InvalidFileDescriptor };
+
+        size_t m_activeReads_ByteCount{ 0 };
+
+        u64 m_activeOffset{ 0 };
+        u32 m_activeCacheSlot{ InvalidFileCacheIndex };
+        u32 m_maxFileHandles{ 1 };
+        u32 m_queueDepth{ 1 };
+        u32 m_fixedBufferSize{ 0 };
+        s32 m_overCommit{ 0 };
+
+        u16 m_activeReads_Count{ 0 };
+
+        ConstructionOptions m_constructionOptions;
+        bool m_usesRegisteredFiles{ false };
+        bool m_usesFixedBuffers{ false };
+    };
+} // namespace AZ::IO
@@ -0,0 +1,382 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/Memory/OSAllocator_Platform.h>
+#include <AzCore/Memory/OSPageAllocator.h>
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/spin_mutex.h>
+
+#include <stdio.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace AZ::OSPageAllocator
+{
+    namespace
+    {
+        constexpr size_t HugePageSize = 2 * 1024 * 1024;
+        constexpr size_t GranuleSize = AZ_PAGE_SIZE;
+        constexpr size_t GranulesPerHugePage = HugePageSize / GranuleSize;
+        constexpr size_t MaxArenaSize = 256 * 1024 * 1024;
+        constexpr size_t MaxGranulesPerArena = MaxArenaSize / GranuleSize;
+        constexpr size_t GranuleWordCount = MaxGranulesPerArena / 64;
+        constexpr size_t MaxArenaCount = 64;
+        // Matches MPOL_PREFERRED in linux/mempolicy.h. The kernel falls back to other nodes if the preferred node is full.
+        constexpr int MemoryPolicyPreferred = 1;
+
+        static_assert(HugePageSize % GranuleSize == 0, "The huge page size needs to be a multiple of AZ_PAGE_SIZE.");
+        static_assert(MaxGranulesPerArena % 64 == 0, "The granule bitmap needs to fill complete words.");
+
+        struct Arena
+        {
+            char* m_base = nullptr;
+            size_t m_size = 0;
+            size_t m_granuleCount = 0;
+            size_t m_usedGranules = 0;
+            int m_numaNode = -1;
+            OSPageAllocatorConfig::HugePages m_hugePages = OSPageAllocatorConfig::HugePages::Disabled;
+            u64 m_usedGranuleBits[GranuleWordCount] = {};
+
+            bool Contains(const void* ptr) const
+            {
+                return ptr >= m_base && ptr < m_base + m_size;
+            }
+
+            bool IsUsed(size_t granule) const
+            {
+                return (m_usedGranuleBits[granule / 64] & (u64(1) << (granule % 64))) != 0;
+            }
+
+            void SetUsed(size_t first, size_t count, bool used)
+            {
+                for (size_t granule = first; granule < first + count; ++granule)
+                {
+                    const u64 bit = u64(1) << (granule % 64);
+                    m_usedGranuleBits[granule / 64] = used ? (m_usedGranuleBits[granule / 64] | bit) : (m_usedGranuleBits[granule / 64] & ~bit);
+                }
+                m_usedGranules = used ? m_usedGranules + count : m_usedGranules - count;
+            }
+
+            //! Returns the first granule of a free run of count granules that starts at a multiple of alignmentGranules,
+            //! or m_granuleCount if there's no such run.
+            size_t FindFreeRun(size_t count, size_t alignmentGranules) const
+            {
+                if (m_granuleCount - m_usedGranules < count)
+                {
+                    return m_granuleCount;
+                }
+                size_t start = 0;
+                while (start + count <= m_granuleCount)
+                {
+                    size_t granule = start;
+                    while (granule < start + count && !IsUsed(granule))
+                    {
+                        ++granule;
+                    }
+                    if (granule == start + count)
+                    {
+                        return start;
+                    }
+                    start = AZ::SizeAlignUp(granule + 1, alignmentGranules);
+                }
+                return m_granuleCount;
+            }
+        };
+
+        struct State
+        {
+            AZStd::spin_mutex m_mutex;
+            OSPageAllocatorConfig m_config;
+            Arena m_arenas[MaxArenaCount];
+            size_t m_arenaCount = 0;
+            size_t m_allocatedBytes = 0;
+            size_t m_numaLocalBytes = 0;
+            u64 m_arenaHits = 0;
+            u64 m_arenaMisses = 0;
+        };
+
+        State& GetState()
+        {
+            // Function local so the state is available for allocators that are created during static initialization.
+            static State s_state;
+            return s_state;
+        }
+
+        size_t GetArenaSize(const OSPageAllocatorConfig& config)
+        {
+            return AZ::SizeAlignUp(AZStd::clamp(config.m_arenaSize, HugePageSize, MaxArenaSize), HugePageSize);
+        }
+
+        bool UsesArenas(const OSPageAllocatorConfig& config)
+        {
+            return config.m_hugePages != OSPageAllocatorConfig::HugePages::Disabled || config.m_numaLocal;
+        }
+
+        int GetCurrentNumaNode()
+        {
+            unsigned int cpu = 0;
+            unsigned int node = 0;
+            if (syscall(SYS_getcpu, &cpu, &node, nullptr) != 0)
+            {
+                return 0;
+            }
+            return static_cast<int>(node);
+        }
+
+        void ApplyPolicy(void* address, size_t size, OSPageAllocatorConfig::HugePages hugePages, int numaNode)
+        {
+            if (hugePages == OSPageAllocatorConfig::HugePages::Transparent)
+            {
+                madvise(address, size, MADV_HUGEPAGE);
+            }
+            if (numaNode >= 0)
+            {
+                unsigned long nodeMask = 1ul << numaNode;
+                syscall(SYS_mbind, address, size, MemoryPolicyPreferred, &nodeMask, sizeof(nodeMask) * 8, 0);
+            }
+        }
+
+        //! Reserves the address range for a new arena. The memory is only committed when it's first touched.
+        bool ReserveArena(Arena& arena, const OSPageAllocatorConfig& config, int numaNode)
+        {
+            const size_t arenaSize = GetArenaSize(config);
+            OSPageAllocatorConfig::HugePages hugePages = config.m_hugePages;
+            void* base = MAP_FAILED;
+
+            if (hugePages == OSPageAllocatorConfig::HugePages::Explicit)
+            {
+                base = mmap(nullptr, arenaSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE | MAP_HUGETLB, -1, 0);
+                if (base == MAP_FAILED)
+                {
+                    hugePages = OSPageAllocatorConfig::HugePages::Transparent;
+                }
+            }
+
+            if (base == MAP_FAILED)
+            {
+                // Over reserve so the arena can be aligned to a huge page boundary, then return the unused ends.
+                const size_t reserveSize = arenaSize + HugePageSize;
+                char* reserved = static_cast<char*>(
+                    mmap(nullptr, reserveSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0));
+                if (reserved == MAP_FAILED)
+                {
+                    return false;
+                }
+                char* aligned = reinterpret_cast<char*>(AZ::SizeAlignUp(reinterpret_cast<size_t>(reserved), HugePageSize));
+                const size_t headSize = aligned - reserved;
+                const size_t tailSize = reserveSize - headSize - arenaSize;
+                if (headSize > 0)
+                {
+                    munmap(reserved, headSize);
+                }
+                if (tailSize > 0)
+                {
+                    munmap(aligned + arenaSize, tailSize);
+                }
+                base = aligned;
+            }
+
+            ApplyPolicy(base, arenaSize, hugePages, numaNode);
+
+            arena.m_base = static_cast<char*>(base);
+            arena.m_size = arenaSize;
+            arena.m_granuleCount = arenaSize / GranuleSize;
+            arena.m_usedGranules = 0;
+            arena.m_numaNode = numaNode;
+            // Record the requested mode, even if the arena fell back, so it's picked for future requests with the same configuration.
+            arena.m_hugePages = config.m_hugePages;
+            memset(arena.m_usedGranuleBits, 0, sizeof(arena.m_usedGranuleBits));
+            return true;
+        }
+
+        //! Returns huge pages that no longer hold any allocations to the OS.
+        void ReleaseFreeHugePages(Arena& arena, size_t firstGranule, size_t granuleCount)
+        {
+            const size_t firstHugePage = firstGranule / GranulesPerHugePage;
+            const size_t lastHugePage = (firstGranule + granuleCount - 1) / GranulesPerHugePage;
+            for (size_t hugePage = firstHugePage; hugePage <= lastHugePage; ++hugePage)
+            {
+                const size_t hugePageFirstGranule = hugePage * GranulesPerHugePage;
+                bool isFree = true;
+                for (size_t granule = hugePageFirstGranule; granule < hugePageFirstGranule + GranulesPerHugePage; ++granule)
+                {
+                    if (arena.IsUsed(granule))
+                    {
+                        isFree = false;
+                        break;
+                    }
+                }
+                if (isFree)
+                {
+                    madvise(arena.m_base + hugePage * HugePageSize, HugePageSize, MADV_DONTNEED);
+                }
+            }
+        }
+
+        void* AllocateFromOS(size_t byteSize, size_t alignment, const OSPageAllocatorConfig& config, int numaNode)
+        {
+            const bool useHugePages = config.m_hugePages != OSPageAllocatorConfig::HugePages::Disabled;
+            void* address = AZ_OS_MALLOC(byteSize, useHugePages ? AZStd::max(alignment, HugePageSize) : alignment);
+            if (address && UsesArenas(config))
+            {
+                // Large requests are served by a dedicated mapping from the C runtime, so the policy only applies to this request.
+                ApplyPolicy(address, AZ::SizeAlignDown(byteSize, GranuleSize),
+                    useHugePages ? OSPageAllocatorConfig::HugePages::Transparent : OSPageAllocatorConfig::HugePages::Disabled, numaNode);
+            }
+            return address;
+        }
+    } // namespace
+
+    void* Allocate(size_t byteSize, size_t alignment)
+    {
+        State& state = GetState();
+        OSPageAllocatorConfig config;
+        {
+            AZStd::lock_guard<AZStd::spin_mutex> lock(state.m_mutex);
+            config = state.m_config;
+        }
+
+        if (!UsesArenas(config))
+        {
+            return AZ_OS_MALLOC(byteSize, alignment);
+        }
+
+        const int numaNode = config.m_numaLocal ? GetCurrentNumaNode() : -1;
+        const size_t granuleCount = AZ::SizeAlignUp(byteSize, GranuleSize) / GranuleSize;
+        const size_t alignmentGranules = AZStd::max<size_t>(alignment / GranuleSize, 1);
+        if (byteSize == 0 || granuleCount > GetArenaSize(config) / GranuleSize / 2 || alignment > HugePageSize)
+        {
+            AZStd::lock_guard<AZStd::spin_mutex> lock(state.m_mutex);
+            ++state.m_arenaMisses;
+            return AllocateFromOS(byteSize, alignment, config, numaNode);
+        }
+
+        AZStd::lock_guard<AZStd::spin_mutex> lock(state.m_mutex);
+        for (size_t arenaIndex = 0; arenaIndex < state.m_arenaCount; ++arenaIndex)
+        {
+            Arena& arena = state.m_arenas[arenaIndex];
+            if (arena.m_numaNode != numaNode || arena.m_hugePages != config.m_hugePages)
+            {
+                continue;
+            }
+            const size_t firstGranule = arena.FindFreeRun(granuleCount, alignmentGranules);
+            if (firstGranule < arena.m_granuleCount)
+            {
+                arena.SetUsed(firstGranule, granuleCount, true);
+                ++state.m_arenaHits;
+                state.m_allocatedBytes += granuleCount * GranuleSize;
+                state.m_numaLocalBytes += numaNode >= 0 ? granuleCount * GranuleSize : 0;
+                return arena.m_base + firstGranule * GranuleSize;
+            }
+        }
+
+        ++state.m_arenaMisses;
+        if (state.m_arenaCount < MaxArenaCount)
+        {
+            Arena& arena = state.m_arenas[state.m_arenaCount];
+            if (ReserveArena(arena, config, numaNode))
+            {
+                ++state.m_arenaCount;
+                const size_t firstGranule = arena.FindFreeRun(granuleCount, alignmentGranules);
+                AZ_Assert(firstGranule < arena.m_granuleCount, "A new arena is expected to be able to hold the request.");
+                arena.SetUsed(firstGranule, granuleCount, true);
+                state.m_allocatedBytes += granuleCount * GranuleSize;
+                state.m_numaLocalBytes += numaNode >= 0 ? granuleCount * GranuleSize : 0;
+                return arena.m_base + firstGranule * GranuleSize;
+            }
+        }
+        return AllocateFromOS(byteSize, alignment, config, numaNode);
+    }
+
+    void Free(void* ptr, size_t byteSize)
+    {
+        if (!ptr)
+        {
+            return;
+        }
+
+        State& state = GetState();
+        {
+            AZStd::lock_guard<AZStd::spin_mutex> lock(state.m_mutex);
+            for (size_t arenaIndex = 0; arenaIndex < state.m_arenaCount; ++arenaIndex)
+            {
+                Arena& arena = state.m_arenas[arenaIndex];
+                if (arena.Contains(ptr))
+                {
+                    const size_t firstGranule = (static_cast<char*>(ptr) - arena.m_base) / GranuleSize;
+                    const size_t granuleCount = AZ::SizeAlignUp(byteSize, GranuleSize) / GranuleSize;
+                    AZ_Assert(firstGranule + granuleCount <= arena.m_granuleCount, "Freed range runs past the end of its arena.");
+                    arena.SetUsed(firstGranule, granuleCount, false);
+                    state.m_allocatedBytes -= granuleCount * GranuleSize;
+                    state.m_numaLocalBytes -= arena.m_numaNode >= 0 ? granuleCount * GranuleSize : 0;
+                    ReleaseFreeHugePages(arena, firstGranule, granuleCount);
+                    return;
+                }
+            }
+        }
+        AZ_OS_FREE(ptr);
+    }
+
+    void SetConfig(const OSPageAllocatorConfig& config)
+    {
+        State& state = GetState();
+        AZStd::lock_guard<AZStd::spin_mutex> lock(state.m_mutex);
+        state.m_config = config;
+    }
+
+    OSPageAllocatorConfig GetConfig()
+    {
+        State& state = GetState();
+        AZStd::lock_guard<AZStd::spin_mutex> lock(state.m_mutex);
+        return state.m_config;
+    }
+
+    OSPageAllocatorStats GetStats()
+    {
+        OSPageAllocatorStats stats;
+        {
+            State& state = GetState();
+            AZStd::lock_guard<AZStd::spin_mutex> lock(state.m_mutex);
+            stats.m_arenaCount = state.m_arenaCount;
+            for (size_t arenaIndex = 0; arenaIndex < state.m_arenaCount; ++arenaIndex)
+            {
+                stats.m_reservedBytes += state.m_arenas[arenaIndex].m_size;
+            }
+            stats.m_allocatedBytes = state.m_allocatedBytes;
+            stats.m_numaLocalBytes = state.m_numaLocalBytes;
+            stats.m_arenaHits = state.m_arenaHits;
+            stats.m_arenaMisses = state.m_arenaMisses;
+        }
+
+        rusage usage;
+        if (getrusage(RUSAGE_SELF, &usage) == 0)
+        {
+            stats.m_minorPageFaults = static_cast<u64>(usage.ru_minflt);
+            stats.m_majorPageFaults = static_cast<u64>(usage.ru_majflt);
+        }
+
+        if (FILE* smaps = fopen("/proc/self/smaps_rollup", "r"))
+        {
+            char line[256];
+            while (fgets(line, sizeof(line), smaps))
+            {
+                unsigned long long hugePageKiB = 0;
+                if (sscanf(line, "AnonHugePages: %llu kB", &hugePageKiB) == 1)
+                {
+                    stats.m_hugePageBytes = static_cast<size_t>(hugePageKiB) * 1024;
+                    break;
+                }
+            }
+            fclose(smaps);
+        }
+        return stats;
+    }
+} // namespace AZ::OSPageAllocator
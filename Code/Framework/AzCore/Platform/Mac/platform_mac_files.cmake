@@ -38,6 +38,7 @@ set(FILES
     ../Common/Default/AzCore/IO/Streamer/StreamerContext_Default.h
     ../Common/UnixLike/AzCore/IO/AnsiTerminalUtils_UnixLike.cpp
     ../Common/UnixLike/AzCore/IO/FileIO_UnixLike.cpp
+    ../Common/UnixLike/AzCore/IO/MappedFile_UnixLike.cpp
     ../Common/UnixLike/AzCore/IO/SystemFile_UnixLike.cpp
     ../Common/UnixLike/AzCore/IO/Internal/SystemFileUtils_UnixLike.h
     ../Common/UnixLike/AzCore/IO/Internal/SystemFileUtils_UnixLike.cpp
@@ -49,6 +50,7 @@ set(FILES
     AzCore/IPC/SharedMemory_Mac.cpp
     ../Common/Apple/AzCore/Memory/OSAllocator_Apple.h
     AzCore/Memory/OSAllocator_Platform.h
+    ../Common/Default/AzCore/Memory/OSPageAllocator_Default.cpp
     AzCore/Module/Internal/ModuleManagerSearchPathTool_Mac.cpp
     AzCore/Math/Internal/MathTypes_Mac.h
     AzCore/Math/Random_Platform.h
@@ -38,6 +38,7 @@ set(FILES
     ../Common/WinAPI/AzCore/IO/FileIO_WinAPI.cpp
     ../Common/WinAPI/AzCore/IO/Streamer/StreamerContext_WinAPI.cpp
     ../Common/WinAPI/AzCore/IO/Streamer/StreamerContext_WinAPI.h
+    ../Common/WinAPI/AzCore/IO/MappedFile_WinAPI.cpp
     ../Common/WinAPI/AzCore/IO/SystemFile_WinAPI.cpp
     ../Common/WinAPI/AzCore/IO/SystemFile_WinAPI.h
     AzCore/IO/SystemFile_Platform.h
@@ -53,6 +54,7 @@ set(FILES
     AzCore/IPC/SharedMemory_Windows.cpp
     ../Common/WinAPI/AzCore/Memory/OSAllocator_WinAPI.h
     AzCore/Memory/OSAllocator_Platform.h
+    ../Common/Default/AzCore/Memory/OSPageAllocator_Default.cpp
     AzCore/Math/Random_Platform.h
     AzCore/Math/Random_Windows.cpp
     AzCore/Math/Random_Windows.h
@@ -38,6 +38,7 @@ set(FILES
     ../Common/Apple/AzCore/IO/SystemFile_Apple.h
     ../Common/UnixLike/AzCore/IO/AnsiTerminalUtils_UnixLike.cpp
     ../Common/UnixLike/AzCore/IO/FileIO_UnixLike.cpp
+    ../Common/UnixLike/AzCore/IO/MappedFile_UnixLike.cpp
     ../Common/UnixLike/AzCore/IO/SystemFile_UnixLike.cpp
     ../Common/UnixLike/AzCore/IO/Internal/SystemFileUtils_UnixLike.h
     ../Common/UnixLike/AzCore/IO/Internal/SystemFileUtils_UnixLike.cpp
@@ -47,6 +48,7 @@ set(FILES
     AzCore/IPC/SharedMemory_Platform.h
     ../Common/Apple/AzCore/Memory/OSAllocator_Apple.h
     AzCore/Memory/OSAllocator_Platform.h
+    ../Common/Default/AzCore/Memory/OSPageAllocator_Default.cpp
     AzCore/Math/Internal/MathTypes_iOS.h
     ../Common/Default/AzCore/Module/Internal/ModuleManagerSearchPathTool_Default.cpp
     AzCore/Math/Random_Platform.h
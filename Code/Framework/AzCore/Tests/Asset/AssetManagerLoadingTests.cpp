@@ -156,6 +156,10 @@ namespace UnitTest
 
         // D -> B -> C -> B
         static inline const AZ::Uuid CircularDId{ "{1FE8342E-9DCE-4AA9-969A-3F3A3526E6CF}" };
+        static inline const AZ::Uuid SharedPreloadRootId{ "{6B0D3E52-8F1A-4C27-9B6E-2A4D5C7E8F90}" };
+        static inline const AZ::Uuid SharedPreloadAId{ "{C4E1A7B3-2D5F-4E86-A9C0-1B3D5F7A9C2E}" };
+        static inline const AZ::Uuid SharedPreloadBId{ "{9A2C4E6F-1B3D-4F57-8E9A-0C2E4A6B8D1F}" };
+        static inline const AZ::Uuid SharedPreloadId{ "{E7F9B1D3-5A2C-4E84-B6D8-3F5A7C9E1B24}" };
 
         // Designed to test cases where a preload chain exists and one of the underlying assets
         // Can't be loaded either due to no asset info being found or no handler (The more likely case)
@@ -225,6 +229,11 @@ namespace UnitTest
             catalog->AddAsset<AssetWithQueueAndPreLoadReferences>(CircularBId, "CircularB.txt")->AddPreload(CircularCId);
             catalog->AddAsset<AssetWithQueueAndPreLoadReferences>(CircularCId, "CircularC.txt")->AddPreload(CircularBId);
             catalog->AddAsset<AssetWithQueueAndPreLoadReferences>(CircularDId, "CircularD.txt")->AddPreload(CircularBId);
+
+            catalog->AddAsset<AssetWithQueueAndPreLoadReferences>(SharedPreloadRootId, "SharedPreloadRoot.txt")->AddPreload(SharedPreloadAId)->AddPreload(SharedPreloadBId);
+            catalog->AddAsset<AssetWithQueueAndPreLoadReferences>(SharedPreloadAId, "SharedPreloadA.txt")->AddPreload(SharedPreloadId);
+            catalog->AddAsset<AssetWithQueueAndPreLoadReferences>(SharedPreloadBId, "SharedPreloadB.txt")->AddPreload(SharedPreloadId);
+            catalog->AddAsset<AssetWithQueueAndPreLoadReferences>(SharedPreloadId, "SharedPreload.txt");
         }
 
         void SetupTest()
@@ -320,6 +329,21 @@ namespace UnitTest
                 EXPECT_TRUE(m_streamerWrapper->WriteMemoryFile("CircularC.txt", &circularC, m_serializeContext));
                 EXPECT_TRUE(m_streamerWrapper->WriteMemoryFile("CircularD.txt", &circularD, m_serializeContext));
 
+                // SharedPreloadA and SharedPreloadB both wait on SharedPreload, so they can finish loading at the same time
+                AssetWithQueueAndPreLoadReferences sharedPreloadRoot;
+                AssetWithQueueAndPreLoadReferences sharedPreloadA;
+                AssetWithQueueAndPreLoadReferences sharedPreloadB;
+
+                sharedPreloadRoot.m_preLoad = m_testAssetManager->CreateAsset<AssetWithAssetReference>(SharedPreloadAId, AssetLoadBehavior::PreLoad);
+                sharedPreloadRoot.m_queueLoad = m_testAssetManager->CreateAsset<AssetWithAssetReference>(SharedPreloadBId, AssetLoadBehavior::PreLoad);
+                sharedPreloadA.m_preLoad = m_testAssetManager->CreateAsset<AssetWithAssetReference>(SharedPreloadId, AssetLoadBehavior::PreLoad);
+                sharedPreloadB.m_preLoad = sharedPreloadA.m_preLoad;
+
+                EXPECT_TRUE(m_streamerWrapper->WriteMemoryFile("SharedPreloadRoot.txt", &sharedPreloadRoot, m_serializeContext));
+                EXPECT_TRUE(m_streamerWrapper->WriteMemoryFile("SharedPreloadA.txt", &sharedPreloadA, m_serializeContext));
+                EXPECT_TRUE(m_streamerWrapper->WriteMemoryFile("SharedPreloadB.txt", &sharedPreloadB, m_serializeContext));
+                EXPECT_TRUE(m_streamerWrapper->WriteMemoryFile("SharedPreload.txt", &noRefs, m_serializeContext));
+
                 m_assetHandlerAndCatalog->m_numCreations = 0;
             }
         }
@@ -1644,6 +1668,120 @@ namespace UnitTest
         m_assetHandlerAndCatalog->AssetCatalogRequestBus::Handler::BusDisconnect();
     }
 
+    TEST_F(AssetJobsFloodTest, ContainerLoadTest_AssetsSharingAPreload_AllBecomeReadyAfterThePreload)
+    {
+        m_assetHandlerAndCatalog->AssetCatalogRequestBus::Handler::BusConnect();
+        // Setup has already created/destroyed assets
+        m_assetHandlerAndCatalog->m_numCreations = 0;
+        m_assetHandlerAndCatalog->m_numDestructions = 0;
+        {
+            ContainerReadyListener readyListener(SharedPreloadRootId);
+            OnAssetReadyListener rootListener(SharedPreloadRootId, azrtti_typeid<AssetWithQueueAndPreLoadReferences>());
+            OnAssetReadyListener preLoadAListener(SharedPreloadAId, azrtti_typeid<AssetWithQueueAndPreLoadReferences>());
+            OnAssetReadyListener preLoadBListener(SharedPreloadBId, azrtti_typeid<AssetWithQueueAndPreLoadReferences>());
+            OnAssetReadyListener sharedListener(SharedPreloadId, azrtti_typeid<AssetWithQueueAndPreLoadReferences>());
+
+            rootListener.m_readyCheck = [&]([[maybe_unused]] const OnAssetReadyListener& thisListener)
+            {
+                return (preLoadAListener.m_ready > 0) && (preLoadBListener.m_ready > 0);
+            };
+            preLoadAListener.m_readyCheck = [&]([[maybe_unused]] const OnAssetReadyListener& thisListener)
+            {
+                return (sharedListener.m_ready > 0);
+            };
+            preLoadBListener.m_readyCheck = preLoadAListener.m_readyCheck;
+
+            auto asset = m_testAssetManager->FindOrCreateAsset(SharedPreloadRootId, azrtti_typeid<AssetWithQueueAndPreLoadReferences>(),
+                AZ::Data::AssetLoadBehavior::Default);
+            auto containerReady = m_testAssetManager->GetAssetContainer(asset);
+
+            auto maxTimeout = AZStd::chrono::steady_clock::now() + DefaultTimeoutSeconds;
+
+            while (!readyListener.m_ready)
+            {
+                m_testAssetManager->DispatchEvents();
+                if (AZStd::chrono::steady_clock::now() > maxTimeout)
+                {
+                    break;
+                }
+                AZStd::this_thread::yield();
+            }
+            EXPECT_EQ(containerReady->IsReady(), true);
+            EXPECT_EQ(containerReady->GetDependencies().size(), 3);
+
+            EXPECT_EQ(rootListener.m_ready, 1);
+            EXPECT_EQ(preLoadAListener.m_ready, 1);
+            EXPECT_EQ(preLoadBListener.m_ready, 1);
+            EXPECT_EQ(sharedListener.m_ready, 1);
+        }
+
+        CheckFinishedCreationsAndDestructions();
+        m_assetHandlerAndCatalog->AssetCatalogRequestBus::Handler::BusDisconnect();
+    }
+
+    TEST_F(AssetJobsFloodTest, ContainerLoadTest_LoadTimingsEnabled_RecordsEveryLoadStage)
+    {
+        m_assetHandlerAndCatalog->AssetCatalogRequestBus::Handler::BusConnect();
+        m_testAssetManager->SetAssetLoadTimingsEnabled(true);
+        // Setup has already created/destroyed assets
+        m_assetHandlerAndCatalog->m_numCreations = 0;
+        m_assetHandlerAndCatalog->m_numDestructions = 0;
+        {
+            ContainerReadyListener readyListener(PreloadAssetAId);
+
+            auto asset = m_testAssetManager->FindOrCreateAsset(PreloadAssetAId, azrtti_typeid<AssetWithQueueAndPreLoadReferences>(),
+                AZ::Data::AssetLoadBehavior::Default);
+            auto containerReady = m_testAssetManager->GetAssetContainer(asset);
+
+            auto maxTimeout = AZStd::chrono::steady_clock::now() + DefaultTimeoutSeconds;
+
+            while (!readyListener.m_ready)
+            {
+                m_testAssetManager->DispatchEvents();
+                if (AZStd::chrono::steady_clock::now() > maxTimeout)
+                {
+                    break;
+                }
+                AZStd::this_thread::yield();
+            }
+            EXPECT_EQ(containerReady->IsReady(), true);
+        }
+
+        AZStd::vector<AssetLoadTimings> timings = m_testAssetManager->GetAssetLoadTimings();
+        // PreLoadA, PreLoadB and QueueLoadB
+        EXPECT_EQ(timings.size(), 3);
+        for (const AssetLoadTimings& timing : timings)
+        {
+            EXPECT_NE(timing.m_queuedTime, AssetLoadTimings::Clock::time_point());
+            EXPECT_LE(timing.m_queuedTime, timing.m_streamReadyTime);
+            EXPECT_LE(timing.m_streamReadyTime, timing.m_loadStartTime);
+            EXPECT_LE(timing.m_loadStartTime, timing.m_loadEndTime);
+            EXPECT_LE(timing.m_loadEndTime, timing.m_readyTime);
+            EXPECT_EQ(timing.GetTotalDuration(), timing.m_readyTime - timing.m_queuedTime);
+        }
+
+        auto findTiming = [&timings](const AssetId& assetId)
+        {
+            return AZStd::find_if(timings.begin(), timings.end(), [&assetId](const AssetLoadTimings& timing)
+            {
+                return timing.m_assetId == assetId;
+            });
+        };
+        auto preLoadATiming = findTiming(PreloadAssetAId);
+        auto preLoadBTiming = findTiming(PreloadAssetBId);
+        ASSERT_NE(preLoadATiming, timings.end());
+        ASSERT_NE(preLoadBTiming, timings.end());
+        // PreLoadA can't be ready before its preload is
+        EXPECT_GE(preLoadATiming->m_readyTime, preLoadBTiming->m_readyTime);
+
+        m_testAssetManager->ClearAssetLoadTimings();
+        EXPECT_TRUE(m_testAssetManager->GetAssetLoadTimings().empty());
+
+        m_testAssetManager->SetAssetLoadTimingsEnabled(false);
+        CheckFinishedCreationsAndDestructions();
+        m_assetHandlerAndCatalog->AssetCatalogRequestBus::Handler::BusDisconnect();
+    }
+
 #if AZ_TRAIT_DISABLE_FAILED_ASSET_MANAGER_TESTS
     TEST_F(AssetJobsFloodTest, DISABLED_ContainerLoadTest_AssetWithQueueAndPreLoadReferencesThreeLevels_OnAssetReadyFollowsPreloads)
 #else
@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/DOM/Backends/Binary/BinaryBackend.h>
+#include <AzCore/DOM/Backends/Binary/BinarySerializationUtils.h>
+#include <AzCore/DOM/Backends/JSON/JsonBackend.h>
+#include <AzCore/DOM/DomUtils.h>
+#include <AzCore/DOM/DomValue.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <Tests/DOM/DomFixtures.h>
+
+namespace AZ::Dom::Tests
+{
+    class DomBinaryTests : public DomTestFixture
+    {
+    public:
+        // Validate round-trip serialization to and from the binary format, and from the binary format to JSON
+        void PerformSerializationChecks()
+        {
+            BinaryBackend binaryBackend;
+            AZStd::string serializedValue;
+            auto writeResult = Utils::ValueToSerializedString(binaryBackend, m_value, serializedValue);
+            ASSERT_TRUE(writeResult.IsSuccess());
+            EXPECT_TRUE(Binary::IsBinaryDom(serializedValue));
+
+            // binary -> Value
+            for (Lifetime lifetime : { Lifetime::Temporary, Lifetime::Persistent })
+            {
+                auto readResult = Utils::SerializedStringToValue(binaryBackend, serializedValue, lifetime);
+                ASSERT_TRUE(readResult.IsSuccess());
+                EXPECT_TRUE(Utils::DeepCompareIsEqual(m_value, readResult.GetValue()));
+            }
+
+            // binary -> JSON, which doesn't support nodes
+            if (!m_value.IsNode())
+            {
+                JsonBackend<Json::ParseFlags::Null, Json::OutputFormatting::MinifiedJson> jsonBackend;
+                AZStd::string expectedJson;
+                ASSERT_TRUE(Utils::ValueToSerializedString(jsonBackend, m_value, expectedJson).IsSuccess());
+
+                AZStd::string convertedJson;
+                auto convertResult = jsonBackend.WriteToBuffer(
+                    convertedJson,
+                    [&](Visitor& visitor)
+                    {
+                        return Utils::ReadFromString(binaryBackend, serializedValue, Lifetime::Temporary, visitor);
+                    });
+                EXPECT_TRUE(convertResult.IsSuccess());
+                EXPECT_EQ(expectedJson, convertedJson);
+            }
+        }
+
+        Value m_value;
+    };
+
+    TEST_F(DomBinaryTests, Primitives)
+    {
+        m_value.SetArray();
+        m_value.ArrayPushBack(Value(Type::Null));
+        m_value.ArrayPushBack(Value(true));
+        m_value.ArrayPushBack(Value(false));
+        m_value.ArrayPushBack(Value(AZStd::numeric_limits<AZ::s64>::min()));
+        m_value.ArrayPushBack(Value(AZ::s64{ -1 }));
+        m_value.ArrayPushBack(Value(AZ::s64{ 0 }));
+        m_value.ArrayPushBack(Value(AZStd::numeric_limits<AZ::s64>::max()));
+        m_value.ArrayPushBack(Value(AZStd::numeric_limits<AZ::u64>::max()));
+        m_value.ArrayPushBack(Value(-4.25));
+        m_value.ArrayPushBack(Value(AZStd::numeric_limits<double>::max()));
+        PerformSerializationChecks();
+    }
+
+    TEST_F(DomBinaryTests, Strings)
+    {
+        m_value.SetArray();
+        m_value.ArrayPushBack(Value("", true));
+        m_value.ArrayPushBack(Value("Simple string", true));
+        m_value.ArrayPushBack(Value(AZStd::string(1000, 'x'), true));
+        PerformSerializationChecks();
+    }
+
+    TEST_F(DomBinaryTests, StringWithNullCharacters_RoundTrips)
+    {
+        m_value.SetArray();
+        m_value.ArrayPushBack(Value(AZStd::string_view("a\0b\0c", 5), true));
+
+        BinaryBackend backend;
+        AZStd::string serializedValue;
+        ASSERT_TRUE(Utils::ValueToSerializedString(backend, m_value, serializedValue).IsSuccess());
+        auto readResult = Utils::SerializedStringToValue(backend, serializedValue, Lifetime::Temporary);
+        ASSERT_TRUE(readResult.IsSuccess());
+        EXPECT_EQ(AZStd::string_view("a\0b\0c", 5), readResult.GetValue()[0].GetString());
+    }
+
+    TEST_F(DomBinaryTests, NestedObjectsAndArrays)
+    {
+        m_value.SetObject();
+        for (int j = 0; j < 7; ++j)
+        {
+            Value nestedObject(Type::Object);
+            for (int i = 0; i < 5; ++i)
+            {
+                nestedObject.AddMember(AZStd::string::format("Key%i", i), Value(i));
+            }
+
+            Value nestedArray(Type::Array);
+            for (int i = 0; i < 5; ++i)
+            {
+                nestedArray.ArrayPushBack(Value(i));
+            }
+            nestedObject.AddMember("Array", AZStd::move(nestedArray));
+            m_value.AddMember(AZStd::string::format("Obj%i", j), AZStd::move(nestedObject));
+        }
+        PerformSerializationChecks();
+    }
+
+    TEST_F(DomBinaryTests, Nodes)
+    {
+        m_value.SetNode("TopLevel");
+        for (int i = 0; i < 3; ++i)
+        {
+            Value childNode(Type::Node);
+            childNode.SetNodeName("Child");
+            childNode.AddMember("index", Value(i));
+            childNode.ArrayPushBack(Value("content", true));
+            m_value.ArrayPushBack(AZStd::move(childNode));
+        }
+        m_value.AddMember("attribute", Value(42));
+        PerformSerializationChecks();
+    }
+
+    TEST_F(DomBinaryTests, RepeatedKeys_AreWrittenOnce)
+    {
+        m_value.SetArray();
+        for (int i = 0; i < 10; ++i)
+        {
+            Value entry(Type::Object);
+            entry.AddMember("UniqueKeyName", Value(i));
+            m_value.ArrayPushBack(AZStd::move(entry));
+        }
+
+        BinaryBackend backend;
+        AZStd::string serializedValue;
+        ASSERT_TRUE(Utils::ValueToSerializedString(backend, m_value, serializedValue).IsSuccess());
+        const size_t firstKey = serializedValue.find("UniqueKeyName");
+        ASSERT_NE(AZStd::string::npos, firstKey);
+        EXPECT_EQ(AZStd::string::npos, serializedValue.find("UniqueKeyName", firstKey + 1));
+        PerformSerializationChecks();
+    }
+
+    TEST_F(DomBinaryTests, PersistentRead_StringsReferenceBuffer)
+    {
+        m_value.SetArray();
+        m_value.ArrayPushBack(Value("Referenced string", true));
+
+        BinaryBackend backend;
+        AZStd::string serializedValue;
+        ASSERT_TRUE(Utils::ValueToSerializedString(backend, m_value, serializedValue).IsSuccess());
+
+        auto readResult = Utils::SerializedStringToValue(backend, serializedValue, Lifetime::Persistent);
+        ASSERT_TRUE(readResult.IsSuccess());
+        const AZStd::string_view readString = readResult.GetValue()[0].GetString();
+        EXPECT_EQ("Referenced string", readString);
+        EXPECT_GE(readString.data(), serializedValue.data());
+        EXPECT_LE(readString.data() + readString.size(), serializedValue.data() + serializedValue.size());
+    }
+
+    TEST_F(DomBinaryTests, InvalidData_IsRejected)
+    {
+        m_value.SetObject();
+        m_value.AddMember("Key", Value("Value", true));
+
+        BinaryBackend backend;
+        AZStd::string serializedValue;
+        ASSERT_TRUE(Utils::ValueToSerializedString(backend, m_value, serializedValue).IsSuccess());
+
+        // Every truncated version of the buffer is rejected.
+        for (size_t size = 0; size < serializedValue.size(); ++size)
+        {
+            EXPECT_FALSE(Utils::SerializedStringToValue(backend, serializedValue.substr(0, size), Lifetime::Temporary).IsSuccess());
+        }
+
+        EXPECT_FALSE(Utils::SerializedStringToValue(backend, "{ \"Key\": \"Value\" }", Lifetime::Temporary).IsSuccess());
+        EXPECT_FALSE(Utils::SerializedStringToValue(backend, serializedValue + '\0', Lifetime::Temporary).IsSuccess());
+    }
+} // namespace AZ::Dom::Tests
@@ -8,6 +8,7 @@
 
 #if defined(HAVE_BENCHMARK)
 
+#include <AzCore/DOM/Backends/Binary/BinaryBackend.h>
 #include <AzCore/DOM/Backends/JSON/JsonBackend.h>
 #include <AzCore/DOM/Backends/JSON/JsonSerializationUtils.h>
 #include <AzCore/DOM/DomUtils.h>
@@ -112,6 +113,104 @@ namespace AZ::Dom::Benchmark
     }
     DOM_REGISTER_SERIALIZATION_BENCHMARK_MS(DomJsonBenchmark, AzDomDeserializeToAzDomValue)
 
+    BENCHMARK_DEFINE_F(DomJsonBenchmark, AzDomDeserializeBinaryToRapidjson)(benchmark::State& state)
+    {
+        AZ::Dom::BinaryBackend backend;
+        AZStd::string serializedPayload;
+        Utils::ValueToSerializedString(backend, GenerateDomBenchmarkPayload(state.range(0), state.range(1)), serializedPayload);
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            auto result = AZ::Dom::Json::WriteToRapidJsonDocument(
+                [&](AZ::Dom::Visitor& visitor)
+                {
+                    return AZ::Dom::Utils::ReadFromString(backend, serializedPayload, AZ::Dom::Lifetime::Temporary, visitor);
+                });
+
+            TakeAndDiscardWithoutTimingDtor(result.TakeValue(), state);
+        }
+
+        state.SetBytesProcessed(serializedPayload.size() * state.iterations());
+    }
+    DOM_REGISTER_SERIALIZATION_BENCHMARK_MS(DomJsonBenchmark, AzDomDeserializeBinaryToRapidjson)
+
+    BENCHMARK_DEFINE_F(DomJsonBenchmark, AzDomDeserializeBinaryToAzDomValue)(benchmark::State& state)
+    {
+        AZ::Dom::BinaryBackend backend;
+        AZStd::string serializedPayload;
+        Utils::ValueToSerializedString(backend, GenerateDomBenchmarkPayload(state.range(0), state.range(1)), serializedPayload);
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            auto result = AZ::Dom::Utils::WriteToValue(
+                [&](AZ::Dom::Visitor& visitor)
+                {
+                    return AZ::Dom::Utils::ReadFromString(backend, serializedPayload, AZ::Dom::Lifetime::Temporary, visitor);
+                });
+
+            TakeAndDiscardWithoutTimingDtor(result.TakeValue(), state);
+        }
+
+        state.SetBytesProcessed(serializedPayload.size() * state.iterations());
+    }
+    DOM_REGISTER_SERIALIZATION_BENCHMARK_MS(DomJsonBenchmark, AzDomDeserializeBinaryToAzDomValue)
+
+    // Reads strings as references into the buffer, as when reading from a memory mapped file.
+    BENCHMARK_DEFINE_F(DomJsonBenchmark, AzDomDeserializeBinaryToAzDomValuePersistent)(benchmark::State& state)
+    {
+        AZ::Dom::BinaryBackend backend;
+        AZStd::string serializedPayload;
+        Utils::ValueToSerializedString(backend, GenerateDomBenchmarkPayload(state.range(0), state.range(1)), serializedPayload);
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            auto result = AZ::Dom::Utils::WriteToValue(
+                [&](AZ::Dom::Visitor& visitor)
+                {
+                    return AZ::Dom::Utils::ReadFromString(backend, serializedPayload, AZ::Dom::Lifetime::Persistent, visitor);
+                });
+
+            TakeAndDiscardWithoutTimingDtor(result.TakeValue(), state);
+        }
+
+        state.SetBytesProcessed(serializedPayload.size() * state.iterations());
+    }
+    DOM_REGISTER_SERIALIZATION_BENCHMARK_MS(DomJsonBenchmark, AzDomDeserializeBinaryToAzDomValuePersistent)
+
+    BENCHMARK_DEFINE_F(DomJsonBenchmark, AzDomSerializeAzDomValueToJson)(benchmark::State& state)
+    {
+        AZ::Dom::JsonBackend<AZ::Dom::Json::ParseFlags::ParseComments, AZ::Dom::Json::OutputFormatting::MinifiedJson> backend;
+        Value payload = GenerateDomBenchmarkPayload(state.range(0), state.range(1));
+        AZStd::string serializedPayload;
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            serializedPayload.clear();
+            Utils::ValueToSerializedString(backend, payload, serializedPayload);
+        }
+
+        state.SetBytesProcessed(serializedPayload.size() * state.iterations());
+        state.counters["PayloadBytes"] = aznumeric_cast<double>(serializedPayload.size());
+    }
+    DOM_REGISTER_SERIALIZATION_BENCHMARK_MS(DomJsonBenchmark, AzDomSerializeAzDomValueToJson)
+
+    BENCHMARK_DEFINE_F(DomJsonBenchmark, AzDomSerializeAzDomValueToBinary)(benchmark::State& state)
+    {
+        AZ::Dom::BinaryBackend backend;
+        Value payload = GenerateDomBenchmarkPayload(state.range(0), state.range(1));
+        AZStd::string serializedPayload;
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            serializedPayload.clear();
+            Utils::ValueToSerializedString(backend, payload, serializedPayload);
+        }
+
+        state.SetBytesProcessed(serializedPayload.size() * state.iterations());
+        state.counters["PayloadBytes"] = aznumeric_cast<double>(serializedPayload.size());
+    }
+    DOM_REGISTER_SERIALIZATION_BENCHMARK_MS(DomJsonBenchmark, AzDomSerializeAzDomValueToBinary)
+
     BENCHMARK_DEFINE_F(DomJsonBenchmark, RapidjsonDeserializeToRapidjson)(benchmark::State& state)
     {
         AZ::Dom::JsonBackend backend;
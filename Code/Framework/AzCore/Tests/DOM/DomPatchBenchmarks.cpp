@@ -72,6 +72,81 @@ namespace AZ::Dom::Benchmark
             RunBenchmarkInternal(state, apply);
         }
 
+        // Generates a document shaped like a prefab, with entityCount entities that each have a few components.
+        static Value GenerateEntityDocument(size_t entityCount)
+        {
+            Value document(Type::Object);
+            Value entities(Type::Object);
+            entities.MemberReserve(entityCount);
+            for (size_t i = 0; i < entityCount; ++i)
+            {
+                Value translate(Type::Array);
+                translate.ArrayPushBack(Value(static_cast<double>(i)));
+                translate.ArrayPushBack(Value(0.0));
+                translate.ArrayPushBack(Value(0.0));
+
+                Value transform(Type::Object);
+                transform.AddMember("$type", Value("TransformComponent", false));
+                transform.AddMember("Translate", AZStd::move(translate));
+                transform.AddMember("Scale", Value(1.0));
+
+                Value components(Type::Object);
+                components.AddMember("Transform", AZStd::move(transform));
+
+                Value entity(Type::Object);
+                entity.AddMember("Id", Value(static_cast<AZ::u64>(i)));
+                entity.AddMember("Name", Value(AZStd::string::format("Entity_%zu", i), true));
+                entity.AddMember("Components", AZStd::move(components));
+
+                entities.AddMember(AZStd::string::format("Entity_%zu", i), AZStd::move(entity));
+            }
+            document.AddMember("Entities", AZStd::move(entities));
+            return document;
+        }
+
+        // Generates a patch that moves a single entity in a document generated by GenerateEntityDocument.
+        static Patch GenerateEntityMovePatch(size_t entityCount)
+        {
+            const Path translatePath(AZStd::string::format("/Entities/Entity_%zu/Components/Transform/Translate", entityCount / 2));
+            return Patch({ PatchOperation::TestOperation(translatePath / PathEntry(1), Value(0.0)),
+                           PatchOperation::ReplaceOperation(translatePath / PathEntry(1), Value(42.0)) });
+        }
+
+        void EntityDocumentApply(benchmark::State& state, bool deepCopy)
+        {
+            const size_t entityCount = aznumeric_cast<size_t>(state.range(0));
+            m_before = GenerateEntityDocument(entityCount);
+            const Patch patch = GenerateEntityMovePatch(entityCount);
+
+            for ([[maybe_unused]] auto _ : state)
+            {
+                // A shallow copy shares every container with m_before, so applying the patch only copies the
+                // containers on the path to the modified value.
+                Value instance = deepCopy ? Utils::DeepCopy(m_before) : m_before;
+                auto patchResult = patch.ApplyInPlace(instance);
+                benchmark::DoNotOptimize(patchResult);
+                benchmark::DoNotOptimize(instance);
+            }
+
+            state.SetItemsProcessed(state.iterations());
+        }
+
+        void EntityDocumentGenerate(benchmark::State& state)
+        {
+            const size_t entityCount = aznumeric_cast<size_t>(state.range(0));
+            m_before = GenerateEntityDocument(entityCount);
+            m_after = m_before;
+            GenerateEntityMovePatch(entityCount).ApplyInPlace(m_after);
+
+            for ([[maybe_unused]] auto _ : state)
+            {
+                auto patchInfo = GenerateHierarchicalDeltaPatch(m_before, m_after);
+                benchmark::DoNotOptimize(patchInfo);
+            }
+
+            state.SetItemsProcessed(state.iterations());
+        }
+
     private:
         void RunBenchmarkInternal(benchmark::State& state, bool apply)
         {
@@ -177,4 +252,31 @@ namespace AZ::Dom::Benchmark
         ArrayPrepend(state, true, true);
     }
     DOM_REGISTER_SERIALIZATION_BENCHMARK_MS(DomPatchBenchmark, AzDomPatch_Apply_ArrayPrepend)
+
+    BENCHMARK_DEFINE_F(DomPatchBenchmark, AzDomPatch_Apply_EntityDocument_SharedCopy)(benchmark::State& state)
+    {
+        EntityDocumentApply(state, false);
+    }
+    BENCHMARK_REGISTER_F(DomPatchBenchmark, AzDomPatch_Apply_EntityDocument_SharedCopy)
+        ->Arg(10000)
+        ->Arg(100000)
+        ->Unit(benchmark::kMillisecond);
+
+    BENCHMARK_DEFINE_F(DomPatchBenchmark, AzDomPatch_Apply_EntityDocument_DeepCopy)(benchmark::State& state)
+    {
+        EntityDocumentApply(state, true);
+    }
+    BENCHMARK_REGISTER_F(DomPatchBenchmark, AzDomPatch_Apply_EntityDocument_DeepCopy)
+        ->Arg(10000)
+        ->Arg(100000)
+        ->Unit(benchmark::kMillisecond);
+
+    BENCHMARK_DEFINE_F(DomPatchBenchmark, AzDomPatch_Generate_EntityDocument)(benchmark::State& state)
+    {
+        EntityDocumentGenerate(state);
+    }
+    BENCHMARK_REGISTER_F(DomPatchBenchmark, AzDomPatch_Generate_EntityDocument)
+        ->Arg(10000)
+        ->Arg(100000)
+        ->Unit(benchmark::kMillisecond);
 } // namespace AZ::Dom::Benchmark
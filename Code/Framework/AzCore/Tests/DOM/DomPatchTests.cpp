@@ -580,4 +580,49 @@ namespace AZ::Dom::Tests
 
         EXPECT_FALSE(info.m_forwardPatches.ContainsNormalizedEntries());
     }
+
+    TEST_F(DomPatchTests, ApplyPatch_UnmodifiedContainersRemainShared)
+    {
+        const Value& original = m_dataset;
+        Value patched = original;
+
+        auto result = PatchOperation::ReplaceOperation(Path("/obj/foo"), Value(false)).ApplyInPlace(patched);
+        ASSERT_TRUE(result.IsSuccess());
+
+        // Only the containers along the patched path are copied
+        const Value& constPatched = patched;
+        EXPECT_NE(constPatched.GetInternalValue(), original.GetInternalValue());
+        EXPECT_NE(constPatched["obj"].GetInternalValue(), original["obj"].GetInternalValue());
+        EXPECT_EQ(constPatched["arr"].GetInternalValue(), original["arr"].GetInternalValue());
+        EXPECT_EQ(constPatched["node"].GetInternalValue(), original["node"].GetInternalValue());
+        EXPECT_TRUE(original["obj"]["foo"].GetBool());
+    }
+
+    TEST_F(DomPatchTests, ReadOnlyAndFailedOperations_DoNotCopyContainers)
+    {
+        const Value& original = m_dataset;
+        Value patched = original;
+
+        EXPECT_TRUE(PatchOperation::TestOperation(Path("/obj/foo"), Value(true)).ApplyInPlace(patched).IsSuccess());
+        EXPECT_FALSE(PatchOperation::RemoveOperation(Path("/obj/invalid")).ApplyInPlace(patched).IsSuccess());
+        EXPECT_FALSE(PatchOperation::AddOperation(Path("/arr/10"), Value(1)).ApplyInPlace(patched).IsSuccess());
+
+        const Value& constPatched = patched;
+        EXPECT_EQ(constPatched.GetInternalValue(), original.GetInternalValue());
+    }
+
+    TEST_F(DomPatchTests, TestPatch_SharedSubtreesAreSkipped)
+    {
+        for (int i = 0; i < 100; ++i)
+        {
+            m_dataset["arr"].ArrayPushBack(Value(i));
+            m_dataset["obj"][AZStd::string::format("Key%i", i)] = Value(i);
+        }
+        m_deltaDataset = m_dataset;
+        m_deltaDataset["obj"]["foo"] = Value(42);
+
+        PatchUndoRedoInfo info = GenerateAndVerifyDelta();
+        ASSERT_EQ(1, info.m_forwardPatches.Size());
+        EXPECT_EQ(Path("/obj/foo"), info.m_forwardPatches.begin()->GetDestinationPath());
+    }
 } // namespace AZ::Dom::Tests
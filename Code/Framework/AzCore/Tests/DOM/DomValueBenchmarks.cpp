@@ -6,6 +6,8 @@
  *
  */
 
+#include <AzCore/DOM/Backends/Binary/BinaryBackend.h>
+#include <AzCore/DOM/Backends/JSON/JsonBackend.h>
 #include <AzCore/DOM/DomUtils.h>
 #include <AzCore/DOM/DomValue.h>
 #include <AzCore/Name/NameDictionary.h>
@@ -263,4 +265,37 @@ namespace AZ::Dom::Benchmark
     }
     BENCHMARK_REGISTER_F(DomValueBenchmark, LookupMemberByStringComparison)->Arg(100)->Arg(1000)->Arg(10000)->Unit(benchmark::kMillisecond);
 
+    // Round trips a Value through a serialized payload, as when the payload is sent between the editor and a prefab or
+    // document property editor.
+    template<class BackendType>
+    void RoundTripThroughBackend(DomValueBenchmark& fixture, benchmark::State& state)
+    {
+        BackendType backend;
+        Value original = fixture.GenerateDomBenchmarkPayload(state.range(0), state.range(1));
+        AZStd::string serializedPayload;
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            serializedPayload.clear();
+            Utils::ValueToSerializedString(backend, original, serializedPayload);
+            auto result = Utils::SerializedStringToValue(backend, serializedPayload, Lifetime::Temporary);
+            DomValueBenchmark::TakeAndDiscardWithoutTimingDtor(result.TakeValue(), state);
+        }
+
+        state.SetBytesProcessed(serializedPayload.size() * state.iterations());
+        state.counters["PayloadBytes"] = aznumeric_cast<double>(serializedPayload.size());
+    }
+
+    BENCHMARK_DEFINE_F(DomValueBenchmark, AzDomValueRoundTripJson)(benchmark::State& state)
+    {
+        RoundTripThroughBackend<JsonBackend<Json::ParseFlags::ParseComments, Json::OutputFormatting::MinifiedJson>>(*this, state);
+    }
+    DOM_REGISTER_SERIALIZATION_BENCHMARK_MS(DomValueBenchmark, AzDomValueRoundTripJson)
+
+    BENCHMARK_DEFINE_F(DomValueBenchmark, AzDomValueRoundTripBinary)(benchmark::State& state)
+    {
+        RoundTripThroughBackend<BinaryBackend>(*this, state);
+    }
+    DOM_REGISTER_SERIALIZATION_BENCHMARK_MS(DomValueBenchmark, AzDomValueRoundTripBinary)
+
 } // namespace AZ::Dom::Benchmark
@@ -9,6 +9,7 @@
 #include <AzCore/EBus/EBus.h>
 #include <AzCore/EBus/Results.h>
 #include <AzCore/std/sort.h>
+#include <AzCore/std/containers/span.h>
 #include <AzCore/std/chrono/chrono.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/parallel/thread.h>
@@ -4299,6 +4300,188 @@ namespace UnitTest
             &ReentrantEBusUseTestRequestBus::Events::EventCallsOtherEventOnDifferentEBusId, secondBusId);
     }
 
+    struct BatchedTestEvent
+    {
+        int m_value = 0;
+    };
+
+    class BatchedTestRequests : public AZ::EBusTraits
+    {
+    public:
+        static const AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::ById;
+        using BusIdType = int32_t;
+        static constexpr bool EnableBatchedDispatch = true;
+        static constexpr bool EnableDispatchStatistics = true;
+        using BatchedEventType = BatchedTestEvent;
+
+        virtual void OnBatchedEvents(AZStd::span<const BatchedTestEvent> events) = 0;
+    };
+    using BatchedTestRequestBus = AZ::EBus<BatchedTestRequests>;
+
+    class DeduplicatedBatchedTestRequests : public AZ::EBusTraits
+    {
+    public:
+        static const AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::ById;
+        using BusIdType = int32_t;
+        static constexpr bool EnableBatchedDispatch = true;
+        static constexpr bool DeduplicateBatchedEvents = true;
+        using BatchedEventType = BatchedTestEvent;
+
+        virtual void OnBatchedEvents(AZStd::span<const BatchedTestEvent> events) = 0;
+    };
+    using DeduplicatedBatchedTestRequestBus = AZ::EBus<DeduplicatedBatchedTestRequests>;
+
+    template<class Bus>
+    class BatchedTestHandler
+        : public Bus::Handler
+    {
+    public:
+        explicit BatchedTestHandler(int32_t busId)
+        {
+            Bus::Handler::BusConnect(busId);
+        }
+
+        ~BatchedTestHandler() override
+        {
+            Bus::Handler::BusDisconnect();
+        }
+
+        void OnBatchedEvents(AZStd::span<const BatchedTestEvent> events) override
+        {
+            ++m_batchCount;
+            for (const BatchedTestEvent& event : events)
+            {
+                m_values.push_back(event.m_value);
+            }
+            if (m_onBatch)
+            {
+                m_onBatch();
+            }
+        }
+
+        int m_batchCount = 0;
+        AZStd::vector<int> m_values;
+        AZStd::function<void()> m_onBatch;
+    };
+
+    TEST_F(EBus, BatchedBroadcast_DeliversAllEventsInOneCallPerHandler)
+    {
+        BatchedTestHandler<BatchedTestRequestBus> firstHandler(1);
+        BatchedTestHandler<BatchedTestRequestBus> secondHandler(2);
+
+        BatchedTestRequestBus::QueueBatchedBroadcast({ 1 });
+        BatchedTestRequestBus::QueueBatchedBroadcast({ 2 });
+        BatchedTestRequestBus::QueueBatchedBroadcast({ 3 });
+        EXPECT_EQ(3u, BatchedTestRequestBus::BatchedEventCount());
+        EXPECT_EQ(0, firstHandler.m_batchCount);
+
+        BatchedTestRequestBus::ExecuteBatchedEvents();
+        EXPECT_EQ(0u, BatchedTestRequestBus::BatchedEventCount());
+
+        const AZStd::vector<int> expectedValues = { 1, 2, 3 };
+        EXPECT_EQ(1, firstHandler.m_batchCount);
+        EXPECT_EQ(expectedValues, firstHandler.m_values);
+        EXPECT_EQ(1, secondHandler.m_batchCount);
+        EXPECT_EQ(expectedValues, secondHandler.m_values);
+    }
+
+    TEST_F(EBus, BatchedEvent_GroupsEventsPerAddressInQueueOrder)
+    {
+        BatchedTestHandler<BatchedTestRequestBus> firstHandler(1);
+        BatchedTestHandler<BatchedTestRequestBus> secondHandler(2);
+        BatchedTestHandler<BatchedTestRequestBus> unaddressedHandler(3);
+
+        BatchedTestRequestBus::QueueBatchedEvent(1, { 10 });
+        BatchedTestRequestBus::QueueBatchedEvent(2, { 20 });
+        BatchedTestRequestBus::QueueBatchedEvent(1, { 11 });
+        BatchedTestRequestBus::QueueBatchedEvent(2, { 21 });
+        BatchedTestRequestBus::QueueBatchedEvent(1, { 12 });
+        BatchedTestRequestBus::ExecuteBatchedEvents();
+
+        EXPECT_EQ(1, firstHandler.m_batchCount);
+        EXPECT_EQ(AZStd::vector<int>({ 10, 11, 12 }), firstHandler.m_values);
+        EXPECT_EQ(1, secondHandler.m_batchCount);
+        EXPECT_EQ(AZStd::vector<int>({ 20, 21 }), secondHandler.m_values);
+        EXPECT_EQ(0, unaddressedHandler.m_batchCount);
+    }
+
+    TEST_F(EBus, BatchedEvent_Deduplicated_DeliversLastEventPerAddress)
+    {
+        BatchedTestHandler<DeduplicatedBatchedTestRequestBus> firstHandler(1);
+        BatchedTestHandler<DeduplicatedBatchedTestRequestBus> secondHandler(2);
+
+        DeduplicatedBatchedTestRequestBus::QueueBatchedEvent(1, { 10 });
+        DeduplicatedBatchedTestRequestBus::QueueBatchedEvent(2, { 20 });
+        DeduplicatedBatchedTestRequestBus::QueueBatchedEvent(1, { 11 });
+        DeduplicatedBatchedTestRequestBus::QueueBatchedEvent(1, { 12 });
+        EXPECT_EQ(2u, DeduplicatedBatchedTestRequestBus::BatchedEventCount());
+        DeduplicatedBatchedTestRequestBus::ExecuteBatchedEvents();
+
+        EXPECT_EQ(AZStd::vector<int>({ 12 }), firstHandler.m_values);
+        EXPECT_EQ(AZStd::vector<int>({ 20 }), secondHandler.m_values);
+    }
+
+    TEST_F(EBus, BatchedEvent_QueuedDuringExecute_DeliveredWithNextBatch)
+    {
+        BatchedTestHandler<BatchedTestRequestBus> handler(1);
+        handler.m_onBatch = [&handler]()
+        {
+            if (handler.m_batchCount == 1)
+            {
+                BatchedTestRequestBus::QueueBatchedEvent(1, { 2 });
+            }
+        };
+
+        BatchedTestRequestBus::QueueBatchedEvent(1, { 1 });
+        BatchedTestRequestBus::ExecuteBatchedEvents();
+        EXPECT_EQ(1, handler.m_batchCount);
+        EXPECT_EQ(AZStd::vector<int>({ 1 }), handler.m_values);
+        EXPECT_EQ(1u, BatchedTestRequestBus::BatchedEventCount());
+
+        BatchedTestRequestBus::ExecuteBatchedEvents();
+        EXPECT_EQ(2, handler.m_batchCount);
+        EXPECT_EQ(AZStd::vector<int>({ 1, 2 }), handler.m_values);
+    }
+
+    TEST_F(EBus, BatchedEvent_ClearBatchedEvents_DiscardsEvents)
+    {
+        BatchedTestHandler<BatchedTestRequestBus> handler(1);
+
+        BatchedTestRequestBus::QueueBatchedEvent(1, { 1 });
+        BatchedTestRequestBus::QueueBatchedBroadcast({ 2 });
+        EXPECT_EQ(2u, BatchedTestRequestBus::BatchedEventCount());
+
+        BatchedTestRequestBus::ClearBatchedEvents();
+        EXPECT_EQ(0u, BatchedTestRequestBus::BatchedEventCount());
+
+        BatchedTestRequestBus::ExecuteBatchedEvents();
+        EXPECT_EQ(0, handler.m_batchCount);
+    }
+
+    TEST_F(EBus, DispatchStatistics_RecordsDispatchesAndBatchedEvents)
+    {
+        BatchedTestHandler<BatchedTestRequestBus> firstHandler(1);
+        BatchedTestHandler<BatchedTestRequestBus> secondHandler(2);
+        BatchedTestRequestBus::ResetDispatchStatistics();
+
+        BatchedTestRequestBus::QueueBatchedBroadcast({ 1 });
+        BatchedTestRequestBus::QueueBatchedEvent(1, { 2 });
+        BatchedTestRequestBus::QueueBatchedEvent(2, { 3 });
+        BatchedTestRequestBus::QueueBatchedEvent(2, { 4 });
+        BatchedTestRequestBus::ExecuteBatchedEvents();
+
+        // One broadcast and one event per address
+        AZ::EBusDispatchStatistics statistics = BatchedTestRequestBus::GetDispatchStatistics();
+        EXPECT_EQ(3u, statistics.m_dispatchCount);
+        EXPECT_EQ(4u, statistics.m_batchedEventCount);
+
+        BatchedTestRequestBus::ResetDispatchStatistics();
+        statistics = BatchedTestRequestBus::GetDispatchStatistics();
+        EXPECT_EQ(0u, statistics.m_dispatchCount);
+        EXPECT_EQ(0u, statistics.m_batchedEventCount);
+        EXPECT_EQ(0, statistics.m_dispatchTime.count());
+    }
+
 } // namespace UnitTest
 
 #if defined(HAVE_BENCHMARK)
@@ -4805,6 +4988,152 @@ namespace Benchmark
         }
     }
     BENCHMARK(BM_EBus_Multithreaded_Lockless)->Apply(&BenchmarkSettings::OneToMany)->Apply(&BenchmarkSettings::Multithreaded);
+
+    // Classic vs batched dispatch
+    struct BatchedBenchmarkEvent
+    {
+        int m_value = 0;
+    };
+
+    class BatchedBenchmarkInterface : public AZ::EBusTraits
+    {
+    public:
+        static const AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::ById;
+        using BusIdType = int;
+        static constexpr bool EnableBatchedDispatch = true;
+        using BatchedEventType = BatchedBenchmarkEvent;
+
+        virtual void OnEvent(const BatchedBenchmarkEvent& event) = 0;
+        virtual void OnBatchedEvents(AZStd::span<const BatchedBenchmarkEvent> events) = 0;
+    };
+    using BatchedBenchmarkBus = AZ::EBus<BatchedBenchmarkInterface>;
+
+    class BatchedBenchmarkHandler
+        : public BatchedBenchmarkBus::Handler
+    {
+    public:
+        void OnEvent(const BatchedBenchmarkEvent& event) override
+        {
+            m_sum += event.m_value;
+        }
+
+        void OnBatchedEvents(AZStd::span<const BatchedBenchmarkEvent> events) override
+        {
+            for (const BatchedBenchmarkEvent& event : events)
+            {
+                m_sum += event.m_value;
+            }
+        }
+
+        int m_sum = 0;
+    };
+
+    class BM_EBusBatchedEnvironment
+    {
+    public:
+        BM_EBusBatchedEnvironment(int addressCount, int handlersPerAddress)
+        {
+            m_handlers.resize(addressCount * handlersPerAddress);
+            for (int handlerIndex = 0; handlerIndex < static_cast<int>(m_handlers.size()); ++handlerIndex)
+            {
+                m_handlers[handlerIndex].BusConnect(handlerIndex % addressCount);
+            }
+        }
+
+        ~BM_EBusBatchedEnvironment()
+        {
+            for (BatchedBenchmarkHandler& handler : m_handlers)
+            {
+                handler.BusDisconnect();
+            }
+        }
+
+    private:
+        AZStd::vector<BatchedBenchmarkHandler> m_handlers;
+    };
+
+    namespace BenchmarkSettings
+    {
+        void Batched(::benchmark::internal::Benchmark* benchmark)
+        {
+            Common(benchmark);
+            benchmark
+                ->ArgNames({ { "Addresses" },{ "Events" } })
+                ->Args({ 1, 1 })
+                ->Args({ 1, Many })
+                ->Args({ Many, Many })
+                ->Args({ Many, 10 * Many })
+                ;
+        }
+    }
+
+    static void BM_EBus_Batched_Broadcast_Classic(::benchmark::State& state)
+    {
+        const int eventCount = static_cast<int>(state.range(1));
+        BM_EBusBatchedEnvironment environment(static_cast<int>(state.range(0)), 1);
+
+        while (state.KeepRunning())
+        {
+            for (int eventIndex = 0; eventIndex < eventCount; ++eventIndex)
+            {
+                BatchedBenchmarkBus::Broadcast(&BatchedBenchmarkBus::Events::OnEvent, BatchedBenchmarkEvent{ eventIndex });
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * eventCount);
+    }
+    BENCHMARK(BM_EBus_Batched_Broadcast_Classic)->Apply(&BenchmarkSettings::Batched);
+
+    static void BM_EBus_Batched_Broadcast_Batched(::benchmark::State& state)
+    {
+        const int eventCount = static_cast<int>(state.range(1));
+        BM_EBusBatchedEnvironment environment(static_cast<int>(state.range(0)), 1);
+
+        while (state.KeepRunning())
+        {
+            for (int eventIndex = 0; eventIndex < eventCount; ++eventIndex)
+            {
+                BatchedBenchmarkBus::QueueBatchedBroadcast(BatchedBenchmarkEvent{ eventIndex });
+            }
+            BatchedBenchmarkBus::ExecuteBatchedEvents();
+        }
+        state.SetItemsProcessed(state.iterations() * eventCount);
+    }
+    BENCHMARK(BM_EBus_Batched_Broadcast_Batched)->Apply(&BenchmarkSettings::Batched);
+
+    static void BM_EBus_Batched_Event_Classic(::benchmark::State& state)
+    {
+        const int addressCount = static_cast<int>(state.range(0));
+        const int eventCount = static_cast<int>(state.range(1));
+        BM_EBusBatchedEnvironment environment(addressCount, 1);
+
+        while (state.KeepRunning())
+        {
+            for (int eventIndex = 0; eventIndex < eventCount; ++eventIndex)
+            {
+                BatchedBenchmarkBus::Event(eventIndex % addressCount, &BatchedBenchmarkBus::Events::OnEvent, BatchedBenchmarkEvent{ eventIndex });
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * eventCount);
+    }
+    BENCHMARK(BM_EBus_Batched_Event_Classic)->Apply(&BenchmarkSettings::Batched);
+
+    static void BM_EBus_Batched_Event_Batched(::benchmark::State& state)
+    {
+        const int addressCount = static_cast<int>(state.range(0));
+        const int eventCount = static_cast<int>(state.range(1));
+        BM_EBusBatchedEnvironment environment(addressCount, 1);
+
+        while (state.KeepRunning())
+        {
+            for (int eventIndex = 0; eventIndex < eventCount; ++eventIndex)
+            {
+                BatchedBenchmarkBus::QueueBatchedEvent(eventIndex % addressCount, BatchedBenchmarkEvent{ eventIndex });
+            }
+            BatchedBenchmarkBus::ExecuteBatchedEvents();
+        }
+        state.SetItemsProcessed(state.iterations() * eventCount);
+    }
+    BENCHMARK(BM_EBus_Batched_Event_Batched)->Apply(&BenchmarkSettings::Batched);
 }
 
 #endif // HAVE_BENCHMARK
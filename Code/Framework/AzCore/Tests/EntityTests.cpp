@@ -10,7 +10,11 @@
 #include <AzCore/Asset/AssetManager.h>
 #include <AzCore/Component/Component.h>
 #include <AzCore/Component/Entity.h>
+#include <AzCore/Component/EntityDirectory.h>
 #include <AzCore/Serialization/Utils.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/thread.h>
 
 namespace UnitTest
 {
@@ -699,4 +703,335 @@ namespace UnitTest
             EXPECT_EQ(entity2.GetComponents().size(), 1);
         } // there will be a crash here if they go out of scope if they weren't properly moved.
     }
+
+    using EntityDirectoryTests = LeakDetectionFixture;
+
+    TEST_F(EntityDirectoryTests, InsertFindRemove_ManyEntities_EntitiesAreFound)
+    {
+        constexpr AZ::u64 EntityCount = 1000;
+        AZStd::vector<AZStd::unique_ptr<AZ::Entity>> entities;
+        AZ::EntityDirectory directory;
+        for (AZ::u64 index = 0; index < EntityCount; ++index)
+        {
+            entities.push_back(AZStd::make_unique<AZ::Entity>(AZ::EntityId(index)));
+            EXPECT_TRUE(directory.Insert(entities.back()->GetId(), entities.back().get()));
+        }
+        EXPECT_FALSE(directory.Insert(entities.front()->GetId(), entities.back().get()));
+        EXPECT_EQ(EntityCount, directory.GetSize());
+
+        for (AZ::u64 index = 0; index < EntityCount; index += 2)
+        {
+            EXPECT_TRUE(directory.Remove(entities[index]->GetId()));
+        }
+        EXPECT_FALSE(directory.Remove(entities.front()->GetId()));
+
+        for (AZ::u64 index = 0; index < EntityCount; ++index)
+        {
+            AZ::Entity* expected = (index % 2) ? entities[index].get() : nullptr;
+            EXPECT_EQ(expected, directory.Find(entities[index]->GetId()));
+        }
+
+        size_t enumeratedCount = 0;
+        directory.EnumerateEntities([&enumeratedCount](AZ::Entity*) { ++enumeratedCount; });
+        EXPECT_EQ(EntityCount / 2, enumeratedCount);
+        EXPECT_EQ(EntityCount / 2, directory.GetSize());
+    }
+
+    TEST_F(EntityDirectoryTests, FindByHandle_EntityRemovedAndSlotReused_HandleNoLongerFindsEntity)
+    {
+        AZ::Entity entity1(AZ::EntityId(1));
+        AZ::Entity entity2(AZ::EntityId(2));
+        AZ::EntityDirectory directory;
+
+        directory.Insert(entity1.GetId(), &entity1);
+        const AZ::EntityDirectory::Handle handle1 = directory.GetHandle(entity1.GetId());
+        ASSERT_TRUE(handle1.IsValid());
+        EXPECT_EQ(&entity1, directory.Find(handle1));
+
+        directory.Remove(entity1.GetId());
+        EXPECT_EQ(nullptr, directory.Find(handle1));
+        EXPECT_FALSE(directory.GetHandle(entity1.GetId()).IsValid());
+
+        // The slot of the first entity is reused, but the generation is different.
+        directory.Insert(entity2.GetId(), &entity2);
+        const AZ::EntityDirectory::Handle handle2 = directory.GetHandle(entity2.GetId());
+        EXPECT_EQ(handle1.m_index, handle2.m_index);
+        EXPECT_EQ(nullptr, directory.Find(handle1));
+        EXPECT_EQ(&entity2, directory.Find(handle2));
+    }
+
+    TEST_F(EntityDirectoryTests, ConcurrentInsertFindRemove_EntitiesOfOtherThreadsAreStable)
+    {
+        constexpr AZ::u64 SharedEntityCount = 1000;
+        constexpr AZ::u64 EntitiesPerThread = 1000;
+        constexpr int ThreadCount = 4;
+
+        AZStd::vector<AZStd::unique_ptr<AZ::Entity>> entities;
+        for (AZ::u64 index = 0; index < SharedEntityCount + EntitiesPerThread * ThreadCount; ++index)
+        {
+            entities.push_back(AZStd::make_unique<AZ::Entity>(AZ::EntityId(index)));
+        }
+
+        AZ::EntityDirectory directory;
+        for (AZ::u64 index = 0; index < SharedEntityCount; ++index)
+        {
+            directory.Insert(entities[index]->GetId(), entities[index].get());
+        }
+
+        AZStd::atomic_int failureCount{ 0 };
+        AZStd::vector<AZStd::thread> threads;
+        for (int threadIndex = 0; threadIndex < ThreadCount; ++threadIndex)
+        {
+            threads.emplace_back(
+                [&, threadIndex]()
+                {
+                    const AZ::u64 begin = SharedEntityCount + threadIndex * EntitiesPerThread;
+                    for (AZ::u64 index = begin; index < begin + EntitiesPerThread; ++index)
+                    {
+                        AZ::Entity* entity = entities[index].get();
+                        if (!directory.Insert(entity->GetId(), entity) || directory.Find(entity->GetId()) != entity)
+                        {
+                            ++failureCount;
+                        }
+
+                        AZ::Entity* sharedEntity = entities[index % SharedEntityCount].get();
+                        if (directory.Find(sharedEntity->GetId()) != sharedEntity)
+                        {
+                            ++failureCount;
+                        }
+                    }
+                    for (AZ::u64 index = begin; index < begin + EntitiesPerThread; ++index)
+                    {
+                        if (!directory.Remove(entities[index]->GetId()))
+                        {
+                            ++failureCount;
+                        }
+                    }
+                });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        EXPECT_EQ(0, failureCount);
+        EXPECT_EQ(SharedEntityCount, directory.GetSize());
+    }
+
+    TEST_F(EntityDirectoryTests, InsertRemoveChurn_TablesAreRebuiltRepeatedly_RetiredTablesStayBounded)
+    {
+        constexpr AZ::u64 StableEntityCount = 64;
+        constexpr AZ::u64 ChurnCount = 100000;
+        // Every shard rebuilds its table after a handful of removals, so the churn below replaces thousands of tables.
+        constexpr size_t MaxRetiredTables = 64;
+
+        AZStd::vector<AZStd::unique_ptr<AZ::Entity>> stableEntities;
+        AZ::EntityDirectory directory;
+        for (AZ::u64 index = 0; index < StableEntityCount; ++index)
+        {
+            stableEntities.push_back(AZStd::make_unique<AZ::Entity>(AZ::EntityId(index)));
+            directory.Insert(stableEntities.back()->GetId(), stableEntities.back().get());
+        }
+
+        // Look up the stable entities while their tables are being replaced and released.
+        AZStd::atomic_bool done{ false };
+        AZStd::atomic_int failureCount{ 0 };
+        AZStd::thread reader(
+            [&]()
+            {
+                for (AZ::u64 index = 0; !done; index = (index + 1) % StableEntityCount)
+                {
+                    if (directory.Find(stableEntities[index]->GetId()) != stableEntities[index].get())
+                    {
+                        ++failureCount;
+                    }
+                }
+            });
+
+        AZ::Entity churnEntity;
+        size_t maxRetiredTables = 0;
+        for (AZ::u64 index = 0; index < ChurnCount; ++index)
+        {
+            const AZ::EntityId id(StableEntityCount + index);
+            directory.Insert(id, &churnEntity);
+            directory.Remove(id);
+            maxRetiredTables = AZStd::max(maxRetiredTables, directory.GetRetiredTableCount());
+        }
+        done = true;
+        reader.join();
+
+        EXPECT_EQ(0, failureCount);
+        EXPECT_EQ(StableEntityCount, directory.GetSize());
+        EXPECT_LE(maxRetiredTables, MaxRetiredTables);
+    }
 } // namespace UnitTest
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    // Mirrors how entities used to be tracked by the ComponentApplication, with the lock of the ComponentApplicationBus.
+    class LockedEntityMap
+    {
+    public:
+        bool Insert(const AZ::EntityId& id, AZ::Entity* entity)
+        {
+            AZStd::scoped_lock lock(m_mutex);
+            return m_entities.emplace(id, entity).second;
+        }
+
+        bool Remove(const AZ::EntityId& id)
+        {
+            AZStd::scoped_lock lock(m_mutex);
+            return m_entities.erase(id) == 1;
+        }
+
+        AZ::Entity* Find(const AZ::EntityId& id) const
+        {
+            AZStd::scoped_lock lock(m_mutex);
+            auto it = m_entities.find(id);
+            return it != m_entities.end() ? it->second : nullptr;
+        }
+
+    private:
+        mutable AZStd::recursive_mutex m_mutex;
+        AZStd::unordered_map<AZ::EntityId, AZ::Entity*> m_entities;
+    };
+
+    template<class Directory>
+    class EntityDirectoryBenchmark : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr AZ::u64 SharedEntityCount = 10000;
+        static constexpr AZ::u64 EntitiesPerThread = 1000;
+        //! Number of lookups for every entity that's added and removed.
+        static constexpr AZ::u64 FindsPerChange = 8;
+
+        void RunBenchmark(benchmark::State& state)
+        {
+            if (state.thread_index() == 0)
+            {
+                m_directory = AZStd::make_unique<Directory>();
+                const AZ::u64 entityCount = SharedEntityCount + EntitiesPerThread * state.threads();
+                for (AZ::u64 index = 0; index < entityCount; ++index)
+                {
+                    m_entities.push_back(AZStd::make_unique<AZ::Entity>(AZ::EntityId(index)));
+                }
+                for (AZ::u64 index = 0; index < SharedEntityCount; ++index)
+                {
+                    m_directory->Insert(m_entities[index]->GetId(), m_entities[index].get());
+                }
+            }
+
+            // Every thread adds and removes its own entities while looking up the shared ones.
+            const AZ::u64 begin = SharedEntityCount + state.thread_index() * EntitiesPerThread;
+            AZ::u64 lookup = state.thread_index();
+            for ([[maybe_unused]] auto _ : state)
+            {
+                for (AZ::u64 index = begin; index < begin + EntitiesPerThread; ++index)
+                {
+                    m_directory->Insert(m_entities[index]->GetId(), m_entities[index].get());
+                    for (AZ::u64 find = 0; find < FindsPerChange; ++find)
+                    {
+                        lookup = (lookup + 7919) % SharedEntityCount;
+                        benchmark::DoNotOptimize(m_directory->Find(m_entities[lookup]->GetId()));
+                    }
+                }
+                for (AZ::u64 index = begin; index < begin + EntitiesPerThread; ++index)
+                {
+                    m_directory->Remove(m_entities[index]->GetId());
+                }
+            }
+            state.SetItemsProcessed(state.iterations() * EntitiesPerThread * (FindsPerChange + 2));
+
+            if (state.thread_index() == 0)
+            {
+                m_directory.reset();
+                m_entities = {};
+            }
+        }
+
+    protected:
+        AZStd::unique_ptr<Directory> m_directory;
+        AZStd::vector<AZStd::unique_ptr<AZ::Entity>> m_entities;
+    };
+
+    BENCHMARK_TEMPLATE_DEFINE_F(EntityDirectoryBenchmark, LockedEntityMap_ConcurrentAddRemoveFind, LockedEntityMap)(benchmark::State& state)
+    {
+        RunBenchmark(state);
+    }
+    BENCHMARK_REGISTER_F(EntityDirectoryBenchmark, LockedEntityMap_ConcurrentAddRemoveFind)
+        ->ThreadRange(1, AZStd::thread::hardware_concurrency())
+        ->UseRealTime();
+
+    BENCHMARK_TEMPLATE_DEFINE_F(EntityDirectoryBenchmark, EntityDirectory_ConcurrentAddRemoveFind, AZ::EntityDirectory)(benchmark::State& state)
+    {
+        RunBenchmark(state);
+    }
+    BENCHMARK_REGISTER_F(EntityDirectoryBenchmark, EntityDirectory_ConcurrentAddRemoveFind)
+        ->ThreadRange(1, AZStd::thread::hardware_concurrency())
+        ->UseRealTime();
+
+    class EntityDirectoryLookupBenchmark : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr AZ::u64 EntityCount = 10000;
+
+        void SetUp(benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            if (state.thread_index() == 0)
+            {
+                m_directory = AZStd::make_unique<AZ::EntityDirectory>();
+                for (AZ::u64 index = 0; index < EntityCount; ++index)
+                {
+                    m_entities.push_back(AZStd::make_unique<AZ::Entity>(AZ::EntityId(index)));
+                    m_directory->Insert(m_entities.back()->GetId(), m_entities.back().get());
+                    m_handles.push_back(m_directory->GetHandle(m_entities.back()->GetId()));
+                }
+            }
+        }
+
+        void TearDown(benchmark::State& state) override
+        {
+            if (state.thread_index() == 0)
+            {
+                m_directory.reset();
+                m_entities = {};
+                m_handles = {};
+            }
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        AZStd::unique_ptr<AZ::EntityDirectory> m_directory;
+        AZStd::vector<AZStd::unique_ptr<AZ::Entity>> m_entities;
+        AZStd::vector<AZ::EntityDirectory::Handle> m_handles;
+    };
+
+    BENCHMARK_DEFINE_F(EntityDirectoryLookupBenchmark, FindById)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (const AZStd::unique_ptr<AZ::Entity>& entity : m_entities)
+            {
+                benchmark::DoNotOptimize(m_directory->Find(entity->GetId()));
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * EntityCount);
+    }
+    BENCHMARK_REGISTER_F(EntityDirectoryLookupBenchmark, FindById)->ThreadRange(1, AZStd::thread::hardware_concurrency());
+
+    BENCHMARK_DEFINE_F(EntityDirectoryLookupBenchmark, FindByHandle)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (const AZ::EntityDirectory::Handle& handle : m_handles)
+            {
+                benchmark::DoNotOptimize(m_directory->Find(handle));
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * EntityCount);
+    }
+    BENCHMARK_REGISTER_F(EntityDirectoryLookupBenchmark, FindByHandle)->ThreadRange(1, AZStd::thread::hardware_concurrency());
+} // namespace Benchmark
+#endif
@@ -7,6 +7,7 @@
  */
 
 #include <AzCore/Math/Frustum.h>
+#include <AzCore/Math/SimdBatch.h>
 #include <AzCore/UnitTest/TestTypes.h>
 
 #if defined(HAVE_BENCHMARK)
@@ -38,6 +39,21 @@ namespace Benchmark
                 data.aabbMax = AZ::Vector3(unif(rng), unif(rng), unif(rng)).GetAbs() * 10.0f + data.aabbMin;
                 return data;
             });
+
+            for (const Data& data : m_dataArray)
+            {
+                m_sphereX.push_back(data.sphereCenter.GetX());
+                m_sphereY.push_back(data.sphereCenter.GetY());
+                m_sphereZ.push_back(data.sphereCenter.GetZ());
+                m_sphereRadius.push_back(data.sphereRadius);
+                m_aabbMinX.push_back(data.aabbMin.GetX());
+                m_aabbMinY.push_back(data.aabbMin.GetY());
+                m_aabbMinZ.push_back(data.aabbMin.GetZ());
+                m_aabbMaxX.push_back(data.aabbMax.GetX());
+                m_aabbMaxY.push_back(data.aabbMax.GetY());
+                m_aabbMaxZ.push_back(data.aabbMax.GetZ());
+            }
+            m_results.resize(m_dataArray.size());
         }
     public:
         void SetUp(const benchmark::State&) override
@@ -59,6 +75,19 @@ namespace Benchmark
 
         std::vector<Data> m_dataArray;
         AZ::Frustum m_testFrustum;
+
+        // Structure of arrays copy of m_dataArray for the batched benchmarks.
+        std::vector<float> m_sphereX;
+        std::vector<float> m_sphereY;
+        std::vector<float> m_sphereZ;
+        std::vector<float> m_sphereRadius;
+        std::vector<float> m_aabbMinX;
+        std::vector<float> m_aabbMinY;
+        std::vector<float> m_aabbMinZ;
+        std::vector<float> m_aabbMaxX;
+        std::vector<float> m_aabbMaxY;
+        std::vector<float> m_aabbMaxZ;
+        std::vector<AZ::u8> m_results;
     };
 
     BENCHMARK_F(BM_MathFrustum, SphereIntersect)(benchmark::State& state)
@@ -84,6 +113,46 @@ namespace Benchmark
             }
         }
     }
+
+    // The batched benchmarks take the batch width as argument, to compare the 4-wide path against the wide ones.
+    // Widths the CPU doesn't support run with the widest supported one, the label shows the width that was used.
+    BENCHMARK_DEFINE_F(BM_MathFrustum, BatchSphereCull)(benchmark::State& state)
+    {
+        const AZ::Simd::Batch::Width previousWidth = AZ::Simd::Batch::GetActiveWidth();
+        AZ::Simd::Batch::SetActiveWidth(static_cast<AZ::Simd::Batch::Width>(state.range(0)));
+        state.SetLabel(std::to_string(static_cast<int>(AZ::Simd::Batch::GetActiveWidth())) + " wide");
+
+        const AZ::Simd::Batch::ConstVector3Soa centers(m_sphereX.data(), m_sphereY.data(), m_sphereZ.data());
+        for ([[maybe_unused]] auto _ : state)
+        {
+            size_t visibleCount = AZ::Simd::Batch::FrustumCullSpheres(
+                m_testFrustum, centers, m_sphereRadius.data(), m_results.data(), m_results.size());
+            benchmark::DoNotOptimize(visibleCount);
+        }
+        state.SetItemsProcessed(state.iterations() * m_results.size());
+
+        AZ::Simd::Batch::SetActiveWidth(previousWidth);
+    }
+    BENCHMARK_REGISTER_F(BM_MathFrustum, BatchSphereCull)->Arg(4)->Arg(8)->Arg(16);
+
+    BENCHMARK_DEFINE_F(BM_MathFrustum, BatchAabbCull)(benchmark::State& state)
+    {
+        const AZ::Simd::Batch::Width previousWidth = AZ::Simd::Batch::GetActiveWidth();
+        AZ::Simd::Batch::SetActiveWidth(static_cast<AZ::Simd::Batch::Width>(state.range(0)));
+        state.SetLabel(std::to_string(static_cast<int>(AZ::Simd::Batch::GetActiveWidth())) + " wide");
+
+        const AZ::Simd::Batch::ConstAabbSoa aabbs{ { m_aabbMinX.data(), m_aabbMinY.data(), m_aabbMinZ.data() },
+                                                   { m_aabbMaxX.data(), m_aabbMaxY.data(), m_aabbMaxZ.data() } };
+        for ([[maybe_unused]] auto _ : state)
+        {
+            size_t visibleCount = AZ::Simd::Batch::FrustumCullAabbs(m_testFrustum, aabbs, m_results.data(), m_results.size());
+            benchmark::DoNotOptimize(visibleCount);
+        }
+        state.SetItemsProcessed(state.iterations() * m_results.size());
+
+        AZ::Simd::Batch::SetActiveWidth(previousWidth);
+    }
+    BENCHMARK_REGISTER_F(BM_MathFrustum, BatchAabbCull)->Arg(4)->Arg(8)->Arg(16);
 }
 
 #endif
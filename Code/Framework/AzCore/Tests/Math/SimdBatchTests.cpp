@@ -0,0 +1,231 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Frustum.h>
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/SimdBatch.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+#include <random>
+
+namespace UnitTest
+{
+    using AZ::Simd::Batch::Width;
+
+    // Runs every test with each of the widths, widths the CPU doesn't support fall back to the widest supported one.
+    class MATH_SimdBatch
+        : public ::testing::TestWithParam<Width>
+    {
+    protected:
+        // Not a multiple of any of the widths, so the scalar remainder is covered as well.
+        static constexpr size_t ElementCount = 203;
+
+        void SetUp() override
+        {
+            m_previousWidth = AZ::Simd::Batch::GetActiveWidth();
+            AZ::Simd::Batch::SetActiveWidth(GetParam());
+
+            std::mt19937 rng(1);
+            std::uniform_real_distribution<float> position(-50.0f, 50.0f);
+            std::uniform_real_distribution<float> extent(0.0f, 10.0f);
+            for (size_t i = 0; i < ElementCount; ++i)
+            {
+                m_x.push_back(position(rng));
+                m_y.push_back(position(rng) + 50.0f);
+                m_z.push_back(position(rng));
+                m_radii.push_back(extent(rng));
+                m_maxX.push_back(m_x.back() + extent(rng));
+                m_maxY.push_back(m_y.back() + extent(rng));
+                m_maxZ.push_back(m_z.back() + extent(rng));
+            }
+            // Include a zero vector for the normalize tests.
+            m_x[7] = m_y[7] = m_z[7] = 0.0f;
+        }
+
+        void TearDown() override
+        {
+            AZ::Simd::Batch::SetActiveWidth(m_previousWidth);
+        }
+
+        AZ::Simd::Batch::ConstVector3Soa GetPoints() const
+        {
+            return { m_x.data(), m_y.data(), m_z.data() };
+        }
+
+        AZ::Simd::Batch::ConstAabbSoa GetAabbs() const
+        {
+            return { { m_x.data(), m_y.data(), m_z.data() }, { m_maxX.data(), m_maxY.data(), m_maxZ.data() } };
+        }
+
+        AZ::Vector3 GetPoint(size_t index) const
+        {
+            return AZ::Vector3(m_x[index], m_y[index], m_z[index]);
+        }
+
+        AZ::Aabb GetAabb(size_t index) const
+        {
+            return AZ::Aabb::CreateFromMinMax(GetPoint(index), AZ::Vector3(m_maxX[index], m_maxY[index], m_maxZ[index]));
+        }
+
+        AZStd::vector<float> m_x;
+        AZStd::vector<float> m_y;
+        AZStd::vector<float> m_z;
+        AZStd::vector<float> m_radii;
+        AZStd::vector<float> m_maxX;
+        AZStd::vector<float> m_maxY;
+        AZStd::vector<float> m_maxZ;
+        Width m_previousWidth = Width::Vec4;
+    };
+
+    TEST_P(MATH_SimdBatch, SetActiveWidth_ClampedToSupportedWidth)
+    {
+        const Width supportedWidth = AZ::Simd::Batch::GetSupportedWidth();
+        const Width expectedWidth = static_cast<AZ::u8>(GetParam()) < static_cast<AZ::u8>(supportedWidth) ? GetParam() : supportedWidth;
+        EXPECT_EQ(expectedWidth, AZ::Simd::Batch::GetActiveWidth());
+    }
+
+    TEST_P(MATH_SimdBatch, TransformPoints_MatchesTransformPoint)
+    {
+        AZ::Transform transform = AZ::Transform::CreateFromQuaternionAndTranslation(
+            AZ::Quaternion::CreateRotationZ(0.7f) * AZ::Quaternion::CreateRotationX(-0.3f), AZ::Vector3(1.0f, 2.0f, 3.0f));
+        transform.MultiplyByUniformScale(2.0f);
+
+        AZStd::vector<float> x(ElementCount), y(ElementCount), z(ElementCount);
+        AZ::Simd::Batch::TransformPoints(transform, GetPoints(), { x.data(), y.data(), z.data() }, ElementCount);
+
+        for (size_t i = 0; i < ElementCount; ++i)
+        {
+            const AZ::Vector3 expected = transform.TransformPoint(GetPoint(i));
+            EXPECT_NEAR(expected.GetX(), x[i], 1e-3f);
+            EXPECT_NEAR(expected.GetY(), y[i], 1e-3f);
+            EXPECT_NEAR(expected.GetZ(), z[i], 1e-3f);
+        }
+    }
+
+    TEST_P(MATH_SimdBatch, TransformPoints_InPlace_MatchesTransformPoint)
+    {
+        const AZ::Transform transform = AZ::Transform::CreateFromQuaternionAndTranslation(
+            AZ::Quaternion::CreateRotationY(1.1f), AZ::Vector3(-4.0f, 0.5f, 8.0f));
+
+        AZStd::vector<float> x = m_x, y = m_y, z = m_z;
+        AZ::Simd::Batch::TransformPoints(transform, { x.data(), y.data(), z.data() }, { x.data(), y.data(), z.data() }, ElementCount);
+
+        for (size_t i = 0; i < ElementCount; ++i)
+        {
+            const AZ::Vector3 expected = transform.TransformPoint(GetPoint(i));
+            EXPECT_NEAR(expected.GetX(), x[i], 1e-3f);
+            EXPECT_NEAR(expected.GetY(), y[i], 1e-3f);
+            EXPECT_NEAR(expected.GetZ(), z[i], 1e-3f);
+        }
+    }
+
+    TEST_P(MATH_SimdBatch, DotAndLength_MatchVector3)
+    {
+        AZStd::vector<float> dot(ElementCount), length(ElementCount);
+        AZ::Simd::Batch::Dot(GetPoints(), { m_maxX.data(), m_maxY.data(), m_maxZ.data() }, dot.data(), ElementCount);
+        AZ::Simd::Batch::Length(GetPoints(), length.data(), ElementCount);
+
+        for (size_t i = 0; i < ElementCount; ++i)
+        {
+            EXPECT_NEAR(GetPoint(i).Dot(AZ::Vector3(m_maxX[i], m_maxY[i], m_maxZ[i])), dot[i], 1e-2f);
+            EXPECT_NEAR(GetPoint(i).GetLength(), length[i], 1e-3f);
+        }
+    }
+
+    TEST_P(MATH_SimdBatch, NormalizeSafe_MatchesGetNormalizedSafe)
+    {
+        AZStd::vector<float> x = m_x, y = m_y, z = m_z;
+        AZ::Simd::Batch::NormalizeSafe({ x.data(), y.data(), z.data() }, ElementCount, AZ::Constants::Tolerance);
+
+        for (size_t i = 0; i < ElementCount; ++i)
+        {
+            const AZ::Vector3 expected = GetPoint(i).GetNormalizedSafe(AZ::Constants::Tolerance);
+            EXPECT_NEAR(expected.GetX(), x[i], 1e-5f);
+            EXPECT_NEAR(expected.GetY(), y[i], 1e-5f);
+            EXPECT_NEAR(expected.GetZ(), z[i], 1e-5f);
+        }
+        EXPECT_EQ(0.0f, x[7]);
+    }
+
+    TEST_P(MATH_SimdBatch, AabbOverlaps_MatchesAabbOverlaps)
+    {
+        const AZ::Aabb aabb = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-10.0f, 20.0f, -10.0f), AZ::Vector3(10.0f, 60.0f, 5.0f));
+
+        AZStd::vector<AZ::u8> results(ElementCount);
+        const size_t overlapCount = AZ::Simd::Batch::AabbOverlaps(aabb, GetAabbs(), results.data(), ElementCount);
+
+        size_t expectedCount = 0;
+        for (size_t i = 0; i < ElementCount; ++i)
+        {
+            const bool expected = aabb.Overlaps(GetAabb(i));
+            expectedCount += expected ? 1 : 0;
+            EXPECT_EQ(expected ? 1 : 0, results[i]);
+        }
+        EXPECT_EQ(expectedCount, overlapCount);
+        EXPECT_GT(overlapCount, 0u);
+    }
+
+    TEST_P(MATH_SimdBatch, FrustumCullSpheres_MatchesIntersectSphere)
+    {
+        const AZ::Frustum frustum(
+            AZ::ViewFrustumAttributes(AZ::Transform::CreateIdentity(), 1.0f, 2.0f * atanf(0.5f), 10.0f, 90.0f));
+
+        AZStd::vector<AZ::u8> results(ElementCount);
+        const size_t visibleCount =
+            AZ::Simd::Batch::FrustumCullSpheres(frustum, GetPoints(), m_radii.data(), results.data(), ElementCount);
+
+        size_t expectedCount = 0;
+        for (size_t i = 0; i < ElementCount; ++i)
+        {
+            const bool expected = frustum.IntersectSphere(GetPoint(i), m_radii[i]) != AZ::IntersectResult::Exterior;
+            expectedCount += expected ? 1 : 0;
+            EXPECT_EQ(expected ? 1 : 0, results[i]);
+        }
+        EXPECT_EQ(expectedCount, visibleCount);
+        EXPECT_GT(visibleCount, 0u);
+        EXPECT_LT(visibleCount, ElementCount);
+    }
+
+    TEST_P(MATH_SimdBatch, FrustumCullAabbs_MatchesIntersectAabb)
+    {
+        const AZ::Frustum frustum(
+            AZ::ViewFrustumAttributes(AZ::Transform::CreateIdentity(), 1.0f, 2.0f * atanf(0.5f), 10.0f, 90.0f));
+
+        AZStd::vector<AZ::u8> results(ElementCount);
+        const size_t visibleCount = AZ::Simd::Batch::FrustumCullAabbs(frustum, GetAabbs(), results.data(), ElementCount);
+
+        size_t expectedCount = 0;
+        for (size_t i = 0; i < ElementCount; ++i)
+        {
+            const bool expected = frustum.IntersectAabb(GetAabb(i)) != AZ::IntersectResult::Exterior;
+            expectedCount += expected ? 1 : 0;
+            EXPECT_EQ(expected ? 1 : 0, results[i]);
+        }
+        EXPECT_EQ(expectedCount, visibleCount);
+        EXPECT_GT(visibleCount, 0u);
+        EXPECT_LT(visibleCount, ElementCount);
+    }
+
+    TEST_P(MATH_SimdBatch, EmptyBatch_DoesNothing)
+    {
+        AZ::u8 result = 2;
+        const AZ::Frustum frustum(
+            AZ::ViewFrustumAttributes(AZ::Transform::CreateIdentity(), 1.0f, AZ::Constants::HalfPi, 1.0f, 100.0f));
+        EXPECT_EQ(0u, AZ::Simd::Batch::FrustumCullAabbs(frustum, GetAabbs(), &result, 0));
+        EXPECT_EQ(2, result);
+    }
+
+    INSTANTIATE_TEST_SUITE_P(
+        MATH_SimdBatch, MATH_SimdBatch, ::testing::Values(Width::Vec4, Width::Vec8, Width::Vec16),
+        [](const ::testing::TestParamInfo<Width>& info)
+        {
+            return "Vec" + std::to_string(static_cast<int>(info.param));
+        });
+} // namespace UnitTest
@@ -8,6 +8,7 @@
 
 #include <AzCore/Math/Internal/MathTypes.h>
 #include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/SimdMathVec16.h>
 #include <AzCore/UnitTest/TestTypes.h>
 
 using namespace AZ;
@@ -3153,4 +3154,162 @@ namespace UnitTest
     {
         TestZeroVectorInt<Simd::Vec4>();
     }
+
+    template<typename VectorType>
+    void TestWideLoadStore()
+    {
+        alignas(64) float testLoadValues[VectorType::ElementCount];
+        alignas(64) float testStoreValues[VectorType::ElementCount];
+        alignas(64) int32_t testLoadInts[VectorType::ElementCount];
+        alignas(64) int32_t testStoreInts[VectorType::ElementCount];
+        for (int32_t i = 0; i < VectorType::ElementCount; ++i)
+        {
+            testLoadValues[i] = static_cast<float>(i) + 1.0f;
+            testLoadInts[i] = i + 1;
+        }
+
+        VectorType::StoreAligned(testStoreValues, VectorType::LoadAligned(testLoadValues));
+        VectorType::StoreAligned(testStoreInts, VectorType::LoadAligned(testLoadInts));
+        for (int32_t i = 0; i < VectorType::ElementCount; ++i)
+        {
+            EXPECT_EQ(testLoadValues[i], testStoreValues[i]);
+            EXPECT_EQ(testLoadInts[i], testStoreInts[i]);
+        }
+
+        VectorType::StoreUnaligned(testStoreValues, VectorType::LoadUnaligned(testLoadValues));
+        VectorType::StoreUnaligned(testStoreInts, VectorType::LoadUnaligned(testLoadInts));
+        for (int32_t i = 0; i < VectorType::ElementCount; ++i)
+        {
+            EXPECT_EQ(testLoadValues[i], testStoreValues[i]);
+            EXPECT_EQ(testLoadInts[i], testStoreInts[i]);
+        }
+    }
+
+    template<typename VectorType>
+    void TestWideArithmetic()
+    {
+        float a[VectorType::ElementCount];
+        float b[VectorType::ElementCount];
+        for (int32_t i = 0; i < VectorType::ElementCount; ++i)
+        {
+            a[i] = static_cast<float>(i) - 4.0f;
+            b[i] = 0.5f * static_cast<float>(i) + 1.0f;
+        }
+
+        const typename VectorType::FloatType vecA = VectorType::LoadUnaligned(a);
+        const typename VectorType::FloatType vecB = VectorType::LoadUnaligned(b);
+
+        float added[VectorType::ElementCount];
+        float madd[VectorType::ElementCount];
+        float divided[VectorType::ElementCount];
+        float absSqrt[VectorType::ElementCount];
+        float clamped[VectorType::ElementCount];
+        VectorType::StoreUnaligned(added, VectorType::Sub(VectorType::Add(vecA, vecB), VectorType::Splat(1.0f)));
+        VectorType::StoreUnaligned(madd, VectorType::Madd(vecA, vecB, vecA));
+        VectorType::StoreUnaligned(divided, VectorType::Div(vecA, vecB));
+        VectorType::StoreUnaligned(absSqrt, VectorType::Sqrt(VectorType::Abs(vecA)));
+        VectorType::StoreUnaligned(clamped, VectorType::Clamp(vecA, VectorType::Splat(-1.0f), VectorType::Splat(2.0f)));
+
+        for (int32_t i = 0; i < VectorType::ElementCount; ++i)
+        {
+            EXPECT_NEAR(a[i] + b[i] - 1.0f, added[i], AZ::Constants::Tolerance);
+            EXPECT_NEAR(a[i] * b[i] + a[i], madd[i], AZ::Constants::Tolerance);
+            EXPECT_NEAR(a[i] / b[i], divided[i], AZ::Constants::Tolerance);
+            EXPECT_NEAR(sqrtf(fabsf(a[i])), absSqrt[i], AZ::Constants::Tolerance);
+            EXPECT_NEAR(AZ::GetClamp(a[i], -1.0f, 2.0f), clamped[i], AZ::Constants::Tolerance);
+        }
+    }
+
+    template<typename VectorType>
+    void TestWideCompareSelect()
+    {
+        float a[VectorType::ElementCount];
+        for (int32_t i = 0; i < VectorType::ElementCount; ++i)
+        {
+            a[i] = static_cast<float>(i % 3) - 1.0f;
+        }
+
+        const typename VectorType::FloatType vecA = VectorType::LoadUnaligned(a);
+        const typename VectorType::FloatType zero = VectorType::ZeroFloat();
+        const typename VectorType::FloatType ltMask = VectorType::CmpLt(vecA, zero);
+        const typename VectorType::FloatType eqMask = VectorType::CmpEq(vecA, zero);
+
+        float selected[VectorType::ElementCount];
+        VectorType::StoreUnaligned(selected, VectorType::Select(VectorType::Splat(10.0f), vecA, ltMask));
+
+        const uint32_t ltBits = VectorType::ToBitMask(ltMask);
+        const uint32_t eqBits = VectorType::ToBitMask(eqMask);
+        const uint32_t gtEqBits = VectorType::ToBitMask(VectorType::CmpGtEq(vecA, zero));
+        const uint32_t combinedBits = VectorType::ToBitMask(VectorType::Or(ltMask, eqMask));
+        for (int32_t i = 0; i < VectorType::ElementCount; ++i)
+        {
+            EXPECT_EQ(a[i] < 0.0f ? 10.0f : a[i], selected[i]);
+            EXPECT_EQ(a[i] < 0.0f, ((ltBits >> i) & 1) != 0);
+            EXPECT_EQ(a[i] == 0.0f, ((eqBits >> i) & 1) != 0);
+            EXPECT_EQ(a[i] >= 0.0f, ((gtEqBits >> i) & 1) != 0);
+            EXPECT_EQ(a[i] <= 0.0f, ((combinedBits >> i) & 1) != 0);
+        }
+        EXPECT_EQ(0u, ltBits >> VectorType::ElementCount);
+    }
+
+    template<typename VectorType>
+    void TestWideConvert()
+    {
+        float a[VectorType::ElementCount];
+        for (int32_t i = 0; i < VectorType::ElementCount; ++i)
+        {
+            a[i] = static_cast<float>(i) * 1.75f - 3.0f;
+        }
+
+        int32_t truncated[VectorType::ElementCount];
+        float roundTrip[VectorType::ElementCount];
+        const typename VectorType::Int32Type ints = VectorType::ConvertToInt(VectorType::LoadUnaligned(a));
+        VectorType::StoreUnaligned(truncated, ints);
+        VectorType::StoreUnaligned(roundTrip, VectorType::ConvertToFloat(ints));
+        for (int32_t i = 0; i < VectorType::ElementCount; ++i)
+        {
+            EXPECT_EQ(static_cast<int32_t>(a[i]), truncated[i]);
+            EXPECT_EQ(static_cast<float>(static_cast<int32_t>(a[i])), roundTrip[i]);
+        }
+    }
+
+    TEST(MATH_SimdMath, TestWideLoadStoreVec8)
+    {
+        TestWideLoadStore<Simd::Vec8>();
+    }
+
+    TEST(MATH_SimdMath, TestWideLoadStoreVec16)
+    {
+        TestWideLoadStore<Simd::Vec16>();
+    }
+
+    TEST(MATH_SimdMath, TestWideArithmeticVec8)
+    {
+        TestWideArithmetic<Simd::Vec8>();
+    }
+
+    TEST(MATH_SimdMath, TestWideArithmeticVec16)
+    {
+        TestWideArithmetic<Simd::Vec16>();
+    }
+
+    TEST(MATH_SimdMath, TestWideCompareSelectVec8)
+    {
+        TestWideCompareSelect<Simd::Vec8>();
+    }
+
+    TEST(MATH_SimdMath, TestWideCompareSelectVec16)
+    {
+        TestWideCompareSelect<Simd::Vec16>();
+    }
+
+    TEST(MATH_SimdMath, TestWideConvertVec8)
+    {
+        TestWideConvert<Simd::Vec8>();
+    }
+
+    TEST(MATH_SimdMath, TestWideConvertVec16)
+    {
+        TestWideConvert<Simd::Vec16>();
+    }
 }
@@ -12,6 +12,7 @@
 #include <AzCore/Math/Transform.h>
 #include <AzCore/Math/Vector3.h>
 #include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/SimdBatch.h>
 #include <AzCore/UnitTest/TestTypes.h>
 
 #include <random>
@@ -49,6 +50,16 @@ namespace Benchmark
                 testData.index = distInt(rng) % 3;
                 return testData;
             });
+
+            for (const TestData& testData : m_testDataArray)
+            {
+                m_v3X.push_back(testData.v3.GetX());
+                m_v3Y.push_back(testData.v3.GetY());
+                m_v3Z.push_back(testData.v3.GetZ());
+            }
+            m_resultX.resize(m_testDataArray.size());
+            m_resultY.resize(m_testDataArray.size());
+            m_resultZ.resize(m_testDataArray.size());
         }
     public:
         void SetUp(const benchmark::State&) override
@@ -74,6 +85,14 @@ namespace Benchmark
         };
 
         std::vector<TestData> m_testDataArray;
+
+        // Structure of arrays copy of the v3 values for the batched benchmarks.
+        std::vector<float> m_v3X;
+        std::vector<float> m_v3Y;
+        std::vector<float> m_v3Z;
+        std::vector<float> m_resultX;
+        std::vector<float> m_resultY;
+        std::vector<float> m_resultZ;
     };
 
     BENCHMARK_F(BM_MathTransform, CreateIdentity)(benchmark::State& state)
@@ -609,6 +628,28 @@ namespace Benchmark
             }
         }
     }
+
+    // Takes the batch width as argument, to compare the 4-wide path against the wide ones.
+    // Widths the CPU doesn't support run with the widest supported one, the label shows the width that was used.
+    BENCHMARK_DEFINE_F(BM_MathTransform, BatchTransformPoints)(benchmark::State& state)
+    {
+        const AZ::Simd::Batch::Width previousWidth = AZ::Simd::Batch::GetActiveWidth();
+        AZ::Simd::Batch::SetActiveWidth(static_cast<AZ::Simd::Batch::Width>(state.range(0)));
+        state.SetLabel(std::to_string(static_cast<int>(AZ::Simd::Batch::GetActiveWidth())) + " wide");
+
+        const AZ::Transform& transform = m_testDataArray[0].t1;
+        const AZ::Simd::Batch::ConstVector3Soa points(m_v3X.data(), m_v3Y.data(), m_v3Z.data());
+        const AZ::Simd::Batch::Vector3Soa results{ m_resultX.data(), m_resultY.data(), m_resultZ.data() };
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZ::Simd::Batch::TransformPoints(transform, points, results, m_v3X.size());
+            benchmark::DoNotOptimize(m_resultX.data());
+        }
+        state.SetItemsProcessed(state.iterations() * m_v3X.size());
+
+        AZ::Simd::Batch::SetActiveWidth(previousWidth);
+    }
+    BENCHMARK_REGISTER_F(BM_MathTransform, BatchTransformPoints)->Arg(4)->Arg(8)->Arg(16);
 }
 
 #endif
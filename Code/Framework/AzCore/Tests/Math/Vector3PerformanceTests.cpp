@@ -6,6 +6,7 @@
  *
  */
 
+#include <AzCore/Math/SimdBatch.h>
 #include <AzCore/Math/Vector3.h>
 #include <AzCore/UnitTest/TestTypes.h>
 
@@ -35,6 +36,17 @@ namespace Benchmark
                 vecData.v3 = AZ::Vector3(unif(rng), unif(rng), unif(rng));
                 return vecData;
             });
+
+            for (const VecData& vecData : m_vecDataArray)
+            {
+                m_v1X.push_back(vecData.v1.GetX());
+                m_v1Y.push_back(vecData.v1.GetY());
+                m_v1Z.push_back(vecData.v1.GetZ());
+                m_v2X.push_back(vecData.v2.GetX());
+                m_v2Y.push_back(vecData.v2.GetY());
+                m_v2Z.push_back(vecData.v2.GetZ());
+            }
+            m_results.resize(m_vecDataArray.size());
         }
     public:
         void SetUp(const benchmark::State&) override
@@ -54,6 +66,15 @@ namespace Benchmark
         };
 
         std::vector<VecData> m_vecDataArray;
+
+        // Structure of arrays copy of m_vecDataArray for the batched benchmarks.
+        std::vector<float> m_v1X;
+        std::vector<float> m_v1Y;
+        std::vector<float> m_v1Z;
+        std::vector<float> m_v2X;
+        std::vector<float> m_v2Y;
+        std::vector<float> m_v2Z;
+        std::vector<float> m_results;
     };
 
     BENCHMARK_F(BM_MathVector3, GetSet)(benchmark::State& state)
@@ -689,6 +710,64 @@ namespace Benchmark
             }
         }
     }
+
+    // The batched benchmarks take the batch width as argument, to compare the 4-wide path against the wide ones.
+    // Widths the CPU doesn't support run with the widest supported one, the label shows the width that was used.
+    BENCHMARK_DEFINE_F(BM_MathVector3, BatchDot)(benchmark::State& state)
+    {
+        const AZ::Simd::Batch::Width previousWidth = AZ::Simd::Batch::GetActiveWidth();
+        AZ::Simd::Batch::SetActiveWidth(static_cast<AZ::Simd::Batch::Width>(state.range(0)));
+        state.SetLabel(std::to_string(static_cast<int>(AZ::Simd::Batch::GetActiveWidth())) + " wide");
+
+        const AZ::Simd::Batch::ConstVector3Soa v1(m_v1X.data(), m_v1Y.data(), m_v1Z.data());
+        const AZ::Simd::Batch::ConstVector3Soa v2(m_v2X.data(), m_v2Y.data(), m_v2Z.data());
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZ::Simd::Batch::Dot(v1, v2, m_results.data(), m_results.size());
+            benchmark::DoNotOptimize(m_results.data());
+        }
+        state.SetItemsProcessed(state.iterations() * m_results.size());
+
+        AZ::Simd::Batch::SetActiveWidth(previousWidth);
+    }
+    BENCHMARK_REGISTER_F(BM_MathVector3, BatchDot)->Arg(4)->Arg(8)->Arg(16);
+
+    BENCHMARK_DEFINE_F(BM_MathVector3, BatchLength)(benchmark::State& state)
+    {
+        const AZ::Simd::Batch::Width previousWidth = AZ::Simd::Batch::GetActiveWidth();
+        AZ::Simd::Batch::SetActiveWidth(static_cast<AZ::Simd::Batch::Width>(state.range(0)));
+        state.SetLabel(std::to_string(static_cast<int>(AZ::Simd::Batch::GetActiveWidth())) + " wide");
+
+        const AZ::Simd::Batch::ConstVector3Soa v1(m_v1X.data(), m_v1Y.data(), m_v1Z.data());
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZ::Simd::Batch::Length(v1, m_results.data(), m_results.size());
+            benchmark::DoNotOptimize(m_results.data());
+        }
+        state.SetItemsProcessed(state.iterations() * m_results.size());
+
+        AZ::Simd::Batch::SetActiveWidth(previousWidth);
+    }
+    BENCHMARK_REGISTER_F(BM_MathVector3, BatchLength)->Arg(4)->Arg(8)->Arg(16);
+
+    BENCHMARK_DEFINE_F(BM_MathVector3, BatchNormalizeSafe)(benchmark::State& state)
+    {
+        const AZ::Simd::Batch::Width previousWidth = AZ::Simd::Batch::GetActiveWidth();
+        AZ::Simd::Batch::SetActiveWidth(static_cast<AZ::Simd::Batch::Width>(state.range(0)));
+        state.SetLabel(std::to_string(static_cast<int>(AZ::Simd::Batch::GetActiveWidth())) + " wide");
+
+        // Normalizes in place, after the first iteration the vectors are already normalized but that doesn't change the cost.
+        const AZ::Simd::Batch::Vector3Soa v2{ m_v2X.data(), m_v2Y.data(), m_v2Z.data() };
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZ::Simd::Batch::NormalizeSafe(v2, m_v2X.size(), AZ::Constants::Tolerance);
+            benchmark::DoNotOptimize(m_v2X.data());
+        }
+        state.SetItemsProcessed(state.iterations() * m_v2X.size());
+
+        AZ::Simd::Batch::SetActiveWidth(previousWidth);
+    }
+    BENCHMARK_REGISTER_F(BM_MathVector3, BatchNormalizeSafe)->Arg(4)->Arg(8)->Arg(16);
 }
 
 #endif
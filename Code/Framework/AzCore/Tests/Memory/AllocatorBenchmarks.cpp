@@ -60,6 +60,16 @@ namespace Benchmark
         }
     };
 
+    // Separate thread pool allocator type, so the benchmarks don't share the thread local pools of the global ThreadPoolAllocator
+    class TestThreadPoolAllocator
+        : public AZ::ThreadPoolBase<TestThreadPoolAllocator>
+    {
+    public:
+        AZ_TYPE_INFO(TestThreadPoolAllocator, "{794A30CF-0A20-4FDE-9A8B-105B94A6C8C3}");
+
+        using Base = AZ::ThreadPoolBase<TestThreadPoolAllocator>;
+    };
+
     // Allocated bytes reported by the allocator
     static const char* s_counterAllocatorMemory = "Allocator_Memory";
 
@@ -250,6 +260,42 @@ namespace Benchmark
         }
     };
 
+    // Small object churn from all threads at the same time, which is what happens when entities are spawned or EBus handlers
+    // connect and disconnect from many threads. Unlike the other fixtures timing isn't paused between allocations, as pausing
+    // synchronizes the threads and would hide the contention on the allocator.
+    template <typename TAllocator>
+    class ContendedAllocationBenchmarkFixture
+        : public AllocatorBenchmarkFixture<TAllocator>
+    {
+        using base = AllocatorBenchmarkFixture<TAllocator>;
+
+    public:
+        void Benchmark(benchmark::State& state)
+        {
+            AZStd::vector<void*>& perThreadAllocations = base::GetPerThreadAllocations(state.thread_index());
+            const size_t numberOfAllocations = perThreadAllocations.size();
+            const AllocationSizeArray& allocationArray = s_allocationSizes[SMALL];
+
+            for ([[maybe_unused]] auto _ : state)
+            {
+                for (size_t allocationIndex = 0; allocationIndex < numberOfAllocations; ++allocationIndex)
+                {
+                    const size_t allocationSize = allocationArray[allocationIndex % allocationArray.size()];
+                    perThreadAllocations[allocationIndex] = this->GetAllocator().allocate(allocationSize, 16);
+                }
+
+                for (size_t allocationIndex = 0; allocationIndex < numberOfAllocations; ++allocationIndex)
+                {
+                    const size_t allocationSize = allocationArray[allocationIndex % allocationArray.size()];
+                    this->GetAllocator().deallocate(perThreadAllocations[allocationIndex], allocationSize, 16);
+                    perThreadAllocations[allocationIndex] = nullptr;
+                }
+            }
+
+            state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(numberOfAllocations) * 2);
+        }
+    };
+
     template<typename TAllocator>
     class RecordedAllocationBenchmarkFixture : public ::benchmark::Fixture
     {
@@ -447,6 +493,12 @@ namespace Benchmark
         b->Arg(100);
     }
 
+    // For contended ranges, use enough allocations per thread to cycle through several pages of each pool bucket
+    static void ContendedRunRanges(benchmark::internal::Benchmark* b)
+    {
+        b->Arg(1024);
+    }
+
     // Test under and over-subscription of threads vs the amount of CPUs available
     static const unsigned int MaxThreadRange = 2 * AZStd::thread::hardware_concurrency();
 
@@ -479,9 +531,23 @@ namespace Benchmark
     BM_REGISTER_ALLOCATOR(HphaSchemaAllocator, HphaSchemaAllocator);
     BM_REGISTER_ALLOCATOR(SystemAllocator, TestSystemAllocator);
 
+    // Contended cases only use small allocations so pool allocators can be compared against the general purpose allocators.
+    // The thread range starts at 1 to provide the uncontended baseline for the scaling.
+#define BM_REGISTER_CONTENDED_ALLOCATOR(TESTNAME, ALLOCATORTYPE) \
+    namespace BM_##TESTNAME \
+    { \
+        BM_REGISTER_TEMPLATE(ContendedAllocationBenchmarkFixture, TESTNAME##_SMALL_CONTENDED, ALLOCATORTYPE) \
+            ->ThreadRange(1, MaxThreadRange)->Apply(ContendedRunRanges)->UseRealTime(); \
+    }
+
+    BM_REGISTER_CONTENDED_ALLOCATOR(RawMallocAllocator, RawMallocAllocator);
+    BM_REGISTER_CONTENDED_ALLOCATOR(SystemAllocator, TestSystemAllocator);
+    BM_REGISTER_CONTENDED_ALLOCATOR(ThreadPoolAllocator, TestThreadPoolAllocator);
+
     //BM_REGISTER_SCHEMA(PoolSchema); // Requires special alignment requests while allocating
     // BM_REGISTER_ALLOCATOR(OSAllocator, OSAllocator); // Requires special treatment to initialize since it will be already initialized, maybe creating a different instance?
 
+#undef BM_REGISTER_CONTENDED_ALLOCATOR
 #undef BM_REGISTER_ALLOCATOR
 #undef BM_REGISTER_SIZE_FIXTURES
 #undef BM_REGISTER_TEMPLATE
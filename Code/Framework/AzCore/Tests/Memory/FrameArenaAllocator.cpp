@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Memory/FrameArenaAllocator.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/thread.h>
+
+namespace UnitTest
+{
+    class FrameArenaAllocatorTestFixture
+        : public LeakDetectionFixture
+    {
+    };
+
+    TEST_F(FrameArenaAllocatorTestFixture, Allocate_VariousSizesAndAlignments_AllocationsAreAlignedAndDistinct)
+    {
+        AZ::FrameArenaAllocator allocator;
+
+        AZStd::vector<AZStd::pair<char*, size_t>> allocations;
+        for (size_t i = 0; i < 256; ++i)
+        {
+            const size_t size = 1 + (i * 37) % 2048;
+            const size_t alignment = size_t{ 1 } << (i % 8);
+            char* address = static_cast<char*>(allocator.allocate(size, alignment).GetAddress());
+            ASSERT_NE(nullptr, address);
+            EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(address) % alignment);
+            EXPECT_EQ(size, allocator.get_allocated_size(address));
+            memset(address, static_cast<int>(i), size);
+            allocations.emplace_back(address, size);
+        }
+
+        for (size_t i = 0; i < allocations.size(); ++i)
+        {
+            const auto& [address, size] = allocations[i];
+            for (size_t byteIndex = 0; byteIndex < size; ++byteIndex)
+            {
+                ASSERT_EQ(static_cast<char>(i), address[byteIndex]);
+            }
+        }
+        EXPECT_GT(allocator.NumAllocatedBytes(), 0u);
+    }
+
+    TEST_F(FrameArenaAllocatorTestFixture, ResetFrame_AllocationsAfterReset_ReuseTheSamePages)
+    {
+        AZ::FrameArenaAllocator allocator;
+
+        void* firstFrameAddress = allocator.allocate(64, 16);
+        allocator.allocate(100000, 16);
+        EXPECT_EQ(0u, allocator.GetFrameIndex());
+
+        allocator.ResetFrame();
+        EXPECT_EQ(1u, allocator.GetFrameIndex());
+
+        void* secondFrameAddress = allocator.allocate(64, 16);
+        EXPECT_EQ(firstFrameAddress, secondFrameAddress);
+        EXPECT_LT(allocator.NumAllocatedBytes(), 1024u);
+    }
+
+    TEST_F(FrameArenaAllocatorTestFixture, Deallocate_LastAllocation_MemoryIsReused)
+    {
+        AZ::FrameArenaAllocator allocator;
+
+        allocator.allocate(32, 8);
+        void* address = allocator.allocate(128, 8);
+        const size_t allocatedBytes = allocator.NumAllocatedBytes();
+
+        allocator.deallocate(address, 128, 8);
+        EXPECT_LT(allocator.NumAllocatedBytes(), allocatedBytes);
+        EXPECT_EQ(address, allocator.allocate(128, 8).GetAddress());
+    }
+
+    TEST_F(FrameArenaAllocatorTestFixture, Reallocate_LastAllocation_GrowsInPlaceAndKeepsContents)
+    {
+        AZ::FrameArenaAllocator allocator;
+
+        char* address = static_cast<char*>(allocator.allocate(16, 8).GetAddress());
+        memset(address, 0x5a, 16);
+
+        char* grownAddress = static_cast<char*>(allocator.reallocate(address, 256, 8).GetAddress());
+        EXPECT_EQ(address, grownAddress);
+        EXPECT_EQ(256u, allocator.get_allocated_size(grownAddress));
+
+        // No longer the last allocation, so it has to move
+        allocator.allocate(16, 8);
+        char* movedAddress = static_cast<char*>(allocator.reallocate(grownAddress, 512, 8).GetAddress());
+        EXPECT_NE(grownAddress, movedAddress);
+        for (size_t i = 0; i < 16; ++i)
+        {
+            EXPECT_EQ(0x5a, movedAddress[i]);
+        }
+    }
+
+    TEST_F(FrameArenaAllocatorTestFixture, AZStdVector_UsingAllocatorInstance_GrowsAndIsReleasedByReset)
+    {
+        AZ::FrameArenaAllocator& allocator = static_cast<AZ::FrameArenaAllocator&>(AZ::AllocatorInstance<AZ::FrameArenaAllocator>::Get());
+        allocator.ResetFrame();
+
+        {
+            AZStd::vector<int, AZ::FrameArenaStdAllocator> values;
+            for (int i = 0; i < 100000; ++i)
+            {
+                values.push_back(i);
+            }
+            EXPECT_EQ(99999, values.back());
+            EXPECT_GE(allocator.NumAllocatedBytes(), values.size() * sizeof(int));
+        }
+
+        allocator.ResetFrame();
+        EXPECT_EQ(0u, allocator.NumAllocatedBytes());
+        EXPECT_GE(allocator.GetAllocatedBytesHighWaterMark(), 100000 * sizeof(int));
+    }
+
+    TEST_F(FrameArenaAllocatorTestFixture, Allocate_MultipleThreads_StatisticsIncludeAllThreads)
+    {
+        AZ::FrameArenaAllocator allocator;
+
+        constexpr size_t ThreadCount = 4;
+        constexpr size_t AllocationsPerThread = 1000;
+        AZStd::vector<AZStd::thread> threads;
+        for (size_t threadIndex = 0; threadIndex < ThreadCount; ++threadIndex)
+        {
+            threads.emplace_back(
+                [&allocator, threadIndex]()
+                {
+                    for (size_t i = 0; i < AllocationsPerThread; ++i)
+                    {
+                        char* address = static_cast<char*>(allocator.allocate(64, 16).GetAddress());
+                        memset(address, static_cast<int>(threadIndex), 64);
+                    }
+                });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        EXPECT_GE(allocator.NumAllocatedBytes(), ThreadCount * AllocationsPerThread * 64);
+        allocator.ResetFrame();
+        EXPECT_EQ(0u, allocator.NumAllocatedBytes());
+        EXPECT_GE(allocator.GetAllocatedBytesHighWaterMark(), ThreadCount * AllocationsPerThread * 64);
+    }
+
+    TEST_F(FrameArenaAllocatorTestFixture, Allocate_OverThreadFrameBudget_FallsBackToSystemAllocator)
+    {
+        AZ::FrameArenaAllocator allocator;
+        allocator.SetThreadFrameBudget(1024);
+
+        allocator.allocate(512, 8);
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        void* address = allocator.allocate(1024, 8);
+        AZ_TEST_STOP_TRACE_SUPPRESSION_NO_COUNT;
+        ASSERT_NE(nullptr, address);
+        EXPECT_EQ(1024u, allocator.get_allocated_size(address));
+
+        // Fallback allocations are returned to the SystemAllocator, the leak detection fixture verifies this
+        allocator.deallocate(address, 1024, 8);
+    }
+
+    TEST_F(FrameArenaAllocatorTestFixture, Deallocate_AllocationFromPreviousFrame_Asserts)
+    {
+        AZ::FrameArenaAllocator allocator;
+
+        void* address = allocator.allocate(64, 8);
+        allocator.ResetFrame();
+
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        allocator.deallocate(address, 64, 8);
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+    }
+} // namespace UnitTest
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Memory/AllocatorManager.h>
+#include <AzCore/Memory/HphaAllocator.h>
+#include <AzCore/Memory/OSPageAllocator.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace UnitTest
+{
+    class OSPageAllocatorTestFixture
+        : public LeakDetectionFixture
+    {
+    public:
+        void SetUp() override
+        {
+            LeakDetectionFixture::SetUp();
+            m_previousConfig = AZ::AllocatorManager::Instance().GetOSPageAllocatorConfig();
+        }
+
+        void TearDown() override
+        {
+            AZ::AllocatorManager::Instance().SetOSPageAllocatorConfig(m_previousConfig);
+            LeakDetectionFixture::TearDown();
+        }
+
+    protected:
+        struct Allocation
+        {
+            char* m_address;
+            size_t m_size;
+        };
+
+        void AllocateAndVerifyPages(AZStd::vector<Allocation, AZ::OSStdAllocator>& allocations)
+        {
+            for (size_t i = 0; i < 64; ++i)
+            {
+                const size_t size = AZ_PAGE_SIZE * (1 + i % 5);
+                char* address = static_cast<char*>(AZ::OSPageAllocator::Allocate(size, AZ_PAGE_SIZE));
+                ASSERT_NE(nullptr, address);
+                EXPECT_EQ(0u, reinterpret_cast<size_t>(address) % AZ_PAGE_SIZE);
+                memset(address, static_cast<int>(i), size);
+                allocations.push_back({ address, size });
+            }
+
+            for (size_t i = 0; i < allocations.size(); ++i)
+            {
+                for (size_t j = i + 1; j < allocations.size(); ++j)
+                {
+                    const Allocation& lhs = allocations[i];
+                    const Allocation& rhs = allocations[j];
+                    EXPECT_FALSE(lhs.m_address < rhs.m_address + rhs.m_size && rhs.m_address < lhs.m_address + lhs.m_size);
+                }
+            }
+        }
+
+        AZ::OSPageAllocatorConfig m_previousConfig;
+    };
+
+    TEST_F(OSPageAllocatorTestFixture, Allocate_DefaultConfig_PagesAreAlignedAndDistinct)
+    {
+        AZ::AllocatorManager::Instance().SetOSPageAllocatorConfig(AZ::OSPageAllocatorConfig{});
+
+        AZStd::vector<Allocation, AZ::OSStdAllocator> allocations;
+        AllocateAndVerifyPages(allocations);
+        for (const Allocation& allocation : allocations)
+        {
+            AZ::OSPageAllocator::Free(allocation.m_address, allocation.m_size);
+        }
+    }
+
+    TEST_F(OSPageAllocatorTestFixture, Allocate_HugePageArenas_PagesAreAlignedDistinctAndStatsBalance)
+    {
+        AZ::OSPageAllocatorConfig config;
+        config.m_hugePages = AZ::OSPageAllocatorConfig::HugePages::Transparent;
+        config.m_numaLocal = true;
+        config.m_arenaSize = 4 * 1024 * 1024;
+        AZ::AllocatorManager::Instance().SetOSPageAllocatorConfig(config);
+        const AZ::OSPageAllocatorStats statsBefore = AZ::AllocatorManager::Instance().GetOSPageAllocatorStats();
+
+        AZStd::vector<Allocation, AZ::OSStdAllocator> allocations;
+        AllocateAndVerifyPages(allocations);
+        const AZ::OSPageAllocatorStats statsDuring = AZ::AllocatorManager::Instance().GetOSPageAllocatorStats();
+        EXPECT_GE(statsDuring.m_reservedBytes, statsDuring.m_allocatedBytes);
+        EXPECT_GE(statsDuring.m_arenaHits + statsDuring.m_arenaMisses, statsBefore.m_arenaHits + statsBefore.m_arenaMisses);
+
+        for (const Allocation& allocation : allocations)
+        {
+            AZ::OSPageAllocator::Free(allocation.m_address, allocation.m_size);
+        }
+        const AZ::OSPageAllocatorStats statsAfter = AZ::AllocatorManager::Instance().GetOSPageAllocatorStats();
+        EXPECT_EQ(statsBefore.m_allocatedBytes, statsAfter.m_allocatedBytes);
+        EXPECT_EQ(statsBefore.m_numaLocalBytes, statsAfter.m_numaLocalBytes);
+    }
+
+    TEST_F(OSPageAllocatorTestFixture, HphaSchema_HugePageArenas_AllocationsSucceed)
+    {
+        AZ::OSPageAllocatorConfig config;
+        config.m_hugePages = AZ::OSPageAllocatorConfig::HugePages::Transparent;
+        AZ::AllocatorManager::Instance().SetOSPageAllocatorConfig(config);
+
+        AZ::HphaSchema schema;
+        AZStd::vector<AZStd::pair<void*, size_t>, AZ::OSStdAllocator> allocations;
+        for (size_t size : { size_t{ 16 }, size_t{ 600 }, size_t{ 4096 }, size_t{ 200 * 1024 }, size_t{ 3 * 1024 * 1024 } })
+        {
+            void* address = schema.allocate(size, 16);
+            ASSERT_NE(nullptr, address);
+            memset(address, 0xAB, size);
+            allocations.emplace_back(address, size);
+        }
+        for (const auto& [address, size] : allocations)
+        {
+            schema.deallocate(address, size, 16);
+        }
+        schema.GarbageCollect();
+    }
+} // namespace UnitTest
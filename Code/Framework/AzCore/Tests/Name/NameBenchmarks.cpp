@@ -10,6 +10,7 @@
 #include <AzCore/Name/Name.h>
 #include <AzCore/Name/NameDictionary.h>
 #include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/parallel/thread.h>
 
 namespace AZ::NameBenchmarks
 {
@@ -88,6 +89,77 @@ namespace AZ::NameBenchmarks
     }
     BENCHMARK_REGISTER_F(NameBenchmarkFixture, CreateNameCacheHit);
 
+    // Looks up existing names from many threads at once, as happens when assets, material properties and serialized
+    // data all create names concurrently.
+    class NameLookupBenchmarkFixture : public NameBenchmarkFixture
+    {
+    public:
+        static constexpr size_t PoolSize = 100;
+
+        void SetUp(const ::benchmark::State& st) override
+        {
+            NameBenchmarkFixture::SetUp(st);
+            CreateNames(st);
+        }
+
+        void SetUp(::benchmark::State& st) override
+        {
+            NameBenchmarkFixture::SetUp(st);
+            CreateNames(st);
+        }
+
+        void TearDown(::benchmark::State& st) override
+        {
+            ReleaseNames(st);
+            NameBenchmarkFixture::TearDown(st);
+        }
+
+        void TearDown(const ::benchmark::State& st) override
+        {
+            ReleaseNames(st);
+            NameBenchmarkFixture::TearDown(st);
+        }
+
+    protected:
+        void CreateNames(const ::benchmark::State& st)
+        {
+            // The names are created once and kept alive so every lookup in the benchmark hits an existing entry
+            if (st.thread_index() == 0)
+            {
+                for (size_t i = 0; i < PoolSize; ++i)
+                {
+                    m_existingNames.emplace_back(AZStd::string::format("name%zu", i));
+                }
+            }
+        }
+
+        void ReleaseNames(const ::benchmark::State& st)
+        {
+            if (st.thread_index() == 0)
+            {
+                m_existingNames = {};
+            }
+        }
+
+        AZStd::vector<AZ::Name> m_existingNames;
+    };
+
+    BENCHMARK_DEFINE_F(NameLookupBenchmarkFixture, CreateNameCacheHit_MultiThreaded)(::benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto var_ : state)
+        {
+            for (size_t i = 0; i < PoolSize; ++i)
+            {
+                benchmark::DoNotOptimize(AZ::Name(m_existingNames[i].GetStringView()));
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * PoolSize);
+    }
+    BENCHMARK_REGISTER_F(NameLookupBenchmarkFixture, CreateNameCacheHit_MultiThreaded)
+        ->ThreadRange(1, static_cast<int>(2 * AZStd::thread::hardware_concurrency()))
+        ->UseRealTime();
+
     BENCHMARK_DEFINE_F(NameBenchmarkFixture, CreateNameCacheMiss)(::benchmark::State& state)
     {
         constexpr size_t poolSize = 100;
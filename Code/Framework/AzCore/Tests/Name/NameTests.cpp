@@ -439,6 +439,47 @@ namespace UnitTest
         }
     }
 
+    TEST_F(NameTest, NameConstructFromHash_AfterLookupTableGrowsAndShrinks)
+    {
+        // Enough names to force the lock free lookup table to be rebuilt several times
+        constexpr size_t nameCount = 5000;
+        AZStd::vector<AZ::Name> names;
+        names.reserve(nameCount);
+        for (size_t i = 0; i < nameCount; ++i)
+        {
+            names.emplace_back(AZStd::string::format("name%zu", i));
+        }
+        EXPECT_EQ(NameDictionaryTester::GetEntryCount(), nameCount);
+
+        for (const AZ::Name& name : names)
+        {
+            AZ::Name lookupName = AZ::NameDictionary::Instance().FindName(name.GetHash());
+            EXPECT_EQ(name, lookupName);
+        }
+
+        // Releasing every other name leaves removed entries in the lookup table that lookups have to probe past
+        AZStd::vector<AZ::Name::Hash> releasedHashes;
+        for (size_t i = 0; i < nameCount; i += 2)
+        {
+            releasedHashes.push_back(names[i].GetHash());
+            names[i] = AZ::Name();
+        }
+        EXPECT_EQ(NameDictionaryTester::GetEntryCount(), nameCount / 2);
+
+        for (AZ::Name::Hash hash : releasedHashes)
+        {
+            EXPECT_TRUE(AZ::NameDictionary::Instance().FindName(hash).IsEmpty());
+        }
+        for (size_t i = 1; i < nameCount; i += 2)
+        {
+            EXPECT_EQ(names[i], AZ::NameDictionary::Instance().FindName(names[i].GetHash()));
+            EXPECT_EQ(names[i], AZ::Name(AZStd::string::format("name%zu", i)));
+        }
+
+        names.clear();
+        EXPECT_EQ(NameDictionaryTester::GetEntryCount(), 0);
+    }
+
     TEST_F(NameTest, NameComparisonTest)
     {
         AZ::Name a{"a"};
@@ -0,0 +1,347 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/Streamer/StorageDrive_Linux.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/StringFunc/StringFunc.h>
+#include <AzCore/Utils/Utils.h>
+
+#include <Tests/FileIOBaseTestTypes.h>
+#include <Tests/Streamer/StreamStackEntryConformityTests.h>
+
+namespace AZ::IO
+{
+    constexpr AZ::u32 TestMaxFileHandles = 4;
+    constexpr AZ::u32 TestMaxMetaDataEntries = 16;
+    constexpr AZ::u32 TestQueueDepth = 8;
+    constexpr AZ::s32 TestOverCommit = 0;
+    constexpr AZ::u32 TestFixedBufferSize = 0;
+
+    //
+    // StreamStackEntry API Conformity
+    //
+    class StorageDriveLinuxTestDescription :
+        public StreamStackEntryConformityTestsDescriptor<StorageDriveLinux>
+    {
+    public:
+        void SetUp() override
+        {
+            // Skipping here keeps the tests from constructing a drive, which requires io_uring.
+            if (!StorageDriveLinux::IsSupported())
+            {
+                GTEST_SKIP() << "io_uring isn't available on this machine.";
+            }
+        }
+
+        StorageDriveLinux CreateInstance() override
+        {
+            StorageDriveLinux::ConstructionOptions options;
+            options.m_minimalReporting = true;
+            return StorageDriveLinux(TestMaxFileHandles, TestMaxMetaDataEntries, TestQueueDepth, TestOverCommit, TestFixedBufferSize,
+                options);
+        }
+    };
+
+    INSTANTIATE_TYPED_TEST_SUITE_P(
+        Streamer_StorageDriveLinuxConformityTests, StreamStackEntryConformityTests, StorageDriveLinuxTestDescription);
+
+    //
+    // StorageDriveLinux Tests
+    //
+
+    class Streamer_StorageDriveLinuxTestFixture
+        : public UnitTest::LeakDetectionFixture
+        , public UnitTest::SetRestoreFileIOBaseRAII
+        , public ::testing::WithParamInterface<AZ::u32>
+    {
+    public:
+        static constexpr char s_dummyFilename[] = "DummyLinux.bin";
+        static constexpr char s_fileCharacter = 'F';
+        static constexpr char s_beginCharacter = 'B';
+        static constexpr char s_endCharacter = 'E';
+        static constexpr char s_chunkCharacter = 'C';
+
+        UnitTest::TestFileIOBase m_fileIO{};
+        AZStd::string m_dummyFilepath;
+        AZ::IO::RequestPath m_dummyRequestPath;
+        AZStd::shared_ptr<StorageDriveLinux> m_storageDrive{};
+        AZ::IO::StreamerContext* m_context = nullptr;
+        AZStd::vector<AZStd::string> m_dummyFiles;
+
+        Streamer_StorageDriveLinuxTestFixture()
+            : UnitTest::SetRestoreFileIOBaseRAII(m_fileIO)
+        {
+            PrepareTestFilepath();
+        }
+
+        void SetUp() override
+        {
+            if (!StorageDriveLinux::IsSupported())
+            {
+                GTEST_SKIP() << "io_uring isn't available on this machine.";
+            }
+
+            m_context = new AZ::IO::StreamerContext();
+            m_dummyRequestPath = RequestPath(AZ::IO::PathView(m_dummyFilepath));
+
+            StorageDriveLinux::ConstructionOptions options;
+            options.m_hasSeekPenalty = false;
+            options.m_minimalReporting = true;
+            m_storageDrive = AZStd::make_shared<StorageDriveLinux>(
+                TestMaxFileHandles, TestMaxMetaDataEntries, TestQueueDepth, TestOverCommit, GetParam(), options);
+            m_storageDrive->SetContext(*m_context);
+        }
+
+        void TearDown() override
+        {
+            m_storageDrive.reset();
+            delete m_context;
+            m_context = nullptr;
+
+            for (auto& dummyFile : m_dummyFiles)
+            {
+                AZ::IO::SystemFile::Delete(dummyFile.c_str());
+            }
+            m_dummyFiles.clear();
+            m_dummyFiles.shrink_to_fit();
+        }
+
+        // Create a file filled with a single character.
+        // If chunkOffset is non-zero, it will write in a specific character every chunkOffset bytes till the end of file.
+        // If beginEndMarkers is true, it will write in specific bytes to mark the begin and end of the file.
+        void CreateDummyFile(size_t fileSize, size_t chunkOffset = 0, bool beginEndMarkers = false)
+        {
+            SystemFile file;
+            ASSERT_TRUE(file.Open(m_dummyFilepath.c_str(), SystemFile::OpenMode::SF_OPEN_CREATE | SystemFile::OpenMode::SF_OPEN_READ_WRITE));
+            m_dummyFiles.push_back(m_dummyFilepath);
+
+            AZStd::unique_ptr<char[]> buffer(new char[fileSize]);
+            ::memset(buffer.get(), s_fileCharacter, fileSize);
+            if (chunkOffset != 0)
+            {
+                for (size_t offset = 0; offset < fileSize; offset += chunkOffset)
+                {
+                    buffer[offset] = s_chunkCharacter;
+                }
+            }
+            if (beginEndMarkers)
+            {
+                buffer[0] = s_beginCharacter;
+                buffer[fileSize - 1] = s_endCharacter;
+            }
+
+            auto bytesWritten = file.Write(buffer.get(), fileSize);
+            file.Close();
+            ASSERT_EQ(bytesWritten, fileSize);
+        }
+
+        void WaitTillCompleted()
+        {
+            StreamStackEntry::Status status;
+            auto startTime = AZStd::chrono::steady_clock::now();
+            do
+            {
+                m_storageDrive->ExecuteRequests();
+                m_context->FinalizeCompletedRequests();
+
+                status.m_isIdle = true;
+                m_storageDrive->UpdateStatus(status);
+
+                if (AZStd::chrono::steady_clock::now() - startTime > AZStd::chrono::seconds(5))
+                {
+                    FAIL();
+                }
+            } while (!status.m_isIdle);
+        }
+
+    private:
+        void PrepareTestFilepath()
+        {
+            char exePath[AZ_MAX_PATH_LEN] = { 0 };
+            auto result = AZ::Utils::GetExecutablePath(exePath, AZ_MAX_PATH_LEN);
+            if (result.m_pathStored != AZ::Utils::ExecutablePathResult::Success)
+            {
+                return;
+            }
+
+            AZStd::string filePath(exePath);
+            if (result.m_pathIncludesFilename)
+            {
+                AZ::StringFunc::Path::StripFullName(filePath);
+            }
+
+            AZ::StringFunc::Path::Join(filePath.c_str(), "TestFiles", filePath);
+            if (!AZ::IO::SystemFile::Exists(filePath.c_str()))
+            {
+                if (!AZ::IO::SystemFile::CreateDir(filePath.c_str()))
+                {
+                    return;
+                }
+            }
+
+            AZ::StringFunc::Path::Join(filePath.c_str(), s_dummyFilename, m_dummyFilepath);
+        }
+    };
+
+    TEST_P(Streamer_StorageDriveLinuxTestFixture, Constructor_ValidArguments_RingIsCreated)
+    {
+        EXPECT_TRUE(m_storageDrive->IsValid());
+    }
+
+    TEST_P(Streamer_StorageDriveLinuxTestFixture, FileMetaDataRetrievalRequest_FileExists_ReportsAccurateFileSize)
+    {
+        CreateDummyFile(4_kib);
+
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateFileMetaDataRetrieval(m_dummyRequestPath);
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                auto& fileMetaData = AZStd::get<Requests::FileMetaDataRetrievalData>(request.GetCommand());
+                EXPECT_TRUE(fileMetaData.m_found);
+                EXPECT_EQ(4_kib, fileMetaData.m_fileSize);
+            });
+
+        m_storageDrive->QueueRequest(request);
+        WaitTillCompleted();
+    }
+
+    TEST_P(Streamer_StorageDriveLinuxTestFixture, FileExistsRequest_FileDoesNotExist_ReturnsCompletedWithFileNotFound)
+    {
+        AZ::IO::RequestPath path(AZ::IO::PathView(m_dummyFilepath + ".disappear"));
+
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateFileExistsCheck(path);
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                auto& fileExistsCheck = AZStd::get<Requests::FileExistsCheckData>(request.GetCommand());
+                EXPECT_EQ(AZ::IO::IStreamerTypes::RequestStatus::Completed, request.GetStatus());
+                EXPECT_FALSE(fileExistsCheck.m_found);
+            });
+        m_storageDrive->QueueRequest(request);
+        WaitTillCompleted();
+    }
+
+    TEST_P(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_InvalidFilePath_ReportsFailure)
+    {
+        constexpr AZ::u64 readSize = 4_kib;
+        char buffer[readSize];
+
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        AZ::IO::RequestPath path{ AZ::IO::PathView{ m_dummyFilepath + "/Broken/Path.txt" } };
+        request->CreateRead(nullptr, buffer, readSize, path, 0, readSize);
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                EXPECT_EQ(AZ::IO::IStreamerTypes::RequestStatus::Failed, request.GetStatus());
+            });
+
+        m_storageDrive->QueueRequest(request);
+        WaitTillCompleted();
+    }
+
+    TEST_P(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_ParallelReads_DataIsCorrect)
+    {
+        constexpr size_t chunkSize = 16_kib;
+        constexpr size_t numChunks = TestQueueDepth * 2;
+        constexpr size_t fileSize = numChunks * chunkSize;
+        AZStd::array<AZStd::unique_ptr<u8[]>, numChunks> buffers;
+
+        // Create a file with chunk markers and begin/end markers
+        CreateDummyFile(fileSize, chunkSize, true);
+
+        size_t completedCount = 0;
+        for (size_t i = 0; i < numChunks; ++i)
+        {
+            buffers[i].reset(new u8[chunkSize]);
+            AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+            request->CreateRead(nullptr, buffers[i].get(), chunkSize, m_dummyRequestPath, i * chunkSize, chunkSize);
+            request->SetCompletionCallback([&completedCount](const FileRequest& request)
+                {
+                    EXPECT_EQ(request.GetStatus(), AZ::IO::IStreamerTypes::RequestStatus::Completed);
+                    completedCount++;
+                });
+            m_storageDrive->QueueRequest(request);
+        }
+
+        WaitTillCompleted();
+
+        EXPECT_EQ(numChunks, completedCount);
+        EXPECT_EQ(buffers[0][0], s_beginCharacter);
+        EXPECT_EQ(buffers[0][chunkSize - 1], s_fileCharacter);
+        for (size_t i = 1; i < numChunks; ++i)
+        {
+            EXPECT_EQ(buffers[i][0], s_chunkCharacter);
+        }
+        EXPECT_EQ(buffers[numChunks - 1][chunkSize - 1], s_endCharacter);
+    }
+
+    TEST_P(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_ReadsInFlight_AvailableSlotsAreReduced)
+    {
+        constexpr size_t readSize = 4_kib;
+        CreateDummyFile(readSize * TestQueueDepth);
+
+        AZStd::unique_ptr<u8[]> buffer(new u8[readSize * TestQueueDepth]);
+        StreamStackEntry::Status statusBefore;
+        m_storageDrive->UpdateStatus(statusBefore);
+        EXPECT_EQ(aznumeric_cast<s32>(TestQueueDepth) + TestOverCommit, statusBefore.m_numAvailableSlots);
+
+        for (u32 i = 0; i < TestQueueDepth; ++i)
+        {
+            AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+            request->CreateRead(nullptr, buffer.get() + (i * readSize), readSize, m_dummyRequestPath, i * readSize, readSize);
+            m_storageDrive->QueueRequest(request);
+        }
+
+        StreamStackEntry::Status statusAfter;
+        m_storageDrive->UpdateStatus(statusAfter);
+        EXPECT_EQ(TestOverCommit, statusAfter.m_numAvailableSlots);
+        EXPECT_FALSE(statusAfter.m_isIdle);
+
+        WaitTillCompleted();
+    }
+
+    TEST_P(Streamer_StorageDriveLinuxTestFixture, FlushEntireCacheRequest_FlushPreviouslyReadFile_NoErrorsReported)
+    {
+        constexpr size_t fileSize = 16_kib;
+        AZStd::unique_ptr<char[]> buffer(new char[fileSize]);
+        CreateDummyFile(fileSize);
+
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateRead(nullptr, buffer.get(), fileSize, m_dummyRequestPath, 0, fileSize);
+        m_storageDrive->QueueRequest(request);
+        WaitTillCompleted();
+
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        AZ::IO::FileRequest* flushRequest = m_context->GetNewInternalRequest();
+        flushRequest->CreateFlushAll();
+        m_storageDrive->QueueRequest(flushRequest);
+        WaitTillCompleted();
+        AZ_TEST_STOP_TRACE_SUPPRESSION(0);
+    }
+
+    TEST_P(Streamer_StorageDriveLinuxTestFixture, CollectStatistics_ReadDone_MoreThanZeroStatisticsReturned)
+    {
+        constexpr size_t fileSize = 16_kib;
+        AZStd::unique_ptr<char[]> buffer(new char[fileSize]);
+        CreateDummyFile(fileSize);
+
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateRead(nullptr, buffer.get(), fileSize, m_dummyRequestPath, 0, fileSize);
+        m_storageDrive->QueueRequest(request);
+        WaitTillCompleted();
+
+        AZStd::vector<Statistic> statistics;
+        m_storageDrive->CollectStatistics(statistics);
+        EXPECT_FALSE(statistics.empty());
+    }
+
+    // Run all tests with reads going directly to the output buffer and with reads going through registered buffers.
+    INSTANTIATE_TEST_CASE_P(
+        Streamer_StorageDriveLinux, Streamer_StorageDriveLinuxTestFixture, ::testing::Values(0u, 65536u));
+} // namespace AZ::IO
@@ -1961,6 +1961,19 @@ TEST_F(SerializeBasicTest, BasicTypeTest_Succeed)
             IO::FileIOStream stream(testBinFilePath.c_str(), IO::OpenMode::ModeRead);
             TestLoad(&stream);
         }
+
+        // Mapped binary version
+        AZ::IO::Path testMappedBinFilePath = serializeTestFilePath / "serializebasictest.mbin";
+        {
+            AZ_TracePrintf("SerializeBasicTest", "Writing as Mapped Binary...\n");
+            IO::FileIOStream stream(testMappedBinFilePath.c_str(), IO::OpenMode::ModeWrite);
+            TestSave(&stream, ObjectStream::ST_BINARY_MAPPED);
+        }
+        {
+            AZ_TracePrintf("SerializeBasicTest", "Loading as Mapped Binary...\n");
+            IO::FileIOStream stream(testMappedBinFilePath.c_str(), IO::OpenMode::ModeRead);
+            TestLoad(&stream);
+        }
     }
 
     TEST_F(SerializeBasicTest, BasicTypeTest_LocaleIndependent)
@@ -205,6 +205,52 @@ namespace JsonSerializationTests
         EXPECT_TRUE(loadInstance.Equals(*description.m_instance, this->m_fullyReflected));
     }
 
+    TYPED_TEST(TypedJsonSerializationTests, LoadStreaming_EmptyJson_SucceedsAndObjectMatchesDefaults)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        this->Reflect(true);
+
+        TypeParam loadInstance;
+        ResultCode loadResult = AZ::JsonSerialization::LoadStreaming(loadInstance, "{}", *this->m_deserializationSettings);
+        ASSERT_EQ(Outcomes::DefaultsUsed, loadResult.GetOutcome());
+
+        TypeParam expectedInstance;
+        EXPECT_TRUE(loadInstance.Equals(expectedInstance, this->m_fullyReflected));
+    }
+
+    TYPED_TEST(TypedJsonSerializationTests, LoadStreaming_JsonWithoutDefaults_SucceedsAndObjectMatches)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        this->Reflect(true);
+        auto description = TypeParam::GetInstanceWithoutDefaults();
+
+        TypeParam loadInstance;
+        ResultCode loadResult = AZ::JsonSerialization::LoadStreaming(
+            loadInstance, description.m_jsonWithStrippedDefaults, *this->m_deserializationSettings);
+        ASSERT_EQ(Outcomes::Success, loadResult.GetOutcome());
+        EXPECT_TRUE(loadInstance.Equals(*description.m_instance, this->m_fullyReflected));
+    }
+
+    TYPED_TEST(TypedJsonSerializationTests, LoadStreaming_JsonWithoutDefaults_ResultMatchesLoad)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        this->Reflect(true);
+        auto description = TypeParam::GetInstanceWithoutDefaults();
+        this->m_jsonDocument->Parse(description.m_jsonWithStrippedDefaults);
+
+        TypeParam documentInstance;
+        ResultCode documentResult = AZ::JsonSerialization::Load(documentInstance, *this->m_jsonDocument, *this->m_deserializationSettings);
+        TypeParam streamingInstance;
+        ResultCode streamingResult = AZ::JsonSerialization::LoadStreaming(
+            streamingInstance, description.m_jsonWithStrippedDefaults, *this->m_deserializationSettings);
+        EXPECT_EQ(documentResult.GetProcessing(), streamingResult.GetProcessing());
+        EXPECT_EQ(documentResult.GetOutcome(), streamingResult.GetOutcome());
+        EXPECT_TRUE(streamingInstance.Equals(documentInstance, this->m_fullyReflected));
+    }
+
     // Load
 
     TEST_F(JsonSerializationTests, Load_PrimitiveAtTheRoot_SucceedsAndObjectMatches)
@@ -313,6 +359,48 @@ namespace JsonSerializationTests
         EXPECT_EQ(Outcomes::Catastrophic, loadResult.GetOutcome());
     }
 
+    TEST_F(JsonSerializationTests, LoadStreaming_PrimitiveAtTheRoot_SucceedsAndObjectMatches)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        bool loadValue = false;
+        ResultCode loadResult = AZ::JsonSerialization::LoadStreaming(loadValue, "true", *m_deserializationSettings);
+        ASSERT_EQ(Outcomes::Success, loadResult.GetOutcome());
+        EXPECT_TRUE(loadValue);
+    }
+
+    TEST_F(JsonSerializationTests, LoadStreaming_ArrayAtTheRoot_SucceedsAndObjectMatches)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        auto genericInfo = AZ::SerializeGenericTypeInfo<AZStd::vector<int>>::GetGenericInfo();
+        ASSERT_NE(nullptr, genericInfo);
+        genericInfo->Reflect(m_serializeContext.get());
+
+        AZStd::vector<int> loadValues;
+        ResultCode loadResult = AZ::JsonSerialization::LoadStreaming(loadValues, "[13,42,88]", *m_deserializationSettings);
+        ASSERT_EQ(Outcomes::Success, loadResult.GetOutcome());
+        EXPECT_EQ(loadValues, AZStd::vector<int>({ 13, 42, 88 }));
+    }
+
+    TEST_F(JsonSerializationTests, LoadStreaming_LoadToNullPtr_ReturnsCatastrophic)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        ResultCode loadResult = AZ::JsonSerialization::LoadStreaming(nullptr, azrtti_typeid<int>(), "42", *m_deserializationSettings);
+        EXPECT_EQ(Outcomes::Catastrophic, loadResult.GetOutcome());
+    }
+
+    TEST_F(JsonSerializationTests, LoadStreaming_InvalidJson_ReturnsCatastrophic)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        bool loadValue = false;
+        ResultCode loadResult = AZ::JsonSerialization::LoadStreaming(loadValue, "[true", *m_deserializationSettings);
+        EXPECT_EQ(Outcomes::Catastrophic, loadResult.GetOutcome());
+        EXPECT_EQ(Processing::Halted, loadResult.GetProcessing());
+    }
+
     TEST_F(JsonSerializationTests, Load_UnrelatedPointerType_FailsToCast)
     {
         using namespace AZ::JsonSerializationResult;
@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#if defined(HAVE_BENCHMARK)
+
+#include <AzCore/IO/ByteContainerStream.h>
+#include <AzCore/IO/GenericStreams.h>
+#include <AzCore/Serialization/MappedObjectStream.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Utils/Utils.h>
+#include <AzTest/Utils.h>
+
+namespace AZ::MappedObjectStreamBenchmarks
+{
+    struct BenchmarkPod
+    {
+        AZ_TYPE_INFO(BenchmarkPod, "{E3A4C5D6-1B2F-4E8A-9C7D-6F5E4D3C2B19}");
+        AZ_CLASS_ALLOCATOR(BenchmarkPod, AZ::SystemAllocator);
+
+        static void Reflect(AZ::SerializeContext& context)
+        {
+            context.Class<BenchmarkPod>()
+                ->Field("Id", &BenchmarkPod::m_id)
+                ->Field("X", &BenchmarkPod::m_x)
+                ->Field("Y", &BenchmarkPod::m_y)
+                ->Field("Z", &BenchmarkPod::m_z)
+                ->Field("Scale", &BenchmarkPod::m_scale)
+                ->Field("Flags", &BenchmarkPod::m_flags);
+        }
+
+        AZ::u64 m_id = 0;
+        float m_x = 0.0f;
+        float m_y = 0.0f;
+        float m_z = 0.0f;
+        float m_scale = 1.0f;
+        AZ::u32 m_flags = 0;
+    };
+
+    class MappedObjectStreamBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    protected:
+        void SetUp(const ::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            m_serializeContext = AZStd::make_unique<AZ::SerializeContext>();
+            BenchmarkPod::Reflect(*m_serializeContext);
+            m_tempDirectory = AZStd::make_unique<AZ::Test::ScopedAutoTempDirectory>();
+        }
+        void SetUp(::benchmark::State& state) override
+        {
+            SetUp(static_cast<const ::benchmark::State&>(state));
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            m_tempDirectory.reset();
+            m_serializeContext.reset();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(::benchmark::State& state) override
+        {
+            TearDown(static_cast<const ::benchmark::State&>(state));
+        }
+
+        AZStd::vector<char> SaveObjects(int64_t objectCount, AZ::DataStream::StreamType streamType)
+        {
+            AZStd::vector<char> buffer;
+            AZ::IO::ByteContainerStream<AZStd::vector<char>> stream(&buffer);
+            AZ::ObjectStream* objectStream = AZ::ObjectStream::Create(&stream, *m_serializeContext, streamType);
+            for (int64_t i = 0; i < objectCount; ++i)
+            {
+                BenchmarkPod pod;
+                pod.m_id = static_cast<AZ::u64>(i);
+                pod.m_x = static_cast<float>(i);
+                objectStream->WriteClass(&pod);
+            }
+            objectStream->Finalize();
+            return buffer;
+        }
+
+        AZStd::unique_ptr<AZ::SerializeContext> m_serializeContext;
+        AZStd::unique_ptr<AZ::Test::ScopedAutoTempDirectory> m_tempDirectory;
+    };
+
+    BENCHMARK_DEFINE_F(MappedObjectStreamBenchmarkFixture, LoadBlocking_Binary)(benchmark::State& state)
+    {
+        AZStd::vector<char> buffer = SaveObjects(state.range(0), AZ::DataStream::ST_BINARY);
+        while (state.KeepRunning())
+        {
+            AZ::IO::MemoryStream stream(buffer.data(), buffer.size());
+            AZ::ObjectStream::LoadBlocking(&stream, *m_serializeContext, [](void* classPtr, const AZ::Uuid&, AZ::SerializeContext*)
+            {
+                benchmark::DoNotOptimize(classPtr);
+                delete static_cast<BenchmarkPod*>(classPtr);
+            });
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK_REGISTER_F(MappedObjectStreamBenchmarkFixture, LoadBlocking_Binary)->Arg(100)->Arg(10000);
+
+    BENCHMARK_DEFINE_F(MappedObjectStreamBenchmarkFixture, LoadBlocking_MappedBinary)(benchmark::State& state)
+    {
+        AZStd::vector<char> buffer = SaveObjects(state.range(0), AZ::DataStream::ST_BINARY_MAPPED);
+        while (state.KeepRunning())
+        {
+            AZ::IO::MemoryStream stream(buffer.data(), buffer.size());
+            AZ::ObjectStream::LoadBlocking(&stream, *m_serializeContext, [](void* classPtr, const AZ::Uuid&, AZ::SerializeContext*)
+            {
+                benchmark::DoNotOptimize(classPtr);
+                delete static_cast<BenchmarkPod*>(classPtr);
+            });
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK_REGISTER_F(MappedObjectStreamBenchmarkFixture, LoadBlocking_MappedBinary)->Arg(100)->Arg(10000);
+
+    BENCHMARK_DEFINE_F(MappedObjectStreamBenchmarkFixture, Open_MappedBinary)(benchmark::State& state)
+    {
+        AZStd::vector<char> buffer = SaveObjects(state.range(0), AZ::DataStream::ST_BINARY_MAPPED);
+        AZ::IO::Path filePath = m_tempDirectory->GetDirectoryAsPath() / "benchmark.mbin";
+        AZ::Utils::WriteFile(AZStd::span<const AZStd::byte>(reinterpret_cast<const AZStd::byte*>(buffer.data()), buffer.size()), filePath.Native());
+
+        while (state.KeepRunning())
+        {
+            AZ::MappedObjectStream stream;
+            stream.Open(filePath.c_str(), *m_serializeContext);
+            for (size_t rootIndex = 0; rootIndex < stream.GetRootCount(); ++rootIndex)
+            {
+                benchmark::DoNotOptimize(stream.GetMappedRoot<BenchmarkPod>(rootIndex));
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK_REGISTER_F(MappedObjectStreamBenchmarkFixture, Open_MappedBinary)->Arg(100)->Arg(10000);
+} // namespace AZ::MappedObjectStreamBenchmarks
+
+#endif // defined(HAVE_BENCHMARK)
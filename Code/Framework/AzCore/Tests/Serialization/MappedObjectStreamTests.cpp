@@ -0,0 +1,331 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/ByteContainerStream.h>
+#include <AzCore/IO/GenericStreams.h>
+#include <AzCore/Serialization/MappedObjectStream.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Utils/Utils.h>
+#include <AzTest/Utils.h>
+
+namespace UnitTest
+{
+    namespace MappedObjectStreamTestClasses
+    {
+        struct MappedPod
+        {
+            AZ_TYPE_INFO(MappedPod, "{0C2A3A8E-54D3-4B7E-9E0B-6A8C4F1E2D31}");
+            AZ_CLASS_ALLOCATOR(MappedPod, AZ::SystemAllocator);
+
+            static void Reflect(AZ::SerializeContext& context, unsigned int version = 1)
+            {
+                context.Class<MappedPod>()
+                    ->Version(version)
+                    ->Field("Int", &MappedPod::m_int)
+                    ->Field("Float", &MappedPod::m_float)
+                    ->Field("U64", &MappedPod::m_u64)
+                    ->Field("Bool", &MappedPod::m_bool);
+            }
+
+            int m_int = 1;
+            float m_float = 2.0f;
+            AZ::u64 m_u64 = 3;
+            bool m_bool = false;
+        };
+
+        struct MappedNode
+        {
+            AZ_TYPE_INFO(MappedNode, "{5F9B0C47-7E0D-4C6A-A3B1-2D8E9F4A6C12}");
+            AZ_CLASS_ALLOCATOR(MappedNode, AZ::SystemAllocator);
+
+            static void Reflect(AZ::SerializeContext& context)
+            {
+                context.Class<MappedNode>()
+                    ->Field("Value", &MappedNode::m_value)
+                    ->Field("Pod", &MappedNode::m_pod)
+                    ->Field("Next", &MappedNode::m_next);
+            }
+
+            int m_value = 0;
+            MappedPod* m_pod = nullptr;
+            MappedNode* m_next = nullptr;
+        };
+
+        struct UnmappedClass
+        {
+            AZ_TYPE_INFO(UnmappedClass, "{B1E7D6A2-3C48-4F5E-8A9D-0E7C6B5A4F23}");
+            AZ_CLASS_ALLOCATOR(UnmappedClass, AZ::SystemAllocator);
+
+            static void Reflect(AZ::SerializeContext& context)
+            {
+                context.Class<UnmappedClass>()
+                    ->Field("Name", &UnmappedClass::m_name)
+                    ->Field("Values", &UnmappedClass::m_values);
+            }
+
+            AZStd::string m_name;
+            AZStd::vector<int> m_values;
+        };
+    } // namespace MappedObjectStreamTestClasses
+
+    using namespace MappedObjectStreamTestClasses;
+
+    class MappedObjectStreamTest
+        : public LeakDetectionFixture
+    {
+    public:
+        void SetUp() override
+        {
+            m_serializeContext = AZStd::make_unique<AZ::SerializeContext>();
+            MappedPod::Reflect(*m_serializeContext);
+            MappedNode::Reflect(*m_serializeContext);
+            UnmappedClass::Reflect(*m_serializeContext);
+        }
+
+        void TearDown() override
+        {
+            m_serializeContext.reset();
+        }
+
+        template<class... T>
+        AZStd::vector<char> Save(AZ::SerializeContext& context, const T&... objects)
+        {
+            AZStd::vector<char> buffer;
+            AZ::IO::ByteContainerStream<AZStd::vector<char>> stream(&buffer);
+            AZ::ObjectStream* objectStream = AZ::ObjectStream::Create(&stream, context, AZ::ObjectStream::ST_BINARY_MAPPED);
+            EXPECT_NE(nullptr, objectStream);
+            const bool written = (objectStream->WriteClass(&objects) && ...);
+            EXPECT_TRUE(written);
+            EXPECT_TRUE(objectStream->Finalize());
+            return buffer;
+        }
+
+        AZ::IO::Path WriteTestFile(const AZStd::vector<char>& buffer)
+        {
+            AZ::IO::Path filePath = m_tempDirectory.GetDirectoryAsPath() / "mappedobjectstream.mbin";
+            auto span = AZStd::span<const AZStd::byte>(reinterpret_cast<const AZStd::byte*>(buffer.data()), buffer.size());
+            EXPECT_TRUE(AZ::Utils::WriteFile(span, filePath.Native()).IsSuccess());
+            return filePath;
+        }
+
+        // Offsets of the stream header fields and the root entry fields the corruption tests modify
+        static constexpr size_t RootTableOffsetField = 32;
+        static constexpr size_t RelocationTableOffsetField = 48;
+        static constexpr size_t RootImageOffsetField = 24;
+
+        static AZ::u64 ReadU64(const AZStd::vector<char>& buffer, AZ::u64 offset)
+        {
+            AZ::u64 value;
+            memcpy(&value, buffer.data() + offset, sizeof(value));
+            return value;
+        }
+
+        static void WriteU64(AZStd::vector<char>& buffer, AZ::u64 offset, AZ::u64 value)
+        {
+            memcpy(buffer.data() + offset, &value, sizeof(value));
+        }
+
+        void ExpectOpenFails(const AZStd::vector<char>& buffer)
+        {
+            AZ::MappedObjectStream stream;
+            AZ_TEST_START_TRACE_SUPPRESSION;
+            EXPECT_FALSE(stream.Open(WriteTestFile(buffer).c_str(), *m_serializeContext));
+            AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+            EXPECT_FALSE(stream.IsOpen());
+        }
+
+    protected:
+        AZStd::unique_ptr<AZ::SerializeContext> m_serializeContext;
+        AZ::Test::ScopedAutoTempDirectory m_tempDirectory;
+    };
+
+    TEST_F(MappedObjectStreamTest, Open_TriviallyCopyableRoot_IsUsedInPlace)
+    {
+        MappedPod pod;
+        pod.m_int = 42;
+        pod.m_float = 0.5f;
+        pod.m_u64 = 0x0123456789ABCDEF;
+        pod.m_bool = true;
+
+        AZ::MappedObjectStream stream;
+        ASSERT_TRUE(stream.Open(WriteTestFile(Save(*m_serializeContext, pod)).c_str(), *m_serializeContext));
+        ASSERT_EQ(1u, stream.GetRootCount());
+        EXPECT_EQ(azrtti_typeid<MappedPod>(), stream.GetRootTypeId(0));
+        EXPECT_EQ(nullptr, stream.GetMappedRoot<MappedNode>(0));
+
+        const MappedPod* mappedPod = stream.GetMappedRoot<MappedPod>(0);
+        ASSERT_NE(nullptr, mappedPod);
+        EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(mappedPod) % alignof(MappedPod));
+        EXPECT_EQ(42, mappedPod->m_int);
+        EXPECT_FLOAT_EQ(0.5f, mappedPod->m_float);
+        EXPECT_EQ(0x0123456789ABCDEFull, mappedPod->m_u64);
+        EXPECT_TRUE(mappedPod->m_bool);
+    }
+
+    TEST_F(MappedObjectStreamTest, Open_RootWithPointers_PointersAreRelocated)
+    {
+        MappedPod pod;
+        pod.m_int = 7;
+        MappedNode tail;
+        tail.m_value = 2;
+        MappedNode head;
+        head.m_value = 1;
+        head.m_pod = &pod;
+        head.m_next = &tail;
+
+        AZ::MappedObjectStream stream;
+        ASSERT_TRUE(stream.Open(WriteTestFile(Save(*m_serializeContext, head)).c_str(), *m_serializeContext));
+
+        const MappedNode* mappedHead = stream.GetMappedRoot<MappedNode>(0);
+        ASSERT_NE(nullptr, mappedHead);
+        EXPECT_EQ(1, mappedHead->m_value);
+        ASSERT_NE(nullptr, mappedHead->m_pod);
+        EXPECT_EQ(7, mappedHead->m_pod->m_int);
+        ASSERT_NE(nullptr, mappedHead->m_next);
+        EXPECT_EQ(2, mappedHead->m_next->m_value);
+        EXPECT_EQ(nullptr, mappedHead->m_next->m_pod);
+        EXPECT_EQ(nullptr, mappedHead->m_next->m_next);
+    }
+
+    TEST_F(MappedObjectStreamTest, Open_NonTriviallyCopyableRoot_IsLoadedFromEmbeddedStream)
+    {
+        MappedPod pod;
+        pod.m_int = 3;
+        UnmappedClass unmapped;
+        unmapped.m_name = "Unmapped";
+        unmapped.m_values = { 1, 2, 3 };
+
+        AZ::MappedObjectStream stream;
+        ASSERT_TRUE(stream.Open(WriteTestFile(Save(*m_serializeContext, unmapped, pod)).c_str(), *m_serializeContext));
+        ASSERT_EQ(2u, stream.GetRootCount());
+        EXPECT_EQ(azrtti_typeid<UnmappedClass>(), stream.GetRootTypeId(0));
+        EXPECT_EQ(nullptr, stream.GetMappedRoot(0));
+        ASSERT_NE(nullptr, stream.GetMappedRoot<MappedPod>(1));
+        EXPECT_EQ(3, stream.GetMappedRoot<MappedPod>(1)->m_int);
+
+        size_t loadedCount = 0;
+        EXPECT_TRUE(stream.LoadUnmappedRoots([&loadedCount](void* classPtr, const AZ::Uuid& classId, AZ::SerializeContext*)
+        {
+            ASSERT_EQ(azrtti_typeid<UnmappedClass>(), classId);
+            auto loaded = static_cast<UnmappedClass*>(classPtr);
+            EXPECT_STREQ("Unmapped", loaded->m_name.c_str());
+            EXPECT_EQ(3u, loaded->m_values.size());
+            delete loaded;
+            ++loadedCount;
+        }));
+        EXPECT_EQ(1u, loadedCount);
+    }
+
+    TEST_F(MappedObjectStreamTest, LoadBlocking_MappedStream_CopiesRootsInOrder)
+    {
+        MappedPod pod;
+        pod.m_int = 11;
+        MappedNode node;
+        node.m_value = 5;
+        node.m_pod = &pod;
+        UnmappedClass unmapped;
+        unmapped.m_name = "Copied";
+
+        AZStd::vector<char> buffer = Save(*m_serializeContext, node, unmapped);
+        AZ::IO::MemoryStream stream(buffer.data(), buffer.size());
+
+        AZStd::vector<AZ::Uuid> loadedTypes;
+        EXPECT_TRUE(AZ::ObjectStream::LoadBlocking(&stream, *m_serializeContext,
+            [&loadedTypes](void* classPtr, const AZ::Uuid& classId, AZ::SerializeContext*)
+            {
+                loadedTypes.push_back(classId);
+                if (classId == azrtti_typeid<MappedNode>())
+                {
+                    auto loaded = static_cast<MappedNode*>(classPtr);
+                    EXPECT_EQ(5, loaded->m_value);
+                    ASSERT_NE(nullptr, loaded->m_pod);
+                    EXPECT_EQ(11, loaded->m_pod->m_int);
+                    EXPECT_EQ(nullptr, loaded->m_next);
+                    delete loaded->m_pod;
+                    delete loaded;
+                }
+                else
+                {
+                    auto loaded = static_cast<UnmappedClass*>(classPtr);
+                    EXPECT_STREQ("Copied", loaded->m_name.c_str());
+                    delete loaded;
+                }
+            }));
+
+        ASSERT_EQ(2u, loadedTypes.size());
+        EXPECT_EQ(azrtti_typeid<MappedNode>(), loadedTypes[0]);
+        EXPECT_EQ(azrtti_typeid<UnmappedClass>(), loadedTypes[1]);
+    }
+
+    TEST_F(MappedObjectStreamTest, Open_ChangedClassLayout_Fails)
+    {
+        MappedPod pod;
+        AZ::IO::Path filePath = WriteTestFile(Save(*m_serializeContext, pod));
+
+        AZ::SerializeContext changedContext;
+        MappedPod::Reflect(changedContext, 2);
+
+        AZ::MappedObjectStream stream;
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        EXPECT_FALSE(stream.Open(filePath.c_str(), changedContext));
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+        EXPECT_FALSE(stream.IsOpen());
+    }
+
+    TEST_F(MappedObjectStreamTest, Open_TruncatedFile_Fails)
+    {
+        MappedPod pod;
+        AZStd::vector<char> buffer = Save(*m_serializeContext, pod);
+        buffer.resize(buffer.size() / 2);
+
+        AZ::MappedObjectStream stream;
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        EXPECT_FALSE(stream.Open(WriteTestFile(buffer).c_str(), *m_serializeContext));
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+    }
+
+    TEST_F(MappedObjectStreamTest, Open_RelocationOutsideImages_Fails)
+    {
+        MappedPod pod;
+        MappedNode node;
+        node.m_pod = &pod;
+        AZStd::vector<char> buffer = Save(*m_serializeContext, node);
+
+        // Point the relocation at the image offset of the root entry
+        const AZ::u64 rootEntry = ReadU64(buffer, RootTableOffsetField);
+        WriteU64(buffer, ReadU64(buffer, RelocationTableOffsetField), rootEntry + RootImageOffsetField);
+        ExpectOpenFails(buffer);
+    }
+
+    TEST_F(MappedObjectStreamTest, Open_PointerOutsideImages_Fails)
+    {
+        MappedPod pod;
+        MappedNode node;
+        node.m_pod = &pod;
+        AZStd::vector<char> buffer = Save(*m_serializeContext, node);
+
+        // Point the pod of the node at the root table
+        const AZ::u64 slot = ReadU64(buffer, ReadU64(buffer, RelocationTableOffsetField));
+        WriteU64(buffer, slot, ReadU64(buffer, RootTableOffsetField));
+        ExpectOpenFails(buffer);
+    }
+
+    TEST_F(MappedObjectStreamTest, Open_PointerCycle_Fails)
+    {
+        MappedNode tail;
+        MappedNode head;
+        head.m_next = &tail;
+        AZStd::vector<char> buffer = Save(*m_serializeContext, head);
+
+        // Point the next node of the head back at the head
+        const AZ::u64 slot = ReadU64(buffer, ReadU64(buffer, RelocationTableOffsetField));
+        WriteU64(buffer, slot, ReadU64(buffer, ReadU64(buffer, RootTableOffsetField) + RootImageOffsetField));
+        ExpectOpenFails(buffer);
+    }
+} // namespace UnitTest
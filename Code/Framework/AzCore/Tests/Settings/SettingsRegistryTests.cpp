@@ -14,6 +14,8 @@
 #include <AzCore/Serialization/Json/JsonSystemComponent.h>
 #include <AzCore/Settings/SettingsRegistryImpl.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/UnitTest/TestTypes.h>
@@ -592,6 +594,176 @@ namespace SettingsRegistryTests
         EXPECT_FALSE(this->m_registry->Get(notFoundValue, testPath));
     }
 
+    //
+    // Snapshot mode
+    //
+
+    TEST_F(SettingsRegistryTest, SnapshotMode_SetAfterEnabling_GetReturnsNewValue)
+    {
+        EXPECT_TRUE(m_registry->Set("/O3DE/Test/Value", AZ::s64{ 1 }));
+        EXPECT_TRUE(m_registry->Set("/O3DE/Other/Value", "Other"));
+        m_registry->SetSnapshotMode(true);
+        EXPECT_TRUE(m_registry->IsSnapshotModeEnabled());
+        const AZ::u64 version = m_registry->GetSnapshotVersion();
+
+        AZ::s64 value{};
+        EXPECT_TRUE(m_registry->Get(value, "/O3DE/Test/Value"));
+        EXPECT_EQ(1, value);
+
+        EXPECT_TRUE(m_registry->Set("/O3DE/Test/Value", AZ::s64{ 2 }));
+        EXPECT_GT(m_registry->GetSnapshotVersion(), version);
+        EXPECT_TRUE(m_registry->Get(value, "/O3DE/Test/Value"));
+        EXPECT_EQ(2, value);
+
+        AZStd::string otherValue;
+        EXPECT_TRUE(m_registry->Get(otherValue, "/O3DE/Other/Value"));
+        EXPECT_STREQ("Other", otherValue.c_str());
+
+        EXPECT_TRUE(m_registry->Set("/TopLevel", true));
+        bool topLevelValue{};
+        EXPECT_TRUE(m_registry->Get(topLevelValue, "/TopLevel"));
+        EXPECT_TRUE(topLevelValue);
+    }
+
+    TEST_F(SettingsRegistryTest, SnapshotMode_Remove_ValueIsNoLongerFound)
+    {
+        EXPECT_TRUE(m_registry->Set("/O3DE/Test/Value", 42.0));
+        EXPECT_TRUE(m_registry->Set("/O3DE/Test/Kept", 43.0));
+        m_registry->SetSnapshotMode(true);
+
+        EXPECT_TRUE(m_registry->Remove("/O3DE/Test/Value"));
+        double value{};
+        EXPECT_FALSE(m_registry->Get(value, "/O3DE/Test/Value"));
+        EXPECT_TRUE(m_registry->Get(value, "/O3DE/Test/Kept"));
+        EXPECT_DOUBLE_EQ(43.0, value);
+
+        EXPECT_TRUE(m_registry->Remove("/O3DE"));
+        EXPECT_FALSE(m_registry->Get(value, "/O3DE/Test/Kept"));
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::NoType, m_registry->GetType("/O3DE"));
+    }
+
+    TEST_F(SettingsRegistryTest, SnapshotMode_MergeSettings_MergedValuesAreVisible)
+    {
+        m_registry->SetSnapshotMode(true);
+        ASSERT_TRUE(m_registry->MergeSettings(R"({ "Object": { "Value": 42, "Array": [ 1, 2 ] } })",
+            AZ::SettingsRegistryInterface::Format::JsonMergePatch));
+        ASSERT_TRUE(m_registry->MergeSettings(R"({ "Value": 43 })",
+            AZ::SettingsRegistryInterface::Format::JsonMergePatch, "/Object"));
+
+        AZ::s64 value{};
+        EXPECT_TRUE(m_registry->Get(value, "/Object/Value"));
+        EXPECT_EQ(43, value);
+        EXPECT_TRUE(m_registry->Get(value, "/Object/Array/1"));
+        EXPECT_EQ(2, value);
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::Object, m_registry->GetType("/Object"));
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::Object, m_registry->GetType(""));
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::Array, m_registry->GetType("/Object/Array"));
+    }
+
+    TEST_F(SettingsRegistryTest, SnapshotMode_GetSetObject_SetAndGetValue_Success)
+    {
+        m_registry->SetSnapshotMode(true);
+        TestClass::Reflect(*m_serializeContext);
+        TestClass value = TestClass::Initialize();
+        ASSERT_TRUE(m_registry->SetObject("/Test/Object", &value, azrtti_typeid(value)));
+
+        TestClass readValue;
+        ASSERT_TRUE(m_registry->GetObject(&readValue, azrtti_typeid(readValue), "/Test/Object"));
+        EXPECT_EQ(value.m_var1, readValue.m_var1);
+        EXPECT_DOUBLE_EQ(value.m_var2, readValue.m_var2);
+
+        m_serializeContext->EnableRemoveReflection();
+        TestClass::Reflect(*m_serializeContext);
+        m_serializeContext->DisableRemoveReflection();
+    }
+
+    TEST_F(SettingsRegistryTest, SnapshotMode_Disable_ReadsFromRegistry)
+    {
+        m_registry->SetSnapshotMode(true);
+        m_registry->SetSnapshotMode(false);
+        EXPECT_FALSE(m_registry->IsSnapshotModeEnabled());
+
+        EXPECT_TRUE(m_registry->Set("/O3DE/Test/Value", AZ::u64{ 7 }));
+        AZ::u64 value{};
+        EXPECT_TRUE(m_registry->Get(value, "/O3DE/Test/Value"));
+        EXPECT_EQ(7u, value);
+    }
+
+    TEST_F(SettingsRegistryTest, KeyHandle_GetAfterSet_ReturnsNewValue)
+    {
+        AZ::SettingsRegistryImpl::KeyHandle key("/O3DE/Test/Value");
+        ASSERT_TRUE(key.IsValid());
+
+        AZ::s64 value{};
+        EXPECT_FALSE(m_registry->Get(value, key));
+        EXPECT_TRUE(m_registry->Set("/O3DE/Test/Value", AZ::s64{ 1 }));
+        EXPECT_TRUE(m_registry->Get(value, key));
+        EXPECT_EQ(1, value);
+
+        m_registry->SetSnapshotMode(true);
+        EXPECT_TRUE(m_registry->Get(value, key));
+        EXPECT_EQ(1, value);
+        // Reading through the cached node again
+        EXPECT_TRUE(m_registry->Get(value, key));
+        EXPECT_EQ(1, value);
+
+        EXPECT_TRUE(m_registry->Set("/O3DE/Test/Value", AZ::s64{ 2 }));
+        EXPECT_TRUE(m_registry->Get(value, key));
+        EXPECT_EQ(2, value);
+
+        EXPECT_TRUE(m_registry->Remove("/O3DE/Test/Value"));
+        EXPECT_FALSE(m_registry->Get(value, key));
+    }
+
+    TEST_F(SettingsRegistryTest, KeyHandle_InvalidPath_ReturnsFalse)
+    {
+        AZ::SettingsRegistryImpl::KeyHandle key("#$%^");
+        EXPECT_FALSE(key.IsValid());
+        bool value{};
+        EXPECT_FALSE(m_registry->Get(value, key));
+    }
+
+    TEST_F(SettingsRegistryTest, SnapshotMode_ConcurrentReadsAndWrites_ReadersSeeIncreasingValues)
+    {
+        static constexpr AZ::s64 WriteCount = 1000;
+        static constexpr size_t ReaderCount = 4;
+        EXPECT_TRUE(m_registry->Set("/O3DE/Counter", AZ::s64{ 0 }));
+        m_registry->SetSnapshotMode(true);
+
+        AZStd::atomic_bool readFailed{ false };
+        AZStd::vector<AZStd::thread> readers;
+        for (size_t readerIndex = 0; readerIndex < ReaderCount; ++readerIndex)
+        {
+            readers.emplace_back([this, &readFailed, readerIndex]()
+            {
+                AZ::SettingsRegistryImpl::KeyHandle key("/O3DE/Counter");
+                AZ::s64 lastValue = 0;
+                while (lastValue < WriteCount)
+                {
+                    AZ::s64 value{};
+                    // Alternate between reading through the key handle and the path
+                    const bool found = (readerIndex % 2 == 0) ? m_registry->Get(value, key) : m_registry->Get(value, "/O3DE/Counter");
+                    if (!found || value < lastValue)
+                    {
+                        readFailed = true;
+                        return;
+                    }
+                    lastValue = value;
+                }
+            });
+        }
+
+        for (AZ::s64 counter = 1; counter <= WriteCount; ++counter)
+        {
+            m_registry->Set("/O3DE/Counter", counter);
+        }
+        for (AZStd::thread& reader : readers)
+        {
+            reader.join();
+        }
+        EXPECT_FALSE(readFailed);
+    }
+
     //
     // Specializations::Append
     //
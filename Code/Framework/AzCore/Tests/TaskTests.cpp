@@ -9,6 +9,7 @@
 #include <AzCore/Task/TaskGraph.h>
 #include <AzCore/Task/TaskExecutor.h>
 #include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/std/parallel/thread.h>
 
 #include <AzCore/UnitTest/TestTypes.h>
 
@@ -624,6 +625,133 @@ namespace UnitTest
 
         EXPECT_EQ(3 | 0b100000, x);
     }
+
+    TEST_F(TaskGraphTestFixture, FanOutIsStolenByIdleWorkers)
+    {
+        // All successors of the root are pushed to the local deque of the worker that ran the root, so any other
+        // worker running one of them must have stolen it
+        constexpr size_t fanOut = 16;
+        AZStd::vector<AZStd::thread_id> threadIds(fanOut);
+        TaskExecutor executor{ 4 };
+
+        TaskGraph graph{ "FanOutIsStolenByIdleWorkers" };
+        auto root = graph.AddTask(
+            defaultTD,
+            []
+            {
+            });
+        for (size_t i = 0; i < fanOut; ++i)
+        {
+            auto branch = graph.AddTask(
+                defaultTD,
+                [&threadIds, i]
+                {
+                    threadIds[i] = AZStd::this_thread::get_id();
+                    AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(2));
+                });
+            root.Precedes(branch);
+        }
+
+        TaskGraphEvent ev{ "ev" };
+        graph.SubmitOnExecutor(executor, &ev);
+        ev.Wait();
+
+        size_t stolenCount = 0;
+        for (const AZStd::thread_id& threadId : threadIds)
+        {
+            stolenCount += threadId != threadIds[0] ? 1 : 0;
+        }
+        EXPECT_GT(stolenCount, 0u);
+    }
+
+    TEST_F(TaskGraphTestFixture, LargeFanOutOverflowsLocalQueue)
+    {
+        // More successors than fit in a worker's local deque, the remainder spills over into the worker's shared queue
+        constexpr int fanOut = 5000;
+        AZStd::atomic<int> x = 0;
+
+        TaskGraph graph{ "LargeFanOutOverflowsLocalQueue" };
+        auto root = graph.AddTask(
+            defaultTD,
+            []
+            {
+            });
+        for (int i = 0; i < fanOut; ++i)
+        {
+            auto branch = graph.AddTask(
+                defaultTD,
+                [&x]
+                {
+                    ++x;
+                });
+            root.Precedes(branch);
+        }
+
+        TaskGraphEvent ev{ "ev" };
+        graph.SubmitOnExecutor(*m_executor, &ev);
+        ev.Wait();
+
+        EXPECT_EQ(fanOut, x);
+    }
+
+    TEST_F(TaskGraphTestFixture, SpreadAffinity)
+    {
+        static TaskDescriptor spreadTD{ "TaskGraphTestTask", "TaskGraphTests", TaskPriority::MEDIUM, AZ::TaskAffinity::SPREAD };
+        AZStd::atomic<int> x = 0;
+
+        TaskGraph graph{ "SpreadAffinity" };
+        auto root = graph.AddTask(
+            defaultTD,
+            [&x]
+            {
+                x = 1;
+            });
+        for (int i = 0; i < 8; ++i)
+        {
+            auto branch = graph.AddTask(
+                spreadTD,
+                [&x]
+                {
+                    x += 2;
+                });
+            root.Precedes(branch);
+        }
+
+        TaskGraphEvent ev{ "ev" };
+        graph.SubmitOnExecutor(*m_executor, &ev);
+        ev.Wait();
+
+        EXPECT_EQ(17, x);
+    }
+
+    TEST_F(TaskGraphTestFixture, CpuMaskPinsTasksToWorker)
+    {
+        constexpr size_t taskCount = 16;
+        static TaskDescriptor pinnedTD{ "TaskGraphTestTask", "TaskGraphTests", TaskPriority::MEDIUM, AZ::TaskAffinity::LOCAL, 0b10 };
+        AZStd::vector<AZStd::thread_id> threadIds(taskCount);
+        TaskExecutor executor{ 4 };
+
+        TaskGraph graph{ "CpuMaskPinsTasksToWorker" };
+        for (size_t i = 0; i < taskCount; ++i)
+        {
+            graph.AddTask(
+                pinnedTD,
+                [&threadIds, i]
+                {
+                    threadIds[i] = AZStd::this_thread::get_id();
+                    AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(1));
+                });
+        }
+
+        TaskGraphEvent ev{ "ev" };
+        graph.SubmitOnExecutor(executor, &ev);
+        ev.Wait();
+
+        for (const AZStd::thread_id& threadId : threadIds)
+        {
+            EXPECT_EQ(threadIds[0], threadId);
+        }
+    }
 } // namespace UnitTest
 
 #if defined(HAVE_BENCHMARK)
@@ -739,5 +867,30 @@ namespace Benchmark
             ev.Wait();
         }
     }
+
+    BENCHMARK_F(TaskGraphBenchmarkFixture, OneToManyFanOut)(benchmark::State& state)
+    {
+        auto root = graph->AddTask(
+            descriptors[2],
+            []
+            {
+            });
+        for (int i = 0; i < 256; ++i)
+        {
+            auto branch = graph->AddTask(
+                descriptors[2],
+                []
+                {
+                });
+            root.Precedes(branch);
+        }
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            TaskGraphEvent ev{ "ev" };
+            graph->SubmitOnExecutor(*executor, &ev);
+            ev.Wait();
+        }
+    }
 } // namespace Benchmark
 #endif
@@ -7,6 +7,8 @@
  */
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/Math/Random.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/sort.h>
 #include <AzCore/UnitTest/TestTypes.h>
 
@@ -65,3 +67,171 @@ TEST_F(OrderedTickBus, OnTick_HandlersFireInSortedOrder)
     // check the order they actually fired in
     EXPECT_EQ(actualTickOrder, sortedOrder);
 }
+
+TEST_F(OrderedTickBus, DispatchTick_WithoutExecutor_HandlersFireInSortedOrder)
+{
+    AZStd::vector<int> unsortedHandlerOrder = { 3, 1, 2, 0 };
+    AZStd::vector<int> actualTickOrder;
+
+    AZStd::list<OrderedTicker> tickers;
+    for (int order : unsortedHandlerOrder)
+    {
+        OrderedTicker& ticker = tickers.emplace_back();
+        ticker.m_order = order;
+        ticker.m_targetList = &actualTickOrder;
+        ticker.TickBus::Handler::BusConnect();
+    }
+
+    DispatchTick(0.f, ScriptTimePoint{}, nullptr);
+
+    EXPECT_EQ(actualTickOrder, AZStd::vector<int>({ 0, 1, 2, 3 }));
+}
+
+// Parallel safe TickBus handler that writes to a shared counter
+struct ParallelTicker : public TickBus::Handler
+{
+    int m_order = TICK_DEFAULT;
+    AZStd::atomic_int* m_tickCount = nullptr;
+    AZStd::vector<Crc32> m_writes;
+    AZStd::vector<int>* m_writeLog = nullptr; ///< Only modified by handlers that declare a write
+    int m_id = 0;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // TickBus
+    int GetTickOrder() override { return m_order; }
+    bool IsTickParallelSafe() override { return true; }
+    ParallelTickAccess GetParallelTickAccess() override
+    {
+        ParallelTickAccess access;
+        access.m_writes = m_writes;
+        return access;
+    }
+
+    void OnTick(float /*deltaTime*/, ScriptTimePoint /*time*/) override
+    {
+        if (m_writeLog)
+        {
+            m_writeLog->push_back(m_id);
+        }
+        ++(*m_tickCount);
+    }
+    ///////////////////////////////////////////////////////////////////////////
+};
+
+// Serial handler that records how many parallel handlers ticked before it
+struct BarrierTicker : public TickBus::Handler
+{
+    int m_order = TICK_DEFAULT;
+    AZStd::atomic_int* m_tickCount = nullptr;
+    int m_observedTickCount = -1;
+
+    int GetTickOrder() override { return m_order; }
+
+    void OnTick(float /*deltaTime*/, ScriptTimePoint /*time*/) override
+    {
+        m_observedTickCount = m_tickCount->load();
+    }
+};
+
+TEST_F(OrderedTickBus, DispatchTick_ParallelHandlers_AllFinishBeforeLaterSerialHandler)
+{
+    AZ::TaskExecutor executor{ 4 };
+    AZStd::atomic_int tickCount{ 0 };
+
+    constexpr int ParallelTickerCount = 32;
+    AZStd::list<ParallelTicker> parallelTickers;
+    for (int i = 0; i < ParallelTickerCount; ++i)
+    {
+        ParallelTicker& ticker = parallelTickers.emplace_back();
+        ticker.m_order = TICK_GAME;
+        ticker.m_tickCount = &tickCount;
+        ticker.TickBus::Handler::BusConnect();
+    }
+
+    BarrierTicker barrierTicker;
+    barrierTicker.m_order = TICK_DEFAULT;
+    barrierTicker.m_tickCount = &tickCount;
+    barrierTicker.TickBus::Handler::BusConnect();
+
+    DispatchTick(0.f, ScriptTimePoint{}, &executor);
+
+    EXPECT_EQ(ParallelTickerCount, tickCount.load());
+    EXPECT_EQ(ParallelTickerCount, barrierTicker.m_observedTickCount);
+}
+
+TEST_F(OrderedTickBus, DispatchTick_ParallelHandlersWritingSameData_TickInConnectionOrder)
+{
+    AZ::TaskExecutor executor{ 4 };
+    AZStd::atomic_int tickCount{ 0 };
+    AZStd::vector<int> writeLog;
+
+    constexpr int ParallelTickerCount = 16;
+    AZStd::list<ParallelTicker> parallelTickers;
+    for (int i = 0; i < ParallelTickerCount; ++i)
+    {
+        ParallelTicker& ticker = parallelTickers.emplace_back();
+        ticker.m_tickCount = &tickCount;
+        ticker.m_id = i;
+        // Every other handler writes the log, the others run freely around them
+        if (i % 2 == 0)
+        {
+            ticker.m_writes.push_back(AZ_CRC_CE("WriteLog"));
+            ticker.m_writeLog = &writeLog;
+        }
+        ticker.TickBus::Handler::BusConnect();
+    }
+
+    DispatchTick(0.f, ScriptTimePoint{}, &executor);
+
+    EXPECT_EQ(ParallelTickerCount, tickCount.load());
+    AZStd::vector<int> expectedWriteLog;
+    for (int i = 0; i < ParallelTickerCount; i += 2)
+    {
+        expectedWriteLog.push_back(i);
+    }
+    EXPECT_EQ(expectedWriteLog, writeLog);
+}
+
+// TickBus router that counts the ticks it sees and can stop them from reaching the handlers
+struct CountingTickRouter : public TickBus::Router
+{
+    int m_tickCount = 0;
+    bool m_skipHandlers = false;
+
+    void OnTick(float /*deltaTime*/, ScriptTimePoint /*time*/) override
+    {
+        ++m_tickCount;
+        if (m_skipHandlers)
+        {
+            TickBus::SetRouterProcessingState(TickBus::RouterProcessingState::SkipListeners);
+        }
+    }
+};
+
+TEST_F(OrderedTickBus, DispatchTick_RouterConnected_RouterSeesTickBeforeHandlers)
+{
+    AZ::TaskExecutor executor{ 4 };
+    AZStd::atomic_int tickCount{ 0 };
+
+    AZStd::list<ParallelTicker> parallelTickers;
+    for (int i = 0; i < 4; ++i)
+    {
+        ParallelTicker& ticker = parallelTickers.emplace_back();
+        ticker.m_tickCount = &tickCount;
+        ticker.TickBus::Handler::BusConnect();
+    }
+
+    CountingTickRouter router;
+    router.BusRouterConnect();
+
+    DispatchTick(0.f, ScriptTimePoint{}, &executor);
+    EXPECT_EQ(1, router.m_tickCount);
+    EXPECT_EQ(4, tickCount.load());
+
+    router.m_skipHandlers = true;
+    DispatchTick(0.f, ScriptTimePoint{}, &executor);
+    EXPECT_EQ(2, router.m_tickCount);
+    EXPECT_EQ(4, tickCount.load());
+
+    router.BusRouterDisconnect();
+}
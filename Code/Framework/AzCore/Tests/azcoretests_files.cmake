@@ -81,6 +81,7 @@ set(FILES
     DLL.cpp
     DOM/DomFixtures.cpp
     DOM/DomFixtures.h
+    DOM/DomBinaryTests.cpp
     DOM/DomJsonTests.cpp
     DOM/DomJsonBenchmarks.cpp
     DOM/DomPathTests.cpp
@@ -148,6 +149,7 @@ set(FILES
     Math/ShapeIntersectionPerformanceTests.cpp
     Math/ShapeIntersectionTests.cpp
     Math/SfmtTests.cpp
+    Math/SimdBatchTests.cpp
     Math/SimdMathTests.cpp
     Math/SphereTests.cpp
     Math/RayTests.cpp
@@ -165,9 +167,11 @@ set(FILES
     Math/VectorNPerformanceTests.cpp
     Math/PackedVectorTest.cpp
     Memory/AllocatorBenchmarks.cpp
+    Memory/FrameArenaAllocator.cpp
     Memory/HphaAllocator.cpp
     Memory/HphaAllocatorErrorDetection.cpp
     Memory/LeakDetection.cpp
+    Memory/OSPageAllocator.cpp
     Memory.cpp
     Metrics/EventLoggerFactoryTests.cpp
     Metrics/EventLoggerReflectUtilsTests.cpp
@@ -230,6 +234,8 @@ set(FILES
     Serialization/Json/UnorderedSetSerializerTests.cpp
     Serialization/Json/UnsupportedTypesSerializerTests.cpp
     Serialization/Json/UuidSerializerTests.cpp
+    Serialization/MappedObjectStreamBenchmarks.cpp
+    Serialization/MappedObjectStreamTests.cpp
     Serialization.cpp
     SerializeContextFixture.h
     Settings/CommandLineTests.cpp
@@ -18,6 +18,8 @@
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/IO/SystemFile.h>
 #include <AzCore/IO/FileIO.h>
+#include <AzCore/Jobs/Algorithms.h>
+#include <AzCore/Jobs/JobContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/Utils.h>
 #include <AzCore/NativeUI/NativeUIRequests.h>
@@ -50,6 +52,9 @@ namespace AZ::IO
     AZ_CVAR(int32_t, az_archive_verbosity, 0, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
         "Sets the verbosity level for logging Archive operations\n"
         ">=1 - Turns on verbose logging of all operations");
+    AZ_CVAR(bool, az_archive_parallel_open, true, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "If enabled, the archives that match a wildcard passed to OpenPacks are opened on the job system.\n"
+        "They are still added to the list of archives in alphabetical order.");
 }
 
 namespace AZ::IO::ArchiveInternal
@@ -58,6 +63,9 @@ namespace AZ::IO::ArchiveInternal
     // to the actual index , this offset is added to get the valid handle
     static constexpr size_t PseudoFileIdxOffset = 1;
 
+    // the flags of the archives opened with OpenPack(s)
+    static constexpr int PackArchiveFlags = INestedArchive::FLAGS_OPTIMIZED_READ_ONLY | INestedArchive::FLAGS_ABSOLUTE_PATHS;
+
     struct CCachedFileRawData
     {
         void* m_pCachedData;
@@ -1161,7 +1169,7 @@ namespace AZ::IO
             }
         }
 
-        const int flags = INestedArchive::FLAGS_OPTIMIZED_READ_ONLY | INestedArchive::FLAGS_ABSOLUTE_PATHS;
+        const int flags = ArchiveInternal::PackArchiveFlags;
 
         desc.pArchive = OpenArchive(szFullPath, szBindRoot, flags, pData);
         if (!desc.pArchive)
@@ -1328,6 +1336,25 @@ namespace AZ::IO
 
             // Open files in alphabetical order.
             AZStd::sort(files.begin(), files.end());
+
+            // Reading the central directory is most of the cost of opening an archive and the archives don't depend on each
+            // other, so the archives are opened on the job system first. OpenArchive returns these archives when they're
+            // added below, so they keep being added in alphabetical order.
+            AZStd::vector<AZStd::intrusive_ptr<INestedArchive>> preopenedArchives;
+            AZ::JobContext* jobContext = AZ::JobContext::GetGlobalContext();
+            if (az_archive_parallel_open && jobContext && files.size() > 1)
+            {
+                AZ_PROFILE_SCOPE(AzCore, "Archive::OpenPacks - open archives in parallel");
+                preopenedArchives.resize(files.size());
+                AZ::parallel_for(
+                    0, aznumeric_cast<int>(files.size()),
+                    [this, &files, &preopenedArchives, szDir](int index)
+                    {
+                        preopenedArchives[index] = OpenArchive(files[index].Native(), szDir, ArchiveInternal::PackArchiveFlags);
+                    },
+                    jobContext);
+            }
+
             bool bAllOk = true;
             for (const AZ::IO::FixedMaxPath& file : files)
             {
@@ -10,6 +10,7 @@
 #include <AzCore/Console/Console.h>
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/Math/Crc.h>
+#include <AzCore/std/sort.h>
 #include <AzCore/std/string/conversions.h>
 
 #include <AzFramework/Archive/ZipFileFormat.h>
@@ -93,6 +94,7 @@ namespace AZ::IO::ZipDir
             auto pathIt = m_pCache->m_relativePathPool.emplace(AZ::IO::PathView(szRelativePath, AZ::IO::PosixPathSeparator).LexicallyNormal());
             m_szRelativePath = *pathIt.first;
             // this is the name of the directory - create it or find it
+            m_pCache->InvalidateLookupTable();
             m_pFileEntry = m_pCache->GetRoot()->Add(m_szRelativePath.Native());
             if (m_pFileEntry && az_archive_zip_directory_cache_verbosity)
             {
@@ -150,7 +152,9 @@ namespace AZ::IO::ZipDir
                 m_fileHandle = AZ::IO::InvalidHandle;
             }
         }
+        InvalidateLookupTable();
         m_treeDir.Clear();
+        m_mappedFile.Close();
     }
 
     bool Cache::WriteCompressedData(uint8_t* data, size_t size, bool)
@@ -581,6 +585,7 @@ namespace AZ::IO::ZipDir
         ErrorEnum e = pDir->RemoveFile(fileName);
         if (e == ZD_ERROR_SUCCESS)
         {
+            InvalidateLookupTable();
             m_nFlags |= FLAGS_UNCOMPACTED | FLAGS_CDR_DIRTY;
 
             if (az_archive_zip_directory_cache_verbosity)
@@ -622,6 +627,7 @@ namespace AZ::IO::ZipDir
         ErrorEnum e = pDir->RemoveDir(dirName);
         if (e == ZD_ERROR_SUCCESS)
         {
+            InvalidateLookupTable();
             m_nFlags |= FLAGS_UNCOMPACTED | FLAGS_CDR_DIRTY;
 
             if (az_archive_zip_directory_cache_verbosity)
@@ -639,6 +645,7 @@ namespace AZ::IO::ZipDir
         ErrorEnum e = m_treeDir.RemoveAll();
         if (e == ZD_ERROR_SUCCESS)
         {
+            InvalidateLookupTable();
             m_nFlags |= FLAGS_UNCOMPACTED | FLAGS_CDR_DIRTY;
         }
         return e;
@@ -735,8 +742,18 @@ namespace AZ::IO::ZipDir
     {
         AZ::IO::PathView szPath{ szPathSrc };
 
-        ZipDir::FindFile fd(GetRoot());
-        FileEntry* fileEntry = fd.FindExact(szPath);
+        FileEntry* fileEntry;
+        if (m_nFlags & FLAGS_READ_ONLY)
+        {
+            // Read-only caches don't change after they're opened, so they can use the lookup table
+            BuildLookupTable();
+            fileEntry = FindFileInLookupTable(szPath);
+        }
+        else
+        {
+            ZipDir::FindFile fd(GetRoot());
+            fileEntry = fd.FindExact(szPath);
+        }
         if (!fileEntry)
         {
             if (az_archive_zip_directory_cache_verbosity)
@@ -748,6 +765,99 @@ namespace AZ::IO::ZipDir
         return fileEntry;
     }
 
+    void Cache::BuildLookupTable()
+    {
+        if (m_lookupTableBuilt.load(AZStd::memory_order_acquire))
+        {
+            return;
+        }
+
+        AZStd::scoped_lock lock(m_lookupTableMutex);
+        if (m_lookupTableBuilt.load(AZStd::memory_order_relaxed))
+        {
+            return;
+        }
+
+        m_lookupTable.clear();
+        m_lookupPaths.clear();
+        m_lookupTable.reserve(m_treeDir.NumFilesTotal());
+        AZ::IO::FixedMaxPath dirPath;
+        AddToLookupTable(m_treeDir, dirPath);
+        AZStd::sort(m_lookupTable.begin(), m_lookupTable.end(),
+            [](const LookupEntry& lhs, const LookupEntry& rhs)
+            {
+                return lhs.m_hash < rhs.m_hash;
+            });
+
+        m_lookupTableBuilt.store(true, AZStd::memory_order_release);
+    }
+
+    void Cache::AddToLookupTable(FileEntryTree& dir, AZ::IO::FixedMaxPath& dirPath)
+    {
+        const size_t dirPathLength = dirPath.Native().size();
+        for (auto it = dir.GetFileBegin(); it != dir.GetFileEnd(); ++it)
+        {
+            dirPath /= it->first;
+            const AZStd::string_view filePath = dirPath.Native();
+
+            LookupEntry& entry = m_lookupTable.emplace_back();
+            entry.m_hash = HashPath(dirPath);
+            entry.m_pathOffset = aznumeric_cast<AZ::u32>(m_lookupPaths.size());
+            entry.m_pathLength = aznumeric_cast<AZ::u32>(filePath.size());
+            entry.m_fileEntry = it->second.get();
+            m_lookupPaths.insert(m_lookupPaths.end(), filePath.begin(), filePath.end());
+
+            dirPath.Native().resize(dirPathLength);
+        }
+
+        for (auto it = dir.GetDirBegin(); it != dir.GetDirEnd(); ++it)
+        {
+            dirPath /= it->first;
+            AddToLookupTable(*it->second, dirPath);
+            dirPath.Native().resize(dirPathLength);
+        }
+    }
+
+    void Cache::InvalidateLookupTable()
+    {
+        AZStd::scoped_lock lock(m_lookupTableMutex);
+        m_lookupTableBuilt.store(false, AZStd::memory_order_release);
+        m_lookupTable = {};
+        m_lookupPaths = {};
+    }
+
+    FileEntry* Cache::FindFileInLookupTable(AZ::IO::PathView szPath) const
+    {
+        const AZ::u32 hash = HashPath(szPath);
+        auto it = AZStd::lower_bound(m_lookupTable.begin(), m_lookupTable.end(), hash,
+            [](const LookupEntry& entry, AZ::u32 value)
+            {
+                return entry.m_hash < value;
+            });
+        for (; it != m_lookupTable.end() && it->m_hash == hash; ++it)
+        {
+            const AZStd::string_view entryPath(m_lookupPaths.data() + it->m_pathOffset, it->m_pathLength);
+            if (AZ::IO::PathView(entryPath) == szPath)
+            {
+                return it->m_fileEntry;
+            }
+        }
+        return nullptr;
+    }
+
+    AZ::u32 Cache::HashPath(AZ::IO::PathView szPath)
+    {
+        AZ::Crc32 hash;
+        for (const AZ::IO::PathView& segment : szPath)
+        {
+            const AZStd::string_view segmentName = segment.Native();
+            hash.Add(segmentName.data(), segmentName.size(), true);
+            // separate the segments so "ab/c" and "a/bc" don't hash the same
+            hash.Add("/", 1);
+        }
+        return hash;
+    }
+
     // refreshes information about the given file entry into this file entry
     ErrorEnum Cache::Refresh(FileEntryBase* pFileEntry)
     {
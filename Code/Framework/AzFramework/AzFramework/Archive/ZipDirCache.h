@@ -16,9 +16,12 @@
 #pragma once
 
 #include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/MappedFile.h>
 #include <AzCore/IO/Path/Path.h>
 #include <AzCore/Memory/PoolAllocator.h>
 #include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/smart_ptr/intrusive_base.h>
 #include <AzFramework/Archive/Codec.h>
 #include <AzFramework/Archive/ZipDirStructures.h>
@@ -128,6 +131,15 @@ namespace AZ::IO::ZipDir
 
         size_t GetCompressedSizeEstimate(size_t uncompressedSize, CompressionCodec::Codec codec);
 
+        // builds the lookup table from the tree, if it hasn't been built yet
+        void BuildLookupTable();
+        void AddToLookupTable(FileEntryTree& dir, AZ::IO::FixedMaxPath& dirPath);
+        // the lookup table needs to be rebuilt after the tree changes
+        void InvalidateLookupTable();
+        FileEntry* FindFileInLookupTable(AZ::IO::PathView szPath) const;
+        // case insensitive hash of the segments of the path, so it matches the path comparison on every platform
+        static AZ::u32 HashPath(AZ::IO::PathView szPath);
+
     protected:
         friend class CacheFactory;
         friend class FileEntryTransactionAdd;
@@ -158,6 +170,23 @@ namespace AZ::IO::ZipDir
 
         // CDR buffer.
         AZStd::vector<uint8_t> m_CDR_buffer;
+        // Read-only caches that were opened from disk map the archive instead of copying the CDR into m_CDR_buffer.
+        // The names in the tree point into the mapping, so it's released after the tree.
+        AZ::IO::MappedFile m_mappedFile;
+
+        // Flat table sorted by path hash, built on the first lookup in a read-only cache,
+        // so finding a file is a binary search instead of a walk through the tree.
+        struct LookupEntry
+        {
+            AZ::u32 m_hash;
+            AZ::u32 m_pathOffset; // offset of the relative path in m_lookupPaths
+            AZ::u32 m_pathLength;
+            FileEntry* m_fileEntry;
+        };
+        AZStd::vector<LookupEntry> m_lookupTable;
+        AZStd::vector<char> m_lookupPaths;
+        AZStd::atomic_bool m_lookupTableBuilt{ false };
+        AZStd::mutex m_lookupTableMutex;
 
         ZipFile::EHeaderEncryptionType m_encryptedHeaders = ZipFile::HEADERS_NOT_ENCRYPTED;
         ZipFile::EHeaderSignatureType m_signedHeaders;
@@ -29,6 +29,11 @@ namespace AZ::IO::ZipDir
     // this sets the window size of the blocks of data read from the end of the file to find the Central Directory Record
     // since normally there are no
     static constexpr size_t CDRSearchWindowSize = 0x100;
+
+    AZ_CVAR(bool, az_archive_zip_directory_cache_map_files, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "If enabled, read-only archives are memory mapped while their central directory is read,\n"
+        "and the central directory stays mapped for as long as the archive is open.");
+
     CacheFactory::CacheFactory(InitMethod nInitMethod, uint32_t nFlags)
     {
         m_nCDREndPos = 0;
@@ -84,6 +89,12 @@ namespace AZ::IO::ZipDir
                 AZ_Warning("Archive", false, R"(ZD_ERROR_IO_FAILED: Could not open file "%s" in binary mode for reading)", szFileName);
                 return {};
             }
+            if (az_archive_zip_directory_cache_map_files && !(m_nFlags & FLAGS_READ_INSIDE_PAK))
+            {
+                // falls back to reading through the file handle if the file can't be mapped
+                m_mappedFile.Open(szFileName);
+                m_mappedFilePos = 0;
+            }
             if (!ReadCache(*pCache))
             {
                 AZ_Warning("Archive", false, R"(ZD_ERROR_IO_FAILED: Could not read the CDR of the pack file "%s".)", pCache->m_strFilePath.c_str());
@@ -165,6 +176,7 @@ namespace AZ::IO::ZipDir
 
         m_treeFileEntries.Swap(rwCache.m_treeDir);
         m_CDR_buffer.swap(rwCache.m_CDR_buffer);   // CDR Buffer contain actually the string pool for the tree directory.
+        rwCache.m_mappedFile = AZStd::move(m_mappedFile); // or the mapping, if the CDR was parsed in place
 
         // very important: we need this offset to be able to add to the zip file
         rwCache.m_lCDROffset = m_CDREnd.lCDROffset;
@@ -313,6 +325,7 @@ namespace AZ::IO::ZipDir
         memset(&m_CDREnd, 0, sizeof(m_CDREnd));
         m_mapFileEntries.clear();
         m_treeFileEntries.Clear();
+        m_mappedFile.Close();
         m_encryptedHeaders = ZipFile::HEADERS_NOT_ENCRYPTED;
     }
 
@@ -455,25 +468,41 @@ namespace AZ::IO::ZipDir
             return true;
         }
 
-        auto& pBuffer = m_CDR_buffer; // Use persistent buffer.
-
-        pBuffer.resize(m_CDREnd.lCDRSize + 16); // Allocate some more because we use this memory as a strings pool.
-
-        if (pBuffer.empty()) // couldn't allocate enough memory for temporary copy of CDR
+        uint8_t* pCDR = nullptr;
+        if (m_mappedFile.IsOpen())
         {
-            AZ_Warning("Archive", false, "ZD_ERROR_NO_MEMORY: Not enough memory to cache Central Directory record for fast initialization. This error may not happen on non-console systems");
-            return false;
+            // The CDR is used in place as the strings pool. The mapping is private, so terminating the names
+            // only copies the pages of the CDR and doesn't change the file.
+            if (!ValidateHeaderData())
+            {
+                AZ_Warning("Archive", false, "ZD_ERROR_CORRUPTED_DATA: Archive contains corrupted CDR.");
+                return false;
+            }
+            pCDR = reinterpret_cast<uint8_t*>(m_mappedFile.GetData().data()) + m_CDREnd.lCDROffset;
         }
-
-        if (!ReadHeaderData(&pBuffer[0], m_CDREnd.lCDRSize))
+        else
         {
-            AZ_Warning("Archive", false, "ZD_ERROR_CORRUPTED_DATA: Archive contains corrupted CDR.");
-            return false;
+            auto& pBuffer = m_CDR_buffer; // Use persistent buffer.
+
+            pBuffer.resize(m_CDREnd.lCDRSize + 16); // Allocate some more because we use this memory as a strings pool.
+
+            if (pBuffer.empty()) // couldn't allocate enough memory for temporary copy of CDR
+            {
+                AZ_Warning("Archive", false, "ZD_ERROR_NO_MEMORY: Not enough memory to cache Central Directory record for fast initialization. This error may not happen on non-console systems");
+                return false;
+            }
+
+            if (!ReadHeaderData(&pBuffer[0], m_CDREnd.lCDRSize))
+            {
+                AZ_Warning("Archive", false, "ZD_ERROR_CORRUPTED_DATA: Archive contains corrupted CDR.");
+                return false;
+            }
+            pCDR = &pBuffer[0];
         }
 
         // now we've read the complete CDR - parse it.
-        ZipFile::CDRFileHeader* pFile = (ZipFile::CDRFileHeader*)(&pBuffer[0]);
-        const uint8_t* pEndOfData = &pBuffer[0] + m_CDREnd.lCDRSize;
+        ZipFile::CDRFileHeader* pFile = (ZipFile::CDRFileHeader*)(pCDR);
+        const uint8_t* pEndOfData = pCDR + m_CDREnd.lCDRSize;
         uint8_t* pFileName;
 
         while ((pFileName = (uint8_t*)(pFile + 1)) <= pEndOfData)
@@ -673,6 +702,28 @@ namespace AZ::IO::ZipDir
     // seeks in the file relative to the starting position
     void CacheFactory::Seek(uint32_t nPos, int nOrigin) // throw
     {
+        if (m_mappedFile.IsOpen())
+        {
+            const size_t mappedSize = m_mappedFile.GetData().size();
+            size_t newPos = nPos;
+            if (nOrigin == SEEK_CUR)
+            {
+                newPos += m_mappedFilePos;
+            }
+            else if (nOrigin == SEEK_END)
+            {
+                newPos += mappedSize;
+            }
+
+            if (newPos > mappedSize)
+            {
+                AZ_Warning("Archive", false, "ZD_ERROR_IO_FAILED: Cannot seek beyond the end of the mapped archive.");
+                return;
+            }
+            m_mappedFilePos = newPos;
+            return;
+        }
+
         if (FSeek(&m_fileExt, nPos, nOrigin))
         {
             AZ_Warning("Archive", false, "ZD_ERROR_IO_FAILED: Cannot fseek() to the new position in the file. This is unexpected error and should not happen under any circumstances. Perhaps some network or disk failure error has caused this");
@@ -682,6 +733,11 @@ namespace AZ::IO::ZipDir
 
     int64_t CacheFactory::Tell() // throw
     {
+        if (m_mappedFile.IsOpen())
+        {
+            return aznumeric_cast<int64_t>(m_mappedFilePos);
+        }
+
         int64_t nPos = FTell(&m_fileExt);
         if (nPos == -1)
         {
@@ -693,6 +749,19 @@ namespace AZ::IO::ZipDir
 
     bool CacheFactory::Read(void* pDest, uint32_t nSize) // throw
     {
+        if (m_mappedFile.IsOpen())
+        {
+            AZStd::span<const AZStd::byte> data = m_mappedFile.GetData();
+            if (nSize > data.size() - m_mappedFilePos)
+            {
+                AZ_Warning("Archive", false, "ZD_ERROR_IO_FAILED: Cannot read beyond the end of the mapped archive");
+                return false;
+            }
+            memcpy(pDest, data.data() + m_mappedFilePos, nSize);
+            m_mappedFilePos += nSize;
+            return true;
+        }
+
         if (FRead(&m_fileExt, pDest, nSize, 1) != 1)
         {
             AZ_Warning("Archive", false, "ZD_ERROR_IO_FAILED: Cannot fread() a portion of data from archive");
@@ -708,6 +777,11 @@ namespace AZ::IO::ZipDir
             return false;
         }
 
+        return ValidateHeaderData();
+    }
+
+    bool CacheFactory::ValidateHeaderData()
+    {
         switch (m_encryptedHeaders)
         {
         case ZipFile::HEADERS_NOT_ENCRYPTED:
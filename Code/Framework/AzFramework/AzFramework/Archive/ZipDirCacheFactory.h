@@ -12,6 +12,7 @@
 
 #pragma once
 
+#include <AzCore/IO/MappedFile.h>
 #include <AzFramework/Archive/IArchive.h>
 #include <AzFramework/AzFrameworkAPI.h>
 
@@ -76,6 +77,8 @@ namespace AZ::IO::ZipDir
         int64_t Tell(); // throw
         bool Read(void* pDest, uint32_t nSize); // throw
         bool ReadHeaderData(void* pDest, uint32_t nSize); // throw
+        // checks that the header data can be used with the encryption and signing of the archive
+        bool ValidateHeaderData();
 
 
     protected:
@@ -99,6 +102,11 @@ namespace AZ::IO::ZipDir
 
         AZStd::vector<uint8_t> m_CDR_buffer;
 
+        // Read-only archives on disk are mapped, so the headers are read without a file operation per entry
+        // and the CDR is parsed in place instead of being copied into m_CDR_buffer.
+        AZ::IO::MappedFile m_mappedFile;
+        size_t m_mappedFilePos = 0;
+
         bool m_bBuildFileEntryMap;
         bool m_bBuildFileEntryTree;
         bool m_bBuildOptimizedFileEntry;
@@ -12,6 +12,7 @@
 #include <AzFramework/Asset/CustomAssetTypeComponent.h>
 #include <AzFramework/Asset/AssetSystemComponent.h>
 #include <AzFramework/Components/TransformComponent.h>
+#include <AzFramework/Components/TransformHierarchySystemComponent.h>
 #include <AzFramework/Components/NonUniformScaleComponent.h>
 #include <AzFramework/Components/AzFrameworkConfigurationSystemComponent.h>
 #include <AzFramework/Device/DeviceAttributesSystemComponent.h>
@@ -42,6 +43,7 @@ namespace AzFramework
             AzFramework::CustomAssetTypeComponent::CreateDescriptor(),
             AzFramework::FileTag::ExcludeFileComponent::CreateDescriptor(),
             AzFramework::TransformComponent::CreateDescriptor(),
+            AzFramework::TransformHierarchySystemComponent::CreateDescriptor(),
             AzFramework::NonUniformScaleComponent::CreateDescriptor(),
             AzFramework::GameEntityContextComponent::CreateDescriptor(),
             AzFramework::RenderGeometry::GameIntersectorComponent::CreateDescriptor(),
@@ -71,6 +73,7 @@ namespace AzFramework
         return AZ::ComponentTypeList
         {
             azrtti_typeid<AzFramework::OctreeSystemComponent>(),
+            azrtti_typeid<AzFramework::TransformHierarchySystemComponent>(),
             azrtti_typeid<AzFramework::QualitySystemComponent>(),
             azrtti_typeid<AzFramework::DeviceAttributesSystemComponent>(),
         };
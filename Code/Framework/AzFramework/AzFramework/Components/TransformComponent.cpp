@@ -12,6 +12,7 @@
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Component/Entity.h>
 #include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/Math/Transform.h>
 #include <AzCore/Math/Quaternion.h>
@@ -80,6 +81,10 @@ namespace AZ
 
 namespace AzFramework
 {
+    AZ_CVAR(bool, bg_transformHierarchyBatchUpdate, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "If enabled, transforms that are activated register with the TransformHierarchy, which updates the children of moved "
+        "transforms once per tick in depth order instead of through the TransformNotificationBus.");
+
     bool TransformComponentVersionConverter(AZ::SerializeContext& context, AZ::SerializeContext::DataElementNode& classElement)
     {
         if (classElement.GetVersion() < 3)
@@ -156,6 +161,17 @@ namespace AzFramework
         AZ::TransformBus::Handler::BusConnect(m_entity->GetId());
         AZ::TransformNotificationBus::Bind(m_notificationBus, m_entity->GetId());
 
+        if (bg_transformHierarchyBatchUpdate)
+        {
+            m_hierarchy = AZ::Interface<TransformHierarchy>::Get();
+            if (m_hierarchy)
+            {
+                m_hierarchyNode = m_hierarchy->AddNode(*this, m_localTM, m_worldTM);
+                m_hierarchy->SetKeepWorldTMOnParentChange(
+                    m_hierarchyNode, m_onParentChangedBehavior == AZ::OnParentChangedBehavior::DoNotUpdate);
+            }
+        }
+
         const bool keepWorldTm = (m_parentActivationTransformMode == ParentActivationTransformMode::MaintainCurrentWorldTransform || !m_parentId.IsValid());
         SetParentImpl(m_parentId, keepWorldTm);
     }
@@ -177,6 +193,12 @@ namespace AzFramework
             AZ::EntityBus::Handler::BusDisconnect();
         }
         AZ::TransformBus::Handler::BusDisconnect();
+
+        if (m_hierarchy)
+        {
+            m_hierarchy->RemoveNode(m_hierarchyNode);
+            DetachFromHierarchy();
+        }
     }
 
     void TransformComponent::BindTransformChangedEventHandler(AZ::TransformChangedEvent::Handler& handler)
@@ -478,6 +500,11 @@ namespace AzFramework
     void TransformComponent::SetOnParentChangedBehavior(AZ::OnParentChangedBehavior onParentChangedBehavior)
     {
         m_onParentChangedBehavior = onParentChangedBehavior;
+        if (m_hierarchy)
+        {
+            m_hierarchy->SetKeepWorldTMOnParentChange(
+                m_hierarchyNode, m_onParentChangedBehavior == AZ::OnParentChangedBehavior::DoNotUpdate);
+        }
     }
 
     void TransformComponent::OnTransformChanged(const AZ::Transform& parentLocalTM, const AZ::Transform& parentWorldTM)
@@ -529,6 +556,8 @@ namespace AzFramework
                 "Entity '%s' %s has static transform, but parent has non-static transform. This may lead to unexpected movement.",
                 GetEntity()->GetName().c_str(), GetEntityId().ToString().c_str());
 
+            UpdateHierarchyParent();
+
             if (m_onNewParentKeepWorldTM)
             {
                 ComputeLocalTM();
@@ -545,6 +574,7 @@ namespace AzFramework
         AZ_Assert(parentEntityId == m_parentId, "We expect to receive notifications only from the current parent!");
         m_parentTM = nullptr;
         m_parentActive = false;
+        UpdateHierarchyParent();
         ComputeLocalTM();
     }
 
@@ -566,6 +596,13 @@ namespace AzFramework
         }
 
         m_parentId = parentId;
+        if (m_hierarchyParentNode != TransformHierarchy::InvalidNode)
+        {
+            // Linked again in OnEntityActivated once the new parent is active.
+            m_hierarchyParentNode = TransformHierarchy::InvalidNode;
+            m_hierarchy->SetParent(m_hierarchyNode, m_hierarchyParentNode);
+        }
+
         if (m_parentId.IsValid())
         {
             AZ::ComponentApplicationRequests* componentApplication = AZ::Interface<AZ::ComponentApplicationRequests>::Get();
@@ -636,7 +673,8 @@ namespace AzFramework
     {
         // Called when our parent transform changes
         // Ignore the event until we've already derived our local transform.
-        if (m_parentTM)
+        // If the parent is part of the same hierarchy, the hierarchy updates this transform instead.
+        if (m_parentTM && m_hierarchyParentNode == TransformHierarchy::InvalidNode)
         {
             if (m_onParentChangedBehavior == AZ::OnParentChangedBehavior::Update)
             {
@@ -644,6 +682,7 @@ namespace AzFramework
                 AZ::TransformNotificationBus::Event(
                     m_notificationBus, &AZ::TransformNotificationBus::Events::OnTransformChanged, m_localTM, m_worldTM);
                 m_transformChangedEvent.Signal(m_localTM, m_worldTM);
+                UpdateHierarchyTransforms();
             }
             else
             {
@@ -652,6 +691,7 @@ namespace AzFramework
                 // transform has not changed, and with this OnParentChangedBehavior setting the expectation is that
                 // another system will update our transform, and the notification will be triggered then.
                 m_localTM = parentWorldTM.GetInverse() * m_worldTM;
+                UpdateHierarchyTransforms();
             }
         }
     }
@@ -667,9 +707,8 @@ namespace AzFramework
             m_localTM = m_worldTM;
         }
 
-        AZ::TransformNotificationBus::Event(
-            m_notificationBus, &AZ::TransformNotificationBus::Events::OnTransformChanged, m_localTM, m_worldTM);
-        m_transformChangedEvent.Signal(m_localTM, m_worldTM);
+        UpdateHierarchyTransforms();
+        NotifyTransformChanged();
 
         AzFramework::IEntityBoundsUnion* boundsUnion = AZ::Interface<AzFramework::IEntityBoundsUnion>::Get();
         if (boundsUnion != nullptr)
@@ -689,11 +728,50 @@ namespace AzFramework
             m_worldTM = m_localTM;
         }
 
+        UpdateHierarchyTransforms();
+        NotifyTransformChanged();
+    }
+
+    void TransformComponent::NotifyTransformChanged()
+    {
         AZ::TransformNotificationBus::Event(
             m_notificationBus, &AZ::TransformNotificationBus::Events::OnTransformChanged, m_localTM, m_worldTM);
         m_transformChangedEvent.Signal(m_localTM, m_worldTM);
     }
 
+    void TransformComponent::UpdateHierarchyParent()
+    {
+        if (!m_hierarchy)
+        {
+            return;
+        }
+
+        m_hierarchyParentNode = TransformHierarchy::InvalidNode;
+        if (auto* parentComponent = azrtti_cast<TransformComponent*>(m_parentTM))
+        {
+            if (parentComponent->m_hierarchy == m_hierarchy)
+            {
+                m_hierarchyParentNode = parentComponent->m_hierarchyNode;
+            }
+        }
+        m_hierarchy->SetParent(m_hierarchyNode, m_hierarchyParentNode);
+    }
+
+    void TransformComponent::UpdateHierarchyTransforms()
+    {
+        if (m_hierarchy)
+        {
+            m_hierarchy->SetTransforms(m_hierarchyNode, m_localTM, m_worldTM);
+        }
+    }
+
+    void TransformComponent::DetachFromHierarchy()
+    {
+        m_hierarchy = nullptr;
+        m_hierarchyNode = TransformHierarchy::InvalidNode;
+        m_hierarchyParentNode = TransformHierarchy::InvalidNode;
+    }
+
     bool TransformComponent::AreMoveRequestsAllowed() const
     {
         // Don't allow static transform to be moved while entity is activated.
@@ -14,6 +14,7 @@
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/EBus/Event.h>
 #include <AzFramework/AzFrameworkAPI.h>
+#include <AzFramework/Components/TransformHierarchy.h>
 
 namespace AzToolsFramework
 {
@@ -42,6 +43,7 @@ namespace AzFramework
         AZ_COMPONENT(TransformComponent, AZ::TransformComponentTypeId, AZ::TransformInterface);
 
         friend class AzToolsFramework::Components::TransformComponent;
+        friend class TransformHierarchy;
 
         using ParentActivationTransformMode = AZ::TransformConfig::ParentActivationTransformMode;
 
@@ -163,6 +165,18 @@ namespace AzFramework
         void ComputeWorldTM();
         //////////////////////////////////////////////////////////////////////////
 
+        //! Methods implementing the batched update through the TransformHierarchy.
+        //! @{
+        //! Sends the transform changed notifications for the current transforms.
+        void NotifyTransformChanged();
+        //! Links the node of this transform to the node of the parent if the parent is part of the same hierarchy.
+        void UpdateHierarchyParent();
+        //! Stores the current transforms in the hierarchy so the children are updated on the next update of the hierarchy.
+        void UpdateHierarchyTransforms();
+        //! Called by the hierarchy when it's destroyed while this transform is still registered.
+        void DetachFromHierarchy();
+        //! @}
+
         //! Returns whether external calls are currently allowed to move the transform.
         bool AreMoveRequestsAllowed() const;
 
@@ -191,5 +205,9 @@ namespace AzFramework
         bool m_isStatic = false; ///< If true, the transform is static and doesn't move while entity is active.
         /// Behavior for this entity's transform when its parent's transform changes.
         AZ::OnParentChangedBehavior m_onParentChangedBehavior = AZ::OnParentChangedBehavior::Update;
+
+        TransformHierarchy* m_hierarchy = nullptr; ///< If set, the children in the hierarchy are updated by the hierarchy.
+        TransformHierarchy::NodeId m_hierarchyNode = TransformHierarchy::InvalidNode;
+        TransformHierarchy::NodeId m_hierarchyParentNode = TransformHierarchy::InvalidNode; ///< Set if the parent is in the same hierarchy.
     };
 }   // namespace AZ
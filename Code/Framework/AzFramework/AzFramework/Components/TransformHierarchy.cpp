@@ -0,0 +1,378 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Jobs/Algorithms.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/std/algorithm.h>
+#include <AzFramework/Components/TransformComponent.h>
+#include <AzFramework/Components/TransformHierarchy.h>
+
+AZ_DECLARE_BUDGET(AzFramework);
+
+namespace AzFramework
+{
+    AZ_CVAR(uint32_t, bg_transformHierarchyParallelMinNodes, 2048, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "The minimum number of transforms at a single depth of the transform hierarchy before the update of that depth is "
+        "split over the job system. 0 disables the parallel update.");
+
+    namespace
+    {
+        //! The number of transforms updated by a single job.
+        constexpr uint32_t SlotsPerJob = 512;
+
+        template<typename T>
+        void ApplySlotOrder(AZStd::vector<T>& values, const AZStd::vector<uint32_t>& newSlots, uint32_t newSlotCount)
+        {
+            AZStd::vector<T> sorted(newSlotCount);
+            for (size_t slot = 0; slot < newSlots.size(); ++slot)
+            {
+                if (newSlots[slot] != AZStd::numeric_limits<uint32_t>::max())
+                {
+                    sorted[newSlots[slot]] = AZStd::move(values[slot]);
+                }
+            }
+            values.swap(sorted);
+        }
+    } // namespace
+
+    TransformHierarchy::~TransformHierarchy()
+    {
+        for (size_t slot = 0; slot < m_components.size(); ++slot)
+        {
+            if (m_components[slot] && (m_flags[slot] & Removed) == 0)
+            {
+                m_components[slot]->DetachFromHierarchy();
+            }
+        }
+    }
+
+    auto TransformHierarchy::AddNode(TransformComponent& component, const AZ::Transform& localTM, const AZ::Transform& worldTM)
+        -> NodeId
+    {
+        NodeId node;
+        if (!m_freeNodes.empty())
+        {
+            node = m_freeNodes.back();
+            m_freeNodes.pop_back();
+        }
+        else
+        {
+            node = aznumeric_cast<NodeId>(m_nodeSlots.size());
+            m_nodeSlots.push_back(InvalidSlot);
+        }
+
+        m_nodeSlots[node] = aznumeric_cast<uint32_t>(m_flags.size());
+        m_localTMs.push_back(localTM);
+        m_worldTMs.push_back(worldTM);
+        m_parentSlots.push_back(InvalidSlot);
+        m_parentNodes.push_back(InvalidNode);
+        m_slotNodes.push_back(node);
+        m_flags.push_back(0);
+        m_components.push_back(&component);
+
+        ++m_nodeCount;
+        // New nodes are at depth 0 until the next sort.
+        m_isSorted = false;
+        return node;
+    }
+
+    void TransformHierarchy::RemoveNode(NodeId node)
+    {
+        const uint32_t slot = m_nodeSlots[node];
+        AZ_Assert(slot != InvalidSlot && (m_flags[slot] & Removed) == 0, "Transform hierarchy node %u has already been removed.", node);
+
+        // The slot is kept until the next sort so the order of the slots doesn't change while notifications are sent.
+        m_flags[slot] = Removed;
+        m_components[slot] = nullptr;
+        --m_nodeCount;
+        m_isSorted = false;
+    }
+
+    void TransformHierarchy::SetParent(NodeId node, NodeId parent)
+    {
+        const uint32_t slot = m_nodeSlots[node];
+        if (m_parentNodes[slot] != parent)
+        {
+            m_parentNodes[slot] = parent;
+            m_isSorted = false;
+        }
+    }
+
+    void TransformHierarchy::SetTransforms(NodeId node, const AZ::Transform& localTM, const AZ::Transform& worldTM)
+    {
+        const uint32_t slot = m_nodeSlots[node];
+        m_localTMs[slot] = localTM;
+        m_worldTMs[slot] = worldTM;
+        m_flags[slot] |= Moved;
+        m_hasChanges = true;
+    }
+
+    void TransformHierarchy::SetKeepWorldTMOnParentChange(NodeId node, bool keepWorldTM)
+    {
+        const uint32_t slot = m_nodeSlots[node];
+        m_flags[slot] = keepWorldTM ? (m_flags[slot] | KeepWorldTM) : (m_flags[slot] & ~KeepWorldTM);
+    }
+
+    void TransformHierarchy::Update()
+    {
+        // Notification handlers that move transforms are picked up by the next update.
+        if (!m_hasChanges || m_isUpdating)
+        {
+            return;
+        }
+
+        AZ_PROFILE_FUNCTION(AzFramework);
+        m_isUpdating = true;
+
+        if (!m_isSorted)
+        {
+            SortByDepth();
+        }
+
+        // Every depth only reads from the previous depths, so all transforms at a single depth can be updated in parallel.
+        AZ::JobContext* jobContext = AZ::JobContext::GetGlobalContext();
+        const uint32_t parallelMinNodes = bg_transformHierarchyParallelMinNodes;
+        for (size_t depth = 0; depth + 1 < m_depthOffsets.size(); ++depth)
+        {
+            const uint32_t begin = m_depthOffsets[depth];
+            const uint32_t end = m_depthOffsets[depth + 1];
+            if (jobContext && parallelMinNodes > 0 && end - begin >= parallelMinNodes)
+            {
+                const int jobCount = aznumeric_cast<int>((end - begin + SlotsPerJob - 1) / SlotsPerJob);
+                AZ::parallel_for(
+                    0, jobCount,
+                    [this, begin, end](int job)
+                    {
+                        const uint32_t jobBegin = begin + aznumeric_cast<uint32_t>(job) * SlotsPerJob;
+                        UpdateSlots(jobBegin, AZStd::min(jobBegin + SlotsPerJob, end));
+                    },
+                    jobContext);
+            }
+            else
+            {
+                UpdateSlots(begin, end);
+            }
+        }
+
+        m_hasChanges = false;
+        SendNotifications();
+        m_isUpdating = false;
+    }
+
+    size_t TransformHierarchy::GetNodeCount() const
+    {
+        return m_nodeCount;
+    }
+
+    size_t TransformHierarchy::GetDepthCount() const
+    {
+        return m_depthOffsets.empty() ? 0 : m_depthOffsets.size() - 1;
+    }
+
+    void TransformHierarchy::SortByDepth()
+    {
+        AZ_PROFILE_FUNCTION(AzFramework);
+
+        const uint32_t slotCount = aznumeric_cast<uint32_t>(m_flags.size());
+
+        // Resolve the parent nodes to slots. Nodes with a parent that was removed become root nodes.
+        for (uint32_t slot = 0; slot < slotCount; ++slot)
+        {
+            m_parentSlots[slot] = InvalidSlot;
+            if ((m_flags[slot] & Removed) == 0 && m_parentNodes[slot] != InvalidNode)
+            {
+                const uint32_t parentSlot = m_nodeSlots[m_parentNodes[slot]];
+                if (parentSlot != InvalidSlot && (m_flags[parentSlot] & Removed) == 0)
+                {
+                    m_parentSlots[slot] = parentSlot;
+                }
+                else
+                {
+                    m_parentNodes[slot] = InvalidNode;
+                }
+            }
+        }
+
+        // Calculate the depth of every slot by walking up to the first ancestor with a known depth.
+        constexpr uint32_t UnknownDepth = InvalidSlot;
+        constexpr uint32_t VisitingDepth = InvalidSlot - 1;
+        AZStd::vector<uint32_t> depths(slotCount, UnknownDepth);
+        AZStd::vector<uint32_t> chain;
+        uint32_t depthCount = 0;
+        for (uint32_t slot = 0; slot < slotCount; ++slot)
+        {
+            if ((m_flags[slot] & Removed) != 0 || depths[slot] != UnknownDepth)
+            {
+                continue;
+            }
+
+            chain.clear();
+            uint32_t current = slot;
+            while (current != InvalidSlot && depths[current] == UnknownDepth)
+            {
+                depths[current] = VisitingDepth;
+                chain.push_back(current);
+                current = m_parentSlots[current];
+            }
+
+            uint32_t depth = 0;
+            if (current != InvalidSlot)
+            {
+                if (depths[current] == VisitingDepth)
+                {
+                    // The TransformComponent rejects circular parenting, but in case one slips through the cycle is broken here
+                    // instead of updating forever.
+                    AZ_Warning("TransformHierarchy", false, "Circular transform hierarchy detected, the loop is broken up.");
+                    m_parentSlots[chain.back()] = InvalidSlot;
+                    m_parentNodes[chain.back()] = InvalidNode;
+                }
+                else
+                {
+                    depth = depths[current] + 1;
+                }
+            }
+
+            for (size_t i = chain.size(); i-- > 0;)
+            {
+                depths[chain[i]] = depth++;
+            }
+            depthCount = AZStd::max(depthCount, depth);
+        }
+
+        // Counting sort by depth, which keeps the existing order within a depth.
+        m_depthOffsets.assign(depthCount + 1, 0);
+        for (uint32_t slot = 0; slot < slotCount; ++slot)
+        {
+            if ((m_flags[slot] & Removed) == 0)
+            {
+                ++m_depthOffsets[depths[slot] + 1];
+            }
+        }
+        for (uint32_t depth = 0; depth < depthCount; ++depth)
+        {
+            m_depthOffsets[depth + 1] += m_depthOffsets[depth];
+        }
+
+        AZStd::vector<uint32_t> nextSlots(m_depthOffsets.begin(), m_depthOffsets.end() - 1);
+        AZStd::vector<uint32_t> newSlots(slotCount, InvalidSlot);
+        for (uint32_t slot = 0; slot < slotCount; ++slot)
+        {
+            if ((m_flags[slot] & Removed) == 0)
+            {
+                newSlots[slot] = nextSlots[depths[slot]]++;
+            }
+            else
+            {
+                // The node id can be used again now that nothing refers to it anymore.
+                m_nodeSlots[m_slotNodes[slot]] = InvalidSlot;
+                m_freeNodes.push_back(m_slotNodes[slot]);
+            }
+        }
+        for (uint32_t& parentSlot : m_parentSlots)
+        {
+            if (parentSlot != InvalidSlot)
+            {
+                parentSlot = newSlots[parentSlot];
+            }
+        }
+
+        const uint32_t newSlotCount = m_depthOffsets.back();
+        ApplySlotOrder(m_localTMs, newSlots, newSlotCount);
+        ApplySlotOrder(m_worldTMs, newSlots, newSlotCount);
+        ApplySlotOrder(m_parentSlots, newSlots, newSlotCount);
+        ApplySlotOrder(m_parentNodes, newSlots, newSlotCount);
+        ApplySlotOrder(m_slotNodes, newSlots, newSlotCount);
+        ApplySlotOrder(m_flags, newSlots, newSlotCount);
+        ApplySlotOrder(m_components, newSlots, newSlotCount);
+
+        for (uint32_t slot = 0; slot < newSlotCount; ++slot)
+        {
+            m_nodeSlots[m_slotNodes[slot]] = slot;
+        }
+
+        m_isSorted = true;
+    }
+
+    void TransformHierarchy::UpdateSlots(uint32_t begin, uint32_t end)
+    {
+        for (uint32_t slot = begin; slot < end; ++slot)
+        {
+            AZ::u8 flags = m_flags[slot];
+            const uint32_t parentSlot = m_parentSlots[slot];
+            if (parentSlot != InvalidSlot && (m_flags[parentSlot] & WorldChanged) != 0)
+            {
+                const AZ::Transform& parentWorldTM = m_worldTMs[parentSlot];
+                if ((flags & (KeepWorldTM | Moved)) == KeepWorldTM)
+                {
+                    // Matches AZ::OnParentChangedBehavior::DoNotUpdate, which doesn't send notifications either.
+                    m_localTMs[slot] = parentWorldTM.GetInverse() * m_worldTMs[slot];
+                    flags |= LocalChanged;
+                }
+                else
+                {
+                    // If the transform moved itself as well its world transform was based on the previous world transform of
+                    // the parent, so it's recomputed and the component is notified again.
+                    m_worldTMs[slot] = parentWorldTM * m_localTMs[slot];
+                    flags |= WorldChanged | Notify;
+                }
+            }
+            else if (flags & Moved)
+            {
+                flags |= WorldChanged;
+            }
+            m_flags[slot] = flags;
+        }
+    }
+
+    void TransformHierarchy::SendNotifications()
+    {
+        AZ_PROFILE_FUNCTION(AzFramework);
+
+        // Handlers can add, remove or move transforms, so the arrays are indexed instead of iterated. Nodes that are added
+        // are appended and removed nodes are only released on the next sort, so the order of the slots doesn't change.
+        // The flags of this update are taken out before any handler runs, so transforms that handlers move keep their Moved
+        // flag for the next update, even if their slot comes later.
+        const size_t slotCount = m_flags.size();
+        m_notifyFlags.resize(slotCount);
+        for (size_t slot = 0; slot < slotCount; ++slot)
+        {
+            m_notifyFlags[slot] = m_flags[slot] & ~PersistentFlags;
+            m_flags[slot] &= PersistentFlags;
+        }
+
+        for (size_t slot = 0; slot < slotCount; ++slot)
+        {
+            const AZ::u8 flags = m_notifyFlags[slot];
+            if (flags == 0)
+            {
+                continue;
+            }
+
+            TransformComponent* component = m_components[slot];
+            if (!component)
+            {
+                continue;
+            }
+            if (flags & LocalChanged)
+            {
+                component->m_localTM = m_localTMs[slot];
+            }
+            if (flags & WorldChanged)
+            {
+                component->m_worldTM = m_worldTMs[slot];
+            }
+            if (flags & Notify)
+            {
+                component->NotifyTransformChanged();
+            }
+        }
+    }
+} // namespace AzFramework
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Transform.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/RTTI/RTTIMacros.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/limits.h>
+#include <AzFramework/AzFrameworkAPI.h>
+
+namespace AzFramework
+{
+    class TransformComponent;
+
+    //! Batched update of the world transforms of TransformComponents.
+    //! By default a TransformComponent that moves notifies its children through the TransformNotificationBus, which in turn
+    //! notify their children, one entity at a time. When bg_transformHierarchyBatchUpdate is enabled TransformComponents
+    //! register with the hierarchy instead. The hierarchy keeps the local and world transforms in contiguous arrays sorted by
+    //! depth in the hierarchy. A transform that moves still updates and notifies right away, but only marks itself as changed
+    //! in the hierarchy. Update then recomputes the world transforms of all descendants of the changed transforms one depth at
+    //! a time, splitting large depths over the job system, and sends the notifications for the descendants in a single pass
+    //! afterwards, parents before children. Until Update is called, which happens once per tick, the descendants of a moved
+    //! transform report their previous transforms.
+    class AZF_API TransformHierarchy
+    {
+    public:
+        AZ_RTTI(TransformHierarchy, "{5E1B5A4C-3D6B-4B1E-9B0F-6B3C1C7E2A44}");
+        AZ_CLASS_ALLOCATOR(TransformHierarchy, AZ::SystemAllocator);
+
+        using NodeId = uint32_t;
+        static constexpr NodeId InvalidNode = AZStd::numeric_limits<NodeId>::max();
+
+        TransformHierarchy() = default;
+        virtual ~TransformHierarchy();
+
+        //! Adds a transform to the hierarchy without a parent.
+        NodeId AddNode(TransformComponent& component, const AZ::Transform& localTM, const AZ::Transform& worldTM);
+        //! Removes a transform from the hierarchy. Children of the node become root nodes.
+        void RemoveNode(NodeId node);
+
+        //! Sets the parent of a node. Use InvalidNode if the node has no parent or if the parent isn't in the hierarchy, in
+        //! which case the component keeps track of the parent through the TransformNotificationBus.
+        void SetParent(NodeId node, NodeId parent);
+        //! Stores the transforms the component of the node has moved to. The descendants of the node are updated on the next
+        //! Update.
+        void SetTransforms(NodeId node, const AZ::Transform& localTM, const AZ::Transform& worldTM);
+        //! If set, the world transform of the node is kept when the parent moves and the local transform is updated instead.
+        void SetKeepWorldTMOnParentChange(NodeId node, bool keepWorldTM);
+
+        //! Recomputes the world transforms of all descendants of the nodes that moved and sends the notifications.
+        void Update();
+
+        size_t GetNodeCount() const;
+        //! Returns the number of levels in the hierarchy, as of the last Update.
+        size_t GetDepthCount() const;
+
+    private:
+        static constexpr uint32_t InvalidSlot = AZStd::numeric_limits<uint32_t>::max();
+
+        enum NodeFlags : AZ::u8
+        {
+            Moved = 1 << 0, //!< The component moved and its transforms were stored with SetTransforms.
+            WorldChanged = 1 << 1, //!< The world transform changed, so the children need to be updated.
+            LocalChanged = 1 << 2, //!< The local transform was updated to keep the world transform when the parent moved.
+            Notify = 1 << 3, //!< The world transform was recomputed and the component needs to be notified.
+            KeepWorldTM = 1 << 4, //!< Persistent, see SetKeepWorldTMOnParentChange.
+            Removed = 1 << 5, //!< Persistent, the slot is released on the next sort.
+
+            PersistentFlags = KeepWorldTM | Removed
+        };
+
+        void SortByDepth();
+        void UpdateSlots(uint32_t begin, uint32_t end);
+        void SendNotifications();
+
+        // Per slot data, sorted by depth after SortByDepth.
+        AZStd::vector<AZ::Transform> m_localTMs;
+        AZStd::vector<AZ::Transform> m_worldTMs;
+        AZStd::vector<uint32_t> m_parentSlots;
+        AZStd::vector<NodeId> m_parentNodes;
+        AZStd::vector<NodeId> m_slotNodes;
+        AZStd::vector<AZ::u8> m_flags;
+        AZStd::vector<TransformComponent*> m_components;
+        //! The flags SendNotifications works from, so flags set by notification handlers are kept for the next update.
+        AZStd::vector<AZ::u8> m_notifyFlags;
+
+        //! The first slot of every depth, with the total number of sorted slots as the last entry.
+        AZStd::vector<uint32_t> m_depthOffsets;
+        AZStd::vector<uint32_t> m_nodeSlots;
+        AZStd::vector<NodeId> m_freeNodes;
+        size_t m_nodeCount = 0;
+        bool m_isSorted = true;
+        bool m_hasChanges = false;
+        bool m_isUpdating = false;
+    };
+} // namespace AzFramework
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzFramework/Components/TransformHierarchy.h>
+#include <AzFramework/Components/TransformHierarchySystemComponent.h>
+
+namespace AzFramework
+{
+    void TransformHierarchySystemComponent::Reflect(AZ::ReflectContext* context)
+    {
+        if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serializeContext->Class<TransformHierarchySystemComponent, AZ::Component>()
+                ->Version(1);
+        }
+    }
+
+    void TransformHierarchySystemComponent::GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided)
+    {
+        provided.push_back(AZ_CRC_CE("TransformHierarchyService"));
+    }
+
+    void TransformHierarchySystemComponent::GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible)
+    {
+        incompatible.push_back(AZ_CRC_CE("TransformHierarchyService"));
+    }
+
+    TransformHierarchySystemComponent::TransformHierarchySystemComponent() = default;
+
+    TransformHierarchySystemComponent::~TransformHierarchySystemComponent() = default;
+
+    void TransformHierarchySystemComponent::Activate()
+    {
+        m_hierarchy = AZStd::make_unique<TransformHierarchy>();
+        AZ::Interface<TransformHierarchy>::Register(m_hierarchy.get());
+        AZ::TickBus::Handler::BusConnect();
+    }
+
+    void TransformHierarchySystemComponent::Deactivate()
+    {
+        AZ::TickBus::Handler::BusDisconnect();
+        AZ::Interface<TransformHierarchy>::Unregister(m_hierarchy.get());
+        // Any transforms that are still registered fall back to updating their children through the TransformNotificationBus.
+        m_hierarchy.reset();
+    }
+
+    void TransformHierarchySystemComponent::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
+    {
+        m_hierarchy->Update();
+    }
+
+    int TransformHierarchySystemComponent::GetTickOrder()
+    {
+        // After gameplay, animation, physics and attachments have moved their entities, but before the render data is updated.
+        return AZ::TICK_PRE_RENDER;
+    }
+} // namespace AzFramework
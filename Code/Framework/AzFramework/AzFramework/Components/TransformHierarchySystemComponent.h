@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/Component.h>
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzFramework/AzFrameworkAPI.h>
+
+namespace AzFramework
+{
+    class TransformHierarchy;
+
+    //! Owns the TransformHierarchy, makes it available through AZ::Interface<TransformHierarchy> and updates it once per tick,
+    //! before rendering.
+    class AZF_API TransformHierarchySystemComponent
+        : public AZ::Component
+        , public AZ::TickBus::Handler
+    {
+    public:
+        AZ_COMPONENT(TransformHierarchySystemComponent, "{0B7A3D8E-4C0F-4F3A-8E2B-7D1C5A9F3B62}");
+
+        static void Reflect(AZ::ReflectContext* context);
+        static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided);
+        static void GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible);
+
+        TransformHierarchySystemComponent();
+        ~TransformHierarchySystemComponent() override;
+
+        //! AZ::Component overrides.
+        //! @{
+        void Activate() override;
+        void Deactivate() override;
+        //! @}
+
+        //! AZ::TickBus overrides.
+        //! @{
+        void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+        int GetTickOrder() override;
+        //! @}
+
+    private:
+        AZStd::unique_ptr<TransformHierarchy> m_hierarchy;
+    };
+} // namespace AzFramework
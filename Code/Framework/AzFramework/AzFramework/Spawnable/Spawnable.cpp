@@ -10,9 +10,11 @@
 #include <AzCore/RTTI/ReflectContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/std/numeric.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/sort.h>
 #include <AzCore/std/typetraits/typetraits.h>
 #include <AzFramework/Spawnable/Spawnable.h>
+#include <AzFramework/Spawnable/SpawnableClonePlan.h>
 
 namespace AzFramework
 {
@@ -446,6 +448,16 @@ namespace AzFramework
         return m_entities.empty();
     }
 
+    AZStd::shared_ptr<const SpawnableClonePlan> Spawnable::GetClonePlan(AZ::SerializeContext& serializeContext) const
+    {
+        AZStd::lock_guard lock(m_clonePlanMutex);
+        if (!m_clonePlan)
+        {
+            m_clonePlan = AZStd::make_shared<SpawnableClonePlan>(serializeContext, m_entities);
+        }
+        return &m_clonePlan->GetSerializeContext() == &serializeContext ? m_clonePlan : nullptr;
+    }
+
     SpawnableMetaData& Spawnable::GetMetaData()
     {
         return m_metaData;
@@ -12,7 +12,9 @@
 #include <AzCore/Component/Entity.h>
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzFramework/Spawnable/SpawnableMetaData.h>
 #include <AzFramework/AzFrameworkAPI.h>
@@ -20,10 +22,13 @@
 namespace AZ
 {
     class ReflectContext;
+    class SerializeContext;
 }
 
 namespace AzFramework
 {
+    class SpawnableClonePlan;
+
     class AZF_API Spawnable final
         : public AZ::Data::AssetData
     {
@@ -168,6 +173,10 @@ namespace AzFramework
         EntityAliasVisitor TryGetAliases();
         bool IsEmpty() const;
 
+        //! Returns the plan to clone the entities in this spawnable with, which is compiled on the first call.
+        //! Returns nullptr if the plan was compiled for a different Serialize Context.
+        AZStd::shared_ptr<const SpawnableClonePlan> GetClonePlan(AZ::SerializeContext& serializeContext) const;
+
         SpawnableMetaData& GetMetaData();
         const SpawnableMetaData& GetMetaData() const;
 
@@ -182,6 +191,8 @@ namespace AzFramework
         // Includes both direct and nested entities of the prefab.
         EntityList m_entities;
 
+        mutable AZStd::shared_ptr<const SpawnableClonePlan> m_clonePlan;
+        mutable AZStd::mutex m_clonePlanMutex;
         mutable AZStd::atomic<int32_t> m_shareState{ ShareState::NotShared };
     };
 
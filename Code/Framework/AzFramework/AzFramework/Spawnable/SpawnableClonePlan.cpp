@@ -0,0 +1,503 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Asset/AssetSerializer.h>
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Component/Component.h>
+#include <AzCore/Component/Entity.h>
+#include <AzCore/IO/ByteContainerStream.h>
+#include <AzCore/Serialization/DynamicSerializableField.h>
+#include <AzCore/Serialization/EditContextConstants.inl>
+#include <AzCore/Serialization/IdUtils.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/string/string.h>
+#include <AzFramework/Spawnable/SpawnableClonePlan.h>
+
+namespace AzFramework
+{
+    SpawnableClonePlan::SpawnableClonePlan(AZ::SerializeContext& serializeContext, const Spawnable::EntityList& entities)
+        : m_serializeContext(serializeContext)
+    {
+        const ClassData* entityClassData = m_serializeContext.FindClassData(azrtti_typeid<AZ::Entity>());
+        if (entityClassData)
+        {
+            const size_t entityProgram = CompileProgram(*entityClassData);
+            if (entityProgram != InvalidProgram)
+            {
+                for (const AZStd::unique_ptr<AZ::Entity>& entity : entities)
+                {
+                    if (entity)
+                    {
+                        CompileReachableTypes(entity.get(), entityProgram);
+                    }
+                }
+            }
+        }
+    }
+
+    AZ::Entity* SpawnableClonePlan::CloneEntity(const AZ::Entity& prototype, EntityIdMap& idMap) const
+    {
+        AZStd::vector<char> scratchBuffer;
+        const AZ::TypeId& typeId = AZ::SerializeTypeInfo<AZ::Entity>::GetUuid(&prototype);
+        const void* source =
+            AZ::SerializeTypeInfo<AZ::Entity>::RttiCast(&prototype, AZ::SerializeTypeInfo<AZ::Entity>::GetRttiTypeId(&prototype));
+        void* clone = CloneObject(source, typeId, idMap, scratchBuffer);
+        return clone ? m_serializeContext.Cast<AZ::Entity*>(clone, typeId) : nullptr;
+    }
+
+    AZ::Component* SpawnableClonePlan::CloneComponent(const AZ::Component& prototype, EntityIdMap& idMap) const
+    {
+        AZStd::vector<char> scratchBuffer;
+        const AZ::TypeId& typeId = AZ::SerializeTypeInfo<AZ::Component>::GetUuid(&prototype);
+        const void* source =
+            AZ::SerializeTypeInfo<AZ::Component>::RttiCast(&prototype, AZ::SerializeTypeInfo<AZ::Component>::GetRttiTypeId(&prototype));
+        void* clone = CloneObject(source, typeId, idMap, scratchBuffer);
+        return clone ? m_serializeContext.Cast<AZ::Component*>(clone, typeId) : nullptr;
+    }
+
+    AZ::SerializeContext& SpawnableClonePlan::GetSerializeContext() const
+    {
+        return m_serializeContext;
+    }
+
+    size_t SpawnableClonePlan::GetCompiledTypeCount() const
+    {
+        return AZStd::count_if(
+            m_programs.begin(), m_programs.end(),
+            [](const Program& program)
+            {
+                return program.m_state == ProgramState::Compiled;
+            });
+    }
+
+    size_t SpawnableClonePlan::GetFallbackTypeCount() const
+    {
+        return m_programs.size() - GetCompiledTypeCount();
+    }
+
+    size_t SpawnableClonePlan::CompileProgram(const ClassData& classData)
+    {
+        if (auto it = m_programLookup.find(classData.m_typeId); it != m_programLookup.end())
+        {
+            // Types that are still being compiled are only found through a container that holds elements of the type itself,
+            // which is left to the Serialize Context.
+            return m_programs[it->second].m_state == ProgramState::Compiled ? it->second : InvalidProgram;
+        }
+
+        const size_t index = m_programs.size();
+        m_programLookup.emplace(classData.m_typeId, index);
+        m_programs.emplace_back().m_classData = &classData;
+
+        // Compiling the class can add programs for element types, so the program is only looked up again afterwards.
+        AZStd::vector<Operation> operations;
+        const bool compiled = CompileClass(classData, 0, nullptr, operations);
+
+        Program& program = m_programs[index];
+        if (compiled)
+        {
+            program.m_operations = AZStd::move(operations);
+            program.m_state = ProgramState::Compiled;
+            return index;
+        }
+        program.m_state = ProgramState::Fallback;
+        return InvalidProgram;
+    }
+
+    bool SpawnableClonePlan::CompileClass(
+        const ClassData& classData, size_t offset, const ClassElement* element, AZStd::vector<Operation>& operations)
+    {
+        if (classData.IsDeprecated())
+        {
+            // The Serialize Context leaves deprecated classes untouched as well.
+            return true;
+        }
+        // Event handlers can modify the object while it's being written, so cloning the object field by field is no longer
+        // guaranteed to give the same result.
+        if (classData.m_eventHandler || classData.m_typeId == azrtti_typeid<AZ::DynamicSerializableField>())
+        {
+            return false;
+        }
+
+        if (classData.m_typeId == azrtti_typeid<AZ::EntityId>())
+        {
+            Operation& operation = operations.emplace_back();
+            operation.m_opCode = OpCode::RemapEntityId;
+            operation.m_offset = offset;
+            if (element)
+            {
+                if (AZ::Attribute* attribute = AZ::FindAttribute(AZ::Edit::Attributes::IdGeneratorFunction, element->m_attributes))
+                {
+                    operation.m_opCode = OpCode::GenerateEntityId;
+                    operation.m_idGenerator = azrtti_cast<EntityIdGenerator*>(attribute);
+                    return operation.m_idGenerator != nullptr;
+                }
+            }
+            return true;
+        }
+
+        if (classData.m_container)
+        {
+            return CompileContainer(classData, offset, operations);
+        }
+
+        if (classData.m_serializer)
+        {
+            if (classData.m_isTriviallyCopyable && classData.m_classSize > 0)
+            {
+                AddCopy(offset, classData.m_classSize, operations);
+                return true;
+            }
+
+            Operation& operation = operations.emplace_back();
+            operation.m_offset = offset;
+            operation.m_classData = &classData;
+            if (classData.m_typeId == azrtti_typeid<AZStd::string>())
+            {
+                operation.m_opCode = OpCode::CopyString;
+            }
+            else if (const AZ::GenericClassInfo* genericInfo = m_serializeContext.FindGenericClassInfo(classData.m_typeId);
+                     genericInfo && genericInfo->GetGenericTypeId() == AZ::GetAssetClassId())
+            {
+                operation.m_opCode = OpCode::CloneAsset;
+            }
+            else
+            {
+                operation.m_opCode = OpCode::CloneSerialized;
+            }
+            return true;
+        }
+
+        for (const ClassElement& classElement : classData.m_elements)
+        {
+            const ClassData* elementClassData = GetElementClassData(classData, classElement);
+            if (!elementClassData || (classElement.m_flags & ClassElement::FLG_DYNAMIC_FIELD))
+            {
+                return false;
+            }
+
+            if (classElement.m_flags & ClassElement::FLG_POINTER)
+            {
+                Operation& operation = operations.emplace_back();
+                operation.m_opCode = OpCode::ClonePointer;
+                operation.m_offset = offset + classElement.m_offset;
+                operation.m_element = &classElement;
+            }
+            else if (!CompileClass(*elementClassData, offset + classElement.m_offset, &classElement, operations))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool SpawnableClonePlan::CompileContainer(const ClassData& classData, size_t offset, AZStd::vector<Operation>& operations)
+    {
+        AZ::SerializeContext::IDataContainer* container = classData.m_container;
+        if (container->IsSmartPointer())
+        {
+            return false;
+        }
+
+        const ClassElement* element = nullptr;
+        size_t elementTypeCount = 0;
+        container->EnumTypes(
+            [&element, &elementTypeCount](const AZ::Uuid&, const ClassElement* genericClassElement)
+            {
+                element = genericClassElement;
+                ++elementTypeCount;
+                return true;
+            });
+        if (elementTypeCount != 1 || !element || (element->m_flags & ClassElement::FLG_DYNAMIC_FIELD))
+        {
+            return false;
+        }
+
+        size_t elementProgram = InvalidProgram;
+        if ((element->m_flags & ClassElement::FLG_POINTER) == 0)
+        {
+            const ClassData* elementClassData = element->m_genericClassInfo ? element->m_genericClassInfo->GetClassData()
+                                                                            : m_serializeContext.FindClassData(element->m_typeId);
+            if (!elementClassData)
+            {
+                return false;
+            }
+            elementProgram = CompileProgram(*elementClassData);
+            if (elementProgram == InvalidProgram)
+            {
+                return false;
+            }
+        }
+
+        Operation& operation = operations.emplace_back();
+        operation.m_opCode = OpCode::CloneContainer;
+        operation.m_offset = offset;
+        operation.m_classData = &classData;
+        operation.m_element = element;
+        operation.m_elementProgram = elementProgram;
+        return true;
+    }
+
+    void SpawnableClonePlan::AddCopy(size_t offset, size_t size, AZStd::vector<Operation>& operations)
+    {
+        // Merge fields that directly follow each other into a single copy.
+        if (!operations.empty())
+        {
+            Operation& last = operations.back();
+            if (last.m_opCode == OpCode::Copy && last.m_offset + last.m_size == offset)
+            {
+                last.m_size += size;
+                return;
+            }
+        }
+
+        Operation& operation = operations.emplace_back();
+        operation.m_opCode = OpCode::Copy;
+        operation.m_offset = offset;
+        operation.m_size = size;
+    }
+
+    auto SpawnableClonePlan::GetElementClassData(const ClassData& classData, const ClassElement& element) const -> const ClassData*
+    {
+        if (element.m_genericClassInfo)
+        {
+            return element.m_genericClassInfo->GetClassData();
+        }
+        return m_serializeContext.FindClassData(element.m_typeId, &classData, element.m_nameCrc);
+    }
+
+    void SpawnableClonePlan::CompileReachableTypes(const void* object, size_t program)
+    {
+        const char* source = reinterpret_cast<const char*>(object);
+        // Compiling types for the pointers can grow the list of programs, so the program can't be held on to.
+        for (size_t i = 0; i < m_programs[program].m_operations.size(); ++i)
+        {
+            const Operation operation = m_programs[program].m_operations[i];
+            if (operation.m_opCode == OpCode::ClonePointer)
+            {
+                CompilePointeeType(*reinterpret_cast<void* const*>(source + operation.m_offset), *operation.m_element);
+            }
+            else if (operation.m_opCode == OpCode::CloneContainer)
+            {
+                operation.m_classData->m_container->EnumElements(
+                    const_cast<char*>(source + operation.m_offset),
+                    [this, &operation](void* element, const AZ::Uuid&, const ClassData*, const ClassElement*)
+                    {
+                        if (operation.m_elementProgram != InvalidProgram)
+                        {
+                            CompileReachableTypes(element, operation.m_elementProgram);
+                        }
+                        else
+                        {
+                            CompilePointeeType(*reinterpret_cast<void**>(element), *operation.m_element);
+                        }
+                        return true;
+                    });
+            }
+        }
+    }
+
+    void SpawnableClonePlan::CompilePointeeType(const void* pointer, const ClassElement& element)
+    {
+        if (!pointer)
+        {
+            return;
+        }
+
+        const AZ::TypeId typeId = element.m_azRtti ? element.m_azRtti->GetActualUuid(pointer) : element.m_typeId;
+        const ClassData* classData = m_serializeContext.FindClassData(typeId);
+        if (!classData)
+        {
+            return;
+        }
+
+        const size_t program = CompileProgram(*classData);
+        if (program != InvalidProgram)
+        {
+            if (typeId != element.m_typeId && element.m_azRtti && classData->m_azRtti)
+            {
+                pointer = element.m_azRtti->Cast(pointer, classData->m_azRtti->GetTypeId());
+            }
+            CompileReachableTypes(pointer, program);
+        }
+    }
+
+    void* SpawnableClonePlan::CloneObject(
+        const void* source, const AZ::TypeId& typeId, EntityIdMap& idMap, AZStd::vector<char>& scratchBuffer) const
+    {
+        if (const size_t program = FindProgram(typeId); program != InvalidProgram)
+        {
+            const ClassData& classData = *m_programs[program].m_classData;
+            if (classData.m_factory)
+            {
+                void* clone = classData.m_factory->Create(classData.m_name);
+                Execute(m_programs[program], reinterpret_cast<const char*>(source), reinterpret_cast<char*>(clone), idMap, scratchBuffer);
+                return clone;
+            }
+        }
+
+        // The type wasn't compiled, so fall back to the Serialize Context. This matches
+        // AZ::IdUtils::Remapper::CloneObjectAndGenerateNewIdsAndFixRefs.
+        void* clone = m_serializeContext.CloneObject(source, typeId);
+        if (clone)
+        {
+            using Remapper = AZ::IdUtils::Remapper<AZ::EntityId, false>;
+            auto idMapper =
+                [&idMap](const AZ::EntityId& originalId, bool replaceId, const Remapper::IdGenerator& idGenerator) -> AZ::EntityId
+            {
+                if (replaceId)
+                {
+                    return idGenerator ? idMap.emplace(originalId, idGenerator()).first->second : originalId;
+                }
+                auto it = idMap.find(originalId);
+                return it != idMap.end() ? it->second : originalId;
+            };
+            Remapper::ReplaceIdsAndIdRefs(clone, typeId, idMapper, &m_serializeContext);
+        }
+        return clone;
+    }
+
+    void* SpawnableClonePlan::ClonePointee(
+        const void* source, const ClassElement& element, EntityIdMap& idMap, AZStd::vector<char>& scratchBuffer) const
+    {
+        const AZ::TypeId typeId = element.m_azRtti ? element.m_azRtti->GetActualUuid(source) : element.m_typeId;
+        const size_t program = FindProgram(typeId);
+        const ClassData* classData = program != InvalidProgram ? m_programs[program].m_classData : m_serializeContext.FindClassData(typeId);
+        if (!classData)
+        {
+            AZ_Error("Spawnables", false, "Unable to clone element '%s' because type %s isn't reflected.", element.m_name,
+                typeId.ToString<AZStd::string>().c_str());
+            return nullptr;
+        }
+
+        // Like the Serialize Context, work with the actual type and cast back to the type of the element when done.
+        if (typeId != element.m_typeId && element.m_azRtti && classData->m_azRtti)
+        {
+            source = element.m_azRtti->Cast(source, classData->m_azRtti->GetTypeId());
+        }
+        void* clone = CloneObject(source, typeId, idMap, scratchBuffer);
+        return clone ? m_serializeContext.DownCast(clone, typeId, element.m_typeId, classData->m_azRtti, element.m_azRtti) : nullptr;
+    }
+
+    void SpawnableClonePlan::Execute(
+        const Program& program, const char* source, char* target, EntityIdMap& idMap, AZStd::vector<char>& scratchBuffer) const
+    {
+        for (const Operation& operation : program.m_operations)
+        {
+            const char* sourceField = source + operation.m_offset;
+            char* targetField = target + operation.m_offset;
+            switch (operation.m_opCode)
+            {
+            case OpCode::Copy:
+                memcpy(targetField, sourceField, operation.m_size);
+                break;
+            case OpCode::RemapEntityId:
+            {
+                const AZ::EntityId& id = *reinterpret_cast<const AZ::EntityId*>(sourceField);
+                auto it = idMap.find(id);
+                *reinterpret_cast<AZ::EntityId*>(targetField) = it != idMap.end() ? it->second : id;
+                break;
+            }
+            case OpCode::GenerateEntityId:
+            {
+                const AZ::EntityId& id = *reinterpret_cast<const AZ::EntityId*>(sourceField);
+                auto it = idMap.find(id);
+                if (it == idMap.end())
+                {
+                    it = idMap.emplace(id, operation.m_idGenerator->Invoke(nullptr)).first;
+                }
+                *reinterpret_cast<AZ::EntityId*>(targetField) = it->second;
+                break;
+            }
+            case OpCode::CopyString:
+                *reinterpret_cast<AZStd::string*>(targetField) = *reinterpret_cast<const AZStd::string*>(sourceField);
+                break;
+            case OpCode::CloneAsset:
+                static_cast<AZ::AssetSerializer*>(operation.m_classData->m_serializer.get())->Clone(sourceField, targetField);
+                break;
+            case OpCode::CloneSerialized:
+            {
+                AZ::SerializeContext::IDataSerializer& serializer = *operation.m_classData->m_serializer;
+                scratchBuffer.clear();
+                AZ::IO::ByteContainerStream<AZStd::vector<char>> stream(&scratchBuffer);
+                serializer.Save(sourceField, stream);
+                stream.Seek(0, AZ::IO::GenericStream::ST_SEEK_BEGIN);
+                serializer.Load(targetField, stream, operation.m_classData->m_version);
+                serializer.PostClone(targetField);
+                break;
+            }
+            case OpCode::ClonePointer:
+                // Null pointers are skipped, which leaves the value the constructor assigned, the same as the Serialize Context.
+                if (const void* pointee = *reinterpret_cast<void* const*>(sourceField); pointee != nullptr)
+                {
+                    *reinterpret_cast<void**>(targetField) = ClonePointee(pointee, *operation.m_element, idMap, scratchBuffer);
+                }
+                break;
+            case OpCode::CloneContainer:
+                CloneContainer(operation, sourceField, targetField, idMap, scratchBuffer);
+                break;
+            default:
+                AZ_Assert(false, "Unsupported clone operation %i.", aznumeric_cast<int>(operation.m_opCode));
+                break;
+            }
+        }
+    }
+
+    void SpawnableClonePlan::CloneContainer(
+        const Operation& operation, const char* source, char* target, EntityIdMap& idMap, AZStd::vector<char>& scratchBuffer) const
+    {
+        AZ::SerializeContext::IDataContainer* container = operation.m_classData->m_container;
+        const Program* elementProgram = operation.m_elementProgram != InvalidProgram ? &m_programs[operation.m_elementProgram] : nullptr;
+        const bool canAccessByIndex = container->CanAccessElementsByIndex();
+        size_t index = 0;
+
+        container->ClearElements(target, &m_serializeContext);
+        container->EnumElements(
+            const_cast<char*>(source),
+            [&](void* sourceElement, const AZ::Uuid&, const ClassData*, const ClassElement*)
+            {
+                const void* pointee = nullptr;
+                if (!elementProgram)
+                {
+                    pointee = *reinterpret_cast<void**>(sourceElement);
+                    if (!pointee)
+                    {
+                        return true;
+                    }
+                }
+
+                // Fixed size containers keep their elements when cleared, so write into those first.
+                void* targetElement = canAccessByIndex && container->Size(target) > index
+                    ? container->GetElementByIndex(target, operation.m_element, index)
+                    : container->ReserveElement(target, operation.m_element);
+                ++index;
+                if (!targetElement)
+                {
+                    AZ_Error("Spawnables", false, "Failed to reserve element in container. The container may be full.");
+                    return true;
+                }
+
+                if (elementProgram)
+                {
+                    Execute(*elementProgram, reinterpret_cast<const char*>(sourceElement), reinterpret_cast<char*>(targetElement), idMap,
+                        scratchBuffer);
+                }
+                else
+                {
+                    *reinterpret_cast<void**>(targetElement) = ClonePointee(pointee, *operation.m_element, idMap, scratchBuffer);
+                }
+                container->StoreElement(target, targetElement);
+                return true;
+            });
+    }
+
+    size_t SpawnableClonePlan::FindProgram(const AZ::TypeId& typeId) const
+    {
+        auto it = m_programLookup.find(typeId);
+        return it != m_programLookup.end() && m_programs[it->second].m_state == ProgramState::Compiled ? it->second : InvalidProgram;
+    }
+} // namespace AzFramework
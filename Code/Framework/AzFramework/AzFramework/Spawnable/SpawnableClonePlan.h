@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/limits.h>
+#include <AzFramework/Spawnable/Spawnable.h>
+#include <AzFramework/AzFrameworkAPI.h>
+
+namespace AZ
+{
+    class Component;
+    class Entity;
+}
+
+namespace AzFramework
+{
+    //! Pre-compiled instructions to clone the entities in a spawnable.
+    //! Cloning through the Serialize Context walks the reflection data for every field of every entity that's spawned, and copies
+    //! even plain values by saving them to a stream and loading them back. The clone plan does that walk once per reflected type
+    //! and turns it into a flat list of operations, mostly memcpy ranges for trivially copyable fields, with fix ups for entity ids,
+    //! strings, assets, containers and pointers. The plan is built once per spawnable and reused for every spawn.
+    //! Types the plan can't handle, for instance types with serialization event handlers, fall back to the Serialize Context.
+    //! The result is the same as AZ::IdUtils::Remapper<AZ::EntityId>::CloneObjectAndGenerateNewIdsAndFixRefs.
+    class AZF_API SpawnableClonePlan final
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(SpawnableClonePlan, AZ::SystemAllocator);
+
+        using EntityIdMap = AZStd::unordered_map<AZ::EntityId, AZ::EntityId>;
+
+        //! Compiles the plan for all the types that can be reached from the provided entities. Types that are encountered
+        //! later, for instance because entities were added to the spawnable, are cloned through the Serialize Context.
+        SpawnableClonePlan(AZ::SerializeContext& serializeContext, const Spawnable::EntityList& entities);
+
+        //! Clones the entity and its components. Entity ids with an id generator, such as the id of the entity, are assigned the
+        //! id in idMap or a newly generated id that's added to idMap. All other entity ids are remapped using idMap.
+        AZ::Entity* CloneEntity(const AZ::Entity& prototype, EntityIdMap& idMap) const;
+        //! Clones a single component, using the same entity id rules as CloneEntity.
+        AZ::Component* CloneComponent(const AZ::Component& prototype, EntityIdMap& idMap) const;
+
+        AZ::SerializeContext& GetSerializeContext() const;
+        //! The number of reflected types that were compiled.
+        size_t GetCompiledTypeCount() const;
+        //! The number of reflected types that couldn't be compiled and are cloned through the Serialize Context.
+        size_t GetFallbackTypeCount() const;
+
+    private:
+        using ClassData = AZ::SerializeContext::ClassData;
+        using ClassElement = AZ::SerializeContext::ClassElement;
+        using EntityIdGenerator = AZ::AttributeFunction<AZ::EntityId()>;
+
+        static constexpr size_t InvalidProgram = AZStd::numeric_limits<size_t>::max();
+
+        enum class OpCode : AZ::u8
+        {
+            Copy, //!< memcpy m_size bytes.
+            RemapEntityId, //!< Look up the entity id in the id map.
+            GenerateEntityId, //!< Look up the entity id in the id map or generate a new one.
+            CopyString, //!< Assign an AZStd::string.
+            CloneAsset, //!< Copy an asset reference.
+            CloneSerialized, //!< Save and load the value through the serializer of the type.
+            ClonePointer, //!< Create a new object of the actual type and clone it.
+            CloneContainer //!< Clone all elements in the container.
+        };
+
+        struct Operation
+        {
+            OpCode m_opCode = OpCode::Copy;
+            size_t m_offset = 0;
+            size_t m_size = 0;
+            const ClassData* m_classData = nullptr;
+            const ClassElement* m_element = nullptr;
+            EntityIdGenerator* m_idGenerator = nullptr;
+            //! Program for the elements of a container that are stored by value.
+            size_t m_elementProgram = InvalidProgram;
+        };
+
+        enum class ProgramState : AZ::u8
+        {
+            Compiling,
+            Compiled,
+            Fallback
+        };
+
+        struct Program
+        {
+            const ClassData* m_classData = nullptr;
+            AZStd::vector<Operation> m_operations;
+            ProgramState m_state = ProgramState::Compiling;
+        };
+
+        size_t CompileProgram(const ClassData& classData);
+        bool CompileClass(const ClassData& classData, size_t offset, const ClassElement* element, AZStd::vector<Operation>& operations);
+        bool CompileContainer(const ClassData& classData, size_t offset, AZStd::vector<Operation>& operations);
+        static void AddCopy(size_t offset, size_t size, AZStd::vector<Operation>& operations);
+        const ClassData* GetElementClassData(const ClassData& classData, const ClassElement& element) const;
+        //! Walks the prototype to compile the types of the objects that are only known at runtime, such as the components.
+        void CompileReachableTypes(const void* object, size_t program);
+        void CompilePointeeType(const void* pointer, const ClassElement& element);
+
+        void* CloneObject(const void* source, const AZ::TypeId& typeId, EntityIdMap& idMap, AZStd::vector<char>& scratchBuffer) const;
+        void* ClonePointee(
+            const void* source, const ClassElement& element, EntityIdMap& idMap, AZStd::vector<char>& scratchBuffer) const;
+        void Execute(
+            const Program& program, const char* source, char* target, EntityIdMap& idMap, AZStd::vector<char>& scratchBuffer) const;
+        void CloneContainer(
+            const Operation& operation, const char* source, char* target, EntityIdMap& idMap, AZStd::vector<char>& scratchBuffer) const;
+        size_t FindProgram(const AZ::TypeId& typeId) const;
+
+        AZStd::unordered_map<AZ::TypeId, size_t> m_programLookup;
+        AZStd::vector<Program> m_programs;
+        AZ::SerializeContext& m_serializeContext;
+    };
+} // namespace AzFramework
@@ -225,6 +225,10 @@ namespace AzFramework
         AZ::SerializeContext* m_serializeContext { nullptr };
         //! The priority at which this call will be executed.
         SpawnablePriority m_priority { SpawnablePriority_Default };
+        //! The number of times all entities in the spawnable are spawned. Entity references are resolved within each instance, the
+        //!     same as calling SpawnAllEntities this many times, but the entities are created in a single batch and the callbacks
+        //!     are called once with the entities of all instances.
+        uint32_t m_instanceCount { 1 };
     };
 
     struct AZF_API SpawnEntitiesOptionalArgs final
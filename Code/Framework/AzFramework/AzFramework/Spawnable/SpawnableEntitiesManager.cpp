@@ -16,6 +16,7 @@
 #include <AzFramework/Components/TransformComponent.h>
 #include <AzFramework/Entity/GameEntityContextBus.h>
 #include <AzFramework/Spawnable/Spawnable.h>
+#include <AzFramework/Spawnable/SpawnableClonePlan.h>
 #include <AzFramework/Spawnable/SpawnableEntitiesManager.h>
 
 namespace AzFramework
@@ -62,6 +63,7 @@ namespace AzFramework
             optionalArgs.m_serializeContext == nullptr ? m_defaultSerializeContext : optionalArgs.m_serializeContext;
         queueEntry.m_completionCallback = AZStd::move(optionalArgs.m_completionCallback);
         queueEntry.m_preInsertionCallback = AZStd::move(optionalArgs.m_preInsertionCallback);
+        queueEntry.m_instanceCount = optionalArgs.m_instanceCount;
         QueueRequest(ticket, optionalArgs.m_priority, AZStd::move(queueEntry));
     }
 
@@ -343,8 +345,13 @@ namespace AzFramework
     }
 
     AZ::Entity* SpawnableEntitiesManager::CloneSingleEntity(const AZ::Entity& entityPrototype,
-        EntityIdMap& prototypeToCloneMap, AZ::SerializeContext& serializeContext)
+        EntityIdMap& prototypeToCloneMap, AZ::SerializeContext& serializeContext, const SpawnableClonePlan* clonePlan)
     {
+        if (clonePlan)
+        {
+            return clonePlan->CloneEntity(entityPrototype, prototypeToCloneMap);
+        }
+
         // If the same ID gets remapped more than once, preserve the original remapping instead of overwriting it.
         constexpr bool allowDuplicateIds = false;
 
@@ -357,34 +364,39 @@ namespace AzFramework
         const Spawnable::EntityAlias& alias,
         EntityIdMap& prototypeToCloneMap,
         AZ::Entity* previouslySpawnedEntity,
-        AZ::SerializeContext& serializeContext)
+        AZ::SerializeContext& serializeContext,
+        const SpawnableClonePlan* clonePlan)
     {
         AZ::Entity* clone = nullptr;
         switch (alias.m_aliasType)
         {
         case Spawnable::EntityAliasType::Original:
             // Behave as the original version.
-            clone = CloneSingleEntity(entityPrototype, prototypeToCloneMap, serializeContext);
+            clone = CloneSingleEntity(entityPrototype, prototypeToCloneMap, serializeContext, clonePlan);
             AZ_Assert(clone != nullptr, "Failed to clone spawnable entity.");
             return clone;
         case Spawnable::EntityAliasType::Disable:
             // Do nothing.
             return nullptr;
         case Spawnable::EntityAliasType::Replace:
-            clone = CloneSingleEntity(*(alias.m_spawnable->GetEntities()[alias.m_targetIndex]), prototypeToCloneMap, serializeContext);
+            clone = CloneSingleEntity(
+                *(alias.m_spawnable->GetEntities()[alias.m_targetIndex]), prototypeToCloneMap, serializeContext,
+                alias.m_spawnable->GetClonePlan(serializeContext).get());
             AZ_Assert(clone != nullptr, "Failed to clone spawnable entity.");
             return clone;
         case Spawnable::EntityAliasType::Additional:
             // The asset handler will have sorted and inserted a Spawnable::EntityAliasType::Original, so the just
             // spawn the additional entity.
-            clone = CloneSingleEntity(*(alias.m_spawnable->GetEntities()[alias.m_targetIndex]), prototypeToCloneMap, serializeContext);
+            clone = CloneSingleEntity(
+                *(alias.m_spawnable->GetEntities()[alias.m_targetIndex]), prototypeToCloneMap, serializeContext,
+                alias.m_spawnable->GetClonePlan(serializeContext).get());
             AZ_Assert(clone != nullptr, "Failed to clone spawnable entity.");
             return clone;
         case Spawnable::EntityAliasType::Merge:
             AZ_Assert(previouslySpawnedEntity != nullptr, "Merging components but there's no entity to add to yet.");
             AppendComponents(
                 *previouslySpawnedEntity, alias.m_spawnable->GetEntities()[alias.m_targetIndex]->GetComponents(), prototypeToCloneMap,
-                serializeContext);
+                serializeContext, alias.m_spawnable->GetClonePlan(serializeContext).get());
             return nullptr;
         default:
             AZ_Assert(false, "Unsupported spawnable entity alias type: %i", alias.m_aliasType);
@@ -396,15 +408,18 @@ namespace AzFramework
         AZ::Entity& target,
         const AZ::Entity::ComponentArrayType& componentPrototypes,
         EntityIdMap& prototypeToCloneMap,
-        AZ::SerializeContext& serializeContext)
+        AZ::SerializeContext& serializeContext,
+        const SpawnableClonePlan* clonePlan)
     {
         // Only components are added and entities are looked up so no duplicate entity ids should be encountered.
         constexpr bool allowDuplicateIds = false;
 
         for (const AZ::Component* component : componentPrototypes)
         {
-            AZ::Component* clone = AZ::IdUtils::Remapper<AZ::EntityId, allowDuplicateIds>::CloneObjectAndGenerateNewIdsAndFixRefs(
-                component, prototypeToCloneMap, &serializeContext);
+            AZ::Component* clone = clonePlan
+                ? clonePlan->CloneComponent(*component, prototypeToCloneMap)
+                : AZ::IdUtils::Remapper<AZ::EntityId, allowDuplicateIds>::CloneObjectAndGenerateNewIdsAndFixRefs(
+                      component, prototypeToCloneMap, &serializeContext);
             AZ_Assert(clone, "Unable to clone component for entity '%s' (%zu).", target.GetName().c_str(), target.GetId());
             [[maybe_unused]] bool result = target.AddComponent(clone);
             AZ_Assert(result, "Unable to add cloned component to entity '%s' (%zu).", target.GetName().c_str(), target.GetId());
@@ -462,72 +477,81 @@ namespace AzFramework
                 const Spawnable::EntityList& entitiesToSpawn = ticket.m_spawnable->GetEntities();
                 uint32_t entitiesToSpawnSize = aznumeric_caster(entitiesToSpawn.size());
 
-                // Reserve buffers
-                spawnedEntities.reserve(spawnedEntities.size() + entitiesToSpawnSize);
-                spawnedEntityIndices.reserve(spawnedEntityIndices.size() + entitiesToSpawnSize);
+                // Clone through the pre-compiled plan of the spawnable if it was compiled for the requested Serialize Context.
+                AZStd::shared_ptr<const SpawnableClonePlan> clonePlan = ticket.m_spawnable->GetClonePlan(*request.m_serializeContext);
 
-                // Pre-generate the full set of entity-id-to-new-entity-id mappings, so that during the clone operation below,
-                // any entity references that point to a not-yet-cloned entity will still get their ids remapped correctly.
-                // We clear out and regenerate the set of IDs on every SpawnAllEntities call, because presumably every entity reference
-                // in every entity we're about to instantiate is intended to point to an entity in our newly-instantiated batch, regardless
-                // of spawn order.  If we didn't clear out the map, it would be possible for some entities here to have references to
-                // previously-spawned entities from a previous SpawnEntities or SpawnAllEntities call.
-                InitializeEntityIdMappings(entitiesToSpawn, ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
+                // Reserve buffers for all instances at once.
+                const uint32_t instanceCount = AZStd::max(request.m_instanceCount, 1u);
+                spawnedEntities.reserve(spawnedEntities.size() + entitiesToSpawnSize * instanceCount);
+                spawnedEntityIndices.reserve(spawnedEntityIndices.size() + entitiesToSpawnSize * instanceCount);
 
-                auto aliasIt = aliases.begin();
-                auto aliasEnd = aliases.end();
-                if (aliasIt == aliasEnd)
+                for (uint32_t instance = 0; instance < instanceCount; ++instance)
                 {
-                    for (uint32_t i = 0; i < entitiesToSpawnSize; ++i)
-                    {
-                        // If this entity has previously been spawned, give it a new id in the reference map
-                        RefreshEntityIdMapping(
-                            entitiesToSpawn[i].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
+                    // Pre-generate the full set of entity-id-to-new-entity-id mappings, so that during the clone operation below,
+                    // any entity references that point to a not-yet-cloned entity will still get their ids remapped correctly.
+                    // We clear out and regenerate the set of IDs on every SpawnAllEntities call and for every instance, because
+                    // presumably every entity reference in every entity we're about to instantiate is intended to point to an entity in
+                    // our newly-instantiated batch, regardless of spawn order. If we didn't clear out the map, it would be possible for
+                    // some entities here to have references to previously-spawned entities from a previous SpawnEntities or
+                    // SpawnAllEntities call or from a previous instance.
+                    InitializeEntityIdMappings(entitiesToSpawn, ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
 
-                        spawnedEntities.emplace_back(
-                            CloneSingleEntity(*entitiesToSpawn[i], ticket.m_entityIdReferenceMap, *request.m_serializeContext));
-                        spawnedEntityIndices.push_back(i);
-                    }
-                }
-                else
-                {
-                    for (uint32_t i = 0; i < entitiesToSpawnSize; ++i)
+                    auto aliasIt = aliases.begin();
+                    auto aliasEnd = aliases.end();
+                    if (aliasIt == aliasEnd)
                     {
-                        // If this entity has previously been spawned, give it a new id in the reference map
-                        RefreshEntityIdMapping(
-                            entitiesToSpawn[i].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
-
-                        if (aliasIt == aliasEnd || aliasIt->m_sourceIndex != i)
+                        for (uint32_t i = 0; i < entitiesToSpawnSize; ++i)
                         {
-                            spawnedEntities.emplace_back(
-                                CloneSingleEntity(*entitiesToSpawn[i], ticket.m_entityIdReferenceMap, *request.m_serializeContext));
+                            // If this entity has previously been spawned, give it a new id in the reference map
+                            RefreshEntityIdMapping(
+                                entitiesToSpawn[i].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
+
+                            spawnedEntities.emplace_back(CloneSingleEntity(
+                                *entitiesToSpawn[i], ticket.m_entityIdReferenceMap, *request.m_serializeContext, clonePlan.get()));
                             spawnedEntityIndices.push_back(i);
                         }
-                        else
+                    }
+                    else
+                    {
+                        for (uint32_t i = 0; i < entitiesToSpawnSize; ++i)
                         {
-                            // The list of entities has already been sorted and optimized (See SpawnableEntitiesAliasList:Optimize) so can
-                            // be safely executed in order without risking an invalid state.
-                            AZ::Entity* previousEntity = nullptr;
-                            do
+                            // If this entity has previously been spawned, give it a new id in the reference map
+                            RefreshEntityIdMapping(
+                                entitiesToSpawn[i].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
+
+                            if (aliasIt == aliasEnd || aliasIt->m_sourceIndex != i)
+                            {
+                                spawnedEntities.emplace_back(CloneSingleEntity(
+                                    *entitiesToSpawn[i], ticket.m_entityIdReferenceMap, *request.m_serializeContext, clonePlan.get()));
+                                spawnedEntityIndices.push_back(i);
+                            }
+                            else
                             {
-                                AZ::Entity* clone = CloneSingleAliasedEntity(
-                                    *entitiesToSpawn[i], *aliasIt, ticket.m_entityIdReferenceMap, previousEntity,
-                                    *request.m_serializeContext);
-                                previousEntity = clone;
-                                if (clone)
+                                // The list of entities has already been sorted and optimized (See SpawnableEntitiesAliasList:Optimize) so
+                                // can be safely executed in order without risking an invalid state.
+                                AZ::Entity* previousEntity = nullptr;
+                                do
                                 {
-                                    spawnedEntities.emplace_back(clone);
-                                    spawnedEntityIndices.push_back(i);
-                                }
-                                ++aliasIt;
-                            } while (aliasIt != aliasEnd && aliasIt->m_sourceIndex == i);
+                                    AZ::Entity* clone = CloneSingleAliasedEntity(
+                                        *entitiesToSpawn[i], *aliasIt, ticket.m_entityIdReferenceMap, previousEntity,
+                                        *request.m_serializeContext, clonePlan.get());
+                                    previousEntity = clone;
+                                    if (clone)
+                                    {
+                                        spawnedEntities.emplace_back(clone);
+                                        spawnedEntityIndices.push_back(i);
+                                    }
+                                    ++aliasIt;
+                                } while (aliasIt != aliasEnd && aliasIt->m_sourceIndex == i);
+                            }
                         }
                     }
                 }
 
                 // There were no initial entities then the ticket now holds exactly all entities. If there were already entities then
-                // a new set are not added so it no longer holds exactly the number of entities.
-                ticket.m_loadAll = spawnedEntitiesInitialCount == 0;
+                // a new set are not added so it no longer holds exactly the number of entities. The same applies when multiple
+                // instances were spawned at once.
+                ticket.m_loadAll = spawnedEntitiesInitialCount == 0 && instanceCount == 1;
 
                 auto newEntitiesBegin = ticket.m_spawnedEntities.begin() + spawnedEntitiesInitialCount;
                 auto newEntitiesEnd = ticket.m_spawnedEntities.end();
@@ -595,6 +619,8 @@ namespace AzFramework
                 spawnedEntities.reserve(spawnedEntities.size() + entitiesToSpawnSize);
                 spawnedEntityIndices.reserve(spawnedEntityIndices.size() + entitiesToSpawnSize);
 
+                AZStd::shared_ptr<const SpawnableClonePlan> clonePlan = ticket.m_spawnable->GetClonePlan(*request.m_serializeContext);
+
                 auto aliasBegin = aliases.begin();
                 auto aliasEnd = aliases.end();
                 if (aliasBegin == aliasEnd)
@@ -607,8 +633,8 @@ namespace AzFramework
                             RefreshEntityIdMapping(
                                 entitiesToSpawn[index].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
 
-                            spawnedEntities.push_back(
-                                CloneSingleEntity(*entitiesToSpawn[index], ticket.m_entityIdReferenceMap, *request.m_serializeContext));
+                            spawnedEntities.push_back(CloneSingleEntity(
+                                *entitiesToSpawn[index], ticket.m_entityIdReferenceMap, *request.m_serializeContext, clonePlan.get()));
                             spawnedEntityIndices.push_back(index);
                         }
                     }
@@ -632,8 +658,8 @@ namespace AzFramework
 
                             if (aliasIt == aliasEnd || aliasIt->m_sourceIndex != index)
                             {
-                                spawnedEntities.emplace_back(
-                                    CloneSingleEntity(*entitiesToSpawn[index], ticket.m_entityIdReferenceMap, *request.m_serializeContext));
+                                spawnedEntities.emplace_back(CloneSingleEntity(
+                                    *entitiesToSpawn[index], ticket.m_entityIdReferenceMap, *request.m_serializeContext, clonePlan.get()));
                                 spawnedEntityIndices.push_back(index);
                             }
                             else
@@ -645,7 +671,7 @@ namespace AzFramework
                                 {
                                     AZ::Entity* clone = CloneSingleAliasedEntity(
                                         *entitiesToSpawn[index], *aliasIt, ticket.m_entityIdReferenceMap, previousEntity,
-                                        *request.m_serializeContext);
+                                        *request.m_serializeContext, clonePlan.get());
                                     previousEntity = clone;
                                     if (clone)
                                     {
@@ -790,6 +816,8 @@ namespace AzFramework
             // match the new set of prototype entities getting spawned.
             InitializeEntityIdMappings(entities, ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
 
+            AZStd::shared_ptr<const SpawnableClonePlan> clonePlan = request.m_spawnable->GetClonePlan(*request.m_serializeContext);
+
             if (ticket.m_loadAll)
             {
                 // The new spawnable may have a different number of entities and since the intent of the user was
@@ -802,7 +830,8 @@ namespace AzFramework
                     // If this entity has previously been spawned, give it a new id in the reference map
                     RefreshEntityIdMapping(entities[i].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
 
-                    AZ::Entity* clone = CloneSingleEntity(*entities[i], ticket.m_entityIdReferenceMap, *request.m_serializeContext);
+                    AZ::Entity* clone =
+                        CloneSingleEntity(*entities[i], ticket.m_entityIdReferenceMap, *request.m_serializeContext, clonePlan.get());
                     AZ_Assert(clone != nullptr, "Failed to clone spawnable entity.");
 
                     ticket.m_spawnedEntities.push_back(clone);
@@ -823,7 +852,8 @@ namespace AzFramework
                         // If this entity has previously been spawned, give it a new id in the reference map
                         RefreshEntityIdMapping(entities[index].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
 
-                        AZ::Entity* clone = CloneSingleEntity(*entities[index], ticket.m_entityIdReferenceMap, *request.m_serializeContext);
+                        AZ::Entity* clone = CloneSingleEntity(
+                            *entities[index], ticket.m_entityIdReferenceMap, *request.m_serializeContext, clonePlan.get());
                         AZ_Assert(clone != nullptr, "Failed to clone spawnable entity.");
                         ticket.m_spawnedEntities.push_back(clone);
                     }
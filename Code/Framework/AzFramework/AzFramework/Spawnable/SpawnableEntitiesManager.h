@@ -27,6 +27,8 @@ namespace AZ
 
 namespace AzFramework
 {
+    class SpawnableClonePlan;
+
     class AZF_API SpawnableEntitiesManager
         : public SpawnableEntitiesInterface::Registrar
     {
@@ -135,6 +137,7 @@ namespace AzFramework
             Ticket* m_ticket;
             EntitySpawnTicket::Id m_ticketId;
             uint32_t m_requestId;
+            uint32_t m_instanceCount;
         };
         struct SpawnEntitiesCommand final
         {
@@ -265,19 +268,26 @@ namespace AzFramework
         
         CommandQueueStatus ProcessQueue(Queue& queue);
 
+        //! Clones the entity using the clone plan of the spawnable the entity is in. If there's no plan, for instance because a
+        //! different Serialize Context was requested, the entity is cloned through the Serialize Context.
         AZ::Entity* CloneSingleEntity(
-            const AZ::Entity& entityPrototype, EntityIdMap& prototypeToCloneMap, AZ::SerializeContext& serializeContext);
+            const AZ::Entity& entityPrototype,
+            EntityIdMap& prototypeToCloneMap,
+            AZ::SerializeContext& serializeContext,
+            const SpawnableClonePlan* clonePlan);
         AZ::Entity* CloneSingleAliasedEntity(
             const AZ::Entity& entityPrototype,
             const Spawnable::EntityAlias& alias,
             EntityIdMap& prototypeToCloneMap,
             AZ::Entity* previouslySpawnedEntity,
-            AZ::SerializeContext& serializeContext);
+            AZ::SerializeContext& serializeContext,
+            const SpawnableClonePlan* clonePlan);
         void AppendComponents(
             AZ::Entity& target,
             const AZ::Entity::ComponentArrayType& componentPrototypes,
             EntityIdMap& prototypeToCloneMap,
-            AZ::SerializeContext& serializeContext);
+            AZ::SerializeContext& serializeContext,
+            const SpawnableClonePlan* clonePlan);
         
         CommandResult ProcessRequest(SpawnAllEntitiesCommand& request);
         CommandResult ProcessRequest(SpawnEntitiesCommand& request);
@@ -149,6 +149,10 @@ set(FILES
     Components/EditorEntityEvents.h
     Components/TransformComponent.cpp
     Components/TransformComponent.h
+    Components/TransformHierarchy.cpp
+    Components/TransformHierarchy.h
+    Components/TransformHierarchySystemComponent.cpp
+    Components/TransformHierarchySystemComponent.h
     Components/CameraBus.h
     Components/ConsoleBus.cpp
     Components/ConsoleBus.h
@@ -398,6 +402,8 @@ set(FILES
     Spawnable/SpawnableAssetHandler.cpp
     Spawnable/SpawnableAssetUtils.h
     Spawnable/SpawnableAssetUtils.cpp
+    Spawnable/SpawnableClonePlan.h
+    Spawnable/SpawnableClonePlan.cpp
     Spawnable/SpawnableEntitiesContainer.h
     Spawnable/SpawnableEntitiesContainer.cpp
     Spawnable/SpawnableEntitiesInterface.h
@@ -312,6 +312,68 @@ namespace UnitTest
         EXPECT_TRUE(AZStd::any_of(fullPaths.cbegin(), fullPaths.cend(), [](auto& path) { return path.ends_with("two.pak"); }));
     }
 
+    TEST_F(ArchiveTestFixture, TestArchiveOpenPacks_FilesInEveryPak_AreFound)
+    {
+        AZ::IO::IArchive* archive = AZ::Interface<AZ::IO::IArchive>::Get();
+        ASSERT_NE(nullptr, archive);
+
+        AZ::IO::FileIOBase* fileIo = AZ::IO::FileIOBase::GetInstance();
+        ASSERT_NE(nullptr, fileIo);
+
+        auto console = AZ::Interface<AZ::IConsole>::Get();
+        ASSERT_NE(nullptr, console);
+
+        constexpr AZStd::string_view dataString = "HELLO WORLD";
+        constexpr size_t pakCount = 4;
+        fileIo->CreatePath("@usercache@/openpacks");
+        for (size_t pakIndex = 0; pakIndex < pakCount; ++pakIndex)
+        {
+            const auto pakPath = AZStd::string::format("@usercache@/openpacks/pak%zu.pak", pakIndex);
+            archive->ClosePack(pakPath);
+            fileIo->Remove(pakPath.c_str());
+
+            auto pArchive = archive->OpenArchive(pakPath, {}, AZ::IO::INestedArchive::FLAGS_CREATE_NEW);
+            ASSERT_NE(nullptr, pArchive);
+            EXPECT_EQ(0, pArchive->UpdateFile(AZStd::string::format("root%zu.txt", pakIndex), dataString.data(), dataString.size(),
+                AZ::IO::INestedArchive::METHOD_STORE, 0));
+            EXPECT_EQ(0, pArchive->UpdateFile(AZStd::string::format("levels/level%zu/levelinfo.xml", pakIndex), dataString.data(),
+                dataString.size(), AZ::IO::INestedArchive::METHOD_COMPRESS, AZ::IO::INestedArchive::LEVEL_FASTEST));
+            pArchive.reset();
+        }
+
+        // Open the packs with and without mapping the archives
+        for (const char* mapFiles : { "true", "false" })
+        {
+            console->PerformCommand("az_archive_zip_directory_cache_map_files", { mapFiles });
+
+            AZStd::vector<AZ::IO::FixedMaxPathString> fullPaths;
+            EXPECT_TRUE(archive->OpenPacks("@usercache@/openpacks/*.pak", &fullPaths));
+            EXPECT_EQ(pakCount, fullPaths.size());
+
+            for (size_t pakIndex = 0; pakIndex < pakCount; ++pakIndex)
+            {
+                EXPECT_TRUE(archive->IsFileExist(
+                    AZStd::string::format("@usercache@/openpacks/root%zu.txt", pakIndex), AZ::IO::FileSearchLocation::InPak));
+                EXPECT_TRUE(archive->IsFileExist(
+                    AZStd::string::format("@usercache@/openpacks/levels/level%zu/levelinfo.xml", pakIndex), AZ::IO::FileSearchLocation::InPak));
+            }
+            EXPECT_FALSE(archive->IsFileExist("@usercache@/openpacks/levels/levelinfo.xml", AZ::IO::FileSearchLocation::InPak));
+            EXPECT_FALSE(archive->IsFileExist("@usercache@/openpacks/levels/level0", AZ::IO::FileSearchLocation::InPak));
+            EXPECT_FALSE(archive->IsFileExist("@usercache@/openpacks/root0.txt/levels", AZ::IO::FileSearchLocation::InPak));
+
+            for (size_t pakIndex = 0; pakIndex < pakCount; ++pakIndex)
+            {
+                EXPECT_TRUE(archive->ClosePack(AZStd::string::format("@usercache@/openpacks/pak%zu.pak", pakIndex)));
+            }
+        }
+        console->PerformCommand("az_archive_zip_directory_cache_map_files", { "true" });
+
+        for (size_t pakIndex = 0; pakIndex < pakCount; ++pakIndex)
+        {
+            fileIo->Remove(AZStd::string::format("@usercache@/openpacks/pak%zu.pak", pakIndex).c_str());
+        }
+    }
+
     TEST_F(ArchiveTestFixture, TestArchiveFGetCachedFileData_LooseFile)
     {
         // ------setup loose file FGetCachedFileData tests -------------------------
@@ -9,7 +9,9 @@
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AzCore/UserSettings/UserSettingsComponent.h>
 #include <AzFramework/Application/Application.h>
+#include <AzCore/Serialization/IdUtils.h>
 #include <AzFramework/Spawnable/SpawnableAssetHandler.h>
+#include <AzFramework/Spawnable/SpawnableClonePlan.h>
 #include <AzFramework/Spawnable/SpawnableEntitiesManager.h>
 #include <AzFramework/Components/TransformComponent.h>
 #include <AzTest/AzTest.h>
@@ -98,6 +100,55 @@ namespace UnitTest
         AZ::EntityId m_parent;
     };
 
+    struct ClonePlanTestData
+    {
+        AZ_TYPE_INFO(ClonePlanTestData, "{0F5C41E5-7C0B-4C5B-A3B8-5E0D6C2E8A17}");
+
+        static void Reflect(AZ::SerializeContext& serializeContext)
+        {
+            serializeContext.Class<ClonePlanTestData>()
+                ->Field("Target", &ClonePlanTestData::m_target)
+                ->Field("Weight", &ClonePlanTestData::m_weight)
+                ->Field("Label", &ClonePlanTestData::m_label);
+        }
+
+        AZ::EntityId m_target;
+        float m_weight{ 0.0f };
+        AZStd::string m_label;
+    };
+
+    // Test component with a mix of plain values, strings, containers and nested structures to validate the clone plans.
+    class ClonePlanTestComponent : public AZ::Component
+    {
+    public:
+        AZ_COMPONENT(ClonePlanTestComponent, "{6B4E2A4D-0F13-4F4C-9C36-2A8D1E4D6F11}");
+
+        void Activate() override {}
+        void Deactivate() override {}
+
+        static void Reflect(AZ::ReflectContext* reflection)
+        {
+            if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(reflection))
+            {
+                ClonePlanTestData::Reflect(*serializeContext);
+                serializeContext->Class<ClonePlanTestComponent, AZ::Component>()
+                    ->Field("Count", &ClonePlanTestComponent::m_count)
+                    ->Field("Scale", &ClonePlanTestComponent::m_scale)
+                    ->Field("Name", &ClonePlanTestComponent::m_name)
+                    ->Field("References", &ClonePlanTestComponent::m_references)
+                    ->Field("Data", &ClonePlanTestComponent::m_data)
+                    ->Field("DataList", &ClonePlanTestComponent::m_dataList);
+            }
+        }
+
+        AZ::u32 m_count{ 0 };
+        float m_scale{ 1.0f };
+        AZStd::string m_name;
+        AZStd::vector<AZ::EntityId> m_references;
+        ClonePlanTestData m_data;
+        AZStd::vector<ClonePlanTestData> m_dataList;
+    };
+
     class SpawnableEntitiesManagerTest : public LeakDetectionFixture
     {
     public:
@@ -115,6 +166,7 @@ namespace UnitTest
             m_application->RegisterComponentDescriptor(ComponentWithEntityReference::CreateDescriptor());
             m_application->RegisterComponentDescriptor(SourceSpawnableComponent::CreateDescriptor());
             m_application->RegisterComponentDescriptor(TargetSpawnableComponent::CreateDescriptor());
+            m_application->RegisterComponentDescriptor(ClonePlanTestComponent::CreateDescriptor());
 
             // Without this, the user settings component would attempt to save on finalize/shutdown. Since the file is
             // shared across the whole engine, if multiple tests are run in parallel, the saving could cause a crash
@@ -622,6 +674,30 @@ namespace UnitTest
         }
     }
 
+    TEST_F(SpawnableEntitiesManagerTest, SpawnAllEntities_InstanceCount_EntityIdsOnlyReferWithinASingleInstance)
+    {
+        constexpr size_t NumEntities = 4;
+        constexpr uint32_t NumInstances = 3;
+        FillSpawnable(NumEntities);
+        CreateEntityReferences(EntityReferenceScheme::AllReferenceNextCircular);
+
+        size_t callbackCount = 0;
+        auto callback = [this, &callbackCount](AzFramework::EntitySpawnTicket::Id, AzFramework::SpawnableConstEntityContainerView entities)
+        {
+            ++callbackCount;
+            EXPECT_EQ(NumEntities * NumInstances, entities.size());
+            ValidateEntityReferences(EntityReferenceScheme::AllReferenceNextCircular, NumEntities, entities);
+        };
+
+        AzFramework::SpawnAllEntitiesOptionalArgs optionalArgs;
+        optionalArgs.m_completionCallback = AZStd::move(callback);
+        optionalArgs.m_instanceCount = NumInstances;
+        m_manager->SpawnAllEntities(*m_ticket, AZStd::move(optionalArgs));
+        ProcessQueueTillEmtpy();
+
+        EXPECT_EQ(1, callbackCount);
+    }
+
     TEST_F(SpawnableEntitiesManagerTest, SpawnAllEntities_DeleteTicketBeforeCall_NoCrash)
     {
         {
@@ -1543,4 +1619,78 @@ namespace UnitTest
 
         EXPECT_LT(defaultPriorityCallId, highPriorityCallId);
     }
+
+    //
+    // SpawnableClonePlan
+    //
+
+    TEST_F(SpawnableEntitiesManagerTest, SpawnableClonePlan_CloneEntity_MatchesSerializeContextClone)
+    {
+        FillSpawnable(2);
+        AzFramework::Spawnable::EntityList& entities = m_spawnable->GetEntities();
+        const AZ::EntityId firstId = entities[0]->GetId();
+        const AZ::EntityId secondId = entities[1]->GetId();
+        const AZ::EntityId externalId(1234);
+
+        auto* component = entities[0]->CreateComponent<ClonePlanTestComponent>();
+        component->m_count = 42;
+        component->m_scale = 2.5f;
+        component->m_name = "A name that's long enough to not fit in the small string buffer";
+        component->m_references = { secondId, externalId, firstId };
+        component->m_data = { secondId, 0.5f, "Data" };
+        component->m_dataList = { { firstId, 1.0f, "First" }, { externalId, 2.0f, "Second" } };
+
+        AZ::SerializeContext* serializeContext = m_application->GetSerializeContext();
+        AZStd::shared_ptr<const AzFramework::SpawnableClonePlan> clonePlan = m_spawnable->GetClonePlan(*serializeContext);
+        ASSERT_NE(nullptr, clonePlan);
+        EXPECT_EQ(0, clonePlan->GetFallbackTypeCount());
+
+        // Use the same id mapping for both clones so the results can be compared directly.
+        AzFramework::SpawnableClonePlan::EntityIdMap planIdMap{ { firstId, AZ::Entity::MakeId() }, { secondId, AZ::Entity::MakeId() } };
+        AzFramework::SpawnableClonePlan::EntityIdMap reflectionIdMap = planIdMap;
+
+        AZStd::unique_ptr<AZ::Entity> planClone(clonePlan->CloneEntity(*entities[0], planIdMap));
+        AZStd::unique_ptr<AZ::Entity> reflectionClone(
+            AZ::IdUtils::Remapper<AZ::EntityId, false>::CloneObjectAndGenerateNewIdsAndFixRefs(
+                entities[0].get(), reflectionIdMap, serializeContext));
+        ASSERT_NE(nullptr, planClone);
+        ASSERT_NE(nullptr, reflectionClone);
+
+        EXPECT_EQ(reflectionClone->GetId(), planClone->GetId());
+        EXPECT_EQ(planIdMap[firstId], planClone->GetId());
+        EXPECT_EQ(reflectionClone->GetName(), planClone->GetName());
+        ASSERT_EQ(reflectionClone->GetComponents().size(), planClone->GetComponents().size());
+        EXPECT_NE(nullptr, planClone->FindComponent<SourceSpawnableComponent>());
+
+        const auto* expected = reflectionClone->FindComponent<ClonePlanTestComponent>();
+        const auto* actual = planClone->FindComponent<ClonePlanTestComponent>();
+        ASSERT_NE(nullptr, expected);
+        ASSERT_NE(nullptr, actual);
+        EXPECT_NE(component, actual);
+        EXPECT_EQ(expected->GetId(), actual->GetId());
+        EXPECT_EQ(expected->m_count, actual->m_count);
+        EXPECT_EQ(expected->m_scale, actual->m_scale);
+        EXPECT_EQ(expected->m_name, actual->m_name);
+        EXPECT_EQ(expected->m_references, actual->m_references);
+        EXPECT_EQ(planIdMap[secondId], actual->m_references[0]);
+        EXPECT_EQ(externalId, actual->m_references[1]);
+        EXPECT_EQ(expected->m_data.m_target, actual->m_data.m_target);
+        EXPECT_EQ(expected->m_data.m_weight, actual->m_data.m_weight);
+        EXPECT_EQ(expected->m_data.m_label, actual->m_data.m_label);
+        ASSERT_EQ(expected->m_dataList.size(), actual->m_dataList.size());
+        for (size_t i = 0; i < expected->m_dataList.size(); ++i)
+        {
+            EXPECT_EQ(expected->m_dataList[i].m_target, actual->m_dataList[i].m_target);
+            EXPECT_EQ(expected->m_dataList[i].m_weight, actual->m_dataList[i].m_weight);
+            EXPECT_EQ(expected->m_dataList[i].m_label, actual->m_dataList[i].m_label);
+        }
+    }
+
+    TEST_F(SpawnableEntitiesManagerTest, SpawnableClonePlan_DifferentSerializeContext_NoPlan)
+    {
+        FillSpawnable(1);
+        AZ::SerializeContext serializeContext;
+        EXPECT_NE(nullptr, m_spawnable->GetClonePlan(*m_application->GetSerializeContext()));
+        EXPECT_EQ(nullptr, m_spawnable->GetClonePlan(serializeContext));
+    }
 } // namespace UnitTest
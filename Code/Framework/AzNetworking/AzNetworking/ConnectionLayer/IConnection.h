@@ -133,6 +133,23 @@ namespace AzNetworking
         //! @return connection quality structure for this connection
         ConnectionQuality& GetConnectionQuality();
 
+        //! Sets whether packets sent on this connection are bit packed, writing bounded values with only the bits their range needs.
+        //! Both endpoints must use the same float precision. Packets can also request bit packing individually, see IPacket::IsBitPacked.
+        //! Currently unsupported on TcpConnections
+        //! @param enabled        true to bit pack all packets sent on this connection
+        //! @param floatPrecision largest error allowed when quantizing bounded floats in bit packed packets
+        void SetPacketBitPacking(bool enabled, float floatPrecision = DefaultBitPackedFloatPrecision);
+
+        //! Returns whether all packets sent on this connection are bit packed.
+        //! Currently unsupported on TcpConnections
+        //! @return boolean true if packets sent on this connection are bit packed
+        bool IsPacketBitPackingEnabled() const;
+
+        //! Returns the precision of bounded floats in bit packed packets sent or received on this connection.
+        //! Currently unsupported on TcpConnections
+        //! @return largest error allowed when quantizing bounded floats
+        float GetBitPackedFloatPrecision() const;
+
     private:
 
         // The following data members are here in the interface for performance reasons
@@ -141,6 +158,8 @@ namespace AzNetworking
         ConnectionMetrics m_connectionMetrics;
         ConnectionQuality m_connectionQuality;
         void*             m_userData = nullptr;
+        float             m_bitPackedFloatPrecision = DefaultBitPackedFloatPrecision;
+        bool              m_packetBitPacking = false;
     };
 }
 
@@ -69,4 +69,20 @@ namespace AzNetworking
     {
         return m_connectionQuality;
     }
+
+    inline void IConnection::SetPacketBitPacking(bool enabled, float floatPrecision)
+    {
+        m_packetBitPacking = enabled;
+        m_bitPackedFloatPrecision = floatPrecision;
+    }
+
+    inline bool IConnection::IsPacketBitPackingEnabled() const
+    {
+        return m_packetBitPacking;
+    }
+
+    inline float IConnection::GetBitPackedFloatPrecision() const
+    {
+        return m_bitPackedFloatPrecision;
+    }
 }
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/parallel/atomic.h>
+
+namespace AzNetworking
+{
+    //! @class SpscQueue
+    //! @brief unbounded lock free queue handing elements from a single producer thread to a single consumer thread.
+    //! Elements are stored in fixed size blocks. The producer links a new block when the tail block is full, and the consumer hands
+    //! emptied blocks back to the producer for reuse. Elements are written and read in place, so large elements are never copied.
+    //! Several threads may take turns producing as long as they are externally synchronized, the same applies to consuming.
+    template <typename TYPE, uint32_t BLOCK_SIZE = 32>
+    class SpscQueue
+    {
+    public:
+
+        static_assert(BLOCK_SIZE > 0, "SpscQueue blocks must hold at least one element");
+
+        SpscQueue();
+        ~SpscQueue();
+
+        //! Producer only, returns the slot the next element is written to.
+        //! The element is not visible to the consumer until Push is called, calling this again before Push returns the same slot.
+        //! @return reference to the slot of the next element, holding whatever value was last popped from it
+        TYPE& GetPushSlot();
+
+        //! Producer only, publishes the element written to the slot returned by GetPushSlot.
+        void Push();
+
+        //! Consumer only, returns the oldest published element.
+        //! @return pointer to the oldest published element, nullptr if the queue is empty
+        TYPE* Front();
+
+        //! Consumer only, removes the element returned by Front.
+        void Pop();
+
+        //! Consumer only, returns true if the queue holds no published elements.
+        //! @return boolean true if the queue is empty
+        bool IsEmpty();
+
+    private:
+
+        struct Block
+        {
+            AZStd::array<TYPE, BLOCK_SIZE> m_elements;
+            AZStd::atomic<uint32_t> m_published{ 0 };
+            AZStd::atomic<Block*> m_next{ nullptr };
+            uint32_t m_consumed = 0;
+        };
+
+        AZ_DISABLE_COPY_MOVE(SpscQueue);
+
+        //! Producer only, returns an empty block, reusing the block released by the consumer if there is one.
+        Block* AcquireBlock();
+
+        //! Consumer only, hands an emptied block back to the producer.
+        void ReleaseBlock(Block* block);
+
+        Block* m_head = nullptr; //< Block the consumer reads from
+        Block* m_tail = nullptr; //< Block the producer writes to
+        AZStd::atomic<Block*> m_spareBlock{ nullptr };
+    };
+}
+
+#include <AzNetworking/DataStructures/SpscQueue.inl>
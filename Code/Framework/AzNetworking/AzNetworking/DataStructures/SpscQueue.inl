@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+namespace AzNetworking
+{
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    inline SpscQueue<TYPE, BLOCK_SIZE>::SpscQueue()
+    {
+        m_head = new Block();
+        m_tail = m_head;
+    }
+
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    inline SpscQueue<TYPE, BLOCK_SIZE>::~SpscQueue()
+    {
+        Block* block = m_head;
+        while (block != nullptr)
+        {
+            Block* next = block->m_next.load(AZStd::memory_order_relaxed);
+            delete block;
+            block = next;
+        }
+        delete m_spareBlock.load(AZStd::memory_order_relaxed);
+    }
+
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    inline TYPE& SpscQueue<TYPE, BLOCK_SIZE>::GetPushSlot()
+    {
+        // Only the producer writes the published count, so a relaxed load sees its own latest value
+        const uint32_t published = m_tail->m_published.load(AZStd::memory_order_relaxed);
+        if (published == BLOCK_SIZE)
+        {
+            Block* block = AcquireBlock();
+            m_tail->m_next.store(block, AZStd::memory_order_release);
+            m_tail = block;
+            return block->m_elements[0];
+        }
+        return m_tail->m_elements[published];
+    }
+
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    inline void SpscQueue<TYPE, BLOCK_SIZE>::Push()
+    {
+        const uint32_t published = m_tail->m_published.load(AZStd::memory_order_relaxed);
+        AZ_Assert(published < BLOCK_SIZE, "Push called without a slot, call GetPushSlot first");
+        m_tail->m_published.store(published + 1, AZStd::memory_order_release);
+    }
+
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    inline TYPE* SpscQueue<TYPE, BLOCK_SIZE>::Front()
+    {
+        if (m_head->m_consumed == BLOCK_SIZE)
+        {
+            Block* next = m_head->m_next.load(AZStd::memory_order_acquire);
+            if (next == nullptr)
+            {
+                return nullptr;
+            }
+            // The producer linked a new block, so it no longer touches this one
+            Block* emptied = m_head;
+            m_head = next;
+            ReleaseBlock(emptied);
+        }
+
+        if (m_head->m_consumed < m_head->m_published.load(AZStd::memory_order_acquire))
+        {
+            return &m_head->m_elements[m_head->m_consumed];
+        }
+        return nullptr;
+    }
+
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    inline void SpscQueue<TYPE, BLOCK_SIZE>::Pop()
+    {
+        AZ_Assert(m_head->m_consumed < m_head->m_published.load(AZStd::memory_order_relaxed), "Pop called on an empty SpscQueue, call Front first");
+        ++m_head->m_consumed;
+    }
+
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    inline bool SpscQueue<TYPE, BLOCK_SIZE>::IsEmpty()
+    {
+        return Front() == nullptr;
+    }
+
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    inline typename SpscQueue<TYPE, BLOCK_SIZE>::Block* SpscQueue<TYPE, BLOCK_SIZE>::AcquireBlock()
+    {
+        Block* block = m_spareBlock.exchange(nullptr, AZStd::memory_order_acquire);
+        if (block == nullptr)
+        {
+            return new Block();
+        }
+
+        block->m_published.store(0, AZStd::memory_order_relaxed);
+        block->m_next.store(nullptr, AZStd::memory_order_relaxed);
+        block->m_consumed = 0;
+        return block;
+    }
+
+    template <typename TYPE, uint32_t BLOCK_SIZE>
+    inline void SpscQueue<TYPE, BLOCK_SIZE>::ReleaseBlock(Block* block)
+    {
+        // Keep a single spare block, the queue only grows past two blocks if the consumer falls behind
+        delete m_spareBlock.exchange(block, AZStd::memory_order_acq_rel);
+    }
+}
@@ -74,6 +74,31 @@ namespace AzNetworking
         //! Updates the INetworkInterface.
         virtual void Update() = 0;
 
+        //! Transmits any packets the INetworkInterface batched up since the last flush.
+        //! Called by the networking system at the end of every tick, after all gameplay systems had a chance to send.
+        virtual void FlushSends() = 0;
+
+        //! Starts staging sends, splitting them into a pipeline that can run across several threads.
+        //! While staging, sending a packet only serializes it. EncodeStagedSends then compresses and encrypts a connection's packets
+        //! and hands them to the thread calling TransmitStagedSends, which is the only thread that touches the socket.
+        //! Must be called from the thread that updates the network interface.
+        virtual void BeginStagedSends() = 0;
+
+        //! Encodes the packets a connection sent since staging began, may be called concurrently for different connections.
+        //! Must be called exactly once for every connection in the set when staging began, after the connection sent its packets.
+        //! @param connectionId identifier of the connection to encode the staged packets of
+        virtual void EncodeStagedSends(ConnectionId connectionId) = 0;
+
+        //! Transmits encoded packets. Connections transmit in ascending connection id order, a connection only starts transmitting
+        //! once its packets were encoded, so the order of datagrams on the wire doesn't depend on thread scheduling.
+        //! Must be called from the thread that called BeginStagedSends.
+        //! @return boolean true once every connection was encoded and transmitted, false if some are still being encoded
+        virtual bool TransmitStagedSends() = 0;
+
+        //! Encodes and transmits whatever is left, then stops staging sends.
+        //! Must be called from the thread that called BeginStagedSends, once no other thread is encoding.
+        virtual void EndStagedSends() = 0;
+
         //! A helper function that transmits a packet on this connection reliably.
         //! Note that a packetId is not returned here, since retransmits may cause the packetId to change
         //! @param connectionId identifier of the connection to send to
@@ -28,6 +28,7 @@ namespace AzNetworking
     class NetworkingSystemComponent final
         : public AZ::Component
         , public AZ::SystemTickBus::Handler
+        , public AZ::TickBus::Handler
         , public INetworking
     {
     public:
@@ -51,6 +52,12 @@ namespace AzNetworking
         void OnSystemTick() override;
         //! @}
 
+        //! AZ::TickBus::Handler overrides.
+        //! @{
+        void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+        int GetTickOrder() override;
+        //! @}
+
         //! INetworking overrides.
         //! @{
         INetworkInterface* CreateNetworkInterface(const AZ::Name& name, ProtocolType protocolType, TrustZone trustZone, IConnectionListener& listener) override;
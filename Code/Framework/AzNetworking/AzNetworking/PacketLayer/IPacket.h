@@ -49,6 +49,10 @@ namespace AzNetworking
         //! @param serializer ISerializer instance to use for serialization
         //! @return boolean true for success, false for serialization failure
         virtual bool Serialize(ISerializer& serializer) = 0;
+
+        //! Returns true if this packet should always be bit packed on transports that support it, regardless of connection settings.
+        //! @return boolean true if this packet should be bit packed
+        virtual bool IsBitPacked() const { return false; }
     };
 }
 
@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/Serialization/NetworkBitInputSerializer.h>
+#include <AzNetworking/Utilities/QuantizedValues.h>
+#include <AzCore/std/algorithm.h>
+
+namespace AzNetworking
+{
+    NetworkBitInputSerializer::NetworkBitInputSerializer(uint8_t* buffer, uint32_t bufferCapacity, float floatPrecision)
+        : m_bitPosition(0)
+        , m_bufferCapacity(bufferCapacity)
+        , m_floatPrecision(floatPrecision)
+        , m_buffer(buffer)
+    {
+        ;
+    }
+
+    SerializerMode NetworkBitInputSerializer::GetSerializerMode() const
+    {
+        return SerializerMode::ReadFromObject;
+    }
+
+    bool NetworkBitInputSerializer::Serialize(bool& value, [[maybe_unused]] const char* name)
+    {
+        return WriteBits(value ? 1 : 0, 1);
+    }
+
+    bool NetworkBitInputSerializer::Serialize(int8_t& value, [[maybe_unused]] const char* name, int8_t minValue, int8_t maxValue)
+    {
+        return SerializeBoundedValue<int8_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitInputSerializer::Serialize(int16_t& value, [[maybe_unused]] const char* name, int16_t minValue, int16_t maxValue)
+    {
+        return SerializeBoundedValue<int16_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitInputSerializer::Serialize(int32_t& value, [[maybe_unused]] const char* name, int32_t minValue, int32_t maxValue)
+    {
+        return SerializeBoundedValue<int32_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitInputSerializer::Serialize(long& value, [[maybe_unused]] const char* name, long minValue, long maxValue)
+    {
+        return SerializeBoundedValue<long>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitInputSerializer::Serialize(AZ::s64& value, [[maybe_unused]] const char* name, AZ::s64 minValue, AZ::s64 maxValue)
+    {
+        return SerializeBoundedValue<AZ::s64>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitInputSerializer::Serialize(uint8_t& value, [[maybe_unused]] const char* name, uint8_t minValue, uint8_t maxValue)
+    {
+        return SerializeBoundedValue<uint8_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitInputSerializer::Serialize(uint16_t& value, [[maybe_unused]] const char* name, uint16_t minValue, uint16_t maxValue)
+    {
+        return SerializeBoundedValue<uint16_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitInputSerializer::Serialize(uint32_t& value, [[maybe_unused]] const char* name, uint32_t minValue, uint32_t maxValue)
+    {
+        return SerializeBoundedValue<uint32_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitInputSerializer::Serialize(unsigned long& value, [[maybe_unused]] const char* name, unsigned long minValue, unsigned long maxValue)
+    {
+        return SerializeBoundedValue<unsigned long>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitInputSerializer::Serialize(AZ::u64& value, [[maybe_unused]] const char* name, AZ::u64 minValue, AZ::u64 maxValue)
+    {
+        return SerializeBoundedValue<AZ::u64>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitInputSerializer::Serialize(float& value, [[maybe_unused]] const char* name, float minValue, float maxValue)
+    {
+        const uint32_t bitCount = GetQuantizedFloatBitCount(minValue, maxValue, m_floatPrecision);
+        if (bitCount > 0)
+        {
+            const uint32_t maxQuantizedValue = static_cast<uint32_t>((uint64_t(1) << bitCount) - 1);
+            return WriteBits(QuantizeFloat(value, minValue, maxValue, maxQuantizedValue), bitCount);
+        }
+
+        // Unbounded or too wide a range to quantize at the requested precision, write the raw bits
+        uint32_t rawValue = 0;
+        memcpy(&rawValue, &value, sizeof(float));
+        return WriteBits(rawValue, 32);
+    }
+
+    bool NetworkBitInputSerializer::Serialize(double& value, [[maybe_unused]] const char* name, [[maybe_unused]] double minValue, [[maybe_unused]] double maxValue)
+    {
+        uint64_t rawValue = 0;
+        memcpy(&rawValue, &value, sizeof(double));
+        return WriteBits(rawValue, 64);
+    }
+
+    bool NetworkBitInputSerializer::SerializeBytes(uint8_t* buffer, uint32_t bufferCapacity, [[maybe_unused]] bool isString, uint32_t& outSize, [[maybe_unused]] const char* name)
+    {
+        return SerializeBoundedValue<uint32_t>(0, bufferCapacity, outSize) && SerializeBytes(reinterpret_cast<const uint8_t*>(buffer), outSize);
+    }
+
+    bool NetworkBitInputSerializer::BeginObject([[maybe_unused]] const char* name)
+    {
+        return true;
+    }
+
+    bool NetworkBitInputSerializer::EndObject([[maybe_unused]] const char* name)
+    {
+        return true;
+    }
+
+    const uint8_t* NetworkBitInputSerializer::GetBuffer() const
+    {
+        return m_buffer;
+    }
+
+    uint32_t NetworkBitInputSerializer::GetCapacity() const
+    {
+        return m_bufferCapacity;
+    }
+
+    uint32_t NetworkBitInputSerializer::GetSize() const
+    {
+        return static_cast<uint32_t>((m_bitPosition + 7) / 8);
+    }
+
+    bool NetworkBitInputSerializer::CopyToBuffer(const uint8_t* data, uint32_t dataSize)
+    {
+        return NetworkBitInputSerializer::SerializeBytes(data, dataSize);
+    }
+
+    template <typename ORIGINAL_TYPE>
+    bool NetworkBitInputSerializer::SerializeBoundedValue(ORIGINAL_TYPE minValue, ORIGINAL_TYPE maxValue, ORIGINAL_TYPE inputValue)
+    {
+        m_serializerValid &= (inputValue >= minValue);
+        m_serializerValid &= (inputValue <= maxValue);
+        const uint64_t valueRange = static_cast<uint64_t>(maxValue) - static_cast<uint64_t>(minValue);
+        const uint64_t adjustedValue = static_cast<uint64_t>(inputValue) - static_cast<uint64_t>(minValue);
+        return m_serializerValid && WriteBits(adjustedValue, GetRequiredBitCount(valueRange));
+    }
+
+    bool NetworkBitInputSerializer::WriteBits(uint64_t value, uint32_t bitCount)
+    {
+        if (!m_serializerValid || ((m_bitPosition + bitCount + 7) / 8 > m_bufferCapacity))
+        {
+            // Keep the failed boolean so we can verify serialization success
+            m_serializerValid = false;
+            return false;
+        }
+
+        // Bits are packed least significant first, a partially written byte keeps its lower bits
+        while (bitCount > 0)
+        {
+            const uint64_t byteIndex = m_bitPosition / 8;
+            const uint32_t bitOffset = static_cast<uint32_t>(m_bitPosition % 8);
+            const uint32_t bitsToWrite = AZStd::min(8 - bitOffset, bitCount);
+            const uint8_t bits = static_cast<uint8_t>((value & ((1u << bitsToWrite) - 1)) << bitOffset);
+            m_buffer[byteIndex] = (bitOffset == 0) ? bits : static_cast<uint8_t>(m_buffer[byteIndex] | bits);
+            value >>= bitsToWrite;
+            bitCount -= bitsToWrite;
+            m_bitPosition += bitsToWrite;
+        }
+        return true;
+    }
+
+    bool NetworkBitInputSerializer::SerializeBytes(const uint8_t* data, uint32_t count)
+    {
+        const uint64_t currSize = (m_bitPosition + 7) / 8;
+        const uint64_t nextSize = currSize + count;
+
+        if (!m_serializerValid || (nextSize > m_bufferCapacity))
+        {
+            // Keep the failed boolean so we can verify serialization success
+            m_serializerValid = false;
+            return false;
+        }
+
+        // Byte arrays are aligned to the next byte boundary so they can be copied directly
+        memcpy(m_buffer + currSize, data, count);
+        m_bitPosition = nextSize * 8;
+        return true;
+    }
+}
@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/Serialization/NetworkBitOutputSerializer.h>
+#include <AzNetworking/Utilities/QuantizedValues.h>
+#include <AzCore/std/algorithm.h>
+
+namespace AzNetworking
+{
+    NetworkBitOutputSerializer::NetworkBitOutputSerializer(const uint8_t* buffer, uint32_t bufferCapacity, float floatPrecision)
+        : m_bitPosition(0)
+        , m_bufferCapacity(bufferCapacity)
+        , m_floatPrecision(floatPrecision)
+        , m_buffer(buffer)
+    {
+        ;
+    }
+
+    SerializerMode NetworkBitOutputSerializer::GetSerializerMode() const
+    {
+        return SerializerMode::WriteToObject;
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(bool& value, [[maybe_unused]] const char* name)
+    {
+        const uint64_t bitValue = ReadBits(1);
+        value = m_serializerValid ? (bitValue > 0) : value;
+        return m_serializerValid;
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(int8_t& value, [[maybe_unused]] const char* name, int8_t minValue, int8_t maxValue)
+    {
+        return SerializeBoundedValue<int8_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(int16_t& value, [[maybe_unused]] const char* name, int16_t minValue, int16_t maxValue)
+    {
+        return SerializeBoundedValue<int16_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(int32_t& value, [[maybe_unused]] const char* name, int32_t minValue, int32_t maxValue)
+    {
+        return SerializeBoundedValue<int32_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(long& value, [[maybe_unused]] const char* name, long minValue, long maxValue)
+    {
+        return SerializeBoundedValue<long>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(AZ::s64& value, [[maybe_unused]] const char* name, AZ::s64 minValue, AZ::s64 maxValue)
+    {
+        return SerializeBoundedValue<AZ::s64>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(uint8_t& value, [[maybe_unused]] const char* name, uint8_t minValue, uint8_t maxValue)
+    {
+        return SerializeBoundedValue<uint8_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(uint16_t& value, [[maybe_unused]] const char* name, uint16_t minValue, uint16_t maxValue)
+    {
+        return SerializeBoundedValue<uint16_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(uint32_t& value, [[maybe_unused]] const char* name, uint32_t minValue, uint32_t maxValue)
+    {
+        return SerializeBoundedValue<uint32_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(unsigned long& value, [[maybe_unused]] const char* name, unsigned long minValue, unsigned long maxValue)
+    {
+        return SerializeBoundedValue<unsigned long>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(AZ::u64& value, [[maybe_unused]] const char* name, AZ::u64 minValue, AZ::u64 maxValue)
+    {
+        return SerializeBoundedValue<AZ::u64>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(float& value, [[maybe_unused]] const char* name, float minValue, float maxValue)
+    {
+        const uint32_t bitCount = GetQuantizedFloatBitCount(minValue, maxValue, m_floatPrecision);
+        if (bitCount > 0)
+        {
+            const uint32_t maxQuantizedValue = static_cast<uint32_t>((uint64_t(1) << bitCount) - 1);
+            const uint32_t quantizedValue = static_cast<uint32_t>(ReadBits(bitCount));
+            value = m_serializerValid ? DequantizeFloat(quantizedValue, minValue, maxValue, maxQuantizedValue) : value;
+            return m_serializerValid;
+        }
+
+        const uint32_t rawValue = static_cast<uint32_t>(ReadBits(32));
+        if (m_serializerValid)
+        {
+            memcpy(&value, &rawValue, sizeof(float));
+        }
+        return m_serializerValid;
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(double& value, [[maybe_unused]] const char* name, [[maybe_unused]] double minValue, [[maybe_unused]] double maxValue)
+    {
+        const uint64_t rawValue = ReadBits(64);
+        if (m_serializerValid)
+        {
+            memcpy(&value, &rawValue, sizeof(double));
+        }
+        return m_serializerValid;
+    }
+
+    bool NetworkBitOutputSerializer::SerializeBytes(uint8_t* buffer, uint32_t bufferCapacity, [[maybe_unused]] bool isString, uint32_t& outSize, [[maybe_unused]] const char* name)
+    {
+        return SerializeBoundedValue<uint32_t>(0, bufferCapacity, outSize) && SerializeBytes(buffer, outSize);
+    }
+
+    bool NetworkBitOutputSerializer::BeginObject([[maybe_unused]] const char* name)
+    {
+        return true;
+    }
+
+    bool NetworkBitOutputSerializer::EndObject([[maybe_unused]] const char* name)
+    {
+        return true;
+    }
+
+    const uint8_t* NetworkBitOutputSerializer::GetBuffer() const
+    {
+        return m_buffer;
+    }
+
+    uint32_t NetworkBitOutputSerializer::GetCapacity() const
+    {
+        return m_bufferCapacity;
+    }
+
+    uint32_t NetworkBitOutputSerializer::GetSize() const
+    {
+        return GetReadSize();
+    }
+
+    template <typename ORIGINAL_TYPE>
+    bool NetworkBitOutputSerializer::SerializeBoundedValue(ORIGINAL_TYPE minValue, ORIGINAL_TYPE maxValue, ORIGINAL_TYPE& outValue)
+    {
+        const uint64_t valueRange = static_cast<uint64_t>(maxValue) - static_cast<uint64_t>(minValue);
+        const uint64_t adjustedValue = ReadBits(GetRequiredBitCount(valueRange));
+        m_serializerValid &= (adjustedValue <= valueRange);
+        outValue = m_serializerValid ? static_cast<ORIGINAL_TYPE>(static_cast<uint64_t>(minValue) + adjustedValue) : outValue;
+        return m_serializerValid;
+    }
+
+    uint64_t NetworkBitOutputSerializer::ReadBits(uint32_t bitCount)
+    {
+        if (!m_serializerValid || ((m_bitPosition + bitCount + 7) / 8 > m_bufferCapacity))
+        {
+            // Keep the failed boolean so we can verify serialization success
+            m_serializerValid = false;
+            return 0;
+        }
+
+        uint64_t result = 0;
+        uint32_t resultShift = 0;
+        while (resultShift < bitCount)
+        {
+            const uint64_t byteIndex = m_bitPosition / 8;
+            const uint32_t bitOffset = static_cast<uint32_t>(m_bitPosition % 8);
+            const uint32_t bitsToRead = AZStd::min(8 - bitOffset, bitCount - resultShift);
+            const uint64_t bits = (m_buffer[byteIndex] >> bitOffset) & ((1u << bitsToRead) - 1);
+            result |= bits << resultShift;
+            resultShift += bitsToRead;
+            m_bitPosition += bitsToRead;
+        }
+        return result;
+    }
+
+    bool NetworkBitOutputSerializer::SerializeBytes(uint8_t* data, uint32_t count)
+    {
+        const uint64_t currSize = GetReadSize();
+        const uint64_t nextSize = currSize + count;
+
+        if (!m_serializerValid || (nextSize > m_bufferCapacity))
+        {
+            // Keep the failed boolean so we can verify serialization success
+            m_serializerValid = false;
+            return false;
+        }
+
+        memcpy(data, m_buffer + currSize, count);
+        m_bitPosition = nextSize * 8;
+        return true;
+    }
+}
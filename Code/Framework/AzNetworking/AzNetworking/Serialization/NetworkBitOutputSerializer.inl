@@ -0,0 +1,27 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+namespace AzNetworking
+{
+    inline const uint8_t* NetworkBitOutputSerializer::GetUnreadData() const
+    {
+        return m_buffer + GetReadSize();
+    }
+
+    inline uint32_t NetworkBitOutputSerializer::GetUnreadSize() const
+    {
+        return (m_bufferCapacity - GetReadSize());
+    }
+
+    inline uint32_t NetworkBitOutputSerializer::GetReadSize() const
+    {
+        return static_cast<uint32_t>((m_bitPosition + 7) / 8);
+    }
+}
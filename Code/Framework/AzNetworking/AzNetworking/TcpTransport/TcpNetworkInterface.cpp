@@ -105,6 +105,31 @@ namespace AzNetworking
         return connectionId;
     }
 
+    void TcpNetworkInterface::FlushSends()
+    {
+        // Tcp sends are written to the socket immediately
+    }
+
+    void TcpNetworkInterface::BeginStagedSends()
+    {
+        // Tcp sends are written to the socket immediately, there is nothing to stage
+    }
+
+    void TcpNetworkInterface::EncodeStagedSends([[maybe_unused]] ConnectionId connectionId)
+    {
+        ;
+    }
+
+    bool TcpNetworkInterface::TransmitStagedSends()
+    {
+        return true;
+    }
+
+    void TcpNetworkInterface::EndStagedSends()
+    {
+        ;
+    }
+
     void TcpNetworkInterface::Update()
     {
         const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
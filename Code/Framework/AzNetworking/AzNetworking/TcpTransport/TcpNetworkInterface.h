@@ -94,6 +94,11 @@ namespace AzNetworking
         bool Listen(uint16_t port) override;
         ConnectionId Connect(const IpAddress& remoteAddress, uint16_t localPort = 0) override;
         void Update() override;
+        void FlushSends() override;
+        void BeginStagedSends() override;
+        void EncodeStagedSends(ConnectionId connectionId) override;
+        bool TransmitStagedSends() override;
+        void EndStagedSends() override;
         bool SendReliablePacket(ConnectionId connectionId, const IPacket& packet) override;
         PacketId SendUnreliablePacket(ConnectionId connectionId, const IPacket& packet) override;
         bool WasPacketAcked(ConnectionId connectionId, PacketId packetId) override;
@@ -69,6 +69,24 @@ namespace AzNetworking
         UdpSocket::Close();
     }
 
+    int32_t DtlsSocket::Encrypt(const uint8_t* data, uint32_t size, DtlsEndpoint& dtlsEndpoint, uint8_t* outData, uint32_t outSize) const
+    {
+        if (dtlsEndpoint.m_sslSocket == nullptr)
+        {
+            AZLOG_ERROR("Trying to encrypt on an open socketfd, but with a nullptr ssl socket wrapper!");
+            return SocketOpResultErrorNoSsl;
+        }
+
+#if AZ_TRAIT_USE_OPENSSL
+        // Write out the packet we were requested to send
+        SSL_write(dtlsEndpoint.m_sslSocket, data, size);
+        return BIO_read(dtlsEndpoint.m_writeBio, outData, outSize);
+#else
+        AZ_UNUSED(data, size, outData, outSize);
+        return 0;
+#endif
+    }
+
     int32_t DtlsSocket::SendInternal(const IpAddress& address, const uint8_t* data, uint32_t size, bool encrypt, DtlsEndpoint& dtlsEndpoint) const
     {
         if (!encrypt)
@@ -77,25 +95,17 @@ namespace AzNetworking
             return UdpSocket::SendInternal(address, data, size, encrypt, dtlsEndpoint);
         }
 
-        if (dtlsEndpoint.m_sslSocket == nullptr)
+        uint8_t encrpytedSendBuffer[MaxUdpTransmissionUnit];
+        const int32_t sentBytesEnc = Encrypt(data, size, dtlsEndpoint, encrpytedSendBuffer, sizeof(encrpytedSendBuffer));
+        if (sentBytesEnc <= 0)
         {
-            AZLOG_ERROR("Trying to send on an open socketfd, but with a nullptr ssl socket wrapper!");
-            return SocketOpResultErrorNoSsl;
+            return (sentBytesEnc < 0) ? sentBytesEnc : 0;
         }
 
-#if AZ_TRAIT_USE_OPENSSL
-        uint8_t encrpytedSendBuffer[MaxUdpTransmissionUnit];
-        // Write out the packet we were requested to send
-        SSL_write(dtlsEndpoint.m_sslSocket, data, size);
-        const int32_t sentBytesEnc = BIO_read(dtlsEndpoint.m_writeBio, encrpytedSendBuffer, sizeof(encrpytedSendBuffer));
-
         // Track encryption metrics
         m_sentBytesEncryptionInflation += aznumeric_cast<uint32_t>(sentBytesEnc - aznumeric_cast<int32_t>(size));
         m_sentPacketsEncrypted++;
 
         return UdpSocket::SendInternal(address, encrpytedSendBuffer, sentBytesEnc, encrypt, dtlsEndpoint);
-#else
-        return 0;
-#endif
     }
 }
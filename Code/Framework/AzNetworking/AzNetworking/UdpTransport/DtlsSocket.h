@@ -55,6 +55,15 @@ namespace AzNetworking
         //! Closes an open socket.
         void Close() override;
 
+        //! Encrypts a payload for the endpoint without sending it, so it can be transmitted later by SendEncrypted.
+        //! @param data         pointer to the data to encrypt
+        //! @param size         size of the payload in bytes
+        //! @param dtlsEndpoint data required for DTLS encryption
+        //! @param outData      buffer to write the encrypted payload to
+        //! @param outSize      capacity of the output buffer in bytes
+        //! @return size of the encrypted payload in bytes, <= 0 on error
+        int32_t Encrypt(const uint8_t* data, uint32_t size, DtlsEndpoint& dtlsEndpoint, uint8_t* outData, uint32_t outSize) const override;
+
     private:
 
         int32_t SendInternal(const IpAddress& address, const uint8_t* data, uint32_t size, bool encrypt, DtlsEndpoint& dtlsEndpoint) const override;
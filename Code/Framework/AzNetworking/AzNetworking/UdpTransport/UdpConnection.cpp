@@ -166,8 +166,7 @@ namespace AzNetworking
         }
     }
 
-    void UdpConnection::ProcessSent(PacketId packetId, [[maybe_unused]] const IPacket& packet, 
-        uint32_t packetSize, [[maybe_unused]] ReliabilityType reliability)
+    void UdpConnection::ProcessSent(PacketId packetId, uint32_t packetSize, [[maybe_unused]] ReliabilityType reliability)
     {
         const AZ::TimeMs currentTimeMs = AZ::GetElapsedTimeMs();
 
@@ -219,7 +218,7 @@ namespace AzNetworking
         return PacketTimeoutResult::Lost;
     }
 
-    bool UdpConnection::ProcessReceived(UdpPacketHeader& header, [[maybe_unused]] const NetworkOutputSerializer& serializer, 
+    bool UdpConnection::ProcessReceived(UdpPacketHeader& header, [[maybe_unused]] const ISerializer& serializer, 
         uint32_t packetSize, AZ::TimeMs currentTimeMs)
     {
         if (!m_packetTracker.ProcessReceived(this, header))
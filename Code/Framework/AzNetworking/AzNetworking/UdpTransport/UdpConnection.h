@@ -14,6 +14,7 @@
 #include <AzNetworking/UdpTransport/UdpPacketTracker.h>
 #include <AzNetworking/UdpTransport/UdpReliableQueue.h>
 #include <AzNetworking/UdpTransport/UdpFragmentQueue.h>
+#include <AzNetworking/DataStructures/SpscQueue.h>
 #include <AzCore/Console/ILogger.h>
 
 namespace AzNetworking
@@ -107,10 +108,9 @@ namespace AzNetworking
 
         //! Process a packet for sending.
         //! @param packetId   identifier of the packet being sent
-        //! @param packet     reference to the packet being transmitted
         //! @param packetSize packet size in bytes
         //! @param reliability whether or not to guarantee delivery
-        void ProcessSent(PacketId packetId, const IPacket& packet, uint32_t packetSize, ReliabilityType reliability);
+        void ProcessSent(PacketId packetId, uint32_t packetSize, ReliabilityType reliability);
 
         //! Process a timed out packet header.
         //! @param packetId    identifier of the packet that timed out
@@ -120,11 +120,11 @@ namespace AzNetworking
 
         //! Process a received packet header.
         //! @param header        the packet header received to process
-        //! @param serializer    the output serializer containing the transmitted packet data
+        //! @param serializer    the serializer containing the transmitted packet data
         //! @param packetSize    the size of the received packet in bytes
         //! @param currentTimeMs current wall clock time in milliseconds
         //! @return boolean true on successful handling of the received header
-        bool ProcessReceived(UdpPacketHeader& header, const NetworkOutputSerializer& serializer, uint32_t packetSize, AZ::TimeMs currentTimeMs);
+        bool ProcessReceived(UdpPacketHeader& header, const ISerializer& serializer, uint32_t packetSize, AZ::TimeMs currentTimeMs);
 
         //! Handle a core network packet.
         //! @param listener   a connection listener to receive connection related events
@@ -151,6 +151,28 @@ namespace AzNetworking
         uint32_t  m_timeoutCounter = 0;
 
         AZStd::mutex m_sendPacketMutex;
+
+        //! A packet sent while the network interface stages sends, see UdpNetworkInterface::BeginStagedSends.
+        //! An empty buffer marks a packet held back by the DTLS handshake or that failed encryption, which only registers for a timeout.
+        struct StagedPacket
+        {
+            ChunkBuffer m_buffer;
+            PacketId m_packetId = InvalidPacketId;
+            ReliabilityType m_reliability = ReliabilityType::Unreliable;
+            uint32_t m_serializedSize = 0; //< Size before compression
+            uint32_t m_sentSize = 0; //< Size after compression, before encryption
+            int64_t m_compressedBytesDelta = 0;
+            bool m_compress = false;
+            bool m_encrypt = false;
+            bool m_encrypted = false;
+        };
+
+        //! Serialized packets waiting to be compressed and encrypted, guarded by m_sendPacketMutex.
+        AZStd::vector<StagedPacket> m_serializedPackets;
+        //! Encoded packets waiting for the network thread to transmit them.
+        SpscQueue<StagedPacket> m_encodedPackets;
+        //! Set once the connection's staged packets for the current pipeline pass have been encoded.
+        AZStd::atomic_bool m_stagedPacketsEncoded{ false };
     };
 }
 
@@ -9,6 +9,7 @@
 #include <AzNetworking/UdpTransport/UdpFragmentQueue.h>
 #include <AzNetworking/UdpTransport/UdpConnection.h>
 #include <AzNetworking/UdpTransport/UdpPacketHeader.h>
+#include <AzNetworking/Serialization/NetworkBitOutputSerializer.h>
 #include <AzNetworking/Serialization/NetworkOutputSerializer.h>
 #include <AzNetworking/Utilities/NetworkCommon.h>
 #include <AzCore/Console/IConsole.h>
@@ -140,15 +141,20 @@ namespace AzNetworking
         m_packetFragments.erase(fragmentSequence);
 
         NetworkOutputSerializer networkSerializer(buffer.GetBuffer(), static_cast<uint32_t>(buffer.GetSize()));
+
+        // First, serialize out the flags, they're always byte aligned and tell us how the rest of the packet was written
+        if (!header.SerializePacketFlags(networkSerializer))
         {
-            ISerializer& networkISerializer = networkSerializer; // To get the default typeinfo parameters in ISerializer
+            AZLOG(NET_FragmentQueue, "Reconstructed fragmented packet failed packet flags serialization");
+            return PacketDispatchResult::Failure;
+        }
 
-            // First, serialize out the header
-            if (!header.SerializePacketFlags(networkSerializer))
-            {
-                AZLOG(NET_FragmentQueue, "Reconstructed fragmented packet failed packet flags serialization");
-                return PacketDispatchResult::Failure;
-            }
+        NetworkBitOutputSerializer bitSerializer(networkSerializer.GetUnreadData(), networkSerializer.GetUnreadSize(), connection->GetBitPackedFloatPrecision());
+        ISerializer& packetSerializer = header.IsPacketFlagSet(PacketFlag::BitPacked)
+            ? static_cast<ISerializer&>(bitSerializer)
+            : networkSerializer;
+        {
+            ISerializer& networkISerializer = packetSerializer; // To get the default typeinfo parameters in ISerializer
 
             if (!networkISerializer.Serialize(header, "Header"))
             {
@@ -160,11 +166,11 @@ namespace AzNetworking
         PacketDispatchResult handledPacket;
         if (header.GetPacketType() < aznumeric_cast<PacketType>(CorePackets::PacketType::MAX))
         {
-            handledPacket = connection->HandleCorePacket(connectionListener, header, networkSerializer);
+            handledPacket = connection->HandleCorePacket(connectionListener, header, packetSerializer);
         }
         else
         {
-            handledPacket = connectionListener.OnPacketReceived(connection, header, networkSerializer);
+            handledPacket = connectionListener.OnPacketReceived(connection, header, packetSerializer);
         }
 
         return handledPacket;
@@ -11,6 +11,8 @@
 #include <AzNetworking/UdpTransport/UdpConnection.h>
 #include <AzNetworking/UdpTransport/DtlsSocket.h>
 #include <AzNetworking/UdpTransport/UdpSocket.h>
+#include <AzNetworking/Serialization/NetworkBitInputSerializer.h>
+#include <AzNetworking/Serialization/NetworkBitOutputSerializer.h>
 #include <AzNetworking/Serialization/NetworkInputSerializer.h>
 #include <AzNetworking/Serialization/NetworkOutputSerializer.h>
 #include <AzNetworking/Framework/ICompressor.h>
@@ -18,6 +20,7 @@
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/ILogger.h>
 #include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/sort.h>
 
 namespace AzNetworking
 {
@@ -38,6 +41,8 @@ namespace AzNetworking
     AZ_CVAR(float, net_RttFudgeScalar, 2.0f, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Scalar value to multiply computed Rtt by to determine an optimal packet timeout threshold");
     AZ_CVAR(uint32_t, net_FragmentedHeaderOverhead, 32, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "A fudge overhead value to take out of fragmented packet payloads");
     AZ_CVAR(bool, net_FragmentsAlwaysReliable, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Whether fragmented packets should be reliable by default or use their source packet's reliability type");
+    AZ_CVAR(bool, net_UdpBitPackPackets, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "If true, new Udp connections bit pack all packets they send, writing bounded values with only the bits their range needs");
+    AZ_CVAR(float, net_UdpBitPackedFloatPrecision, DefaultBitPackedFloatPrecision, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Largest error allowed when quantizing bounded floats in bit packed packets, must match on both endpoints");
     AZ_CVAR(AZ::CVarFixedString, net_UdpCompressor, "MultiplayerCompressor", nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "UDP compressor to use."); // WARN: similar to encryption this needs to be set once and only once before creating the network interface
 
     static uint64_t ConstructTimeoutId(ConnectionId connectionId, PacketId packetId, ReliabilityType reliability)
@@ -153,6 +158,7 @@ namespace AzNetworking
         const TimeoutId timeoutId = m_connectionTimeoutQueue.RegisterItem(aznumeric_cast<uint64_t>(connectionId), timeoutTimeMs);
 
         AZStd::unique_ptr<UdpConnection> connection = AZStd::make_unique<UdpConnection>(connectionId, remoteAddress, *this, ConnectionRole::Connector);
+        connection->SetPacketBitPacking(net_UdpBitPackPackets, net_UdpBitPackedFloatPrecision);
         UdpPacketEncodingBuffer dtlsData;
         m_socket->ConnectDtlsEndpoint(connection->GetDtlsEndpoint(), remoteAddress, dtlsData);
 
@@ -276,7 +282,11 @@ namespace AzNetworking
             else
             {
                 // Deserialize the packet header
-                NetworkOutputSerializer packetSerializer(decodedPacketData, decodedPacketSize);
+                NetworkOutputSerializer networkSerializer(decodedPacketData, decodedPacketSize);
+                NetworkBitOutputSerializer bitSerializer(decodedPacketData, decodedPacketSize, connection->GetBitPackedFloatPrecision());
+                ISerializer& packetSerializer = header.IsPacketFlagSet(PacketFlag::BitPacked)
+                    ? static_cast<ISerializer&>(bitSerializer)
+                    : networkSerializer;
                 ISerializer& serializer = packetSerializer; // To get the default typeinfo parameters in ISerializer
                 if (!serializer.Serialize(header, "Header"))
                 {
@@ -339,12 +349,16 @@ namespace AzNetworking
         m_packetTimeoutQueue.UpdateTimeouts([this](TimeoutQueue::TimeoutItem& item) { return HandlePacketTimeout(item); }, static_cast<int32_t>(net_MaxTimeoutsPerFrame));
 
         // Delete any connections we've disconnected
-        for (RemovedConnection& removedConnection : m_removedConnections)
+        AZStd::vector<RemovedConnection> removedConnections;
+        {
+            AZStd::lock_guard lock(m_removedConnectionsMutex);
+            removedConnections.swap(m_removedConnections);
+        }
+        for (RemovedConnection& removedConnection : removedConnections)
         {
             m_connectionListener.OnDisconnect(removedConnection.m_connection, removedConnection.m_reason, removedConnection.m_endpoint);
             m_connectionSet.DeleteConnection(removedConnection.m_connection->GetConnectionId()); // Will delete the connection
         }
-        m_removedConnections.clear();
 
         // Update metrics
         GetMetrics().m_sendPackets = m_socket->GetSentPackets();
@@ -358,6 +372,77 @@ namespace AzNetworking
         GetMetrics().m_updateTimeMs += AZ::GetElapsedTimeMs() - startTimeMs;
     }
 
+    void UdpNetworkInterface::FlushSends()
+    {
+        m_socket->FlushSends();
+    }
+
+    void UdpNetworkInterface::BeginStagedSends()
+    {
+        AZ_Assert(!m_stagingSends, "BeginStagedSends called while already staging sends");
+
+        m_stagedConnections.clear();
+        m_connectionSet.VisitConnections([this](IConnection& connection)
+        {
+            UdpConnection& udpConnection = static_cast<UdpConnection&>(connection);
+            udpConnection.m_stagedPacketsEncoded = false;
+            m_stagedConnections.push_back(&udpConnection);
+        });
+        AZStd::sort(m_stagedConnections.begin(), m_stagedConnections.end(), [](const UdpConnection* lhs, const UdpConnection* rhs)
+        {
+            return lhs->GetConnectionId() < rhs->GetConnectionId();
+        });
+        m_stagedTransmitIndex = 0;
+        m_stagingSends = true;
+    }
+
+    void UdpNetworkInterface::EncodeStagedSends(ConnectionId connectionId)
+    {
+        UdpConnection* connection = static_cast<UdpConnection*>(m_connectionSet.GetConnection(connectionId));
+        if (connection == nullptr)
+        {
+            return;
+        }
+
+        {
+            AZStd::lock_guard lock(connection->m_sendPacketMutex);
+            EncodeStagedPackets(*connection);
+        }
+        connection->m_stagedPacketsEncoded = true;
+    }
+
+    bool UdpNetworkInterface::TransmitStagedSends()
+    {
+        AZ_Assert(m_stagingSends, "TransmitStagedSends called without staging sends");
+
+        // Connections transmit in order and only once encoded, the encoding thread is done with the connection by then
+        for (; m_stagedTransmitIndex < m_stagedConnections.size(); ++m_stagedTransmitIndex)
+        {
+            UdpConnection& connection = *m_stagedConnections[m_stagedTransmitIndex];
+            if (!connection.m_stagedPacketsEncoded)
+            {
+                return false;
+            }
+            TransmitEncodedPackets(connection);
+        }
+        return true;
+    }
+
+    void UdpNetworkInterface::EndStagedSends()
+    {
+        // Sends read the staging flag under the connection's send mutex, so once each mutex was taken below nothing else gets staged
+        m_stagingSends = false;
+        for (UdpConnection* connection : m_stagedConnections)
+        {
+            // Packets sent after the connection was encoded, like heartbeats from the heartbeat thread
+            AZStd::lock_guard lock(connection->m_sendPacketMutex);
+            EncodeStagedPackets(*connection);
+            TransmitEncodedPackets(*connection);
+        }
+        m_stagedConnections.clear();
+        m_socket->FlushSends();
+    }
+
     bool UdpNetworkInterface::SendReliablePacket(ConnectionId connectionId, const IPacket& packet)
     {
         IConnection* connection = m_connectionSet.GetConnection(connectionId);
@@ -470,6 +555,52 @@ namespace AzNetworking
         return true;
     }
 
+    bool UdpNetworkInterface::CompressPacket(const uint8_t* packetData, uint32_t packetSize, UdpPacketEncodingBuffer& packetBufferOut, int64_t& compressedDeltaOut) const
+    {
+        UdpPacketHeader header;
+        NetworkOutputSerializer flagReader(packetData, packetSize);
+        if (!header.SerializePacketFlags(flagReader))
+        {
+            AZLOG_ERROR("Failed to read packet flags for compression");
+            return false;
+        }
+
+        NetworkInputSerializer flagSerializer(packetBufferOut.GetBuffer(), static_cast<uint32_t>(packetBufferOut.GetCapacity()));
+        ISerializer& serializer = flagSerializer; // To get the default typeinfo parameters in ISerializer
+
+        header.SetPacketFlag(PacketFlag::Compressed, true);
+        if (!header.SerializePacketFlags(serializer))
+        {
+            AZLOG_ERROR("Failed flag serialization for compression");
+            return false;
+        }
+        const uint32_t flagSize = flagSerializer.GetSize();
+        AZ_Assert(flagSize == 1, "Flag bitfield should serialize to one byte");
+
+        // Compress the packet, make sure to offset by the size of the flag which is now serialized
+        const uint32_t payloadSize = packetSize - flagSize;
+        const uint8_t* payload = packetData + flagSize;
+        const AZStd::size_t maxSizeNeeded = m_compressor->GetMaxCompressedBufferSize(payloadSize);
+        AZStd::size_t compressionMemBytesUsed = 0;
+        const CompressorError compErr = m_compressor->Compress(payload, payloadSize, packetBufferOut.GetBuffer() + flagSize, maxSizeNeeded, compressionMemBytesUsed);
+
+        if (compErr != CompressorError::Ok)
+        {
+            AZLOG_ERROR("Failed to compress packet with error %d", aznumeric_cast<int32_t>(compErr));
+            return false;
+        }
+
+        // Only use compression if there's actual gain
+        if (compressionMemBytesUsed >= payloadSize)
+        {
+            return false;
+        }
+
+        packetBufferOut.Resize(aznumeric_cast<int32_t>(flagSize + compressionMemBytesUsed));
+        compressedDeltaOut = aznumeric_cast<int64_t>(packetBufferOut.GetSize() - compressionMemBytesUsed);
+        return true;
+    }
+
     PacketId UdpNetworkInterface::SendPacket(UdpConnection& connection, const IPacket& packet, SequenceId reliableSequence)
     {
         AZLOG(NET_DebugPacketSend, "Sending packet type %u to remote address %s", aznumeric_cast<uint32_t>(packet.GetPacketType()), connection.GetRemoteAddress().GetString().c_str());
@@ -508,26 +639,48 @@ namespace AzNetworking
         if (connection.GetDtlsEndpoint().IsConnecting() && !IsHandshakePacket(connection.GetDtlsEndpoint(), packet.GetPacketType()))
         {
             // IMPORTANT that we register with the timeout queue here, otherwise we don't have the timer to pop for reliable packets
-            RegisterWithTimeoutQueue(connection.GetConnectionId(), localPacketId, reliabilityType, connection.GetMetrics());
+            if (m_stagingSends)
+            {
+                // The timeout queue belongs to the transmitting thread, stage an empty packet that only registers the timeout
+                UdpConnection::StagedPacket& stagedPacket = connection.m_serializedPackets.emplace_back();
+                stagedPacket.m_buffer.Resize(0);
+                stagedPacket.m_packetId = localPacketId;
+                stagedPacket.m_reliability = reliabilityType;
+            }
+            else
+            {
+                RegisterWithTimeoutQueue(connection.GetConnectionId(), localPacketId, reliabilityType, connection.GetMetrics());
+            }
             AZLOG(
                 NET_DebugDtls, "Connection is still in handshake negotiation, blocking packet send for packet type %d",
                 (int)packet.GetPacketType());
             return localPacketId;
         }
 
+        const bool bitPacked = connection.IsPacketBitPackingEnabled() || packet.IsBitPacked();
+        header.SetPacketFlag(PacketFlag::BitPacked, bitPacked);
+
         UdpPacketEncodingBuffer buffer;
         {
             buffer.Resize(buffer.GetCapacity());
 
             NetworkInputSerializer networkSerializer(buffer.GetBuffer(), static_cast<uint32_t>(buffer.GetCapacity()));
-            ISerializer& serializer = networkSerializer; // To get the default typeinfo parameters in ISerializer
-
-            if (!header.SerializePacketFlags(serializer))
+            if (!header.SerializePacketFlags(networkSerializer))
             {
                 AZLOG_ERROR("PacketId %u failed flag serialization and will not be sent", aznumeric_cast<uint32_t>(localPacketId));
                 return InvalidPacketId;
             }
 
+            // The flags are always byte aligned, bit packing only applies to the header and payload that follow them
+            const uint32_t flagSize = networkSerializer.GetSize();
+            NetworkBitInputSerializer bitSerializer
+            (
+                buffer.GetBuffer() + flagSize,
+                static_cast<uint32_t>(buffer.GetCapacity()) - flagSize,
+                connection.GetBitPackedFloatPrecision()
+            );
+            ISerializer& serializer = bitPacked ? static_cast<ISerializer&>(bitSerializer) : networkSerializer; // To get the default typeinfo parameters in ISerializer
+
             if (!serializer.Serialize(header, "Header"))
             {
                 AZLOG_ERROR("PacketId %u failed header serialization and will not be sent", aznumeric_cast<uint32_t>(localPacketId));
@@ -540,7 +693,7 @@ namespace AzNetworking
                 return InvalidPacketId;
             }
 
-            buffer.Resize(serializer.GetSize());
+            buffer.Resize(bitPacked ? flagSize + bitSerializer.GetSize() : networkSerializer.GetSize());
         }
         uint32_t packetSize = static_cast<uint32_t>(buffer.GetSize());
         uint8_t* packetData = buffer.GetBuffer();
@@ -573,43 +726,33 @@ namespace AzNetworking
             return localPacketId;
         }
 
+        // If we're not connected then we're still handshaking and require packets to be unencrypted
+        const bool shouldEncrypt = !IsHandshakePacket(connection.GetDtlsEndpoint(), packet.GetPacketType());
+
+        if (m_stagingSends)
+        {
+            // Compression, encryption and transmission happen in later stages, see EncodeStagedPackets
+            UdpConnection::StagedPacket& stagedPacket = connection.m_serializedPackets.emplace_back();
+            stagedPacket.m_buffer.CopyValues(packetData, packetSize);
+            stagedPacket.m_packetId = localPacketId;
+            stagedPacket.m_reliability = reliabilityType;
+            stagedPacket.m_serializedSize = packetSize;
+            stagedPacket.m_compress = shouldCompress;
+            stagedPacket.m_encrypt = shouldEncrypt;
+            return localPacketId;
+        }
+
         UdpPacketEncodingBuffer writeBuffer;
         if (m_compressor && shouldCompress)
         {
-            NetworkInputSerializer flagSerializer(writeBuffer.GetBuffer(), static_cast<uint32_t>(writeBuffer.GetCapacity()));
-            ISerializer& serializer = flagSerializer; // To get the default typeinfo parameters in ISerializer
-
-            header.SetPacketFlag(PacketFlag::Compressed, true);
-            if (!header.SerializePacketFlags(serializer))
-            {
-                AZLOG_ERROR("PacketId %u failed flag serialization for compression and will not be sent", aznumeric_cast<uint32_t>(localPacketId));
-                return InvalidPacketId;
-            }
-            uint32_t flagSize = flagSerializer.GetSize();
-            AZ_Assert(flagSize == 1, "Flag bitfield should serialize to one byte");
-
-            // Compress the packet, make sure to offset by the size of the flag which is now serialized
-            const uint32_t payloadSize = static_cast<uint32_t>(buffer.GetSize() - flagSize);
-            uint8_t* payload = buffer.GetBuffer() + flagSize;
-            const AZStd::size_t maxSizeNeeded = m_compressor->GetMaxCompressedBufferSize(payloadSize);
-            AZStd::size_t compressionMemBytesUsed = 0;
-            CompressorError compErr = m_compressor->Compress(payload, payloadSize, writeBuffer.GetBuffer() + flagSize, maxSizeNeeded, compressionMemBytesUsed);
-
-            if (compErr != CompressorError::Ok)
-            {
-                AZLOG_ERROR("Failed to compress packet with error %d", aznumeric_cast<int32_t>(compErr));
-                return InvalidPacketId;
-            }
-
-            // Only use compression if there's actual gain
-            if (compressionMemBytesUsed < payloadSize)
+            int64_t compressedDelta = 0;
+            if (CompressPacket(packetData, packetSize, writeBuffer, compressedDelta))
             {
-                writeBuffer.Resize(aznumeric_cast<int32_t>(flagSize + compressionMemBytesUsed));
                 packetSize = static_cast<uint32_t>(writeBuffer.GetSize());
                 packetData = writeBuffer.GetBuffer();
                 // Track byte delta caused by compression
-                GetMetrics().m_sendBytesCompressedDelta += (packetSize - compressionMemBytesUsed);
-            }        
+                GetMetrics().m_sendBytesCompressedDelta += compressedDelta;
+            }
         }
 
         AZLOG(NET_Debug, "Sending local sequence id %d, remote sequence id %d, %s, reliable id: %d, ack vector %x",
@@ -621,12 +764,10 @@ namespace AzNetworking
         );
 
         AZLOG(NET_DebugDtls, "Connection is sending packet type %d", aznumeric_cast<int32_t>(packet.GetPacketType()));
-        // If we're not connected then we're still handshaking and require packets to be unencrypted
-        const bool shouldEncrypt = !IsHandshakePacket(connection.GetDtlsEndpoint(), packet.GetPacketType());
         if (m_socket->Send(address, packetData, packetSize, shouldEncrypt, connection.GetDtlsEndpoint(), connection.GetConnectionQuality()))
         {
             RegisterWithTimeoutQueue(connection.GetConnectionId(), localPacketId, reliabilityType, connection.GetMetrics());
-            connection.ProcessSent(localPacketId, packet, packetSize + UdpPacketHeaderSize, reliabilityType);
+            connection.ProcessSent(localPacketId, packetSize + UdpPacketHeaderSize, reliabilityType);
             GetMetrics().m_sendBytesUncompressed += buffer.GetSize() + UdpPacketHeaderSize + (shouldEncrypt ? DtlsPacketHeaderSize : 0);
             return localPacketId;
         }
@@ -638,6 +779,105 @@ namespace AzNetworking
         return InvalidPacketId;
     }
 
+    void UdpNetworkInterface::EncodeStagedPackets(UdpConnection& connection)
+    {
+        UdpPacketEncodingBuffer compressBuffer;
+        for (const UdpConnection::StagedPacket& serializedPacket : connection.m_serializedPackets)
+        {
+            UdpConnection::StagedPacket& encodedPacket = connection.m_encodedPackets.GetPushSlot();
+            encodedPacket.m_packetId = serializedPacket.m_packetId;
+            encodedPacket.m_reliability = serializedPacket.m_reliability;
+            encodedPacket.m_serializedSize = serializedPacket.m_serializedSize;
+            encodedPacket.m_compressedBytesDelta = 0;
+            encodedPacket.m_compress = serializedPacket.m_compress;
+            encodedPacket.m_encrypt = serializedPacket.m_encrypt;
+            encodedPacket.m_encrypted = false;
+
+            const uint8_t* packetData = serializedPacket.m_buffer.GetBuffer();
+            uint32_t packetSize = static_cast<uint32_t>(serializedPacket.m_buffer.GetSize());
+            if (packetSize == 0)
+            {
+                // Blocked by the handshake, only registers a timeout
+                encodedPacket.m_buffer.Resize(0);
+                encodedPacket.m_sentSize = 0;
+                connection.m_encodedPackets.Push();
+                continue;
+            }
+
+            if (m_compressor && serializedPacket.m_compress
+             && CompressPacket(packetData, packetSize, compressBuffer, encodedPacket.m_compressedBytesDelta))
+            {
+                packetData = compressBuffer.GetBuffer();
+                packetSize = static_cast<uint32_t>(compressBuffer.GetSize());
+            }
+            encodedPacket.m_sentSize = packetSize;
+
+            if (serializedPacket.m_encrypt && m_socket->IsEncrypted())
+            {
+                encodedPacket.m_buffer.Resize(encodedPacket.m_buffer.GetCapacity());
+                const int32_t encryptedSize = m_socket->Encrypt
+                (
+                    packetData,
+                    packetSize,
+                    connection.GetDtlsEndpoint(),
+                    encodedPacket.m_buffer.GetBuffer(),
+                    static_cast<uint32_t>(encodedPacket.m_buffer.GetCapacity())
+                );
+                if (encryptedSize <= 0)
+                {
+                    // Still register a timeout so the packet is treated as lost, reliable packets get resent
+                    AZLOG_ERROR("PacketId %u failed encryption and will not be sent", aznumeric_cast<uint32_t>(serializedPacket.m_packetId));
+                    encodedPacket.m_buffer.Resize(0);
+                    encodedPacket.m_sentSize = 0;
+                    connection.m_encodedPackets.Push();
+                    continue;
+                }
+                encodedPacket.m_buffer.Resize(encryptedSize);
+                encodedPacket.m_encrypted = true;
+            }
+            else
+            {
+                encodedPacket.m_buffer.CopyValues(packetData, packetSize);
+            }
+            connection.m_encodedPackets.Push();
+        }
+        connection.m_serializedPackets.clear();
+    }
+
+    void UdpNetworkInterface::TransmitEncodedPackets(UdpConnection& connection)
+    {
+        const IpAddress& address = connection.GetRemoteAddress();
+        while (UdpConnection::StagedPacket* encodedPacket = connection.m_encodedPackets.Front())
+        {
+            if (encodedPacket->m_buffer.GetSize() == 0)
+            {
+                RegisterWithTimeoutQueue(connection.GetConnectionId(), encodedPacket->m_packetId, encodedPacket->m_reliability, connection.GetMetrics());
+                connection.m_encodedPackets.Pop();
+                continue;
+            }
+
+            const uint8_t* packetData = encodedPacket->m_buffer.GetBuffer();
+            const uint32_t packetSize = static_cast<uint32_t>(encodedPacket->m_buffer.GetSize());
+            const bool sent = encodedPacket->m_encrypted
+                ? m_socket->SendEncrypted(address, packetData, packetSize, encodedPacket->m_sentSize, connection.GetDtlsEndpoint(), connection.GetConnectionQuality())
+                : m_socket->Send(address, packetData, packetSize, false, connection.GetDtlsEndpoint(), connection.GetConnectionQuality());
+
+            // Track byte delta caused by compression
+            GetMetrics().m_sendBytesCompressedDelta += encodedPacket->m_compressedBytesDelta;
+            if (sent)
+            {
+                RegisterWithTimeoutQueue(connection.GetConnectionId(), encodedPacket->m_packetId, encodedPacket->m_reliability, connection.GetMetrics());
+                connection.ProcessSent(encodedPacket->m_packetId, encodedPacket->m_sentSize + UdpPacketHeaderSize, encodedPacket->m_reliability);
+                GetMetrics().m_sendBytesUncompressed += encodedPacket->m_serializedSize + UdpPacketHeaderSize + (encodedPacket->m_encrypt ? DtlsPacketHeaderSize : 0);
+            }
+            else
+            {
+                AZLOG_ERROR("PacketId %u failed to send on the socket", aznumeric_cast<uint32_t>(encodedPacket->m_packetId));
+            }
+            connection.m_encodedPackets.Pop();
+        }
+    }
+
     void UdpNetworkInterface::AcceptConnection(const UdpReaderThread::ReceivedPacket& connectPacket)
     {
         if (!m_allowIncomingConnections)
@@ -696,6 +936,7 @@ namespace AzNetworking
 
         AZLOG(Debug_UdpConnect, "Accepted new Udp Connection");
         AZStd::unique_ptr<UdpConnection> connection = AZStd::make_unique<UdpConnection>(connectionId, connectPacket.m_address, *this, ConnectionRole::Acceptor);
+        connection->SetPacketBitPacking(net_UdpBitPackPackets, net_UdpBitPackedFloatPrecision);
         DtlsEndpoint::ConnectResult result = m_socket->AcceptDtlsEndpoint(connection->GetDtlsEndpoint(), connectPacket.m_address);
 
         // Transition state based on our how our socket resolved
@@ -713,6 +954,9 @@ namespace AzNetworking
         }
 
         connection->m_state = ConnectionState::Disconnecting;
+
+        // Connections may disconnect from the threads updating them while sends are staged
+        AZStd::lock_guard lock(m_removedConnectionsMutex);
         m_removedConnections.emplace_back(RemovedConnection{ connection, reason, endpoint });
     }
 
@@ -18,6 +18,8 @@
 #include <AzNetworking/DataStructures/TimeoutQueue.h>
 #include <AzCore/Threading/ThreadSafeDeque.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
 
 namespace AzNetworking
 {
@@ -109,6 +111,11 @@ namespace AzNetworking
         bool Listen(uint16_t port) override;
         ConnectionId Connect(const IpAddress& remoteAddress, uint16_t localPort = 0) override;
         void Update() override;
+        void FlushSends() override;
+        void BeginStagedSends() override;
+        void EncodeStagedSends(ConnectionId connectionId) override;
+        bool TransmitStagedSends() override;
+        void EndStagedSends() override;
         bool SendReliablePacket(ConnectionId connectionId, const IPacket& packet) override;
         PacketId SendUnreliablePacket(ConnectionId connectionId, const IPacket& packet) override;
         bool WasPacketAcked(ConnectionId connectionId, PacketId packetId) override;
@@ -145,6 +152,23 @@ namespace AzNetworking
         //! @return packet id for the transmitted packet
         PacketId SendPacket(UdpConnection& connection, const IPacket& packet, SequenceId reliableSequence);
 
+        //! Compresses a serialized packet, leaving the packet flags uncompressed and marking the packet as compressed.
+        //! @param packetData          the serialized packet, starting with its packet flags
+        //! @param packetSize          the size of the serialized packet in bytes
+        //! @param packetBufferOut     the compressed packet
+        //! @param compressedDeltaOut  on success, the byte delta to track in the compression metrics
+        //! @return boolean true if the packet was compressed, false if compression failed or didn't reduce the packet size
+        bool CompressPacket(const uint8_t* packetData, uint32_t packetSize, UdpPacketEncodingBuffer& packetBufferOut, int64_t& compressedDeltaOut) const;
+
+        //! Compresses and encrypts the packets a connection staged, and queues them for transmission.
+        //! The caller must hold the connection's send mutex.
+        //! @param connection the connection to encode the staged packets of
+        void EncodeStagedPackets(UdpConnection& connection);
+
+        //! Transmits the encoded packets a connection queued, only called from the thread that began staging.
+        //! @param connection the connection to transmit the encoded packets of
+        void TransmitEncodedPackets(UdpConnection& connection);
+
         //! Accepts an incoming udp connection.
         //! @param connectPacket the initial connectPacket
         void AcceptConnection(const UdpReaderThread::ReceivedPacket& connectPacket);
@@ -195,6 +219,11 @@ namespace AzNetworking
             TerminationEndpoint m_endpoint;
         };
         AZStd::vector<RemovedConnection> m_removedConnections;
+        AZStd::mutex m_removedConnectionsMutex;
+
+        AZStd::atomic_bool m_stagingSends{ false };
+        AZStd::vector<UdpConnection*> m_stagedConnections; //< Sorted by connection id
+        uint32_t m_stagedTransmitIndex = 0;
 
         UdpPacketEncodingBuffer m_decryptBuffer;
         UdpPacketEncodingBuffer m_decompressBuffer;
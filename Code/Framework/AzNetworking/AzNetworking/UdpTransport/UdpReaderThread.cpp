@@ -11,6 +11,7 @@
 #include <AzNetworking/Utilities/NetworkCommon.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/ILogger.h>
+#include <AzCore/std/algorithm.h>
 
 namespace AzNetworking
 {
@@ -176,7 +177,6 @@ namespace AzNetworking
                     break;
                 }
 
-                IpAddress address;
                 const uint32_t bufferHead = static_cast<uint32_t>(receiveBuffer.GetSize());
                 if (bufferHead + MaxUdpTransmissionUnit >= receiveBuffer.GetCapacity())
                 {
@@ -185,20 +185,34 @@ namespace AzNetworking
                     break;
                 }
 
-                uint8_t* dstData = receiveBuffer.GetBufferEnd();
-                receiveBuffer.Resize(bufferHead + MaxUdpTransmissionUnit);
-
-                const int32_t receivedBytes = socket->Receive(address, dstData, MaxUdpTransmissionUnit);
-                if (receivedBytes > 0 && !receivedPackets.full())
+                if (receivedPackets.full())
                 {
-                    receivedPackets.push_back(ReceivedPacket(address, dstData, receivedBytes));
-                    receiveBuffer.Resize(bufferHead + receivedBytes);
+                    break;
                 }
-                else
+
+                // Every datagram gets a full MTU sized slot in the receive buffer
+                const uint32_t freeSlots = static_cast<uint32_t>(receiveBuffer.GetCapacity() - bufferHead - 1) / MaxUdpTransmissionUnit;
+                const uint32_t maxCount = AZStd::min(freeSlots, static_cast<uint32_t>(receivedPackets.capacity() - receivedPackets.size()));
+
+                uint8_t* dstData = receiveBuffer.GetBufferEnd();
+                receiveBuffer.Resize(bufferHead + maxCount * MaxUdpTransmissionUnit);
+
+                UdpSocket::ReceivedDatagram datagrams[UdpSocket::MaxBatchCount];
+                const int32_t receivedCount = socket->ReceiveBatch(datagrams, dstData, MaxUdpTransmissionUnit, maxCount);
+                if (receivedCount <= 0)
                 {
                     receiveBuffer.Resize(bufferHead);
                     break;
                 }
+
+                for (int32_t i = 0; i < receivedCount; ++i)
+                {
+                    if (datagrams[i].m_receivedBytes > 0)
+                    {
+                        receivedPackets.push_back(ReceivedPacket(datagrams[i].m_address, dstData + i * MaxUdpTransmissionUnit, datagrams[i].m_receivedBytes));
+                    }
+                }
+                receiveBuffer.Resize(bufferHead + (receivedCount - 1) * MaxUdpTransmissionUnit + AZStd::max(datagrams[receivedCount - 1].m_receivedBytes, 0));
             }
         }
         m_updateTimeMs += AZ::GetElapsedTimeMs() - startTimeMs;
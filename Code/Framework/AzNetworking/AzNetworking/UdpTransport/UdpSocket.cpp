@@ -17,12 +17,49 @@
 #include <AzCore/EBus/IEventScheduler.h>
 #include <AzCore/EBus/ScheduledEvent.h>
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/std/parallel/mutex.h>
 
 namespace AzNetworking
 {
     AZ_CVAR(int32_t, net_UdpSendBufferSize, 1 * 1024 * 1024, nullptr, AZ::ConsoleFunctorFlags::Null, "Default UDP socket send buffer size");
     AZ_CVAR(int32_t, net_UdpRecvBufferSize, 1 * 1024 * 1024, nullptr, AZ::ConsoleFunctorFlags::Null, "Default UDP socket receive buffer size");
     AZ_CVAR(bool, net_UdpIgnoreWin10054, true, nullptr, AZ::ConsoleFunctorFlags::Null, "If true, will ignore 10054 socket errors on windows");
+    AZ_CVAR(bool, net_UdpBatchReceives, true, nullptr, AZ::ConsoleFunctorFlags::Null, "If true, multiple datagrams are read per system call on platforms that support it");
+    AZ_CVAR(bool, net_UdpBatchSends, true, nullptr, AZ::ConsoleFunctorFlags::Null, "If true, sockets opened afterwards queue outgoing datagrams and transmit them with a single system call per network tick on platforms that support it");
+    AZ_CVAR(bool, net_UdpUseGso, true, nullptr, AZ::ConsoleFunctorFlags::Null, "If true, batched sends coalesce consecutive datagrams to the same address using UDP generic segmentation offload where the kernel supports it");
+
+    struct UdpSocket::SendQueue
+    {
+        struct QueuedDatagram
+        {
+            IpAddress m_address;
+            uint32_t m_offset = 0;
+            uint32_t m_size = 0;
+        };
+
+        AZStd::mutex m_mutex;
+        AZStd::fixed_vector<QueuedDatagram, MaxBatchCount> m_datagrams;
+        AZStd::array<uint8_t, MaxBatchCount * MaxUdpTransmissionUnit> m_buffer;
+        uint32_t m_bufferSize = 0;
+        bool m_useGso = false;
+    };
+
+#if AZ_TRAIT_USE_SOCKET_BATCHED_IO
+    // Largest UDP payload of a single IPv4 datagram, the total size of a segmented send can't exceed it
+    static constexpr uint32_t MaxGsoPayloadSize = 0xFFFF - 20 - 8;
+
+    static sockaddr_in ToSockAddr(const IpAddress& address)
+    {
+        sockaddr_in result;
+        memset(&result, 0, sizeof(result));
+        result.sin_family = AF_INET;
+        result.sin_addr.s_addr = address.GetAddress(ByteOrder::Network);
+        result.sin_port = address.GetPort(ByteOrder::Network);
+        return result;
+    }
+#endif
+
+    UdpSocket::UdpSocket() = default;
 
     UdpSocket::~UdpSocket()
     {
@@ -91,11 +128,30 @@ namespace AzNetworking
             return false;
         }
 
+#if AZ_TRAIT_USE_SOCKET_BATCHED_IO
+        if (net_UdpBatchSends)
+        {
+            m_sendQueue = AZStd::make_unique<SendQueue>();
+            if (net_UdpUseGso)
+            {
+                // Kernels without UDP GSO reject the socket option
+                int32_t segmentSize = 0;
+                socklen_t optionLength = sizeof(segmentSize);
+                m_sendQueue->m_useGso = (::getsockopt(static_cast<int32_t>(m_socketFd), IPPROTO_UDP, UDP_SEGMENT, &segmentSize, &optionLength) == 0);
+            }
+        }
+#endif
+
         return true;
     }
 
     void UdpSocket::Close()
     {
+        if (m_sendQueue != nullptr)
+        {
+            FlushSends();
+            m_sendQueue.reset();
+        }
         CloseSocket(m_socketFd);
         m_socketFd = InvalidSocketFd;
     }
@@ -171,6 +227,36 @@ namespace AzNetworking
         return sentBytes;
     }
 
+    int32_t UdpSocket::SendEncrypted
+    (
+        const IpAddress& address,
+        const uint8_t* data,
+        uint32_t size,
+        uint32_t unencryptedSize,
+        DtlsEndpoint& dtlsEndpoint,
+        const ConnectionQuality& connectionQuality
+    ) const
+    {
+        // Track encryption metrics
+        m_sentBytesEncryptionInflation += aznumeric_cast<uint32_t>(aznumeric_cast<int32_t>(size) - aznumeric_cast<int32_t>(unencryptedSize));
+        m_sentPacketsEncrypted++;
+
+        // The payload is already encrypted, send it as is
+        return Send(address, data, size, false, dtlsEndpoint, connectionQuality);
+    }
+
+    int32_t UdpSocket::Encrypt
+    (
+        [[maybe_unused]] const uint8_t* data,
+        [[maybe_unused]] uint32_t size,
+        [[maybe_unused]] DtlsEndpoint& dtlsEndpoint,
+        [[maybe_unused]] uint8_t* outData,
+        [[maybe_unused]] uint32_t outSize
+    ) const
+    {
+        return SocketOpResultErrorNoSsl;
+    }
+
     int32_t UdpSocket::Receive(IpAddress& outAddress, uint8_t* outData, uint32_t size) const
     {
         AZ_Assert(size > 0, "Invalid data size for send");
@@ -190,42 +276,235 @@ namespace AzNetworking
 
         if (receivedBytes < 0)
         {
-            const int32_t error = GetLastNetworkError();
+            return HandleReceiveError();
+        }
+
+        if (receivedBytes == 0)
+        {
+            return 0;
+        }
+
+        m_recvPackets++;
+        m_recvBytes += receivedBytes;
+        return receivedBytes;
+    }
 
-            if (ErrorIsWouldBlock(error)) // Filter would block messages
+    int32_t UdpSocket::ReceiveBatch(ReceivedDatagram* outDatagrams, uint8_t* outData, uint32_t stride, uint32_t maxCount) const
+    {
+        AZ_Assert(stride > 0, "Invalid data size for receive");
+        AZ_Assert(outData != nullptr && outDatagrams != nullptr, "NULL data pointer passed to receive");
+
+        maxCount = AZStd::min(maxCount, MaxBatchCount);
+
+#if AZ_TRAIT_USE_SOCKET_BATCHED_IO
+        if (net_UdpBatchReceives)
+        {
+            if (!IsOpen())
             {
                 return 0;
             }
 
-            bool ignoreForciblyClosedError = false;
-            if (ErrorIsForciblyClosed(error, ignoreForciblyClosedError))
+            mmsghdr messages[MaxBatchCount];
+            iovec buffers[MaxBatchCount];
+            sockaddr_in fromAddresses[MaxBatchCount];
+            memset(messages, 0, sizeof(mmsghdr) * maxCount);
+            for (uint32_t i = 0; i < maxCount; ++i)
             {
-                if (ignoreForciblyClosedError)
+                buffers[i].iov_base = outData + i * stride;
+                buffers[i].iov_len = stride;
+                messages[i].msg_hdr.msg_iov = &buffers[i];
+                messages[i].msg_hdr.msg_iovlen = 1;
+                messages[i].msg_hdr.msg_name = &fromAddresses[i];
+                messages[i].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+            }
+
+            const int32_t receivedCount = ::recvmmsg(static_cast<int32_t>(m_socketFd), messages, maxCount, MSG_DONTWAIT, nullptr);
+            if (receivedCount < 0)
+            {
+                return HandleReceiveError();
+            }
+
+            for (int32_t i = 0; i < receivedCount; ++i)
+            {
+                outDatagrams[i].m_address = IpAddress(ByteOrder::Network, fromAddresses[i].sin_addr.s_addr, fromAddresses[i].sin_port);
+                outDatagrams[i].m_receivedBytes = static_cast<int32_t>(messages[i].msg_len);
+                m_recvBytes += messages[i].msg_len;
+            }
+            m_recvPackets += receivedCount;
+            return receivedCount;
+        }
+#endif
+
+        int32_t receivedCount = 0;
+        for (; receivedCount < static_cast<int32_t>(maxCount); ++receivedCount)
+        {
+            ReceivedDatagram& datagram = outDatagrams[receivedCount];
+            datagram.m_receivedBytes = Receive(datagram.m_address, outData + receivedCount * stride, stride);
+            if (datagram.m_receivedBytes <= 0)
+            {
+                return (receivedCount > 0) ? receivedCount : datagram.m_receivedBytes;
+            }
+        }
+        return receivedCount;
+    }
+
+    void UdpSocket::FlushSends() const
+    {
+        if (m_sendQueue == nullptr)
+        {
+            return;
+        }
+
+        SendQueue& queue = *m_sendQueue;
+        AZStd::scoped_lock<AZStd::mutex> lock(queue.m_mutex);
+
+#if AZ_TRAIT_USE_SOCKET_BATCHED_IO
+        struct SegmentControl
+        {
+            alignas(cmsghdr) uint8_t m_buffer[CMSG_SPACE(sizeof(uint16_t))];
+        };
+
+        uint32_t datagramIndex = 0;
+        while (IsOpen() && (datagramIndex < queue.m_datagrams.size()))
+        {
+            // Build one message per run of datagrams to the same address. With GSO a run is sent as a single buffer the kernel
+            // splits into segments, which requires every datagram but the last to have the same size
+            mmsghdr messages[MaxBatchCount];
+            iovec buffers[MaxBatchCount];
+            sockaddr_in toAddresses[MaxBatchCount];
+            SegmentControl segmentControls[MaxBatchCount];
+            uint32_t messageStarts[MaxBatchCount + 1];
+            uint32_t messageCount = 0;
+
+            for (uint32_t runStart = datagramIndex; runStart < queue.m_datagrams.size(); ++messageCount)
+            {
+                const SendQueue::QueuedDatagram& first = queue.m_datagrams[runStart];
+                uint32_t runEnd = runStart + 1;
+                uint32_t runSize = first.m_size;
+                if (queue.m_useGso)
                 {
-                    return 0;
+                    while (runEnd < queue.m_datagrams.size())
+                    {
+                        const SendQueue::QueuedDatagram& next = queue.m_datagrams[runEnd];
+                        if ((next.m_address != first.m_address)
+                         || (next.m_size > first.m_size)
+                         || (queue.m_datagrams[runEnd - 1].m_size != first.m_size)
+                         || (runSize + next.m_size > MaxGsoPayloadSize))
+                        {
+                            break;
+                        }
+                        runSize += next.m_size;
+                        ++runEnd;
+                    }
                 }
-                else
+
+                mmsghdr& message = messages[messageCount];
+                memset(&message, 0, sizeof(message));
+                toAddresses[messageCount] = ToSockAddr(first.m_address);
+                // Queued datagrams are stored back to back, so a run is contiguous
+                buffers[messageCount].iov_base = queue.m_buffer.data() + first.m_offset;
+                buffers[messageCount].iov_len = runSize;
+                message.msg_hdr.msg_name = &toAddresses[messageCount];
+                message.msg_hdr.msg_namelen = sizeof(sockaddr_in);
+                message.msg_hdr.msg_iov = &buffers[messageCount];
+                message.msg_hdr.msg_iovlen = 1;
+
+                if (runEnd - runStart > 1)
                 {
-                    return SocketOpResultError;
+                    message.msg_hdr.msg_control = segmentControls[messageCount].m_buffer;
+                    message.msg_hdr.msg_controllen = sizeof(segmentControls[messageCount].m_buffer);
+                    cmsghdr* controlMessage = CMSG_FIRSTHDR(&message.msg_hdr);
+                    controlMessage->cmsg_level = IPPROTO_UDP;
+                    controlMessage->cmsg_type = UDP_SEGMENT;
+                    controlMessage->cmsg_len = CMSG_LEN(sizeof(uint16_t));
+                    const uint16_t segmentSize = static_cast<uint16_t>(first.m_size);
+                    memcpy(CMSG_DATA(controlMessage), &segmentSize, sizeof(segmentSize));
                 }
+
+                messageStarts[messageCount] = runStart;
+                runStart = runEnd;
             }
+            messageStarts[messageCount] = static_cast<uint32_t>(queue.m_datagrams.size());
 
-            AZLOG_WARN("Failed to read from socket (%d:%s)", error, GetNetworkErrorDesc(error));
+            const int32_t sentCount = ::sendmmsg(static_cast<int32_t>(m_socketFd), messages, messageCount, 0);
+            if (sentCount > 0)
+            {
+                datagramIndex = messageStarts[sentCount];
+                continue;
+            }
+
+            const int32_t error = GetLastNetworkError();
+            if (ErrorIsWouldBlock(error))
+            {
+                // The socket send buffer is full, drop the rest like unbatched sends would
+                break;
+            }
+
+            if (messages[0].msg_hdr.msg_control != nullptr)
+            {
+                // Segmentation offload can fail at send time, for example when the device doesn't support checksum offload
+                AZLOG_WARN("UDP segmentation offload failed, disabling it for this socket (%d:%s)", error, GetNetworkErrorDesc(error));
+                queue.m_useGso = false;
+                continue;
+            }
+
+            AZLOG_WARN("Failed to write to socket (%d:%s)", error, GetNetworkErrorDesc(error));
+            datagramIndex = messageStarts[1];
         }
+#endif
+
+        queue.m_datagrams.clear();
+        queue.m_bufferSize = 0;
+    }
+
+    int32_t UdpSocket::HandleReceiveError() const
+    {
+        const int32_t error = GetLastNetworkError();
 
-        if (receivedBytes <= 0)
+        if (ErrorIsWouldBlock(error)) // Filter would block messages
         {
             return 0;
         }
 
-        m_recvPackets++;
-        m_recvBytes += receivedBytes;
-        return receivedBytes;
+        bool ignoreForciblyClosedError = false;
+        if (ErrorIsForciblyClosed(error, ignoreForciblyClosedError))
+        {
+            if (ignoreForciblyClosedError)
+            {
+                return 0;
+            }
+            else
+            {
+                return SocketOpResultError;
+            }
+        }
+
+        AZLOG_WARN("Failed to read from socket (%d:%s)", error, GetNetworkErrorDesc(error));
+        return 0;
     }
 
     int32_t UdpSocket::SendInternal(const IpAddress& address, const uint8_t* data, uint32_t size,
         [[maybe_unused]] bool encrypt, [[maybe_unused]] DtlsEndpoint& dtlsEndpoint) const
     {
+        if (m_sendQueue != nullptr && size <= MaxUdpTransmissionUnit)
+        {
+            SendQueue& queue = *m_sendQueue;
+            {
+                AZStd::scoped_lock<AZStd::mutex> lock(queue.m_mutex);
+                if (!queue.m_datagrams.full() && (queue.m_bufferSize + size <= queue.m_buffer.size()))
+                {
+                    memcpy(queue.m_buffer.data() + queue.m_bufferSize, data, size);
+                    queue.m_datagrams.push_back(SendQueue::QueuedDatagram{ address, queue.m_bufferSize, size });
+                    queue.m_bufferSize += size;
+                    return static_cast<int32_t>(size);
+                }
+            }
+
+            // The queue is full, transmit what's queued and try again
+            FlushSends();
+            return UdpSocket::SendInternal(address, data, size, encrypt, dtlsEndpoint);
+        }
+
         sockaddr_in destAddr;
         memset(&destAddr, 0, sizeof(destAddr));
         destAddr.sin_family = AF_INET;
@@ -14,6 +14,7 @@
 #include <AzNetworking/UdpTransport/DtlsEndpoint.h>
 #include <AzCore/Math/Random.h>
 #include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 
 #ifndef _RELEASE
 #   define ENABLE_LATENCY_DEBUG 1
@@ -42,7 +43,17 @@ namespace AzNetworking
             True   // Socket can accept incoming connections and may require a valid certificate and private key file
         };
 
-        UdpSocket() = default;
+        //! Maximum number of datagrams transferred by a single batched system call.
+        static constexpr uint32_t MaxBatchCount = 64;
+
+        //! A payload received by ReceiveBatch.
+        struct ReceivedDatagram
+        {
+            IpAddress m_address;
+            int32_t m_receivedBytes = 0;
+        };
+
+        UdpSocket();
         virtual ~UdpSocket();
 
         //! Returns true if this is an encrypted socket, false if not.
@@ -86,6 +97,26 @@ namespace AzNetworking
         //! @return number of bytes sent, <= 0 on error
         int32_t Send(const IpAddress& address, const uint8_t* data, uint32_t size, bool encrypt, DtlsEndpoint& dtlsEndpoint, const ConnectionQuality& connectionQuality) const;
 
+        //! Sends a single payload that was already encrypted by Encrypt.
+        //! @param address           the address to send the payload to
+        //! @param data              pointer to the encrypted data to send
+        //! @param size              size of the encrypted payload in bytes
+        //! @param unencryptedSize   size of the payload before encryption, used to track encryption metrics
+        //! @param dtlsEndpoint      data required for DTLS encryption
+        //! @param connectionQuality debug connection quality parameters
+        //! @return number of bytes sent, <= 0 on error
+        int32_t SendEncrypted(const IpAddress& address, const uint8_t* data, uint32_t size, uint32_t unencryptedSize, DtlsEndpoint& dtlsEndpoint, const ConnectionQuality& connectionQuality) const;
+
+        //! Encrypts a payload for the endpoint without sending it, so it can be transmitted later by SendEncrypted.
+        //! The endpoint must not be used by any other thread while encrypting.
+        //! @param data         pointer to the data to encrypt
+        //! @param size         size of the payload in bytes
+        //! @param dtlsEndpoint data required for DTLS encryption
+        //! @param outData      buffer to write the encrypted payload to
+        //! @param outSize      capacity of the output buffer in bytes
+        //! @return size of the encrypted payload in bytes, <= 0 on error or if the socket doesn't support encryption
+        virtual int32_t Encrypt(const uint8_t* data, uint32_t size, DtlsEndpoint& dtlsEndpoint, uint8_t* outData, uint32_t outSize) const;
+
         //! Receives a payload from the UDP socket.
         //! @param outAddress on success, the address of the endpoint that sent the data
         //! @param outData    on success, address to write the received data to
@@ -93,6 +124,18 @@ namespace AzNetworking
         //! @return number of bytes received, <= 0 on error
         int32_t Receive(IpAddress& outAddress, uint8_t* outData, uint32_t size) const;
 
+        //! Receives multiple payloads from the UDP socket, using a single system call where batched socket IO is supported.
+        //! @param outDatagrams on success, the address and size of each received payload
+        //! @param outData      buffer to receive into, payload i is written to outData + i * stride
+        //! @param stride       maximum size of a single payload
+        //! @param maxCount     maximum number of payloads to receive, clamped to MaxBatchCount
+        //! @return number of payloads received, <= 0 on error or if no data is pending
+        int32_t ReceiveBatch(ReceivedDatagram* outDatagrams, uint8_t* outData, uint32_t stride, uint32_t maxCount) const;
+
+        //! Transmits all payloads that were queued by Send since the last flush.
+        //! Sends are only queued if net_UdpBatchSends was enabled when the socket was opened, otherwise this is a no-op.
+        void FlushSends() const;
+
         //! Returns the underlying socket file descriptor.
         //! @return the underlying socket file descriptor
         SocketFd GetSocketFd() const;
@@ -130,12 +173,18 @@ namespace AzNetworking
 
     private:
 
+        int32_t HandleReceiveError() const;
+
         SocketFd m_socketFd = InvalidSocketFd;
         mutable uint32_t m_sentPackets = 0;
         mutable uint32_t m_sentBytes = 0;
         mutable uint32_t m_recvPackets = 0;
         mutable uint32_t m_recvBytes = 0;
 
+        // Outgoing datagrams waiting for FlushSends, only allocated when sends are batched
+        struct SendQueue;
+        AZStd::unique_ptr<SendQueue> m_sendQueue;
+
 #ifdef ENABLE_LATENCY_DEBUG
         struct DeferredData
         {
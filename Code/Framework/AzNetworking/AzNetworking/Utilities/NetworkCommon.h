@@ -36,6 +36,9 @@ namespace AzNetworking
     static const int32_t SocketOpResultErrorNotOpen = -3;
     static const int32_t SocketOpResultErrorNoSsl   = -4;
 
+    //! Default precision of bounded floats in bit packed packets, both endpoints must use the same precision.
+    static constexpr float DefaultBitPackedFloatPrecision = 0.001f;
+
     //! Returns a valid disconnect reason if the provided socket result requires a disconnect.
     DisconnectReason GetDisconnectReasonForSocketResult(int32_t socketResult);
 
@@ -104,6 +107,11 @@ namespace AzNetworking
     //! @return string description for the provided error code
     const char *GetNetworkErrorDesc(int32_t errorCode);
 
+    //! Returns the number of bits needed to encode any value in the range [0, valueRange].
+    //! @param valueRange the largest value that needs to be encoded
+    //! @return number of bits needed, 0 if valueRange is 0
+    uint32_t GetRequiredBitCount(uint64_t valueRange);
+
     //! Generates a string label suitable for container, doesn't allocate or use format strings.
     //! @param value the integral index to generate a string label for
     //! @return string label for the provided index
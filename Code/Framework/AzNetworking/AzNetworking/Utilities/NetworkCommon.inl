@@ -8,6 +8,8 @@
 
 #pragma once
 
+#include <AzCore/Math/MathIntrinsics.h>
+
 namespace AzNetworking
 {
     inline PacketId MakePacketId(SequenceRolloverCount rolloverCount, SequenceId sequenceId)
@@ -25,6 +27,11 @@ namespace AzNetworking
         return SequenceRolloverCount(uint32_t(packetId) >> 16); // shift out the sequence portion of the packet id
     }
 
+    inline uint32_t GetRequiredBitCount(uint64_t valueRange)
+    {
+        return (valueRange == 0) ? 0 : 64 - static_cast<uint32_t>(az_clz_u64(valueRange));
+    }
+
     template <AZStd::size_t MAX_VALUE>
     inline constexpr auto GenerateIndexLabel(AZStd::size_t value)
     {
@@ -59,6 +59,30 @@ namespace AzNetworking
         static float SelectElement(const ValueType& value, int32_t index);
     };
 
+    //! Quantizes a float to an integer in [0, maxQuantizedValue], the scalar form of the conversion QuantizedValues performs.
+    //! Values outside of [minValue, maxValue] are clamped.
+    //! @param value             the value to quantize
+    //! @param minValue          the smallest representable value
+    //! @param maxValue          the largest representable value
+    //! @param maxQuantizedValue the quantized value representing maxValue
+    //! @return the quantized value
+    uint32_t QuantizeFloat(float value, double minValue, double maxValue, uint32_t maxQuantizedValue);
+
+    //! Restores a float quantized by QuantizeFloat.
+    //! @param quantizedValue    the quantized value
+    //! @param minValue          the smallest representable value
+    //! @param maxValue          the largest representable value
+    //! @param maxQuantizedValue the quantized value representing maxValue
+    //! @return the restored value
+    float DequantizeFloat(uint32_t quantizedValue, double minValue, double maxValue, uint32_t maxQuantizedValue);
+
+    //! Returns the number of bits needed to quantize floats in [minValue, maxValue] with steps no larger than precision.
+    //! @param minValue  the smallest representable value
+    //! @param maxValue  the largest representable value
+    //! @param precision the largest acceptable difference between a value and its quantized representation
+    //! @return number of bits needed, 0 if the range is unbounded or can't be quantized in fewer than 32 bits
+    uint32_t GetQuantizedFloatBitCount(float minValue, float maxValue, float precision);
+
     template <AZStd::size_t BYTE_COUNT> struct MaxSerializeValue { };
     template <> struct MaxSerializeValue<4> { static constexpr AZStd::size_t Value = 0xFFFFFFFF - 1; };
     template <> struct MaxSerializeValue<3> { static constexpr AZStd::size_t Value = 0x00FFFFFF - 1; };
@@ -8,6 +8,9 @@
 
 #pragma once
 
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/math.h>
+
 namespace AzNetworking
 {
     inline QuantizedValuesHelper<1>::ValueType QuantizedValuesHelper<1>::FloatsToValue(SimdType::FloatType, const float* quantizedValues)
@@ -70,6 +73,36 @@ namespace AzNetworking
         return value.GetElement(index);
     }
 
+    inline uint32_t QuantizeFloat(float value, double minValue, double maxValue, uint32_t maxQuantizedValue)
+    {
+        const double maximumInt = static_cast<double>(maxQuantizedValue);
+        const double convertToInt = maximumInt / (maxValue - minValue);
+        const double readjusted = convertToInt * (value - minValue);
+        return static_cast<uint32_t>(AZStd::clamp(readjusted, 0.0, maximumInt));
+    }
+
+    inline float DequantizeFloat(uint32_t quantizedValue, double minValue, double maxValue, uint32_t maxQuantizedValue)
+    {
+        const double convertToFloat = (maxValue - minValue) / static_cast<double>(maxQuantizedValue);
+        const double quantized = static_cast<double>(quantizedValue);
+        return static_cast<float>(minValue + static_cast<float>(quantized * convertToFloat));
+    }
+
+    inline uint32_t GetQuantizedFloatBitCount(float minValue, float maxValue, float precision)
+    {
+        if (!AZ::IsFiniteFloat(minValue) || !AZ::IsFiniteFloat(maxValue) || !(minValue < maxValue) || !(precision > 0.0f))
+        {
+            return 0;
+        }
+
+        const double stepCount = AZStd::ceil((static_cast<double>(maxValue) - static_cast<double>(minValue)) / static_cast<double>(precision));
+        if (stepCount >= static_cast<double>(1u << 31))
+        {
+            return 0;
+        }
+        return GetRequiredBitCount(static_cast<uint64_t>(stepCount));
+    }
+
     template <AZStd::size_t NUM_ELEMENTS, AZStd::size_t NUM_BYTES, int32_t MIN_VALUE, int32_t MAX_VALUE>
     inline QuantizedValues<NUM_ELEMENTS, NUM_BYTES, MIN_VALUE, MAX_VALUE>::QuantizedValues()
     {
@@ -287,25 +320,23 @@ namespace AzNetworking
 
         static inline void Set(SelfType& quantizedValues, const ValueType& value)
         {
-            constexpr double maximumInt   = static_cast<double>(MaxSerializedIntValue);
-            constexpr double minimumFloat = static_cast<double>(MIN_VALUE);
-            constexpr double convertToInt = maximumInt / static_cast<double>(MAX_VALUE - MIN_VALUE);
             for (int32_t i = 0; i < static_cast<int32_t>(NUM_ELEMENTS); ++i)
             {
-                const double readjusted = convertToInt * (QuantizedValuesHelper<NUM_ELEMENTS>::SelectElement(value, i) - minimumFloat);
-                quantizedValues.m_serializeValues[i] = static_cast<uint32_t>(AZStd::clamp(readjusted, 0.0, maximumInt));
+                quantizedValues.m_serializeValues[i] = QuantizeFloat
+                (
+                    QuantizedValuesHelper<NUM_ELEMENTS>::SelectElement(value, i), MIN_VALUE, MAX_VALUE, MaxSerializedIntValue
+                );
             }
         }
 
         static inline void DecodeQuantizedValues(SelfType& quantizedValues)
         {
-            constexpr double maximumInt     = static_cast<double>(MaxSerializedIntValue);
-            constexpr double minimumFloat   = static_cast<double>(MIN_VALUE);
-            constexpr double convertToFloat = static_cast<double>(MAX_VALUE - MIN_VALUE) / maximumInt;
             for (int32_t i = 0; i < static_cast<int32_t>(NUM_ELEMENTS); ++i)
             {
-                const double quantized = static_cast<double>(quantizedValues.m_serializeValues[i]);
-                quantizedValues.m_quantizedValues[i] = static_cast<float>(minimumFloat + static_cast<float>(quantized * convertToFloat));
+                quantizedValues.m_quantizedValues[i] = DequantizeFloat
+                (
+                    quantizedValues.m_serializeValues[i], MIN_VALUE, MAX_VALUE, MaxSerializedIntValue
+                );
             }
         }
     };
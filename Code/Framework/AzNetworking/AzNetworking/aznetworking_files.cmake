@@ -36,6 +36,8 @@ set(FILES
     DataStructures/IBitset.h
     DataStructures/RingBufferBitset.h
     DataStructures/RingBufferBitset.inl
+    DataStructures/SpscQueue.h
+    DataStructures/SpscQueue.inl
     DataStructures/TimeoutQueue.cpp
     DataStructures/TimeoutQueue.h
     DataStructures/TimeoutQueue.inl
@@ -56,6 +58,11 @@ set(FILES
     Serialization/HashSerializer.h
     Serialization/ISerializer.h
     Serialization/ISerializer.inl
+    Serialization/NetworkBitInputSerializer.cpp
+    Serialization/NetworkBitInputSerializer.h
+    Serialization/NetworkBitOutputSerializer.cpp
+    Serialization/NetworkBitOutputSerializer.h
+    Serialization/NetworkBitOutputSerializer.inl
     Serialization/NetworkInputSerializer.cpp
     Serialization/NetworkInputSerializer.h
     Serialization/NetworkOutputSerializer.cpp
@@ -9,3 +9,10 @@
 #pragma once
 
 #include <UnixLike/AzNetworking/Utilities/NetworkIncludes_UnixLike.h>
+
+#include <netinet/udp.h>
+
+#ifndef UDP_SEGMENT
+// Older libc headers don't declare the UDP generic segmentation offload option, support is checked at runtime
+#   define UDP_SEGMENT 103
+#endif
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/DataStructures/SpscQueue.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/parallel/thread.h>
+
+namespace UnitTest
+{
+    using SmallSpscQueue = AzNetworking::SpscQueue<uint32_t, 4>;
+
+    TEST(SpscQueue, EmptyQueueHasNoFront)
+    {
+        SmallSpscQueue queue;
+        EXPECT_TRUE(queue.IsEmpty());
+        EXPECT_EQ(queue.Front(), nullptr);
+    }
+
+    TEST(SpscQueue, ElementIsOnlyVisibleOncePushed)
+    {
+        SmallSpscQueue queue;
+        queue.GetPushSlot() = 7;
+        EXPECT_TRUE(queue.IsEmpty());
+
+        queue.Push();
+        ASSERT_NE(queue.Front(), nullptr);
+        EXPECT_EQ(*queue.Front(), 7u);
+
+        queue.Pop();
+        EXPECT_TRUE(queue.IsEmpty());
+    }
+
+    TEST(SpscQueue, PopsInPushOrderAcrossBlocks)
+    {
+        SmallSpscQueue queue;
+
+        // Interleave pushes and pops so emptied blocks get reused
+        uint32_t nextPush = 0;
+        uint32_t nextPop = 0;
+        for (uint32_t round = 0; round < 8; ++round)
+        {
+            for (uint32_t i = 0; i < 6; ++i)
+            {
+                queue.GetPushSlot() = nextPush++;
+                queue.Push();
+            }
+            for (uint32_t i = 0; i < 5; ++i)
+            {
+                ASSERT_NE(queue.Front(), nullptr);
+                EXPECT_EQ(*queue.Front(), nextPop++);
+                queue.Pop();
+            }
+        }
+
+        while (uint32_t* element = queue.Front())
+        {
+            EXPECT_EQ(*element, nextPop++);
+            queue.Pop();
+        }
+        EXPECT_EQ(nextPop, nextPush);
+    }
+
+    TEST(SpscQueue, ConcurrentProducerAndConsumer)
+    {
+        constexpr uint32_t ElementCount = 100000;
+        SmallSpscQueue queue;
+
+        AZStd::thread producer([&queue]()
+        {
+            for (uint32_t i = 0; i < ElementCount; ++i)
+            {
+                queue.GetPushSlot() = i;
+                queue.Push();
+            }
+        });
+
+        uint32_t expected = 0;
+        while (expected < ElementCount)
+        {
+            if (uint32_t* element = queue.Front())
+            {
+                EXPECT_EQ(*element, expected);
+                queue.Pop();
+                ++expected;
+            }
+            else
+            {
+                AZStd::this_thread::yield();
+            }
+        }
+        producer.join();
+
+        EXPECT_TRUE(queue.IsEmpty());
+    }
+}
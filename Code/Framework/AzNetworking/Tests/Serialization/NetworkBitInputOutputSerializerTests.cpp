@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/Serialization/NetworkBitInputSerializer.h>
+#include <AzNetworking/Serialization/NetworkBitOutputSerializer.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    struct BitPackedDataElement
+    {
+        bool testBool = false;
+        int8_t testInt8 = 0;
+        int16_t testInt16 = 1;
+        int32_t testInt32 = 2;
+        int64_t testInt64 = 3;
+        uint8_t testUint8 = 0;
+        uint16_t testUint16 = 1;
+        uint32_t testUint32 = 2;
+        uint64_t testUint64 = 3;
+        uint32_t testBoundedUint32 = 4;
+        int16_t testBoundedInt16 = -5;
+        double testDouble = 1.0;
+        float testFloat = 1.f;
+        float testBoundedFloat = 0.25f;
+        AZStd::fixed_string<32> testFixedString = "FixedString";
+
+        bool Serialize(AzNetworking::ISerializer& serializer)
+        {
+            serializer.Serialize(testBool, "TestBool");
+            serializer.Serialize(testInt8, "TestInt8");
+            serializer.Serialize(testInt16, "TestInt16");
+            serializer.Serialize(testInt32, "TestInt32");
+            serializer.Serialize(testInt64, "TestInt64");
+            serializer.Serialize(testUint8, "TestUint8");
+            serializer.Serialize(testUint16, "TestUint16");
+            serializer.Serialize(testUint32, "TestUint32");
+            serializer.Serialize(testUint64, "TestUint64");
+            serializer.Serialize(testBoundedUint32, "TestBoundedUint32", 0u, 100u);
+            serializer.Serialize(testBoundedInt16, "TestBoundedInt16", int16_t(-10), int16_t(10));
+            serializer.Serialize(testDouble, "TestDouble");
+            serializer.Serialize(testFloat, "TestFloat");
+            serializer.Serialize(testBoundedFloat, "TestBoundedFloat", -1.0f, 1.0f);
+            serializer.Serialize(testFixedString, "TestFixedString");
+            return serializer.IsValid();
+        }
+    };
+
+    class NetworkBitInputOutputSerializerTests
+        : public LeakDetectionFixture
+    {
+    public:
+        static constexpr uint32_t Capacity = 256;
+        AZStd::array<uint8_t, Capacity> m_buffer;
+    };
+
+    TEST_F(NetworkBitInputOutputSerializerTests, RoundTrip_AllTypes_MatchesAndIsSmallerThanByteAligned)
+    {
+        BitPackedDataElement inElement;
+        inElement.testBool = true;
+        inElement.testInt8 = -12;
+        inElement.testInt16 = -1234;
+        inElement.testInt32 = 0x12345678;
+        inElement.testInt64 = -0x123456789abcdef;
+        inElement.testUint8 = 0xab;
+        inElement.testUint16 = 0xabcd;
+        inElement.testUint32 = 0x89abcdef;
+        inElement.testUint64 = 0x0123456789abcdef;
+        inElement.testBoundedUint32 = 99;
+        inElement.testBoundedInt16 = -7;
+        inElement.testDouble = -3.25;
+        inElement.testFloat = 123.456f;
+        inElement.testBoundedFloat = 0.3333f;
+
+        AzNetworking::NetworkBitInputSerializer inSerializer(m_buffer.data(), Capacity);
+        EXPECT_TRUE(inElement.Serialize(inSerializer));
+
+        AZStd::array<uint8_t, Capacity> byteBuffer;
+        AzNetworking::NetworkInputSerializer byteSerializer(byteBuffer.data(), Capacity);
+        EXPECT_TRUE(inElement.Serialize(byteSerializer));
+        EXPECT_LT(inSerializer.GetSize(), byteSerializer.GetSize());
+
+        BitPackedDataElement outElement;
+        AzNetworking::NetworkBitOutputSerializer outSerializer(m_buffer.data(), inSerializer.GetSize());
+        EXPECT_TRUE(outElement.Serialize(outSerializer));
+        EXPECT_EQ(inSerializer.GetSize(), outSerializer.GetSize());
+        EXPECT_EQ(0u, outSerializer.GetUnreadSize());
+
+        EXPECT_EQ(inElement.testBool, outElement.testBool);
+        EXPECT_EQ(inElement.testInt8, outElement.testInt8);
+        EXPECT_EQ(inElement.testInt16, outElement.testInt16);
+        EXPECT_EQ(inElement.testInt32, outElement.testInt32);
+        EXPECT_EQ(inElement.testInt64, outElement.testInt64);
+        EXPECT_EQ(inElement.testUint8, outElement.testUint8);
+        EXPECT_EQ(inElement.testUint16, outElement.testUint16);
+        EXPECT_EQ(inElement.testUint32, outElement.testUint32);
+        EXPECT_EQ(inElement.testUint64, outElement.testUint64);
+        EXPECT_EQ(inElement.testBoundedUint32, outElement.testBoundedUint32);
+        EXPECT_EQ(inElement.testBoundedInt16, outElement.testBoundedInt16);
+        EXPECT_EQ(inElement.testDouble, outElement.testDouble);
+        EXPECT_EQ(inElement.testFloat, outElement.testFloat);
+        EXPECT_NEAR(inElement.testBoundedFloat, outElement.testBoundedFloat, AzNetworking::DefaultBitPackedFloatPrecision);
+        EXPECT_EQ(inElement.testFixedString, outElement.testFixedString);
+    }
+
+    TEST_F(NetworkBitInputOutputSerializerTests, BoundedValues_UseOnlyTheBitsTheirRangeNeeds)
+    {
+        AzNetworking::NetworkBitInputSerializer inSerializer(m_buffer.data(), Capacity);
+        AzNetworking::ISerializer& serializer = inSerializer;
+        for (uint8_t i = 0; i < 8; ++i)
+        {
+            uint8_t value = i;
+            EXPECT_TRUE(serializer.Serialize(value, "Value", uint8_t(0), uint8_t(7)));
+        }
+        // Eight 3 bit values
+        EXPECT_EQ(3u, inSerializer.GetSize());
+
+        // A range of one value takes no space at all
+        int32_t constant = 42;
+        EXPECT_TRUE(serializer.Serialize(constant, "Constant", 42, 42));
+        EXPECT_EQ(3u, inSerializer.GetSize());
+
+        bool flag = true;
+        EXPECT_TRUE(serializer.Serialize(flag, "Flag"));
+        EXPECT_EQ(4u, inSerializer.GetSize());
+
+        AzNetworking::NetworkBitOutputSerializer outSerializer(m_buffer.data(), inSerializer.GetSize());
+        AzNetworking::ISerializer& deserializer = outSerializer;
+        for (uint8_t i = 0; i < 8; ++i)
+        {
+            uint8_t value = 0;
+            EXPECT_TRUE(deserializer.Serialize(value, "Value", uint8_t(0), uint8_t(7)));
+            EXPECT_EQ(i, value);
+        }
+        constant = 0;
+        EXPECT_TRUE(deserializer.Serialize(constant, "Constant", 42, 42));
+        EXPECT_EQ(42, constant);
+        flag = false;
+        EXPECT_TRUE(deserializer.Serialize(flag, "Flag"));
+        EXPECT_TRUE(flag);
+    }
+
+    TEST_F(NetworkBitInputOutputSerializerTests, BoundedFloat_QuantizedToConfiguredPrecision)
+    {
+        constexpr float Precision = 0.01f;
+        AzNetworking::NetworkBitInputSerializer inSerializer(m_buffer.data(), Capacity, Precision);
+        AzNetworking::ISerializer& serializer = inSerializer;
+        float value = 12.345f;
+        EXPECT_TRUE(serializer.Serialize(value, "Value", -100.0f, 100.0f));
+        // 20000 steps of 0.01 need 15 bits
+        EXPECT_EQ(2u, inSerializer.GetSize());
+
+        float outValue = 0.0f;
+        AzNetworking::NetworkBitOutputSerializer outSerializer(m_buffer.data(), inSerializer.GetSize(), Precision);
+        AzNetworking::ISerializer& deserializer = outSerializer;
+        EXPECT_TRUE(deserializer.Serialize(outValue, "Value", -100.0f, 100.0f));
+        EXPECT_NEAR(value, outValue, Precision);
+    }
+
+    TEST_F(NetworkBitInputOutputSerializerTests, OutOfRangeOrOverflow_FailsSerialization)
+    {
+        {
+            AzNetworking::NetworkBitInputSerializer inSerializer(m_buffer.data(), Capacity);
+            AzNetworking::ISerializer& serializer = inSerializer;
+            uint16_t value = 300;
+            EXPECT_FALSE(serializer.Serialize(value, "Value", uint16_t(0), uint16_t(255)));
+            EXPECT_FALSE(serializer.IsValid());
+        }
+        {
+            AzNetworking::NetworkBitInputSerializer inSerializer(m_buffer.data(), 1);
+            AzNetworking::ISerializer& serializer = inSerializer;
+            uint16_t value = 300;
+            EXPECT_FALSE(serializer.Serialize(value, "Value", uint16_t(0), uint16_t(511)));
+        }
+        {
+            // 3 bits of 0b111 exceed a [0, 5] range on read
+            m_buffer[0] = 0x07;
+            AzNetworking::NetworkBitOutputSerializer outSerializer(m_buffer.data(), 1);
+            AzNetworking::ISerializer& deserializer = outSerializer;
+            uint8_t value = 0;
+            EXPECT_FALSE(deserializer.Serialize(value, "Value", uint8_t(0), uint8_t(5)));
+        }
+    }
+} // namespace UnitTest
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+#include <AzNetworking/UdpTransport/UdpSocket.h>
+#include <AzNetworking/ConnectionLayer/IConnection.h>
+#include <AzCore/Console/Console.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    using namespace AzNetworking;
+
+    //! Sends a burst of datagrams over loopback and reads them back, like a server replicating to its clients every tick.
+    //! Argument 0 selects batched socket IO (1) or one system call per datagram (0), argument 1 is the burst size.
+    class UdpSocketLoopbackBenchmark
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr uint16_t SenderPort = 12360;
+        static constexpr uint16_t ReceiverPort = 12361;
+
+        void SetUp(const benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+
+            m_console = AZStd::make_unique<AZ::Console>();
+            m_console->LinkDeferredFunctors(AZ::ConsoleFunctorBase::GetDeferredHead());
+            AZ::Interface<AZ::IConsole>::Register(m_console.get());
+
+            const bool batched = state.range(0) != 0;
+            m_console->PerformCommand("net_UdpBatchSends", { batched ? "true" : "false" }, AZ::ConsoleSilentMode::Silent);
+            m_console->PerformCommand("net_UdpBatchReceives", { batched ? "true" : "false" }, AZ::ConsoleSilentMode::Silent);
+
+            m_sender = AZStd::make_unique<UdpSocket>();
+            m_receiver = AZStd::make_unique<UdpSocket>();
+            m_sender->Open(SenderPort, UdpSocket::CanAcceptConnections::False, TrustZone::ExternalClientToServer);
+            m_receiver->Open(ReceiverPort, UdpSocket::CanAcceptConnections::True, TrustZone::ExternalClientToServer);
+        }
+
+        void SetUp(benchmark::State& state) override
+        {
+            SetUp(static_cast<const benchmark::State&>(state));
+        }
+
+        void TearDown(const benchmark::State& state) override
+        {
+            m_receiver.reset();
+            m_sender.reset();
+
+            m_console->PerformCommand("net_UdpBatchSends", { "true" }, AZ::ConsoleSilentMode::Silent);
+            m_console->PerformCommand("net_UdpBatchReceives", { "true" }, AZ::ConsoleSilentMode::Silent);
+            AZ::Interface<AZ::IConsole>::Unregister(m_console.get());
+            m_console.reset();
+
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        void TearDown(benchmark::State& state) override
+        {
+            TearDown(static_cast<const benchmark::State&>(state));
+        }
+
+        AZStd::unique_ptr<AZ::Console> m_console;
+        AZStd::unique_ptr<UdpSocket> m_sender;
+        AZStd::unique_ptr<UdpSocket> m_receiver;
+    };
+
+    BENCHMARK_DEFINE_F(UdpSocketLoopbackBenchmark, SendAndReceiveBurst)(benchmark::State& state)
+    {
+        const IpAddress receiverAddress(127, 0, 0, 1, ReceiverPort);
+        const uint32_t burstSize = static_cast<uint32_t>(state.range(1));
+
+        AZStd::array<uint8_t, MaxUdpTransmissionUnit> payload;
+        payload.fill(0xa5);
+        AZStd::array<uint8_t, UdpSocket::MaxBatchCount * MaxUdpTransmissionUnit> receiveBuffer;
+        UdpSocket::ReceivedDatagram datagrams[UdpSocket::MaxBatchCount];
+        DtlsEndpoint dtlsEndpoint;
+        const ConnectionQuality connectionQuality;
+
+        int64_t receivedDatagrams = 0;
+        int64_t receivedBytes = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (uint32_t i = 0; i < burstSize; ++i)
+            {
+                m_sender->Send(receiverAddress, payload.data(), static_cast<uint32_t>(payload.size()), false, dtlsEndpoint, connectionQuality);
+            }
+            m_sender->FlushSends();
+
+            // Loopback delivers synchronously, so everything that wasn't dropped is readable now
+            for (;;)
+            {
+                const int32_t receivedCount = m_receiver->ReceiveBatch(datagrams, receiveBuffer.data(), MaxUdpTransmissionUnit, UdpSocket::MaxBatchCount);
+                if (receivedCount <= 0)
+                {
+                    break;
+                }
+                for (int32_t i = 0; i < receivedCount; ++i)
+                {
+                    receivedBytes += datagrams[i].m_receivedBytes;
+                }
+                receivedDatagrams += receivedCount;
+            }
+        }
+
+        state.SetItemsProcessed(receivedDatagrams);
+        state.SetBytesProcessed(receivedBytes);
+    }
+
+    BENCHMARK_REGISTER_F(UdpSocketLoopbackBenchmark, SendAndReceiveBurst)
+        ->Args({ 0, 16 })
+        ->Args({ 1, 16 })
+        ->Args({ 0, 256 })
+        ->Args({ 1, 256 })
+        ->Unit(benchmark::kMicrosecond)
+        ;
+} // namespace Benchmark
+#endif
@@ -9,6 +9,7 @@
 #include <AzNetworking/UdpTransport/UdpNetworkInterface.h>
 #include <AzNetworking/UdpTransport/UdpPacketTracker.h>
 #include <AzNetworking/UdpTransport/UdpPacketIdWindow.h>
+#include <AzNetworking/UdpTransport/UdpSocket.h>
 #include <AzNetworking/ConnectionLayer/IConnectionListener.h>
 #include <AzNetworking/Framework/NetworkingSystemComponent.h>
 #include <AzNetworking/AutoGen/CorePackets.AutoPackets.h>
@@ -17,6 +18,7 @@
 #include <AzCore/Time/TimeSystem.h>
 #include <AzCore/Name/NameDictionary.h>
 #include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/parallel/thread.h>
 
 namespace UnitTest
 {
@@ -320,4 +322,46 @@ namespace UnitTest
             EXPECT_EQ(testClient[i].m_clientNetworkInterface->GetConnectionSet().GetConnectionCount(), 1);
         }
     }
+
+    TEST_F(UdpTransportTests, SocketBatchedIo_LoopbackBurst_DatagramsArriveIntactAndInOrder)
+    {
+        UdpSocket sender;
+        UdpSocket receiver;
+        ASSERT_TRUE(sender.Open(12370, UdpSocket::CanAcceptConnections::False, TrustZone::ExternalClientToServer));
+        ASSERT_TRUE(receiver.Open(12371, UdpSocket::CanAcceptConnections::True, TrustZone::ExternalClientToServer));
+
+        // Equal sized datagrams followed by a short one, which batched sends can coalesce into a single segmented send
+        constexpr uint32_t DatagramCount = 24;
+        const IpAddress receiverAddress(127, 0, 0, 1, 12371);
+        DtlsEndpoint dtlsEndpoint;
+        AZStd::array<uint8_t, MaxUdpTransmissionUnit> payload;
+        for (uint32_t i = 0; i < DatagramCount; ++i)
+        {
+            const uint32_t size = (i + 1 < DatagramCount) ? 200 : 50;
+            payload.fill(static_cast<uint8_t>(i));
+            EXPECT_EQ(static_cast<int32_t>(size), sender.Send(receiverAddress, payload.data(), size, false, dtlsEndpoint, ConnectionQuality()));
+        }
+        sender.FlushSends();
+
+        AZStd::array<uint8_t, UdpSocket::MaxBatchCount * MaxUdpTransmissionUnit> receiveBuffer;
+        UdpSocket::ReceivedDatagram datagrams[UdpSocket::MaxBatchCount];
+        uint32_t receivedCount = 0;
+        for (uint32_t attempt = 0; attempt < 100 && receivedCount < DatagramCount; ++attempt)
+        {
+            const int32_t batchCount = receiver.ReceiveBatch(datagrams, receiveBuffer.data(), MaxUdpTransmissionUnit, UdpSocket::MaxBatchCount);
+            for (int32_t i = 0; i < batchCount; ++i, ++receivedCount)
+            {
+                const uint8_t* data = receiveBuffer.data() + i * MaxUdpTransmissionUnit;
+                EXPECT_EQ((receivedCount + 1 < DatagramCount) ? 200 : 50, datagrams[i].m_receivedBytes);
+                EXPECT_EQ(static_cast<uint8_t>(receivedCount), data[0]);
+                EXPECT_EQ(static_cast<uint8_t>(receivedCount), data[datagrams[i].m_receivedBytes - 1]);
+            }
+            if (batchCount <= 0)
+            {
+                AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(1));
+            }
+        }
+        EXPECT_EQ(DatagramCount, receivedCount);
+        EXPECT_EQ(DatagramCount, receiver.GetRecvPackets());
+    }
 }
@@ -14,14 +14,17 @@ set(FILES
     DataStructures/FixedSizeBitsetViewTests.cpp
     DataStructures/FixedSizeVectorBitsetTests.cpp
     DataStructures/RingBufferBitsetTests.cpp
+    DataStructures/SpscQueueTests.cpp
     DataStructures/TimeoutQueueTests.cpp
     Serialization/DeltaSerializerTests.cpp
     Serialization/HashSerializerTests.cpp
+    Serialization/NetworkBitInputOutputSerializerTests.cpp
     Serialization/NetworkInputOutputSerializerTests.cpp
     Serialization/StringifySerializerTests.cpp
     Serialization/TrackChangedSerializerTests.cpp
     Serialization/TypeValidatingSerializerTests.cpp
     TcpTransport/TcpTransportTests.cpp
+    UdpTransport/UdpSocketBenchmarks.cpp
     UdpTransport/UdpTransportTests.cpp
     Utilities/CidrAddressTests.cpp
     Utilities/IpAddressTests.cpp
@@ -1420,10 +1420,11 @@ namespace AzToolsFramework
         auto undoCacheInterface = AZ::Interface<UndoSystem::UndoCacheInterface>::Get();
         if (undoCacheInterface)
         {
-            for (auto&& entityEntry : m_entities)
-            {
-                undoCacheInterface->Validate((entityEntry.second)->GetId());
-            }
+            m_entities.EnumerateEntities(
+                [undoCacheInterface](AZ::Entity* entity)
+                {
+                    undoCacheInterface->Validate(entity->GetId());
+                });
         }
     }
 
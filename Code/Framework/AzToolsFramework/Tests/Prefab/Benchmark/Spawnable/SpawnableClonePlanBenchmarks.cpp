@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#if defined(HAVE_BENCHMARK)
+
+#include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/Serialization/IdUtils.h>
+#include <AzFramework/Spawnable/SpawnableClonePlan.h>
+#include <AzFramework/Spawnable/SpawnableEntitiesInterface.h>
+#include <Prefab/Benchmark/Spawnable/SpawnableBenchmarkFixture.h>
+
+namespace Benchmark
+{
+    using BM_SpawnableClonePlan = BM_Spawnable;
+
+    namespace
+    {
+        AZ::SerializeContext* GetSerializeContext()
+        {
+            AZ::SerializeContext* serializeContext = nullptr;
+            AZ::ComponentApplicationBus::BroadcastResult(serializeContext, &AZ::ComponentApplicationBus::Events::GetSerializeContext);
+            return serializeContext;
+        }
+    } // namespace
+
+    BENCHMARK_DEFINE_F(BM_SpawnableClonePlan, CloneEntities_SerializeContext)(::benchmark::State& state)
+    {
+        const uint64_t entityCount = aznumeric_cast<uint64_t>(state.range());
+        SetUpSpawnableAsset(entityCount);
+
+        AZ::SerializeContext* serializeContext = GetSerializeContext();
+        const AzFramework::Spawnable::EntityList& prototypes = m_spawnableAsset->GetEntities();
+        AzFramework::SpawnableClonePlan::EntityIdMap idMap;
+        AZStd::vector<AZ::Entity*> clones;
+        clones.reserve(prototypes.size());
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (const AZStd::unique_ptr<AZ::Entity>& prototype : prototypes)
+            {
+                clones.push_back(AZ::IdUtils::Remapper<AZ::EntityId, false>::CloneObjectAndGenerateNewIdsAndFixRefs(
+                    prototype.get(), idMap, serializeContext));
+            }
+
+            state.PauseTiming();
+            for (AZ::Entity* clone : clones)
+            {
+                delete clone;
+            }
+            clones.clear();
+            idMap.clear();
+            state.ResumeTiming();
+        }
+
+        state.SetComplexityN(entityCount);
+    }
+    BENCHMARK_REGISTER_F(BM_SpawnableClonePlan, CloneEntities_SerializeContext)
+        ->RangeMultiplier(10)
+        ->Range(100, 10000)
+        ->Unit(benchmark::kMillisecond)
+        ->Complexity();
+
+    BENCHMARK_DEFINE_F(BM_SpawnableClonePlan, CloneEntities_ClonePlan)(::benchmark::State& state)
+    {
+        const uint64_t entityCount = aznumeric_cast<uint64_t>(state.range());
+        SetUpSpawnableAsset(entityCount);
+
+        AZStd::shared_ptr<const AzFramework::SpawnableClonePlan> clonePlan = m_spawnableAsset->GetClonePlan(*GetSerializeContext());
+        const AzFramework::Spawnable::EntityList& prototypes = m_spawnableAsset->GetEntities();
+        AzFramework::SpawnableClonePlan::EntityIdMap idMap;
+        AZStd::vector<AZ::Entity*> clones;
+        clones.reserve(prototypes.size());
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (const AZStd::unique_ptr<AZ::Entity>& prototype : prototypes)
+            {
+                clones.push_back(clonePlan->CloneEntity(*prototype, idMap));
+            }
+
+            state.PauseTiming();
+            for (AZ::Entity* clone : clones)
+            {
+                delete clone;
+            }
+            clones.clear();
+            idMap.clear();
+            state.ResumeTiming();
+        }
+
+        state.SetComplexityN(entityCount);
+    }
+    BENCHMARK_REGISTER_F(BM_SpawnableClonePlan, CloneEntities_ClonePlan)
+        ->RangeMultiplier(10)
+        ->Range(100, 10000)
+        ->Unit(benchmark::kMillisecond)
+        ->Complexity();
+
+    BENCHMARK_DEFINE_F(BM_SpawnableClonePlan, SpawnInstances_SeparateCalls)(::benchmark::State& state)
+    {
+        const uint64_t entityCountInSpawnable = aznumeric_cast<uint64_t>(state.range(0));
+        const uint64_t instanceCount = aznumeric_cast<uint64_t>(state.range(1));
+
+        SetUpSpawnableAsset(entityCountInSpawnable);
+
+        auto spawner = AzFramework::SpawnableEntitiesInterface::Get();
+        for ([[maybe_unused]] auto _ : state)
+        {
+            state.PauseTiming();
+            m_spawnTicket = aznew AzFramework::EntitySpawnTicket(m_spawnableAsset);
+            state.ResumeTiming();
+
+            for (uint64_t instance = 0; instance < instanceCount; instance++)
+            {
+                spawner->SpawnAllEntities(*m_spawnTicket);
+            }
+            m_rootSpawnableInterface->ProcessSpawnableQueue();
+
+            state.PauseTiming();
+            delete m_spawnTicket;
+            m_spawnTicket = nullptr;
+            m_rootSpawnableInterface->ProcessSpawnableQueue();
+            state.ResumeTiming();
+        }
+
+        state.SetComplexityN(entityCountInSpawnable * instanceCount);
+    }
+    BENCHMARK_REGISTER_F(BM_SpawnableClonePlan, SpawnInstances_SeparateCalls)
+        ->Args({ 10, 100 })
+        ->Args({ 10, 1000 })
+        ->Args({ 100, 100 })
+        ->Unit(benchmark::kMillisecond)
+        ->Complexity();
+
+    BENCHMARK_DEFINE_F(BM_SpawnableClonePlan, SpawnInstances_InstanceCount)(::benchmark::State& state)
+    {
+        const uint64_t entityCountInSpawnable = aznumeric_cast<uint64_t>(state.range(0));
+        const uint64_t instanceCount = aznumeric_cast<uint64_t>(state.range(1));
+
+        SetUpSpawnableAsset(entityCountInSpawnable);
+
+        auto spawner = AzFramework::SpawnableEntitiesInterface::Get();
+        for ([[maybe_unused]] auto _ : state)
+        {
+            state.PauseTiming();
+            m_spawnTicket = aznew AzFramework::EntitySpawnTicket(m_spawnableAsset);
+            state.ResumeTiming();
+
+            AzFramework::SpawnAllEntitiesOptionalArgs optionalArgs;
+            optionalArgs.m_instanceCount = aznumeric_cast<uint32_t>(instanceCount);
+            spawner->SpawnAllEntities(*m_spawnTicket, AZStd::move(optionalArgs));
+            m_rootSpawnableInterface->ProcessSpawnableQueue();
+
+            state.PauseTiming();
+            delete m_spawnTicket;
+            m_spawnTicket = nullptr;
+            m_rootSpawnableInterface->ProcessSpawnableQueue();
+            state.ResumeTiming();
+        }
+
+        state.SetComplexityN(entityCountInSpawnable * instanceCount);
+    }
+    BENCHMARK_REGISTER_F(BM_SpawnableClonePlan, SpawnInstances_InstanceCount)
+        ->Args({ 10, 100 })
+        ->Args({ 10, 1000 })
+        ->Args({ 100, 100 })
+        ->Unit(benchmark::kMillisecond)
+        ->Complexity();
+} // namespace Benchmark
+
+#endif
@@ -7,6 +7,7 @@
  */
 
 #include <AzCore/Component/ComponentApplication.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Math/MathUtils.h>
 #include <AzCore/Math/Matrix3x3.h>
 #include <AzCore/Math/Random.h>
@@ -16,6 +17,7 @@
 
 #include <AzFramework/Application/Application.h>
 #include <AzFramework/Components/TransformComponent.h>
+#include <AzFramework/Components/TransformHierarchy.h>
 
 #include <AzToolsFramework/Application/ToolsApplication.h>
 #include <AzToolsFramework/UnitTest/AzToolsFrameworkTestHelpers.h>
@@ -720,6 +722,203 @@ namespace UnitTest
         EXPECT_TRUE(actualChildWorldPos == expectedChildLocalPos);
     }
 
+    // Fixture with a chain of parented transforms that are updated through the TransformHierarchy.
+    class TransformComponentBatchedHierarchy
+        : public TransformComponentApplication
+    {
+    protected:
+        static constexpr size_t ChainLength = 5;
+
+        void SetUp() override
+        {
+            TransformComponentApplication::SetUp();
+
+            AZ::Interface<AZ::IConsole>::Get()->PerformCommand("bg_transformHierarchyBatchUpdate true");
+            m_hierarchy = AZ::Interface<TransformHierarchy>::Get();
+            if (!m_hierarchy)
+            {
+                m_ownedHierarchy = AZStd::make_unique<TransformHierarchy>();
+                m_hierarchy = m_ownedHierarchy.get();
+                AZ::Interface<TransformHierarchy>::Register(m_hierarchy);
+            }
+
+            for (size_t i = 0; i < ChainLength; ++i)
+            {
+                Entity* entity = aznew Entity(AZStd::string::format("Entity %zu", i).c_str());
+                entity->Init();
+                entity->CreateComponent<TransformComponent>();
+                entity->Activate();
+                if (!m_entities.empty())
+                {
+                    TransformBus::Event(entity->GetId(), &TransformBus::Events::SetParent, m_entities.back()->GetId());
+                }
+                TransformBus::Event(entity->GetId(), &TransformBus::Events::SetLocalTM, GetLocalTM(i));
+                m_entities.push_back(entity);
+            }
+            m_hierarchy->Update();
+        }
+
+        void TearDown() override
+        {
+            for (auto it = m_entities.rbegin(); it != m_entities.rend(); ++it)
+            {
+                (*it)->Deactivate();
+                delete *it;
+            }
+            m_entities.clear();
+
+            if (m_ownedHierarchy)
+            {
+                AZ::Interface<TransformHierarchy>::Unregister(m_ownedHierarchy.get());
+                m_ownedHierarchy.reset();
+            }
+            AZ::Interface<AZ::IConsole>::Get()->PerformCommand("bg_transformHierarchyBatchUpdate false");
+
+            TransformComponentApplication::TearDown();
+        }
+
+        static Transform GetLocalTM(size_t index)
+        {
+            return Transform::CreateFromQuaternionAndTranslation(
+                Quaternion::CreateRotationZ(0.1f * static_cast<float>(index + 1)), Vector3(1.0f, 2.0f, 3.0f));
+        }
+
+        Transform GetWorldTM(size_t index) const
+        {
+            Transform worldTM;
+            TransformBus::EventResult(worldTM, m_entities[index]->GetId(), &TransformBus::Events::GetWorldTM);
+            return worldTM;
+        }
+
+        Transform GetExpectedWorldTM(size_t index, const Transform& rootTM) const
+        {
+            Transform worldTM = rootTM;
+            for (size_t i = 1; i <= index; ++i)
+            {
+                worldTM *= GetLocalTM(i);
+            }
+            return worldTM;
+        }
+
+        AZStd::unique_ptr<TransformHierarchy> m_ownedHierarchy;
+        TransformHierarchy* m_hierarchy = nullptr;
+        AZStd::vector<Entity*> m_entities;
+    };
+
+    TEST_F(TransformComponentBatchedHierarchy, SetUp_AllTransformsRegistered)
+    {
+        EXPECT_EQ(m_hierarchy->GetNodeCount(), ChainLength);
+        EXPECT_EQ(m_hierarchy->GetDepthCount(), ChainLength);
+        for (size_t i = 0; i < ChainLength; ++i)
+        {
+            EXPECT_THAT(GetWorldTM(i), IsClose(GetExpectedWorldTM(i, GetLocalTM(0))));
+        }
+    }
+
+    TEST_F(TransformComponentBatchedHierarchy, MoveRoot_DescendantsUpdatedByHierarchyUpdate)
+    {
+        const Transform previousChildTM = GetWorldTM(1);
+        const Transform rootTM = Transform::CreateTranslation(Vector3(10.0f, -5.0f, 2.0f));
+        TransformBus::Event(m_entities[0]->GetId(), &TransformBus::Events::SetWorldTM, rootTM);
+
+        // The root moves right away, its descendants only when the hierarchy is updated.
+        EXPECT_THAT(GetWorldTM(0), IsClose(rootTM));
+        EXPECT_THAT(GetWorldTM(1), IsClose(previousChildTM));
+
+        m_hierarchy->Update();
+
+        for (size_t i = 0; i < ChainLength; ++i)
+        {
+            EXPECT_THAT(GetWorldTM(i), IsClose(GetExpectedWorldTM(i, rootTM)));
+        }
+    }
+
+    TEST_F(TransformComponentBatchedHierarchy, MoveRoot_NotificationsSentOnceParentsFirst)
+    {
+        AZStd::vector<size_t> notifiedIndices;
+        AZStd::vector<AZ::TransformChangedEvent::Handler> handlers;
+        handlers.reserve(ChainLength);
+        for (size_t i = 0; i < ChainLength; ++i)
+        {
+            handlers.emplace_back(
+                [&notifiedIndices, i](const Transform&, const Transform&)
+                {
+                    notifiedIndices.push_back(i);
+                });
+            TransformBus::Event(m_entities[i]->GetId(), &TransformBus::Events::BindTransformChangedEventHandler, handlers.back());
+        }
+
+        TransformBus::Event(m_entities[0]->GetId(), &TransformBus::Events::SetWorldTM, Transform::CreateTranslation(Vector3(1.0f)));
+        TransformBus::Event(m_entities[0]->GetId(), &TransformBus::Events::SetWorldTM, Transform::CreateTranslation(Vector3(2.0f)));
+        EXPECT_THAT(notifiedIndices, ::testing::ElementsAre(0, 0));
+
+        notifiedIndices.clear();
+        m_hierarchy->Update();
+        EXPECT_THAT(notifiedIndices, ::testing::ElementsAre(1, 2, 3, 4));
+    }
+
+    TEST_F(TransformComponentBatchedHierarchy, MoveRootWithDoNotUpdateChild_ChildKeepsWorldTransform)
+    {
+        const Transform previousChildTM = GetWorldTM(2);
+        TransformBus::Event(
+            m_entities[2]->GetId(), &TransformBus::Events::SetOnParentChangedBehavior, AZ::OnParentChangedBehavior::DoNotUpdate);
+
+        const Transform rootTM = Transform::CreateTranslation(Vector3(-4.0f, 8.0f, 1.0f));
+        TransformBus::Event(m_entities[0]->GetId(), &TransformBus::Events::SetWorldTM, rootTM);
+        m_hierarchy->Update();
+
+        EXPECT_THAT(GetWorldTM(1), IsClose(GetExpectedWorldTM(1, rootTM)));
+        EXPECT_THAT(GetWorldTM(2), IsClose(previousChildTM));
+        Transform childLocalTM;
+        TransformBus::EventResult(childLocalTM, m_entities[2]->GetId(), &TransformBus::Events::GetLocalTM);
+        EXPECT_THAT(childLocalTM, IsClose(GetWorldTM(1).GetInverse() * previousChildTM));
+        // The descendants of the child don't move either, since its world transform didn't change.
+        EXPECT_THAT(GetWorldTM(4), IsClose(previousChildTM * GetLocalTM(3) * GetLocalTM(4)));
+    }
+
+    TEST_F(TransformComponentBatchedHierarchy, HandlerMovesLaterDescendant_ItsChildrenUpdatedByNextUpdate)
+    {
+        // While the hierarchy notifies entity 2, move entity 3, which hasn't been notified yet in the same pass.
+        const Transform movedLocalTM = Transform::CreateTranslation(Vector3(0.0f, 7.0f, -2.0f));
+        bool moved = false;
+        AZ::TransformChangedEvent::Handler handler(
+            [this, &movedLocalTM, &moved](const Transform&, const Transform&)
+            {
+                if (!moved)
+                {
+                    moved = true;
+                    TransformBus::Event(m_entities[3]->GetId(), &TransformBus::Events::SetLocalTM, movedLocalTM);
+                }
+            });
+        TransformBus::Event(m_entities[2]->GetId(), &TransformBus::Events::BindTransformChangedEventHandler, handler);
+
+        const Transform rootTM = Transform::CreateTranslation(Vector3(5.0f, 1.0f, -3.0f));
+        TransformBus::Event(m_entities[0]->GetId(), &TransformBus::Events::SetWorldTM, rootTM);
+        m_hierarchy->Update();
+        ASSERT_TRUE(moved);
+
+        m_hierarchy->Update();
+
+        const Transform expectedTM = GetExpectedWorldTM(2, rootTM) * movedLocalTM;
+        EXPECT_THAT(GetWorldTM(3), IsClose(expectedTM));
+        EXPECT_THAT(GetWorldTM(4), IsClose(expectedTM * GetLocalTM(4)));
+    }
+
+    TEST_F(TransformComponentBatchedHierarchy, DeactivateMiddleOfChain_RemainingChildrenBecomeRoots)
+    {
+        m_entities[2]->Deactivate();
+        const Transform detachedTM = GetWorldTM(3);
+
+        TransformBus::Event(m_entities[0]->GetId(), &TransformBus::Events::SetWorldTM, Transform::CreateTranslation(Vector3(3.0f)));
+        m_hierarchy->Update();
+
+        EXPECT_EQ(m_hierarchy->GetNodeCount(), ChainLength - 1);
+        EXPECT_THAT(GetWorldTM(1), IsClose(GetExpectedWorldTM(1, Transform::CreateTranslation(Vector3(3.0f)))));
+        EXPECT_THAT(GetWorldTM(3), IsClose(detachedTM));
+
+        m_entities[2]->Activate();
+    }
+
     // Fixture provides TransformComponent that is static (or not static) on an entity that has been activated.
     template<bool IsStatic>
     class StaticOrMovableTransformComponent
@@ -90,6 +90,7 @@ set(FILES
     Prefab/Benchmark/Spawnable/SpawnableBenchmarkFixture.h
     Prefab/Benchmark/Spawnable/SpawnableBenchmarkFixture.cpp
     Prefab/Benchmark/Spawnable/SpawnAllEntitiesBenchmarks.cpp
+    Prefab/Benchmark/Spawnable/SpawnableClonePlanBenchmarks.cpp
     Prefab/Instance/InstanceDeserializationTests.cpp
     Prefab/Link/PrefabLinkDomTestFixture.cpp
     Prefab/Link/PrefabLinkDomTestFixture.h
@@ -167,7 +167,8 @@ namespace AZ::Render
             if (m_rasterPass && m_rasterPass->GetRenderPipeline())
             {
                 // Get DrawList from the dynamic draw interface and view
-                AZStd::vector<RHI::DrawListView> drawLists = AZ::RPI::DynamicDrawInterface::Get()->GetDrawListsForPass(m_rasterPass);
+                AZStd::vector<RHI::DrawListView, AZ::FrameArenaStdAllocator> drawLists =
+                    AZ::RPI::DynamicDrawInterface::Get()->GetDrawListsForPass(m_rasterPass);
                 const AZStd::vector<AZ::RPI::ViewPtr>& views =
                     m_rasterPass->GetRenderPipeline()->GetViews(m_rasterPass->GetPipelineViewTag());
                 RHI::DrawListView viewDrawList;
@@ -16,6 +16,8 @@
 #include <Atom/RPI.Public/DynamicDraw/DynamicDrawContext.h>
 #include <Atom/RPI.Public/Material/Material.h>
 
+#include <AzCore/Memory/FrameArenaAllocator.h>
+
 namespace AZ
 {
     namespace RPI
@@ -71,7 +73,8 @@ namespace AZ
             virtual void AddDrawPacket(Scene* scene, ConstPtr<RHI::DrawPacket> drawPacket) = 0;
 
             //! Get DrawLists from any DynamicDrawContext which output to the specified RasterPass.
-            virtual AZStd::vector<RHI::DrawListView> GetDrawListsForPass(const RasterPass* pass) = 0;
+            //! The returned vector is allocated from the frame arena and must not be kept beyond the current frame.
+            virtual AZStd::vector<RHI::DrawListView, AZ::FrameArenaStdAllocator> GetDrawListsForPass(const RasterPass* pass) = 0;
         };
 
         //! Global function to query the DynamicDrawInterface.
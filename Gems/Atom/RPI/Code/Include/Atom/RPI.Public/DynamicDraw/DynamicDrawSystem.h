@@ -36,7 +36,7 @@ namespace AZ
             void DrawGeometry(Data::Instance<Material> material, const GeometryData& geometry, ScenePtr scene) override;
             void AddDrawPacket(Scene* scene, AZStd::unique_ptr<const RHI::DrawPacket> drawPacket) override;
             void AddDrawPacket(Scene* scene, ConstPtr<RHI::DrawPacket> drawPacket) override;
-            AZStd::vector<RHI::DrawListView> GetDrawListsForPass(const RasterPass* pass) override;
+            AZStd::vector<RHI::DrawListView, AZ::FrameArenaStdAllocator> GetDrawListsForPass(const RasterPass* pass) override;
 
             // Submit draw data for selected scene and pipeline
             void SubmitDrawData(Scene* scene, AZStd::vector<ViewPtr> views);
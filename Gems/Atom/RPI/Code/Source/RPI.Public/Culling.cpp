@@ -20,7 +20,9 @@
 #include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/Math/MatrixUtils.h>
 #include <AzCore/Math/ShapeIntersection.h>
+#include <AzCore/Memory/FrameArenaAllocator.h>
 #include <AzCore/Task/TaskGraph.h>
+#include <AzCore/std/containers/span.h>
 #include <AzCore/std/parallel/lock.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzFramework/Visibility/OcclusionBus.h>
@@ -237,7 +239,7 @@ namespace AZ
             AZ::Job* parentJob,
             AZ::TaskGraphEvent* taskGraphEvent)
         {
-            AZStd::shared_ptr<WorklistData> worklistData = AZStd::make_shared<WorklistData>();
+            AZStd::shared_ptr<WorklistData> worklistData = AZStd::allocate_shared<WorklistData>(AZ::FrameArenaStdAllocator());
             worklistData->m_debugCtx = &debugCtx;
             worklistData->m_scene = &scene;
             worklistData->m_sceneEntityContextId = GetEntityContextIdForOcclusion(&scene);
@@ -248,7 +250,8 @@ namespace AZ
             return worklistData;
         }
 
-        // Used to accumulate NodeData into lists to be handed off to jobs for processing
+        // Used to accumulate NodeData into lists to be handed off to jobs for processing.
+        // The work lists only live until culling completes, so they are allocated from the frame arena.
         struct WorkListType
         {
             void Init()
@@ -259,13 +262,13 @@ namespace AZ
             }
 
             u32 m_entryCount = 0;
-            AZStd::vector<AzFramework::IVisibilityScene::NodeData> m_nodes;
+            AZStd::vector<AzFramework::IVisibilityScene::NodeData, AZ::FrameArenaStdAllocator> m_nodes;
         };
 
         // Used to accumulate VisibilityEntry into lists to be handed off to jobs for processing
         struct EntryListType
         {
-            AZStd::vector<AzFramework::VisibilityEntry*> m_entries;
+            AZStd::vector<AzFramework::VisibilityEntry*, AZ::FrameArenaStdAllocator> m_entries;
         };
 
         static bool TestOcclusionCulling(
@@ -273,7 +276,7 @@ namespace AZ
 
         static void ProcessEntrylist(
             const AZStd::shared_ptr<WorklistData>& worklistData,
-            const AZStd::vector<AzFramework::VisibilityEntry*>& entries,
+            AZStd::span<AzFramework::VisibilityEntry* const> entries,
             bool parentNodeContainedInFrustum = false,
             s32 startIdx = 0,
             s32 endIdx = -1)
@@ -625,7 +628,7 @@ namespace AZ
             {
                 // frustum cull occlusion planes
                 using VisibleOcclusionPlane = AZStd::pair<OcclusionPlane, float>;
-                AZStd::vector<VisibleOcclusionPlane> visibleOccluders;
+                AZStd::vector<VisibleOcclusionPlane, AZ::FrameArenaStdAllocator> visibleOccluders;
                 visibleOccluders.reserve(m_occlusionPlanes.size());
                 for (const auto& occlusionPlane : m_occlusionPlanes)
                 {
@@ -691,7 +694,7 @@ namespace AZ
 
             ProcessCullablesCommon(scene, view, frustum);
 
-            AZStd::shared_ptr<WorkListType> worklist = AZStd::make_shared<WorkListType>();
+            AZStd::shared_ptr<WorkListType> worklist = AZStd::allocate_shared<WorkListType>(AZ::FrameArenaStdAllocator());
             worklist->Init();
             AZStd::shared_ptr<WorklistData> worklistData = MakeWorklistData(m_debugCtx, scene, view, frustum, parentJob, taskGraphEvent);
             static const AZ::TaskDescriptor descriptor{ "AZ::RPI::ProcessWorklist", "Graphics" };
@@ -777,7 +780,7 @@ namespace AZ
                         parentJob->SetContinuation(job);
                         job->Start();
                     }
-                    worklist = AZStd::make_shared<WorkListType>();
+                    worklist = AZStd::allocate_shared<WorkListType>(AZ::FrameArenaStdAllocator());
                     worklist->Init();
                 }
 
@@ -838,7 +841,7 @@ namespace AZ
             // EntryListType entryList;
             // Why isn't immediately clear (did profile several times and noticed the difference of ~0.2-0.3ms, seems making it a stack variable
             // increases the runtime for this function, which runs on a single thread and spawns other jobs).
-            AZStd::shared_ptr<EntryListType> entryList = AZStd::make_shared<EntryListType>();
+            AZStd::shared_ptr<EntryListType> entryList = AZStd::allocate_shared<EntryListType>(AZ::FrameArenaStdAllocator());
             entryList->m_entries.reserve(r_numEntriesPerCullingJob);
             AZStd::shared_ptr<WorklistData> worklistData = MakeWorklistData(m_debugCtx, scene, view, frustum, parentJob, nullptr);
 
@@ -874,7 +877,7 @@ namespace AZ
                         };
 
                         AZ::Job* job = AZ::CreateJobFunction(processWorklist, true);
-                        entryList = AZStd::make_shared<EntryListType>();
+                        entryList = AZStd::allocate_shared<EntryListType>(AZ::FrameArenaStdAllocator());
                         entryList->m_entries.reserve(r_numEntriesPerCullingJob);
 
                         parentJob->SetContinuation(job);
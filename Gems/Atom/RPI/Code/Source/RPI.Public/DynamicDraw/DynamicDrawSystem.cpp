@@ -108,9 +108,9 @@ namespace AZ
             }
         }
 
-        AZStd::vector<RHI::DrawListView> DynamicDrawSystem::GetDrawListsForPass(const RasterPass* pass)
+        AZStd::vector<RHI::DrawListView, AZ::FrameArenaStdAllocator> DynamicDrawSystem::GetDrawListsForPass(const RasterPass* pass)
         {
-            AZStd::vector<RHI::DrawListView> result;
+            AZStd::vector<RHI::DrawListView, AZ::FrameArenaStdAllocator> result;
             AZStd::lock_guard<AZStd::mutex> lock(m_mutexDrawContext);
             for (RHI::Ptr<DynamicDrawContext> drawContext : m_dynamicDrawContexts)
             {
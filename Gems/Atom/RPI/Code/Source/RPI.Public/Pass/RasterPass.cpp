@@ -163,7 +163,7 @@ namespace AZ
         void RasterPass::UpdateDrawList()
         {
              // DrawLists from dynamic draw
-            AZStd::vector<RHI::DrawListView> drawLists = DynamicDrawInterface::Get()->GetDrawListsForPass(this);
+            AZStd::vector<RHI::DrawListView, AZ::FrameArenaStdAllocator> drawLists = DynamicDrawInterface::Get()->GetDrawListsForPass(this);
 
             // Get DrawList from view
             const AZStd::vector<ViewPtr>& views = m_pipeline->GetViews(GetPipelineViewTag());
@@ -40,5 +40,15 @@ namespace Multiplayer
 
         // Other systems
         MultiplayerStat_PhysicsFrameTimeUs,
+
+        // Replication
+        MultiplayerStat_EntityUpdateCacheHits,      // Entity updates reused from another connection's serialization this tick
+        MultiplayerStat_EntityUpdateCacheMisses,    // Entity updates serialized this tick while the serialization cache was open
+
+        // Staged connection update pipeline, time summed across worker threads
+        MultiplayerStat_PipelineRelevancyTimeUs,
+        MultiplayerStat_PipelineSerializeTimeUs,
+        MultiplayerStat_PipelineEncodeTimeUs,
+        MultiplayerStat_PipelineTransmitTimeUs,
     };
 }
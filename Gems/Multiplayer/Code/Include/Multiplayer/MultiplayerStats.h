@@ -29,6 +29,17 @@ namespace Multiplayer
         uint64_t m_recordMetricIndex = 0;
         AZ::TimeMs m_totalHistoryTimeMs = AZ::Time::ZeroTimeMs;
 
+        //! Entity updates served from the shared serialization cache instead of being serialized again for each connection.
+        AZ::u64 m_entityUpdateCacheHits = 0;
+        AZ::u64 m_entityUpdateCacheMisses = 0;
+        AZ::u64 m_entityUpdateCacheReusedBytes = 0;
+
+        //! Time spent in each stage of the staged connection update pipeline during the last network tick, summed across threads.
+        AZ::TimeUs m_pipelineRelevancyTimeUs = AZ::Time::ZeroTimeUs;
+        AZ::TimeUs m_pipelineSerializeTimeUs = AZ::Time::ZeroTimeUs;
+        AZ::TimeUs m_pipelineEncodeTimeUs = AZ::Time::ZeroTimeUs;
+        AZ::TimeUs m_pipelineTransmitTimeUs = AZ::Time::ZeroTimeUs;
+
         static const uint32_t RingbufferSamples = 32;
         using MetricRingbuffer = AZStd::array<uint64_t, RingbufferSamples>;
         struct Metric
@@ -58,6 +69,10 @@ namespace Multiplayer
         void RecordRpcSent(AZ::EntityId entityId, const char* entityName, NetComponentId netComponentId, RpcIndex rpcId, uint32_t totalBytes);
         void RecordRpcReceived(AZ::EntityId entityId, const char* entityName, NetComponentId netComponentId, RpcIndex rpcId, uint32_t totalBytes);
         void RecordFrameTime(AZ::TimeUs networkFrameTime);
+        void RecordEntityUpdateCacheTick(uint64_t hits, uint64_t misses, uint64_t reusedBytes);
+        void RecordConnectionUpdatePipelineTick(AZ::TimeUs relevancyTime, AZ::TimeUs serializeTime, AZ::TimeUs encodeTime, AZ::TimeUs transmitTime);
+        //! Returns the fraction of entity updates served from the serialization cache since startup, in the range [0, 1].
+        float CalculateEntityUpdateCacheHitRate() const;
         void TickStats(AZ::TimeMs metricFrameTimeMs);
 
         Metric CalculateComponentPropertyUpdateSentMetrics(NetComponentId netComponentId) const;
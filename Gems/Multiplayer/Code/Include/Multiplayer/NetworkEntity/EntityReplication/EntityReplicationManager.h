@@ -61,6 +61,11 @@ namespace Multiplayer
 
         void ActivatePendingEntities();
         void SendUpdates();
+
+        //! Returns the time SendUpdates spent selecting replicators to update and serializing them since the last call, then resets it.
+        //! @param relevancyTimeOut time spent prioritizing and preparing the replicators that need updates
+        //! @param serializeTimeOut time spent serializing entity updates, rpcs and resets into packets
+        void ConsumeSendUpdatesTimes(AZ::TimeUs& relevancyTimeOut, AZ::TimeUs& serializeTimeOut);
         void Clear(bool forMigration);
 
         bool SetEntityRebasing(NetworkEntityHandle& entityHandle);
@@ -213,6 +218,8 @@ namespace Multiplayer
         AZ::TimeMs m_entityActivationTimeSliceMs = AZ::Time::ZeroTimeMs;
         AZ::TimeMs m_entityPendingRemovalMs = AZ::Time::ZeroTimeMs;
         AZ::TimeMs m_frameTimeMs = AZ::Time::ZeroTimeMs;
+        AZ::TimeUs m_sendUpdatesRelevancyTimeUs = AZ::Time::ZeroTimeUs;
+        AZ::TimeUs m_sendUpdatesSerializeTimeUs = AZ::Time::ZeroTimeUs;
         HostId m_remoteHostId = InvalidHostId;
         uint32_t m_maxRemoteEntitiesPendingCreationCount = AZStd::numeric_limits<uint32_t>::max();
         uint32_t m_maxPayloadSize = 0;
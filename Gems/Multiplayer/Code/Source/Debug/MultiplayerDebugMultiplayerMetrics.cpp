@@ -179,6 +179,16 @@ namespace Multiplayer
         ImGui::Text("Total networked entities: %llu", aznumeric_cast<AZ::u64>(stats.m_entityCount));
         ImGui::Text("Total client connections: %llu", aznumeric_cast<AZ::u64>(stats.m_clientConnectionCount));
         ImGui::Text("Total server connections: %llu", aznumeric_cast<AZ::u64>(stats.m_serverConnectionCount));
+        ImGui::Text("Entity update cache hit rate: %.1f%% (%llu hits, %llu misses, %llu bytes reused)",
+            stats.CalculateEntityUpdateCacheHitRate() * 100.0f,
+            aznumeric_cast<AZ::u64>(stats.m_entityUpdateCacheHits),
+            aznumeric_cast<AZ::u64>(stats.m_entityUpdateCacheMisses),
+            aznumeric_cast<AZ::u64>(stats.m_entityUpdateCacheReusedBytes));
+        ImGui::Text("Connection update pipeline: relevancy %lld us, serialize %lld us, encode %lld us, transmit %lld us",
+            aznumeric_cast<AZ::s64>(stats.m_pipelineRelevancyTimeUs),
+            aznumeric_cast<AZ::s64>(stats.m_pipelineSerializeTimeUs),
+            aznumeric_cast<AZ::s64>(stats.m_pipelineEncodeTimeUs),
+            aznumeric_cast<AZ::s64>(stats.m_pipelineTransmitTimeUs));
         ImGui::NewLine();
 
         static ImGuiTableFlags flags = ImGuiTableFlags_BordersV
@@ -263,4 +263,33 @@ namespace Multiplayer
     {
         SET_PERFORMANCE_STAT(MultiplayerStat_FrameTimeUs, networkFrameTime);
     }
+
+    void MultiplayerStats::RecordEntityUpdateCacheTick(uint64_t hits, uint64_t misses, uint64_t reusedBytes)
+    {
+        m_entityUpdateCacheHits += hits;
+        m_entityUpdateCacheMisses += misses;
+        m_entityUpdateCacheReusedBytes += reusedBytes;
+
+        SET_PERFORMANCE_STAT(MultiplayerStat_EntityUpdateCacheHits, hits);
+        SET_PERFORMANCE_STAT(MultiplayerStat_EntityUpdateCacheMisses, misses);
+    }
+
+    void MultiplayerStats::RecordConnectionUpdatePipelineTick(AZ::TimeUs relevancyTime, AZ::TimeUs serializeTime, AZ::TimeUs encodeTime, AZ::TimeUs transmitTime)
+    {
+        m_pipelineRelevancyTimeUs = relevancyTime;
+        m_pipelineSerializeTimeUs = serializeTime;
+        m_pipelineEncodeTimeUs = encodeTime;
+        m_pipelineTransmitTimeUs = transmitTime;
+
+        SET_PERFORMANCE_STAT(MultiplayerStat_PipelineRelevancyTimeUs, relevancyTime);
+        SET_PERFORMANCE_STAT(MultiplayerStat_PipelineSerializeTimeUs, serializeTime);
+        SET_PERFORMANCE_STAT(MultiplayerStat_PipelineEncodeTimeUs, encodeTime);
+        SET_PERFORMANCE_STAT(MultiplayerStat_PipelineTransmitTimeUs, transmitTime);
+    }
+
+    float MultiplayerStats::CalculateEntityUpdateCacheHitRate() const
+    {
+        const uint64_t lookups = m_entityUpdateCacheHits + m_entityUpdateCacheMisses;
+        return (lookups > 0) ? aznumeric_cast<float>(m_entityUpdateCacheHits) / aznumeric_cast<float>(lookups) : 0.0f;
+    }
 } // namespace Multiplayer
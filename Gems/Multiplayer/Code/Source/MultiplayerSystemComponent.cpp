@@ -17,6 +17,7 @@
 #include <EntityDomains/NullEntityDomain.h>
 #include <ReplicationWindows/NullReplicationWindow.h>
 #include <ReplicationWindows/ServerToClientReplicationWindow.h>
+#include <ReplicationWindows/SpatialInterestReplicationWindow.h>
 #include <Source/AutoGen/AutoComponentTypes.h>
 #include <Multiplayer/Session/ISessionRequests.h>
 #include <Multiplayer/Session/SessionConfig.h>
@@ -42,7 +43,10 @@
 
 #include <cmath>
 #include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
 #include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/std/parallel/thread.h>
 #include <System/PhysXSystem.h>
 
 #include <AzCore/Jobs/JobCompletion.h>
@@ -129,9 +133,15 @@ namespace Multiplayer
         "How often in milliseconds to record transport metrics.");
 
     AZ_CVAR(bool, sv_multithreadedConnectionUpdates, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
-        "If true, the server will send updates to clients on different threads, which improves performance with large number of clients");
+        "If true, the server prepares and encodes updates to clients on job threads while the main thread transmits them in connection order, which improves performance with large number of clients");
     AZ_CVAR(bool, bg_parallelNotifyPreRender, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
         "If true, OnPreRender events will be sent in parallel from job threads. Please make sure the handlers of the event are thread safe.");
+    AZ_CVAR(bool, sv_entityUpdateSerializationCache, true, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "If true, the server serializes each entity update once per distinct replication record and shares the bytes between client connections");
+    AZ_CVAR(bool, sv_useSpatialInterestGrid, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "If true, client replication windows gather relevant entities from a server-wide grid of network entities instead of querying the visibility system per connection");
+    AZ_CVAR(float, sv_spatialInterestGridCellSize, 128.0f, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "The edge length in meters of a spatial interest grid cell, takes effect the next time the grid is enabled");
     
 
     void MultiplayerSystemComponent::Reflect(AZ::ReflectContext* context)
@@ -238,10 +248,14 @@ namespace Multiplayer
         , m_autonomousEntityReplicatorCreatedHandler([this]([[maybe_unused]] NetEntityId netEntityId) { OnAutonomousEntityReplicatorCreated(); })
     {
         AZ::Interface<IMultiplayer>::Register(this);
+        AZ::Interface<EntityUpdateSerializationCache>::Register(&m_entityUpdateSerializationCache);
+        AZ::Interface<SpatialInterestGrid>::Register(&m_spatialInterestGrid);
     }
 
     MultiplayerSystemComponent::~MultiplayerSystemComponent()
     {
+        AZ::Interface<SpatialInterestGrid>::Unregister(&m_spatialInterestGrid);
+        AZ::Interface<EntityUpdateSerializationCache>::Unregister(&m_entityUpdateSerializationCache);
         AZ::Interface<IMultiplayer>::Unregister(this);
     }
 
@@ -359,6 +373,14 @@ namespace Multiplayer
         DECLARE_PERFORMANCE_STAT(MultiplayerGroup_Networking, MultiplayerStat_TotalPacketsDiscardedDueToLoad, "TotalPacketsDiscardedDueToLoad");
 
         DECLARE_PERFORMANCE_STAT(MultiplayerGroup_Networking, MultiplayerStat_PhysicsFrameTimeUs, "PhysicsFrameTimeUs");        
+
+        DECLARE_PERFORMANCE_STAT(MultiplayerGroup_Networking, MultiplayerStat_EntityUpdateCacheHits, "EntityUpdateCacheHits");
+        DECLARE_PERFORMANCE_STAT(MultiplayerGroup_Networking, MultiplayerStat_EntityUpdateCacheMisses, "EntityUpdateCacheMisses");
+
+        DECLARE_PERFORMANCE_STAT(MultiplayerGroup_Networking, MultiplayerStat_PipelineRelevancyTimeUs, "PipelineRelevancyTimeUs");
+        DECLARE_PERFORMANCE_STAT(MultiplayerGroup_Networking, MultiplayerStat_PipelineSerializeTimeUs, "PipelineSerializeTimeUs");
+        DECLARE_PERFORMANCE_STAT(MultiplayerGroup_Networking, MultiplayerStat_PipelineEncodeTimeUs, "PipelineEncodeTimeUs");
+        DECLARE_PERFORMANCE_STAT(MultiplayerGroup_Networking, MultiplayerStat_PipelineTransmitTimeUs, "PipelineTransmitTimeUs");
     }
 
     void MultiplayerSystemComponent::Deactivate()
@@ -377,6 +399,7 @@ namespace Multiplayer
         AZ::TickBus::Handler::BusDisconnect();
         AzFramework::RootSpawnableNotificationBus::Handler::BusDisconnect();
 
+        m_spatialInterestGrid.Disable();
         m_networkEntityManager.Reset();
 
 #if (O3DE_EDITOR_CONNECTION_LISTENER_ENABLE)
@@ -613,9 +636,18 @@ namespace Multiplayer
         // Metrics calculation, as update calls are threaded.
         UpdatedMetricsConnectionCount();
 
+        // Connections that acknowledged the same updates can share serialized entity updates, entity state is fixed until they're sent
+        const bool shareEntityUpdates = sv_entityUpdateSerializationCache && (stats.m_clientConnectionCount > 1);
+        if (shareEntityUpdates)
+        {
+            m_entityUpdateSerializationCache.BeginTick();
+        }
+
         // Send out the game state update to all connections
         UpdateConnections();
 
+        m_entityUpdateSerializationCache.EndTick(stats);
+
         MultiplayerPackets::SyncConsole packet;
         AZ::ThreadSafeDeque<AZStd::string>::DequeType cvarUpdates;
         m_cvarCommands.Swap(cvarUpdates);
@@ -679,17 +711,34 @@ namespace Multiplayer
             // Threaded update calls.
             AZ_PROFILE_SCOPE(MULTIPLAYER, "MultiplayerSystemComponent: UpdateConnections");
 
+            // Each job selects and serializes the updates for one connection, then compresses and encrypts the packets it produced.
+            // Only this thread touches the socket, transmitting connections in connection id order as soon as they're encoded
+            m_networkInterface->BeginStagedSends();
+
+            AZStd::atomic<int64_t> relevancyTimeUs{ 0 };
+            AZStd::atomic<int64_t> serializeTimeUs{ 0 };
+            AZStd::atomic<int64_t> encodeTimeUs{ 0 };
             AZ::JobCompletion jobCompletion;
 
-            auto sendNetworkUpdates = [&jobCompletion](IConnection& connection)
+            auto sendNetworkUpdates = [this, &jobCompletion, &relevancyTimeUs, &serializeTimeUs, &encodeTimeUs](IConnection& connection)
             {
-                AZ::Job* job = AZ::CreateJobFunction([&connection]()
+                AZ::Job* job = AZ::CreateJobFunction([this, &connection, &relevancyTimeUs, &serializeTimeUs, &encodeTimeUs]()
                     {
                         if (connection.GetUserData() != nullptr)
                         {
                             IConnectionData* connectionData = static_cast<IConnectionData*>(connection.GetUserData());
                             connectionData->Update();
+
+                            AZ::TimeUs relevancyTime = AZ::Time::ZeroTimeUs;
+                            AZ::TimeUs serializeTime = AZ::Time::ZeroTimeUs;
+                            connectionData->GetReplicationManager().ConsumeSendUpdatesTimes(relevancyTime, serializeTime);
+                            relevancyTimeUs += aznumeric_cast<int64_t>(relevancyTime);
+                            serializeTimeUs += aznumeric_cast<int64_t>(serializeTime);
                         }
+
+                        const AZStd::chrono::steady_clock::time_point encodeStartTime = AZStd::chrono::steady_clock::now();
+                        m_networkInterface->EncodeStagedSends(connection.GetConnectionId());
+                        encodeTimeUs += AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(AZStd::chrono::steady_clock::now() - encodeStartTime).count();
                     }, true /*auto delete*/, nullptr);
 
                 job->SetDependent(&jobCompletion);
@@ -697,7 +746,36 @@ namespace Multiplayer
             };
 
             m_networkInterface->GetConnectionSet().VisitConnections(sendNetworkUpdates);
+
+            // Transmitting while the jobs run relies on worker threads to run them
+            AZStd::chrono::microseconds transmitTime{ 0 };
+            const AZ::JobContext* jobContext = AZ::JobContext::GetGlobalContext();
+            if (jobContext != nullptr && jobContext->GetJobManager().GetNumWorkerThreads() > 0)
+            {
+                for (;;)
+                {
+                    const AZStd::chrono::steady_clock::time_point transmitStartTime = AZStd::chrono::steady_clock::now();
+                    const bool transmittedAll = m_networkInterface->TransmitStagedSends();
+                    transmitTime += AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(AZStd::chrono::steady_clock::now() - transmitStartTime);
+                    if (transmittedAll)
+                    {
+                        break;
+                    }
+                    AZStd::this_thread::yield();
+                }
+            }
+
             jobCompletion.StartAndWaitForCompletion();
+
+            const AZStd::chrono::steady_clock::time_point transmitStartTime = AZStd::chrono::steady_clock::now();
+            m_networkInterface->EndStagedSends();
+            transmitTime += AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(AZStd::chrono::steady_clock::now() - transmitStartTime);
+
+            GetStats().RecordConnectionUpdatePipelineTick(
+                AZ::TimeUs{ relevancyTimeUs.load() },
+                AZ::TimeUs{ serializeTimeUs.load() },
+                AZ::TimeUs{ encodeTimeUs.load() },
+                AZ::TimeUs{ transmitTime.count() });
         }
         else // On clients (including the Editor) run in a single threaded mode to avoid issues in UI asset loading
         {
@@ -1575,6 +1653,14 @@ namespace Multiplayer
         AZLOG_INFO("Total RPCs sent bytes: %llu", aznumeric_cast<AZ::u64>(rpcsSent.m_totalBytes));
         AZLOG_INFO("Total RPCs received: %llu", aznumeric_cast<AZ::u64>(rpcsRecv.m_totalCalls));
         AZLOG_INFO("Total RPCs received bytes: %llu", aznumeric_cast<AZ::u64>(rpcsRecv.m_totalBytes));
+        AZLOG_INFO("Total entity update cache hits: %llu", aznumeric_cast<AZ::u64>(stats.m_entityUpdateCacheHits));
+        AZLOG_INFO("Total entity update cache misses: %llu", aznumeric_cast<AZ::u64>(stats.m_entityUpdateCacheMisses));
+        AZLOG_INFO("Total entity update cache reused bytes: %llu", aznumeric_cast<AZ::u64>(stats.m_entityUpdateCacheReusedBytes));
+        AZLOG_INFO("Entity update cache hit rate: %.1f%%", stats.CalculateEntityUpdateCacheHitRate() * 100.0f);
+        AZLOG_INFO("Connection update pipeline relevancy time: %lld us", aznumeric_cast<AZ::s64>(stats.m_pipelineRelevancyTimeUs));
+        AZLOG_INFO("Connection update pipeline serialize time: %lld us", aznumeric_cast<AZ::s64>(stats.m_pipelineSerializeTimeUs));
+        AZLOG_INFO("Connection update pipeline encode time: %lld us", aznumeric_cast<AZ::s64>(stats.m_pipelineEncodeTimeUs));
+        AZLOG_INFO("Connection update pipeline transmit time: %lld us", aznumeric_cast<AZ::s64>(stats.m_pipelineTransmitTimeUs));
     }
 
     void MultiplayerSystemComponent::TickVisibleNetworkEntities(float deltaTime, float serverRateSeconds)
@@ -1865,7 +1951,7 @@ namespace Multiplayer
     {
         if (auto connectionData = reinterpret_cast<ServerToClientConnectionData*>(connection->GetUserData()))
         {
-            AZStd::unique_ptr<IReplicationWindow> window = AZStd::make_unique<ServerToClientReplicationWindow>(controlledEntity, connection);
+            AZStd::unique_ptr<IReplicationWindow> window = CreateServerToClientReplicationWindow(controlledEntity, connection);
             connectionData->GetReplicationManager().SetReplicationWindow(AZStd::move(window));
             connectionData->SetControlledEntity(controlledEntity);
 
@@ -1877,6 +1963,21 @@ namespace Multiplayer
         }
     }
 
+    AZStd::unique_ptr<IReplicationWindow> MultiplayerSystemComponent::CreateServerToClientReplicationWindow(NetworkEntityHandle controlledEntity, IConnection* connection)
+    {
+        SpatialInterestGrid* spatialInterestGrid = AZ::Interface<SpatialInterestGrid>::Get();
+        if (sv_useSpatialInterestGrid && spatialInterestGrid)
+        {
+            // The grid is shared by all the client connections, it starts tracking network entities when the first one needs it
+            if (!spatialInterestGrid->IsEnabled())
+            {
+                spatialInterestGrid->Enable(sv_spatialInterestGridCellSize);
+            }
+            return AZStd::make_unique<SpatialInterestReplicationWindow>(controlledEntity, connection, *spatialInterestGrid);
+        }
+        return AZStd::make_unique<ServerToClientReplicationWindow>(controlledEntity, connection);
+    }
+
     void MultiplayerSystemComponent::MetricsEvent()
     {
         const auto& networkInterfaces = AZ::Interface<AzNetworking::INetworking>::Get()->GetNetworkInterfaces();
@@ -9,11 +9,14 @@
 #pragma once
 
 #include <Multiplayer/IMultiplayer.h>
+#include <Multiplayer/ReplicationWindows/IReplicationWindow.h>
 #include <Multiplayer/Session/ISessionHandlingRequests.h>
 #include <Multiplayer/Session/SessionNotifications.h>
 #include <Editor/MultiplayerEditorConnection.h>
 #include <NetworkTime/NetworkTime.h>
 #include <NetworkEntity/NetworkEntityManager.h>
+#include <NetworkEntity/EntityReplication/EntityUpdateSerializationCache.h>
+#include <ReplicationWindows/SpatialInterestGrid.h>
 #include <Source/AutoGen/Multiplayer.AutoPacketDispatcher.h>
 
 #include <AzCore/Component/Component.h>
@@ -185,6 +188,7 @@ namespace Multiplayer
         void ExecuteConsoleCommandList(AzNetworking::IConnection* connection, const AZStd::fixed_vector<Multiplayer::LongNetworkString, 32>& commands);
         static void EnableAutonomousControl(NetworkEntityHandle entityHandle, AzNetworking::ConnectionId ownerConnectionId);
         static void StartServerToClientReplication(uint64_t userId, NetworkEntityHandle controlledEntity, AzNetworking::IConnection* connection);
+        static AZStd::unique_ptr<IReplicationWindow> CreateServerToClientReplicationWindow(NetworkEntityHandle controlledEntity, AzNetworking::IConnection* connection);
 
         AZ_CONSOLEFUNC(MultiplayerSystemComponent, DumpStats, AZ::ConsoleFunctorFlags::Null, "Dumps stats for the current multiplayer session");
         void HostConsoleCommand(const AZ::ConsoleCommandContainer& arguments);
@@ -199,6 +203,8 @@ namespace Multiplayer
         AZ::ThreadSafeDeque<AZStd::string> m_cvarCommands;
 
         NetworkEntityManager m_networkEntityManager;
+        EntityUpdateSerializationCache m_entityUpdateSerializationCache;
+        SpatialInterestGrid m_spatialInterestGrid;
         NetworkTime m_networkTime;
         MultiplayerAgentType m_agentType = MultiplayerAgentType::Uninitialized;
         
@@ -120,6 +120,8 @@ namespace Multiplayer
     void EntityReplicationManager::SendUpdates()
     {
         m_frameTimeMs = AZ::GetElapsedTimeMs();
+        const AZStd::chrono::steady_clock::time_point startTime = AZStd::chrono::steady_clock::now();
+        AZStd::chrono::steady_clock::time_point serializeStartTime;
 
         {
             EntityReplicatorList toSendList = GenerateEntityUpdateList();
@@ -141,6 +143,7 @@ namespace Multiplayer
                     replicator->PrepareToGenerateUpdatePacket();
                 }
             }
+            serializeStartTime = AZStd::chrono::steady_clock::now();
 
             {
                 AZ_PROFILE_SCOPE(MULTIPLAYER, "EntityReplicationManager: SendUpdates - SendEntityUpdateMessages");
@@ -159,6 +162,10 @@ namespace Multiplayer
 
         SendEntityResets();
 
+        const AZStd::chrono::steady_clock::time_point endTime = AZStd::chrono::steady_clock::now();
+        m_sendUpdatesRelevancyTimeUs += AZ::TimeUs{ AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(serializeStartTime - startTime).count() };
+        m_sendUpdatesSerializeTimeUs += AZ::TimeUs{ AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(endTime - serializeStartTime).count() };
+
         AZLOG
         (
             NET_ReplicationInfo,
@@ -172,6 +179,14 @@ namespace Multiplayer
         );
     }
 
+    void EntityReplicationManager::ConsumeSendUpdatesTimes(AZ::TimeUs& relevancyTimeOut, AZ::TimeUs& serializeTimeOut)
+    {
+        relevancyTimeOut = m_sendUpdatesRelevancyTimeUs;
+        serializeTimeOut = m_sendUpdatesSerializeTimeUs;
+        m_sendUpdatesRelevancyTimeUs = AZ::Time::ZeroTimeUs;
+        m_sendUpdatesSerializeTimeUs = AZ::Time::ZeroTimeUs;
+    }
+
     EntityReplicationManager::EntityReplicatorList EntityReplicationManager::GenerateEntityUpdateList()
     {
         if (m_replicationWindow == nullptr)
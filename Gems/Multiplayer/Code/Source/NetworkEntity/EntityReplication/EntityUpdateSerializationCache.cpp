@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/NetworkEntity/EntityReplication/EntityUpdateSerializationCache.h>
+#include <Multiplayer/MultiplayerStats.h>
+#include <AzCore/std/hash.h>
+#include <AzCore/std/parallel/lock.h>
+
+namespace Multiplayer
+{
+    void EntityUpdateSerializationCache::BeginTick()
+    {
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
+        m_cachedUpdates.clear();
+        m_updateData.clear();
+        m_hits = 0;
+        m_misses = 0;
+        m_reusedBytes = 0;
+        m_isOpen = true;
+    }
+
+    void EntityUpdateSerializationCache::EndTick(MultiplayerStats& stats)
+    {
+        if (!m_isOpen)
+        {
+            return;
+        }
+
+        m_isOpen = false;
+        stats.RecordEntityUpdateCacheTick(m_hits, m_misses, m_reusedBytes);
+    }
+
+    bool EntityUpdateSerializationCache::IsOpen() const
+    {
+        return m_isOpen;
+    }
+
+    uint32_t EntityUpdateSerializationCache::Find(NetEntityId netEntityId, NetEntityRole remoteRole, uint8_t* buffer, uint32_t recordSize, uint32_t capacity)
+    {
+        const size_t keyHash = HashKey(netEntityId, remoteRole, buffer, recordSize);
+
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_mutex);
+        const CachedUpdate* cachedUpdate = FindCachedUpdate(keyHash, netEntityId, remoteRole, buffer, recordSize);
+        if ((cachedUpdate == nullptr) || (cachedUpdate->m_updateSize > capacity))
+        {
+            ++m_misses;
+            return 0;
+        }
+
+        // The buffer already holds the matching record, only the serialized properties that follow it need to be copied
+        memcpy(buffer + recordSize, m_updateData.data() + cachedUpdate->m_offset + recordSize, cachedUpdate->m_updateSize - recordSize);
+        ++m_hits;
+        m_reusedBytes += cachedUpdate->m_updateSize;
+        return cachedUpdate->m_updateSize;
+    }
+
+    void EntityUpdateSerializationCache::Store(NetEntityId netEntityId, NetEntityRole remoteRole, const uint8_t* update, uint32_t recordSize, uint32_t updateSize)
+    {
+        AZ_Assert(recordSize <= updateSize, "Entity update is smaller than its replication record");
+        const size_t keyHash = HashKey(netEntityId, remoteRole, update, recordSize);
+
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
+        if (!m_isOpen || FindCachedUpdate(keyHash, netEntityId, remoteRole, update, recordSize) != nullptr)
+        {
+            // Another connection missed on the same update concurrently and stored it first
+            return;
+        }
+
+        CachedUpdate cachedUpdate;
+        cachedUpdate.m_netEntityId = netEntityId;
+        cachedUpdate.m_remoteRole = remoteRole;
+        cachedUpdate.m_recordSize = recordSize;
+        cachedUpdate.m_updateSize = updateSize;
+        cachedUpdate.m_offset = m_updateData.size();
+        m_updateData.insert(m_updateData.end(), update, update + updateSize);
+        m_cachedUpdates.emplace(keyHash, cachedUpdate);
+    }
+
+    size_t EntityUpdateSerializationCache::HashKey(NetEntityId netEntityId, NetEntityRole remoteRole, const uint8_t* record, uint32_t recordSize)
+    {
+        size_t keyHash = 0;
+        AZStd::hash_combine(keyHash, static_cast<uint64_t>(netEntityId), static_cast<uint8_t>(remoteRole));
+        AZStd::hash_range(keyHash, record, record + recordSize);
+        return keyHash;
+    }
+
+    const EntityUpdateSerializationCache::CachedUpdate* EntityUpdateSerializationCache::FindCachedUpdate
+    (
+        size_t keyHash,
+        NetEntityId netEntityId,
+        NetEntityRole remoteRole,
+        const uint8_t* record,
+        uint32_t recordSize
+    ) const
+    {
+        auto [first, last] = m_cachedUpdates.equal_range(keyHash);
+        for (auto iter = first; iter != last; ++iter)
+        {
+            const CachedUpdate& cachedUpdate = iter->second;
+            if ((cachedUpdate.m_netEntityId == netEntityId)
+                && (cachedUpdate.m_remoteRole == remoteRole)
+                && (cachedUpdate.m_recordSize == recordSize)
+                && (memcmp(m_updateData.data() + cachedUpdate.m_offset, record, recordSize) == 0))
+            {
+                return &cachedUpdate;
+            }
+        }
+        return nullptr;
+    }
+}
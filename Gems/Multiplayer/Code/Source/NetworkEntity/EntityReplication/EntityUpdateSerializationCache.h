@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Multiplayer/MultiplayerTypes.h>
+#include <AzCore/RTTI/TypeInfoSimple.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/shared_mutex.h>
+
+namespace Multiplayer
+{
+    struct MultiplayerStats;
+
+    //! @class EntityUpdateSerializationCache
+    //! @brief Shares serialized entity updates between all the connections replicating an entity during a network tick.
+    //! Each connection serializes a dirty entity against its own pending replication record, the set of changes that connection
+    //! hasn't acknowledged yet. Connections that acknowledged the same packets hold identical records and produce identical bytes,
+    //! so the first connection to serialize an entity against a record stores the result and the others copy it.
+    //! The cache is only open while the server updates its connections, entity state doesn't change in that window.
+    //! Find and Store may be called concurrently from the connection update jobs.
+    class EntityUpdateSerializationCache
+    {
+    public:
+        AZ_TYPE_INFO(EntityUpdateSerializationCache, "{DA588ECE-C234-4EB6-B6FA-26EE3654FD6B}");
+
+        //! Opens the cache for a new network tick, discarding the updates cached during the previous one.
+        void BeginTick();
+
+        //! Closes the cache and records its hit rates for this tick.
+        //! @param stats the multiplayer stats to record the hit rates to
+        void EndTick(MultiplayerStats& stats);
+
+        //! Returns true if the cache is open and updates can be shared, false if each connection should serialize on its own.
+        bool IsOpen() const;
+
+        //! Looks up an entity update serialized against the same replication record by another connection.
+        //! @param netEntityId   the entity being updated
+        //! @param remoteRole    the role of the entity on the receiving endpoint
+        //! @param buffer        buffer holding the serialized replication record, the cached update is written here on a hit
+        //! @param recordSize    size of the serialized replication record in bytes
+        //! @param capacity      capacity of the buffer in bytes
+        //! @return the size of the cached update in bytes, or 0 on a miss
+        uint32_t Find(NetEntityId netEntityId, NetEntityRole remoteRole, uint8_t* buffer, uint32_t recordSize, uint32_t capacity);
+
+        //! Stores an entity update for the other connections to reuse.
+        //! @param netEntityId   the entity being updated
+        //! @param remoteRole    the role of the entity on the receiving endpoint
+        //! @param update        the serialized update, which starts with the serialized replication record
+        //! @param recordSize    size of the serialized replication record in bytes
+        //! @param updateSize    size of the serialized update in bytes
+        void Store(NetEntityId netEntityId, NetEntityRole remoteRole, const uint8_t* update, uint32_t recordSize, uint32_t updateSize);
+
+    private:
+        struct CachedUpdate
+        {
+            NetEntityId m_netEntityId = InvalidNetEntityId;
+            NetEntityRole m_remoteRole = NetEntityRole::InvalidRole;
+            uint32_t m_recordSize = 0;
+            uint32_t m_updateSize = 0;
+            size_t m_offset = 0;
+        };
+
+        static size_t HashKey(NetEntityId netEntityId, NetEntityRole remoteRole, const uint8_t* record, uint32_t recordSize);
+        const CachedUpdate* FindCachedUpdate(size_t keyHash, NetEntityId netEntityId, NetEntityRole remoteRole, const uint8_t* record, uint32_t recordSize) const;
+
+        mutable AZStd::shared_mutex m_mutex;
+        AZStd::unordered_multimap<size_t, CachedUpdate> m_cachedUpdates;
+        //! Serialized updates of the current tick, stored back to back. Cleared but not shrunk between ticks.
+        AZStd::vector<uint8_t> m_updateData;
+
+        AZStd::atomic_bool m_isOpen{ false };
+        AZStd::atomic<uint64_t> m_hits{ 0 };
+        AZStd::atomic<uint64_t> m_misses{ 0 };
+        AZStd::atomic<uint64_t> m_reusedBytes{ 0 };
+    };
+}
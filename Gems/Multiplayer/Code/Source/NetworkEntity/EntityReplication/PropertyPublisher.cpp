@@ -7,9 +7,11 @@
  */
 
 #include <Source/NetworkEntity/EntityReplication/PropertyPublisher.h>
+#include <Source/NetworkEntity/EntityReplication/EntityUpdateSerializationCache.h>
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/ILogger.h>
+#include <AzCore/Interface/Interface.h>
 #include <Multiplayer/IMultiplayer.h>
 
 namespace Multiplayer
@@ -372,10 +374,42 @@ namespace Multiplayer
             updateMessage.SetPrefabEntityId(netBindComponent->GetPrefabEntityId());
         }
 
-        InputSerializer inputSerializer(
-            updateMessage.ModifyData().GetBuffer(), static_cast<uint32_t>(updateMessage.ModifyData().GetCapacity()));
+        AzNetworking::PacketEncodingBuffer& updateData = updateMessage.ModifyData();
+        const uint32_t updateCapacity = static_cast<uint32_t>(updateData.GetCapacity());
+
+        // The pending record describes the changes this connection hasn't acknowledged yet. Other connections with the same record
+        // produce the same bytes, so the serialized record is the key into the shared cache.
+        EntityUpdateSerializationCache* serializationCache = AZ::Interface<EntityUpdateSerializationCache>::Get();
+        if ((serializationCache != nullptr) && !serializationCache->IsOpen())
+        {
+            serializationCache = nullptr;
+        }
+
+        uint32_t recordSize = 0;
+        if (serializationCache != nullptr)
+        {
+            InputSerializer recordSerializer(updateData.GetBuffer(), updateCapacity);
+            m_pendingRecord.Serialize(recordSerializer);
+            recordSize = recordSerializer.GetSize();
+
+            const uint32_t cachedSize = serializationCache->Find(
+                netBindComponent->GetNetEntityId(), m_pendingRecord.GetRemoteNetworkRole(), updateData.GetBuffer(), recordSize, updateCapacity);
+            if (cachedSize > 0)
+            {
+                updateData.Resize(cachedSize);
+                return updateMessage;
+            }
+        }
+
+        InputSerializer inputSerializer(updateData.GetBuffer(), updateCapacity);
         SerializeEntityRecord(inputSerializer, netBindComponent);
-        updateMessage.ModifyData().Resize(inputSerializer.GetSize());
+        updateData.Resize(inputSerializer.GetSize());
+
+        if ((serializationCache != nullptr) && inputSerializer.IsValid())
+        {
+            serializationCache->Store(
+                netBindComponent->GetNetEntityId(), m_pendingRecord.GetRemoteNetworkRole(), updateData.GetBuffer(), recordSize, inputSerializer.GetSize());
+        }
 
         return updateMessage;
     }
@@ -111,54 +111,7 @@ namespace Multiplayer
 
         AZ::TransformInterface* transformInterface = m_controlledEntity.GetEntity()->GetTransform();
         const AZ::Vector3 controlledEntityPosition = transformInterface->GetWorldTranslation();
-
-        AZStd::vector<AzFramework::VisibilityEntry*> gatheredEntries;
-        AZ::Sphere awarenessSphere = AZ::Sphere(controlledEntityPosition, sv_ClientAwarenessRadius);
-        AzFramework::IVisibilitySystem* visibilitySystem = AZ::Interface<AzFramework::IVisibilitySystem>::Get();
-        if (visibilitySystem)
-        {
-            visibilitySystem->GetDefaultVisibilityScene()->Enumerate(
-                awarenessSphere,
-                [&gatheredEntries](const AzFramework::IVisibilityScene::NodeData& nodeData)
-                {
-                    gatheredEntries.reserve(gatheredEntries.size() + nodeData.m_entries.size());
-                    for (AzFramework::VisibilityEntry* visEntry : nodeData.m_entries)
-                    {
-                        if (visEntry->m_typeFlags & AzFramework::VisibilityEntry::TypeFlags::TYPE_Entity)
-                        {
-                            gatheredEntries.push_back(visEntry);
-                        }
-                    }
-                });
-        }
-
-        NetworkEntityTracker* networkEntityTracker = GetNetworkEntityTracker();        
-        IFilterEntityManager* filterEntityManager = AZ::Interface<IFilterEntityManager>::Get();
-
-        // Add all the neighbours
-        for (AzFramework::VisibilityEntry* visEntry : gatheredEntries)
-        {
-            AZ::Entity* entity = static_cast<AZ::Entity*>(visEntry->m_userData);
-            NetworkEntityHandle entityHandle(entity, networkEntityTracker);
-            if (entityHandle.GetNetBindComponent() == nullptr)
-            {
-                // Entity does not have netbinding, skip this entity
-                continue;
-            }
-
-            if (filterEntityManager && filterEntityManager->IsEntityFiltered(entity, m_controlledEntity, m_connection->GetConnectionId()))
-            {
-                continue;
-            }
-
-            // We want to find the closest extent to the player and prioritize using that distance
-            const AZ::Vector3 supportNormal = controlledEntityPosition - visEntry->m_boundingVolume.GetCenter();
-            const AZ::Vector3 closestPosition = visEntry->m_boundingVolume.GetSupport(supportNormal);
-            const float gatherDistanceSquared = controlledEntityPosition.GetDistanceSq(closestPosition);
-            const float priority = (gatherDistanceSquared > 0.0f) ? 1.0f / gatherDistanceSquared : 0.0f;
-                
-            AddEntityToReplicationSet(entityHandle, priority, gatherDistanceSquared);
-        }
+        GatherNeighbours(AZ::Sphere(controlledEntityPosition, sv_ClientAwarenessRadius));
 
         // Add in all entities that have forced relevancy
         const Multiplayer::NetEntityHandleSet& alwaysRelevantToClients = GetNetworkEntityManager()->GetAlwaysRelevantToClientsSet();
@@ -285,6 +238,58 @@ namespace Multiplayer
         }
     }
 
+    void ServerToClientReplicationWindow::GatherNeighbours(const AZ::Sphere& awarenessSphere)
+    {
+        const AZ::Vector3& controlledEntityPosition = awarenessSphere.GetCenter();
+
+        AZStd::vector<AzFramework::VisibilityEntry*> gatheredEntries;
+        AzFramework::IVisibilitySystem* visibilitySystem = AZ::Interface<AzFramework::IVisibilitySystem>::Get();
+        if (visibilitySystem)
+        {
+            visibilitySystem->GetDefaultVisibilityScene()->Enumerate(
+                awarenessSphere,
+                [&gatheredEntries](const AzFramework::IVisibilityScene::NodeData& nodeData)
+                {
+                    gatheredEntries.reserve(gatheredEntries.size() + nodeData.m_entries.size());
+                    for (AzFramework::VisibilityEntry* visEntry : nodeData.m_entries)
+                    {
+                        if (visEntry->m_typeFlags & AzFramework::VisibilityEntry::TypeFlags::TYPE_Entity)
+                        {
+                            gatheredEntries.push_back(visEntry);
+                        }
+                    }
+                });
+        }
+
+        NetworkEntityTracker* networkEntityTracker = GetNetworkEntityTracker();        
+        IFilterEntityManager* filterEntityManager = AZ::Interface<IFilterEntityManager>::Get();
+
+        // Add all the neighbours
+        for (AzFramework::VisibilityEntry* visEntry : gatheredEntries)
+        {
+            AZ::Entity* entity = static_cast<AZ::Entity*>(visEntry->m_userData);
+            NetworkEntityHandle entityHandle(entity, networkEntityTracker);
+            if (entityHandle.GetNetBindComponent() == nullptr)
+            {
+                // Entity does not have netbinding, skip this entity
+                continue;
+            }
+
+            if (filterEntityManager && filterEntityManager->IsEntityFiltered(entity, m_controlledEntity, m_connection->GetConnectionId()))
+            {
+                continue;
+            }
+
+            // We want to find the closest extent to the player and prioritize using that distance
+            const AZ::Vector3 supportNormal = controlledEntityPosition - visEntry->m_boundingVolume.GetCenter();
+            const AZ::Vector3 closestPosition = visEntry->m_boundingVolume.GetSupport(supportNormal);
+            const float gatherDistanceSquared = controlledEntityPosition.GetDistanceSq(closestPosition);
+            const float priority = (gatherDistanceSquared > 0.0f) ? 1.0f / gatherDistanceSquared : 0.0f;
+                
+            AddEntityToReplicationSet(entityHandle, priority, gatherDistanceSquared);
+        }
+    }
+
     void ServerToClientReplicationWindow::EvaluateConnection()
     {
         const uint32_t newPacketsSent = m_connection->GetMetrics().m_packetsSent;
@@ -14,6 +14,7 @@
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <AzCore/Component/EntityBus.h>
 #include <AzCore/EBus/ScheduledEvent.h>
+#include <AzCore/Math/Sphere.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 
@@ -56,12 +57,23 @@ namespace Multiplayer
         void DebugDraw() const override;
         //! @}
 
+    protected:
+
+        //! Adds the network entities within the awareness sphere of the controlled entity to the replication set.
+        //! The default implementation queries the default visibility scene.
+        //! @param awarenessSphere sphere centered on the controlled entity, sized by sv_ClientAwarenessRadius
+        virtual void GatherNeighbours(const AZ::Sphere& awarenessSphere);
+
+        void AddEntityToReplicationSet(ConstNetworkEntityHandle& entityHandle, float priority, float distanceSquared);
+
+        NetworkEntityHandle m_controlledEntity;
+        AzNetworking::IConnection* m_connection = nullptr;
+
     private:
 
         void UpdateHierarchyReplicationSet(ReplicationSet& replicationSet, NetworkHierarchyRootComponent& hierarchyComponent);
 
         void EvaluateConnection();
-        void AddEntityToReplicationSet(ConstNetworkEntityHandle& entityHandle, float priority, float distanceSquared);
 
         ServerToClientReplicationWindow& operator=(const ServerToClientReplicationWindow&) = delete;
 
@@ -69,14 +81,11 @@ namespace Multiplayer
         ReplicationCandidateQueue m_candidateQueue;
         ReplicationSet m_replicationSet;
 
-        NetworkEntityHandle m_controlledEntity;
         AZ::TransformInterface* m_controlledEntityTransform = nullptr;
 
         AZ::EntityActivatedEvent::Handler m_entityActivatedEventHandler;
         AZ::EntityDeactivatedEvent::Handler m_entityDeactivatedEventHandler;
 
-        AzNetworking::IConnection* m_connection = nullptr;
-
         // Cached values to detect a poor network connection
         uint32_t m_lastCheckedSentPackets = 0;
         uint32_t m_lastCheckedLostPackets = 0;
@@ -0,0 +1,285 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/ReplicationWindows/SpatialInterestGrid.h>
+#include <Source/NetworkEntity/NetworkEntityTracker.h>
+#include <Multiplayer/IMultiplayer.h>
+#include <Multiplayer/Components/NetBindComponent.h>
+#include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/Component/Entity.h>
+#include <AzCore/std/math.h>
+#include <AzCore/std/parallel/lock.h>
+
+namespace Multiplayer
+{
+    namespace
+    {
+        // Cell coordinates are packed into 21 bits per axis
+        constexpr uint32_t CellCoordinateBits = 21;
+        constexpr uint64_t CellCoordinateMask = (uint64_t(1) << CellCoordinateBits) - 1;
+        constexpr int32_t MaxCellCoordinate = (1 << (CellCoordinateBits - 1)) - 1;
+        constexpr int32_t MinCellCoordinate = -MaxCellCoordinate;
+        constexpr float MinCellSize = 1.0f;
+
+        int32_t ToCellCoordinate(float position, float inverseCellSize)
+        {
+            const float cell = AZStd::floor(position * inverseCellSize);
+            return static_cast<int32_t>(AZStd::clamp(cell, static_cast<float>(MinCellCoordinate), static_cast<float>(MaxCellCoordinate)));
+        }
+
+        uint64_t PackCellKey(int32_t x, int32_t y, int32_t z)
+        {
+            return (static_cast<uint64_t>(x) & CellCoordinateMask)
+                | ((static_cast<uint64_t>(y) & CellCoordinateMask) << CellCoordinateBits)
+                | ((static_cast<uint64_t>(z) & CellCoordinateMask) << (CellCoordinateBits * 2));
+        }
+
+        int32_t UnpackCellCoordinate(uint64_t key, uint32_t axis)
+        {
+            const uint64_t bits = (key >> (CellCoordinateBits * axis)) & CellCoordinateMask;
+            // Sign extend the 21 bit coordinate
+            return static_cast<int32_t>(static_cast<int64_t>(bits << (64 - CellCoordinateBits)) >> (64 - CellCoordinateBits));
+        }
+
+        bool IsCellInRange(const int32_t (&cell)[3], const int32_t (&minCell)[3], const int32_t (&maxCell)[3])
+        {
+            return (cell[0] >= minCell[0]) && (cell[0] <= maxCell[0])
+                && (cell[1] >= minCell[1]) && (cell[1] <= maxCell[1])
+                && (cell[2] >= minCell[2]) && (cell[2] <= maxCell[2]);
+        }
+    }
+
+    SpatialInterestGrid::SpatialInterestGrid()
+        : m_entityActivatedEventHandler([this](AZ::Entity* entity) { OnEntityActivated(entity); })
+        , m_entityDeactivatedEventHandler([this](AZ::Entity* entity) { OnEntityDeactivated(entity); })
+    {
+        ;
+    }
+
+    SpatialInterestGrid::~SpatialInterestGrid()
+    {
+        Disable();
+    }
+
+    void SpatialInterestGrid::Enable(float cellSize)
+    {
+        if (m_enabled)
+        {
+            return;
+        }
+
+        m_cellSize = AZStd::max(cellSize, MinCellSize);
+        m_inverseCellSize = 1.0f / m_cellSize;
+        m_enabled = true;
+
+        if (AZ::ComponentApplicationRequests* componentApplication = AZ::Interface<AZ::ComponentApplicationRequests>::Get())
+        {
+            componentApplication->RegisterEntityActivatedEventHandler(m_entityActivatedEventHandler);
+            componentApplication->RegisterEntityDeactivatedEventHandler(m_entityDeactivatedEventHandler);
+        }
+
+        if (NetworkEntityTracker* networkEntityTracker = GetNetworkEntityTracker())
+        {
+            for (const auto& [netEntityId, entity] : *networkEntityTracker)
+            {
+                if ((entity != nullptr) && (entity->GetState() == AZ::Entity::State::Active))
+                {
+                    OnEntityActivated(entity);
+                }
+            }
+        }
+    }
+
+    void SpatialInterestGrid::Disable()
+    {
+        m_entityActivatedEventHandler.Disconnect();
+        m_entityDeactivatedEventHandler.Disconnect();
+
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
+        m_trackedEntities.clear();
+        m_cells.clear();
+        m_enabled = false;
+    }
+
+    bool SpatialInterestGrid::IsEnabled() const
+    {
+        return m_enabled;
+    }
+
+    void SpatialInterestGrid::AddEntity(AZ::Entity* entity)
+    {
+        AZ::TransformInterface* transformInterface = entity->GetTransform();
+        if (transformInterface == nullptr)
+        {
+            return;
+        }
+
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
+        TrackedEntity& trackedEntity = m_trackedEntities[entity];
+        if (trackedEntity.m_transformChangedHandler.IsConnected())
+        {
+            return;
+        }
+
+        trackedEntity.m_transformChangedHandler = AZ::TransformChangedEvent::Handler(
+            [this, entity]([[maybe_unused]] const AZ::Transform& localTm, const AZ::Transform& worldTm)
+            {
+                SetEntityPosition(entity, worldTm.GetTranslation());
+            });
+        transformInterface->BindTransformChangedEventHandler(trackedEntity.m_transformChangedHandler);
+        InsertIntoCell(entity, transformInterface->GetWorldTranslation(), trackedEntity);
+    }
+
+    void SpatialInterestGrid::RemoveEntity(AZ::Entity* entity)
+    {
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
+        auto trackedIter = m_trackedEntities.find(entity);
+        if (trackedIter != m_trackedEntities.end())
+        {
+            RemoveFromCell(trackedIter->second);
+            m_trackedEntities.erase(trackedIter);
+        }
+    }
+
+    void SpatialInterestGrid::SetEntityPosition(AZ::Entity* entity, const AZ::Vector3& position)
+    {
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
+        TrackedEntity& trackedEntity = m_trackedEntities[entity];
+        if (trackedEntity.m_inCell && (trackedEntity.m_cellKey == GetCellKey(position)))
+        {
+            // Still in the same cell, most transform changes end here
+            m_cells[trackedEntity.m_cellKey][trackedEntity.m_cellIndex].m_position = position;
+            return;
+        }
+
+        RemoveFromCell(trackedEntity);
+        InsertIntoCell(entity, position, trackedEntity);
+    }
+
+    void SpatialInterestGrid::Enumerate(const AZ::Sphere& sphere, const CellCallback& callback) const
+    {
+        const AZ::Vector3& center = sphere.GetCenter();
+        const float radius = sphere.GetRadius();
+        const int32_t minCell[3] =
+        {
+            ToCellCoordinate(center.GetX() - radius, m_inverseCellSize),
+            ToCellCoordinate(center.GetY() - radius, m_inverseCellSize),
+            ToCellCoordinate(center.GetZ() - radius, m_inverseCellSize)
+        };
+        const int32_t maxCell[3] =
+        {
+            ToCellCoordinate(center.GetX() + radius, m_inverseCellSize),
+            ToCellCoordinate(center.GetY() + radius, m_inverseCellSize),
+            ToCellCoordinate(center.GetZ() + radius, m_inverseCellSize)
+        };
+        const uint64_t rangeCellCount = static_cast<uint64_t>(maxCell[0] - minCell[0] + 1)
+            * static_cast<uint64_t>(maxCell[1] - minCell[1] + 1)
+            * static_cast<uint64_t>(maxCell[2] - minCell[2] + 1);
+
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_mutex);
+        if (rangeCellCount > m_cells.size())
+        {
+            // Sparse grid, visiting the occupied cells is cheaper than looking up every cell in range
+            for (const auto& [cellKey, cellEntries] : m_cells)
+            {
+                const int32_t cell[3] = { UnpackCellCoordinate(cellKey, 0), UnpackCellCoordinate(cellKey, 1), UnpackCellCoordinate(cellKey, 2) };
+                if (IsCellInRange(cell, minCell, maxCell))
+                {
+                    callback(cellEntries);
+                }
+            }
+            return;
+        }
+
+        for (int32_t z = minCell[2]; z <= maxCell[2]; ++z)
+        {
+            for (int32_t y = minCell[1]; y <= maxCell[1]; ++y)
+            {
+                for (int32_t x = minCell[0]; x <= maxCell[0]; ++x)
+                {
+                    auto cellIter = m_cells.find(PackCellKey(x, y, z));
+                    if (cellIter != m_cells.end())
+                    {
+                        callback(cellIter->second);
+                    }
+                }
+            }
+        }
+    }
+
+    uint32_t SpatialInterestGrid::GetEntityCount() const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_mutex);
+        return static_cast<uint32_t>(m_trackedEntities.size());
+    }
+
+    uint32_t SpatialInterestGrid::GetCellCount() const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_mutex);
+        return static_cast<uint32_t>(m_cells.size());
+    }
+
+    SpatialInterestGrid::CellKey SpatialInterestGrid::GetCellKey(const AZ::Vector3& position) const
+    {
+        return PackCellKey
+        (
+            ToCellCoordinate(position.GetX(), m_inverseCellSize),
+            ToCellCoordinate(position.GetY(), m_inverseCellSize),
+            ToCellCoordinate(position.GetZ(), m_inverseCellSize)
+        );
+    }
+
+    void SpatialInterestGrid::InsertIntoCell(AZ::Entity* entity, const AZ::Vector3& position, TrackedEntity& trackedEntity)
+    {
+        CellEntries& cellEntries = m_cells[GetCellKey(position)];
+        trackedEntity.m_cellKey = GetCellKey(position);
+        trackedEntity.m_cellIndex = static_cast<uint32_t>(cellEntries.size());
+        trackedEntity.m_inCell = true;
+        cellEntries.push_back({ entity, position });
+    }
+
+    void SpatialInterestGrid::RemoveFromCell(const TrackedEntity& trackedEntity)
+    {
+        if (!trackedEntity.m_inCell)
+        {
+            return;
+        }
+
+        auto cellIter = m_cells.find(trackedEntity.m_cellKey);
+        AZ_Assert(cellIter != m_cells.end(), "Tracked entity refers to a missing grid cell");
+        CellEntries& cellEntries = cellIter->second;
+
+        // Swap the last entry of the cell into the removed slot
+        const uint32_t lastIndex = static_cast<uint32_t>(cellEntries.size() - 1);
+        if (trackedEntity.m_cellIndex != lastIndex)
+        {
+            cellEntries[trackedEntity.m_cellIndex] = cellEntries[lastIndex];
+            m_trackedEntities[cellEntries[trackedEntity.m_cellIndex].m_entity].m_cellIndex = trackedEntity.m_cellIndex;
+        }
+        cellEntries.pop_back();
+
+        if (cellEntries.empty())
+        {
+            m_cells.erase(cellIter);
+        }
+    }
+
+    void SpatialInterestGrid::OnEntityActivated(AZ::Entity* entity)
+    {
+        ConstNetworkEntityHandle entityHandle(entity);
+        if (entityHandle.GetNetBindComponent() != nullptr)
+        {
+            AddEntity(entity);
+        }
+    }
+
+    void SpatialInterestGrid::OnEntityDeactivated(AZ::Entity* entity)
+    {
+        RemoveEntity(entity);
+    }
+}
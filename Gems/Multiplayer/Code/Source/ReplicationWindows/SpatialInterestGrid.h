@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/EntityBus.h>
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/Math/Sphere.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/RTTI/TypeInfoSimple.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/function/function_fwd.h>
+#include <AzCore/std/parallel/shared_mutex.h>
+
+namespace Multiplayer
+{
+    //! @class SpatialInterestGrid
+    //! @brief A hashed uniform grid of the network entities on a server, shared by all the connections' replication windows.
+    //! Entities are bucketed by world position and move between cells as their transforms change, so building a connection's
+    //! relevancy set only visits the cells overlapping its awareness sphere instead of running a visibility scene query.
+    //! Updates happen as transforms change, enumeration may run concurrently from several connections.
+    class SpatialInterestGrid
+    {
+    public:
+        AZ_TYPE_INFO(SpatialInterestGrid, "{27F5E123-77D6-4C01-92D8-CDC7B78F5A12}");
+
+        struct Entry
+        {
+            AZ::Entity* m_entity = nullptr;
+            AZ::Vector3 m_position = AZ::Vector3::CreateZero();
+        };
+        using CellEntries = AZStd::vector<Entry>;
+        using CellCallback = AZStd::function<void(const CellEntries&)>;
+
+        SpatialInterestGrid();
+        ~SpatialInterestGrid();
+
+        //! Starts tracking network entities, seeding the grid with the network entities that are already active.
+        //! @param cellSize edge length of a grid cell in meters
+        void Enable(float cellSize);
+
+        //! Stops tracking network entities and empties the grid.
+        void Disable();
+
+        //! Returns true if the grid is tracking network entities.
+        bool IsEnabled() const;
+
+        //! Starts tracking an entity's transform. Ignored for entities without a transform.
+        //! @param entity the entity to track
+        void AddEntity(AZ::Entity* entity);
+
+        //! Stops tracking an entity.
+        //! @param entity the entity to stop tracking
+        void RemoveEntity(AZ::Entity* entity);
+
+        //! Inserts an entity at the provided position, or moves it there if it's already in the grid.
+        //! @param entity   the entity to place
+        //! @param position world position of the entity
+        void SetEntityPosition(AZ::Entity* entity, const AZ::Vector3& position);
+
+        //! Invokes the callback once for each non-empty cell overlapping the sphere.
+        //! Entries of a cell may lie outside the sphere, callers are expected to test the entry positions.
+        //! @param sphere   the sphere to enumerate
+        //! @param callback the callback to invoke with the entries of each cell
+        void Enumerate(const AZ::Sphere& sphere, const CellCallback& callback) const;
+
+        //! Returns the number of entities in the grid.
+        uint32_t GetEntityCount() const;
+
+        //! Returns the number of non-empty cells in the grid.
+        uint32_t GetCellCount() const;
+
+    private:
+
+        using CellKey = uint64_t;
+
+        struct TrackedEntity
+        {
+            CellKey m_cellKey = 0;
+            uint32_t m_cellIndex = 0;
+            bool m_inCell = false;
+            AZ::TransformChangedEvent::Handler m_transformChangedHandler;
+        };
+
+        CellKey GetCellKey(const AZ::Vector3& position) const;
+        void InsertIntoCell(AZ::Entity* entity, const AZ::Vector3& position, TrackedEntity& trackedEntity);
+        void RemoveFromCell(const TrackedEntity& trackedEntity);
+
+        void OnEntityActivated(AZ::Entity* entity);
+        void OnEntityDeactivated(AZ::Entity* entity);
+
+        AZ::EntityActivatedEvent::Handler m_entityActivatedEventHandler;
+        AZ::EntityDeactivatedEvent::Handler m_entityDeactivatedEventHandler;
+
+        mutable AZStd::shared_mutex m_mutex;
+        AZStd::unordered_map<CellKey, CellEntries> m_cells;
+        AZStd::unordered_map<AZ::Entity*, TrackedEntity> m_trackedEntities;
+        float m_cellSize = 1.0f;
+        float m_inverseCellSize = 1.0f;
+        bool m_enabled = false;
+    };
+}
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/ReplicationWindows/SpatialInterestReplicationWindow.h>
+#include <Source/ReplicationWindows/SpatialInterestGrid.h>
+#include <Multiplayer/Components/NetBindComponent.h>
+#include <Multiplayer/NetworkEntity/IFilterEntityManager.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace Multiplayer
+{
+    SpatialInterestReplicationWindow::SpatialInterestReplicationWindow
+    (
+        NetworkEntityHandle controlledEntity,
+        AzNetworking::IConnection* connection,
+        const SpatialInterestGrid& interestGrid
+    )
+        : ServerToClientReplicationWindow(controlledEntity, connection)
+        , m_interestGrid(interestGrid)
+    {
+        ;
+    }
+
+    void SpatialInterestReplicationWindow::GatherNeighbours(const AZ::Sphere& awarenessSphere)
+    {
+        const AZ::Vector3& controlledEntityPosition = awarenessSphere.GetCenter();
+        const float awarenessRadiusSquared = awarenessSphere.GetRadius() * awarenessSphere.GetRadius();
+
+        // Gather under the grid's lock, but filter and prioritize after releasing it
+        AZStd::vector<SpatialInterestGrid::Entry> gatheredEntries;
+        m_interestGrid.Enumerate(
+            awarenessSphere,
+            [&gatheredEntries, &controlledEntityPosition, awarenessRadiusSquared](const SpatialInterestGrid::CellEntries& cellEntries)
+            {
+                for (const SpatialInterestGrid::Entry& entry : cellEntries)
+                {
+                    if (controlledEntityPosition.GetDistanceSq(entry.m_position) <= awarenessRadiusSquared)
+                    {
+                        gatheredEntries.push_back(entry);
+                    }
+                }
+            });
+
+        NetworkEntityTracker* networkEntityTracker = GetNetworkEntityTracker();
+        IFilterEntityManager* filterEntityManager = AZ::Interface<IFilterEntityManager>::Get();
+
+        // Add all the neighbours
+        for (const SpatialInterestGrid::Entry& entry : gatheredEntries)
+        {
+            NetworkEntityHandle entityHandle(entry.m_entity, networkEntityTracker);
+            if (entityHandle.GetNetBindComponent() == nullptr)
+            {
+                // Entity does not have netbinding, skip this entity
+                continue;
+            }
+
+            if (filterEntityManager && filterEntityManager->IsEntityFiltered(entry.m_entity, m_controlledEntity, m_connection->GetConnectionId()))
+            {
+                continue;
+            }
+
+            const float gatherDistanceSquared = controlledEntityPosition.GetDistanceSq(entry.m_position);
+            const float priority = (gatherDistanceSquared > 0.0f) ? 1.0f / gatherDistanceSquared : 0.0f;
+            AddEntityToReplicationSet(entityHandle, priority, gatherDistanceSquared);
+        }
+    }
+}
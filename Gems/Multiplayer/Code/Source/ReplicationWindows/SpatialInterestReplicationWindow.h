@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Source/ReplicationWindows/ServerToClientReplicationWindow.h>
+
+namespace Multiplayer
+{
+    class SpatialInterestGrid;
+
+    //! @class SpatialInterestReplicationWindow
+    //! @brief A server to client replication window that gathers its neighbours from the server's shared spatial interest grid.
+    //! Entities are prioritized by the distance to their position rather than to their visibility bounds.
+    class SpatialInterestReplicationWindow
+        : public ServerToClientReplicationWindow
+    {
+    public:
+
+        SpatialInterestReplicationWindow(NetworkEntityHandle controlledEntity, AzNetworking::IConnection* connection, const SpatialInterestGrid& interestGrid);
+
+    protected:
+
+        //! ServerToClientReplicationWindow overrides
+        //! @{
+        void GatherNeighbours(const AZ::Sphere& awarenessSphere) override;
+        //! @}
+
+    private:
+
+        SpatialInterestReplicationWindow& operator=(const SpatialInterestReplicationWindow&) = delete;
+
+        const SpatialInterestGrid& m_interestGrid;
+    };
+}
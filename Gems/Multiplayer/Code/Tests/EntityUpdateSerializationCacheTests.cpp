@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Multiplayer/MultiplayerStats.h>
+#include <Source/NetworkEntity/EntityReplication/EntityUpdateSerializationCache.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/containers/array.h>
+
+namespace UnitTest
+{
+    using namespace Multiplayer;
+
+    class EntityUpdateSerializationCacheTests
+        : public LeakDetectionFixture
+    {
+    public:
+        static constexpr uint32_t RecordSize = 4;
+        static constexpr uint32_t UpdateSize = 16;
+        using UpdateBuffer = AZStd::array<uint8_t, 64>;
+
+        static UpdateBuffer MakeUpdate(uint8_t recordValue, uint8_t propertyValue)
+        {
+            UpdateBuffer update;
+            update.fill(propertyValue);
+            AZStd::fill_n(update.data(), RecordSize, recordValue);
+            return update;
+        }
+
+        EntityUpdateSerializationCache m_cache;
+        MultiplayerStats m_stats;
+    };
+
+    TEST_F(EntityUpdateSerializationCacheTests, FindAfterStore_SameRecord_CopiesStoredUpdate)
+    {
+        m_cache.BeginTick();
+        const UpdateBuffer stored = MakeUpdate(0x01, 0xab);
+        m_cache.Store(NetEntityId{ 7 }, NetEntityRole::Client, stored.data(), RecordSize, UpdateSize);
+
+        UpdateBuffer buffer = MakeUpdate(0x01, 0x00);
+        EXPECT_EQ(UpdateSize, m_cache.Find(NetEntityId{ 7 }, NetEntityRole::Client, buffer.data(), RecordSize, static_cast<uint32_t>(buffer.size())));
+        EXPECT_EQ(0, memcmp(stored.data(), buffer.data(), UpdateSize));
+        m_cache.EndTick(m_stats);
+
+        EXPECT_EQ(1u, m_stats.m_entityUpdateCacheHits);
+        EXPECT_EQ(0u, m_stats.m_entityUpdateCacheMisses);
+        EXPECT_EQ(UpdateSize, m_stats.m_entityUpdateCacheReusedBytes);
+    }
+
+    TEST_F(EntityUpdateSerializationCacheTests, Find_DifferentRecordEntityOrRole_Misses)
+    {
+        m_cache.BeginTick();
+        const UpdateBuffer stored = MakeUpdate(0x01, 0xab);
+        m_cache.Store(NetEntityId{ 7 }, NetEntityRole::Client, stored.data(), RecordSize, UpdateSize);
+
+        UpdateBuffer otherRecord = MakeUpdate(0x02, 0x00);
+        EXPECT_EQ(0u, m_cache.Find(NetEntityId{ 7 }, NetEntityRole::Client, otherRecord.data(), RecordSize, static_cast<uint32_t>(otherRecord.size())));
+        UpdateBuffer buffer = MakeUpdate(0x01, 0x00);
+        EXPECT_EQ(0u, m_cache.Find(NetEntityId{ 8 }, NetEntityRole::Client, buffer.data(), RecordSize, static_cast<uint32_t>(buffer.size())));
+        EXPECT_EQ(0u, m_cache.Find(NetEntityId{ 7 }, NetEntityRole::Autonomous, buffer.data(), RecordSize, static_cast<uint32_t>(buffer.size())));
+        m_cache.EndTick(m_stats);
+
+        EXPECT_EQ(0u, m_stats.m_entityUpdateCacheHits);
+        EXPECT_EQ(3u, m_stats.m_entityUpdateCacheMisses);
+    }
+
+    TEST_F(EntityUpdateSerializationCacheTests, BeginTick_AfterPreviousTick_DiscardsCachedUpdates)
+    {
+        m_cache.BeginTick();
+        const UpdateBuffer stored = MakeUpdate(0x01, 0xab);
+        m_cache.Store(NetEntityId{ 7 }, NetEntityRole::Client, stored.data(), RecordSize, UpdateSize);
+        m_cache.EndTick(m_stats);
+        EXPECT_FALSE(m_cache.IsOpen());
+
+        m_cache.BeginTick();
+        EXPECT_TRUE(m_cache.IsOpen());
+        UpdateBuffer buffer = MakeUpdate(0x01, 0x00);
+        EXPECT_EQ(0u, m_cache.Find(NetEntityId{ 7 }, NetEntityRole::Client, buffer.data(), RecordSize, static_cast<uint32_t>(buffer.size())));
+        m_cache.EndTick(m_stats);
+
+        EXPECT_EQ(1u, m_stats.m_entityUpdateCacheMisses);
+        EXPECT_FLOAT_EQ(0.0f, m_stats.CalculateEntityUpdateCacheHitRate());
+    }
+}
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/ReplicationWindows/SpatialInterestGrid.h>
+#include <AzCore/Component/Entity.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace UnitTest
+{
+    using namespace Multiplayer;
+
+    class SpatialInterestGridTests
+        : public LeakDetectionFixture
+    {
+    public:
+        static constexpr float CellSize = 10.0f;
+
+        void SetUp() override
+        {
+            LeakDetectionFixture::SetUp();
+            m_grid = AZStd::make_unique<SpatialInterestGrid>();
+            m_grid->Enable(CellSize);
+        }
+
+        void TearDown() override
+        {
+            m_grid.reset();
+            LeakDetectionFixture::TearDown();
+        }
+
+        AZStd::vector<AZ::Entity*> Gather(const AZ::Sphere& sphere) const
+        {
+            AZStd::vector<AZ::Entity*> entities;
+            m_grid->Enumerate(sphere, [&entities](const SpatialInterestGrid::CellEntries& cellEntries)
+            {
+                for (const SpatialInterestGrid::Entry& entry : cellEntries)
+                {
+                    entities.push_back(entry.m_entity);
+                }
+            });
+            return entities;
+        }
+
+        AZStd::unique_ptr<SpatialInterestGrid> m_grid;
+    };
+
+    TEST_F(SpatialInterestGridTests, Enumerate_ReturnsOnlyEntitiesInOverlappingCells)
+    {
+        AZ::Entity nearEntity;
+        AZ::Entity farEntity;
+        m_grid->SetEntityPosition(&nearEntity, AZ::Vector3(1.0f, 1.0f, 1.0f));
+        m_grid->SetEntityPosition(&farEntity, AZ::Vector3(100.0f, 100.0f, 1.0f));
+        EXPECT_EQ(2u, m_grid->GetEntityCount());
+        EXPECT_EQ(2u, m_grid->GetCellCount());
+
+        // A sphere within a single cell looks the cell up directly
+        const AZStd::vector<AZ::Entity*> gathered = Gather(AZ::Sphere(AZ::Vector3(5.0f, 5.0f, 5.0f), 4.0f));
+        ASSERT_EQ(1u, gathered.size());
+        EXPECT_EQ(&nearEntity, gathered[0]);
+
+        // A sphere spanning more cells than are occupied walks the occupied cells instead
+        EXPECT_EQ(1u, Gather(AZ::Sphere(AZ::Vector3::CreateZero(), 50.0f)).size());
+        EXPECT_EQ(2u, Gather(AZ::Sphere(AZ::Vector3::CreateZero(), 1000.0f)).size());
+    }
+
+    TEST_F(SpatialInterestGridTests, SetEntityPosition_AcrossCells_MovesEntity)
+    {
+        AZ::Entity movingEntity;
+        AZ::Entity otherEntity;
+        m_grid->SetEntityPosition(&movingEntity, AZ::Vector3(1.0f, 1.0f, 1.0f));
+        m_grid->SetEntityPosition(&otherEntity, AZ::Vector3(2.0f, 2.0f, 2.0f));
+        EXPECT_EQ(1u, m_grid->GetCellCount());
+
+        m_grid->SetEntityPosition(&movingEntity, AZ::Vector3(-55.0f, 1.0f, 1.0f));
+        EXPECT_EQ(2u, m_grid->GetCellCount());
+        EXPECT_EQ(2u, m_grid->GetEntityCount());
+
+        const AZStd::vector<AZ::Entity*> gatheredOrigin = Gather(AZ::Sphere(AZ::Vector3(2.0f, 2.0f, 2.0f), 1.0f));
+        ASSERT_EQ(1u, gatheredOrigin.size());
+        EXPECT_EQ(&otherEntity, gatheredOrigin[0]);
+
+        const AZStd::vector<AZ::Entity*> gatheredNegative = Gather(AZ::Sphere(AZ::Vector3(-55.0f, 1.0f, 1.0f), 1.0f));
+        ASSERT_EQ(1u, gatheredNegative.size());
+        EXPECT_EQ(&movingEntity, gatheredNegative[0]);
+    }
+
+    TEST_F(SpatialInterestGridTests, RemoveEntity_EmptiesCells)
+    {
+        AZ::Entity firstEntity;
+        AZ::Entity secondEntity;
+        m_grid->SetEntityPosition(&firstEntity, AZ::Vector3(1.0f, 1.0f, 1.0f));
+        m_grid->SetEntityPosition(&secondEntity, AZ::Vector3(2.0f, 2.0f, 2.0f));
+
+        m_grid->RemoveEntity(&firstEntity);
+        const AZStd::vector<AZ::Entity*> gathered = Gather(AZ::Sphere(AZ::Vector3::CreateZero(), 5.0f));
+        ASSERT_EQ(1u, gathered.size());
+        EXPECT_EQ(&secondEntity, gathered[0]);
+
+        m_grid->RemoveEntity(&secondEntity);
+        EXPECT_EQ(0u, m_grid->GetEntityCount());
+        EXPECT_EQ(0u, m_grid->GetCellCount());
+
+        m_grid->Disable();
+        EXPECT_FALSE(m_grid->IsEnabled());
+    }
+}
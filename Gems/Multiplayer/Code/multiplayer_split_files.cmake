@@ -58,6 +58,8 @@ set(FILES
     Source/NetworkEntity/NetworkSpawnableLibrary.h
     Source/NetworkEntity/EntityReplication/EntityReplicationManager.cpp
     Source/NetworkEntity/EntityReplication/EntityReplicator.cpp
+    Source/NetworkEntity/EntityReplication/EntityUpdateSerializationCache.cpp
+    Source/NetworkEntity/EntityReplication/EntityUpdateSerializationCache.h
     Source/NetworkEntity/EntityReplication/PropertyPublisher.cpp
     Source/NetworkEntity/EntityReplication/PropertyPublisher.h
     Source/NetworkEntity/EntityReplication/PropertySubscriber.cpp
@@ -68,4 +70,8 @@ set(FILES
     Source/ReplicationWindows/NullReplicationWindow.h
     Source/ReplicationWindows/ServerToClientReplicationWindow.cpp
     Source/ReplicationWindows/ServerToClientReplicationWindow.h
+    Source/ReplicationWindows/SpatialInterestGrid.cpp
+    Source/ReplicationWindows/SpatialInterestGrid.h
+    Source/ReplicationWindows/SpatialInterestReplicationWindow.cpp
+    Source/ReplicationWindows/SpatialInterestReplicationWindow.h
 )
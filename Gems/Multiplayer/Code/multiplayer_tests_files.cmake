@@ -14,6 +14,7 @@ set(FILES
     Include/Multiplayer/AutoGen/AutoComponent_Source.jinja
     Tests/AutoGen/TestMultiplayerComponent.AutoComponent.xml
     Tests/ClientHierarchyTests.cpp
+    Tests/EntityUpdateSerializationCacheTests.cpp
     Tests/ServerHierarchyBenchmarks.cpp
     Tests/CommonHierarchySetup.h
     Tests/CommonNetworkEntitySetup.h
@@ -34,6 +35,7 @@ set(FILES
     Tests/RewindableObjectTests.cpp
     Tests/ServerHierarchyTests.cpp
     Tests/SimplePlayerSpawnerTests.cpp
+    Tests/SpatialInterestGridTests.cpp
     Tests/TestMultiplayerComponent.h
     Tests/TestMultiplayerComponent.cpp
 
@@ -11,6 +11,7 @@
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Statistics/StatisticalProfilerProxy.h>
+#include <AzCore/std/parallel/scoped_lock.h>
 #include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzCore/std/time.h>
 
@@ -80,6 +81,12 @@ namespace Profiler
 
         m_enabled = false;
 
+        if (m_streamingCaptureInProgress.load())
+        {
+            m_streamingCaptureInProgress.store(false);
+            m_traceStreamer.Stop();
+        }
+
         // Cleanup all TLS
         m_registeredThreads.clear();
         m_timeRegionMap.clear();
@@ -117,7 +124,7 @@ namespace Profiler
             // guard against enabling mid-marker
             if (m_enabled && ms_threadLocalStorage != nullptr)
             {
-                ms_threadLocalStorage->RegionStackPopBack();
+                ms_threadLocalStorage->RegionStackPopBack(m_streamingCaptureInProgress.load() ? &m_traceStreamer : nullptr);
             }
 
             m_shutdownMutex.unlock_shared();
@@ -151,6 +158,12 @@ namespace Profiler
             return false;
         }
 
+        if (m_streamingCaptureInProgress.load())
+        {
+            AZ_TracePrintf("Profiler", "Attempting to end a streaming capture as a continuous capture, use EndStreamingCapture\n");
+            return false;
+        }
+
         if (m_continuousCaptureEndingMutex.try_lock())
         {
             m_enabled = false;
@@ -166,6 +179,42 @@ namespace Profiler
         return false;
     }
 
+    bool CpuProfiler::BeginStreamingCapture(const AZStd::string& outputFilePath)
+    {
+        bool expected = false;
+        if (!m_continuousCaptureInProgress.compare_exchange_strong(expected, true))
+        {
+            AZ_TracePrintf("Profiler", "Attempting to start a streaming capture while a continuous capture is already in progress\n");
+            return false;
+        }
+
+        if (!m_traceStreamer.Start(outputFilePath))
+        {
+            m_continuousCaptureInProgress.store(false);
+            return false;
+        }
+
+        m_streamingCaptureInProgress.store(true);
+        m_enabled = true;
+        return true;
+    }
+
+    bool CpuProfiler::EndStreamingCapture()
+    {
+        if (!m_streamingCaptureInProgress.load())
+        {
+            AZ_TracePrintf("Profiler", "Attempting to end a streaming capture while one not in progress\n");
+            return false;
+        }
+
+        AZStd::scoped_lock lock(m_continuousCaptureEndingMutex);
+        m_enabled = false;
+        m_streamingCaptureInProgress.store(false);
+        const bool result = m_traceStreamer.Stop();
+        m_continuousCaptureInProgress.store(false);
+        return result;
+    }
+
     bool CpuProfiler::IsContinuousCaptureInProgress() const
     {
         return m_continuousCaptureInProgress.load();
@@ -210,7 +259,8 @@ namespace Profiler
             return;
         }
 
-        if (m_continuousCaptureInProgress.load() && m_continuousCaptureEndingMutex.try_lock())
+        // Streaming captures write the data of each thread directly to disk, only in memory captures save the frames
+        if (m_continuousCaptureInProgress.load() && !m_streamingCaptureInProgress.load() && m_continuousCaptureEndingMutex.try_lock())
         {
             if (m_continuousCaptureData.full() && m_continuousCaptureData.size() != MaxFramesToSave)
             {
@@ -290,7 +340,7 @@ namespace Profiler
         m_timeRegionStack.back().m_startTick = AZStd::GetTimeNowTicks();
     }
 
-    void CpuTimingLocalStorage::RegionStackPopBack()
+    void CpuTimingLocalStorage::RegionStackPopBack(CpuTraceStreamer* traceStreamer)
     {
         // Early out when the stack is empty, this might happen when the profiler was enabled while the thread encountered profiling markers
         if (m_timeRegionStack.empty())
@@ -311,10 +361,46 @@ namespace Profiler
         // Decrement the stack
         m_stackLevel--;
 
+        if (traceStreamer)
+        {
+            RecordTraceEvent(*traceStreamer, back);
+        }
+
         // Add an entry to the cached region
         AddCachedRegion(back);
     }
 
+    void CpuTimingLocalStorage::RecordTraceEvent(CpuTraceStreamer& traceStreamer, const CachedTimeRegion& timeRegion)
+    {
+        if (!m_traceBuffer)
+        {
+            m_traceBuffer = traceStreamer.CreateThreadBuffer(m_executingThreadId);
+        }
+
+        // Name ids are reset for every capture
+        const uint32_t captureGeneration = traceStreamer.GetCaptureGeneration();
+        if (m_traceNameGeneration != captureGeneration)
+        {
+            m_traceNameIds.clear();
+            m_traceNameGeneration = captureGeneration;
+        }
+
+        // Only the first use of a name on each thread needs to lock to intern it
+        auto [nameIt, nameAdded] = m_traceNameIds.try_emplace(timeRegion.m_groupRegionName, 0u);
+        if (nameAdded)
+        {
+            nameIt->second = traceStreamer.InternName(
+                timeRegion.m_groupRegionName.m_groupName, timeRegion.m_groupRegionName.m_regionName.GetStringView());
+        }
+
+        TraceEvent traceEvent;
+        traceEvent.m_startTick = timeRegion.m_startTick;
+        traceEvent.m_endTick = timeRegion.m_endTick;
+        traceEvent.m_nameId = nameIt->second;
+        traceEvent.m_stackDepth = timeRegion.m_stackDepth;
+        m_traceBuffer->TryPush(traceEvent);
+    }
+
     // Gets called when region ends and all data is set
     void CpuTimingLocalStorage::AddCachedRegion(const CachedTimeRegion& timeRegionCached)
     {
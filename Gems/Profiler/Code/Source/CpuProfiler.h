@@ -8,6 +8,8 @@
 
 #pragma once
 
+#include <CpuTraceStreamer.h>
+
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/Debug/Profiler.h>
 #include <AzCore/Memory/SystemAllocator.h>
@@ -78,8 +80,12 @@ namespace Profiler
         // Adds a region to the stack, gets called each time a region begins
         void RegionStackPushBack(CachedTimeRegion& timeRegion);
 
-        // Pops a region from the stack, gets called each time a region ends
-        void RegionStackPopBack();
+        // Pops a region from the stack, gets called each time a region ends.
+        // If a streaming capture is in progress, the region is also recorded to the thread's trace buffer.
+        void RegionStackPopBack(CpuTraceStreamer* traceStreamer);
+
+        // Records a completed region to the thread's trace buffer
+        void RecordTraceEvent(CpuTraceStreamer& traceStreamer, const CachedTimeRegion& timeRegion);
 
         // Add a new cached time region. If the stack is empty, flush all entries to the cached map
         void AddCachedRegion(const CachedTimeRegion& timeRegionCached);
@@ -118,6 +124,13 @@ namespace Profiler
 
         // Keeps track of the first time cached data limit was reached.
         bool m_cachedDataLimitReached = false;
+
+        // Buffer of completed regions for streaming captures, created when the thread records its first region during one
+        AZStd::intrusive_ptr<TraceEventRingBuffer> m_traceBuffer;
+
+        // Ids of the names interned with the CpuTraceStreamer, only valid for m_traceNameGeneration
+        AZStd::unordered_map<CachedTimeRegion::GroupRegionName, uint32_t, CachedTimeRegion::GroupRegionName::Hash> m_traceNameIds;
+        uint32_t m_traceNameGeneration = 0;
     };
 
     //! CpuProfiler will keep track of the registered threads, and
@@ -151,6 +164,11 @@ namespace Profiler
         bool BeginContinuousCapture();
         bool EndContinuousCapture(AZStd::ring_buffer<TimeRegionMap>& flushTarget);
 
+        //! Starting/ending a continuous capture that streams the profiling data to outputFilePath while it's captured,
+        //! instead of keeping it in memory until the capture ends. \see CpuTraceStreamer
+        bool BeginStreamingCapture(const AZStd::string& outputFilePath);
+        bool EndStreamingCapture();
+
         //! Check to see if a programmatic capture is currently in progress, implies
         //! that the profiler is active if returns True.
         bool IsContinuousCaptureInProgress() const;
@@ -197,6 +215,10 @@ namespace Profiler
         // Stores multiple frames of profiling data, size is controlled by MaxFramesToSave. Flushed when EndContinuousCapture is called.
         // Ring buffer so that we can have fast append of new data + removal of old profiling data with good cache locality.
         AZStd::ring_buffer<TimeRegionMap> m_continuousCaptureData;
+
+        // Writes the profiling data to disk during streaming captures
+        CpuTraceStreamer m_traceStreamer;
+        AZStd::atomic_bool m_streamingCaptureInProgress = false;
     };
 
     // Intermediate class to serialize Cpu TimedRegion data.
@@ -0,0 +1,469 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <CpuTraceStreamer.h>
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Platform.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/parallel/scoped_lock.h>
+
+namespace Profiler
+{
+    AZ_CVAR(uint32_t, profiler_traceBufferEventCount, 64 * 1024, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Number of events each thread can buffer during a streaming capture before new events are dropped. Applies to buffers created after it's changed.");
+    AZ_CVAR(uint32_t, profiler_traceFlushIntervalMs, 100, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Interval in milliseconds at which the buffered events of a streaming capture are written to disk");
+
+    namespace
+    {
+        // Field numbers and enum values of the Perfetto trace protos (protos/perfetto/trace) that are written.
+        namespace PerfettoProto
+        {
+            constexpr uint32_t TracePacket = 1; // Trace.packet
+
+            constexpr uint32_t PacketTimestamp = 8;
+            constexpr uint32_t PacketTrustedSequenceId = 10;
+            constexpr uint32_t PacketTrackEvent = 11;
+            constexpr uint32_t PacketInternedData = 12;
+            constexpr uint32_t PacketSequenceFlags = 13;
+            constexpr uint32_t PacketTrackDescriptor = 60;
+
+            constexpr uint32_t TrackEventCategoryIids = 3;
+            constexpr uint32_t TrackEventType = 9;
+            constexpr uint32_t TrackEventNameIid = 10;
+            constexpr uint32_t TrackEventTrackUuid = 11;
+
+            constexpr uint32_t InternedEventCategories = 1;
+            constexpr uint32_t InternedEventNames = 2;
+            constexpr uint32_t InternedStringIid = 1;
+            constexpr uint32_t InternedStringName = 2;
+
+            constexpr uint32_t TrackDescriptorUuid = 1;
+            constexpr uint32_t TrackDescriptorThread = 4;
+            constexpr uint32_t ThreadDescriptorPid = 1;
+            constexpr uint32_t ThreadDescriptorTid = 2;
+            constexpr uint32_t ThreadDescriptorThreadName = 5;
+
+            constexpr uint64_t TypeSliceBegin = 1;
+            constexpr uint64_t TypeSliceEnd = 2;
+
+            constexpr uint64_t SeqIncrementalStateCleared = 1;
+            constexpr uint64_t SeqNeedsIncrementalState = 2;
+
+            // All packets are written by the streamer's writer thread, so they share a single sequence.
+            constexpr uint64_t SequenceId = 1;
+
+            constexpr uint32_t WireTypeVarInt = 0;
+            constexpr uint32_t WireTypeLengthDelimited = 2;
+
+            void AppendVarInt(AZStd::vector<uint8_t>& output, uint64_t value)
+            {
+                while (value >= 0x80)
+                {
+                    output.push_back(static_cast<uint8_t>(value | 0x80));
+                    value >>= 7;
+                }
+                output.push_back(static_cast<uint8_t>(value));
+            }
+
+            void AppendVarIntField(AZStd::vector<uint8_t>& output, uint32_t field, uint64_t value)
+            {
+                AppendVarInt(output, (field << 3) | WireTypeVarInt);
+                AppendVarInt(output, value);
+            }
+
+            void AppendBytesField(AZStd::vector<uint8_t>& output, uint32_t field, const void* data, size_t size)
+            {
+                AppendVarInt(output, (field << 3) | WireTypeLengthDelimited);
+                AppendVarInt(output, size);
+                const uint8_t* bytes = static_cast<const uint8_t*>(data);
+                output.insert(output.end(), bytes, bytes + size);
+            }
+
+            void AppendMessageField(AZStd::vector<uint8_t>& output, uint32_t field, const AZStd::vector<uint8_t>& message)
+            {
+                AppendBytesField(output, field, message.data(), message.size());
+            }
+
+            void AppendStringField(AZStd::vector<uint8_t>& output, uint32_t field, AZStd::string_view string)
+            {
+                AppendBytesField(output, field, string.data(), string.size());
+            }
+        } // namespace PerfettoProto
+
+        // Size of the output cache, the cache is written to the file when it's full and after each pass of the writer thread
+        constexpr size_t OutputFlushSize = 1024 * 1024;
+    } // namespace
+
+    // --- TraceEventRingBuffer ---
+
+    TraceEventRingBuffer::TraceEventRingBuffer(AZStd::thread_id threadId, size_t capacity)
+        : m_threadId(threadId)
+    {
+        size_t powerOfTwoCapacity = 1;
+        while (powerOfTwoCapacity < capacity)
+        {
+            powerOfTwoCapacity <<= 1;
+        }
+        m_events.resize(powerOfTwoCapacity);
+        m_mask = powerOfTwoCapacity - 1;
+    }
+
+    bool TraceEventRingBuffer::TryPush(const TraceEvent& event)
+    {
+        const uint64_t head = m_head.load(AZStd::memory_order_relaxed);
+        if (head - m_tail.load(AZStd::memory_order_acquire) > m_mask)
+        {
+            m_droppedCount.fetch_add(1, AZStd::memory_order_relaxed);
+            return false;
+        }
+
+        m_events[head & m_mask] = event;
+        m_head.store(head + 1, AZStd::memory_order_release);
+        return true;
+    }
+
+    void TraceEventRingBuffer::Discard()
+    {
+        m_tail.store(m_head.load(AZStd::memory_order_acquire), AZStd::memory_order_release);
+        m_droppedCount.store(0, AZStd::memory_order_relaxed);
+    }
+
+    bool TraceEventRingBuffer::IsEmpty() const
+    {
+        return m_tail.load(AZStd::memory_order_relaxed) == m_head.load(AZStd::memory_order_acquire);
+    }
+
+    uint64_t TraceEventRingBuffer::TakeDroppedCount()
+    {
+        return m_droppedCount.exchange(0, AZStd::memory_order_relaxed);
+    }
+
+    AZStd::thread_id TraceEventRingBuffer::GetThreadId() const
+    {
+        return m_threadId;
+    }
+
+    // --- CpuTraceStreamer ---
+
+    CpuTraceStreamer::~CpuTraceStreamer()
+    {
+        if (IsRunning())
+        {
+            Stop();
+        }
+    }
+
+    bool CpuTraceStreamer::Start(const AZStd::string& outputFilePath)
+    {
+        if (m_running)
+        {
+            return false;
+        }
+
+        if (!m_file.Open(
+                outputFilePath.c_str(), AZ::IO::OpenMode::ModeWrite | AZ::IO::OpenMode::ModeBinary | AZ::IO::OpenMode::ModeCreatePath))
+        {
+            AZ_Warning("Profiler", false, "Failed to open '%s' for a streaming capture", outputFilePath.c_str());
+            return false;
+        }
+
+        {
+            AZStd::scoped_lock lock(m_namesMutex);
+            m_names.clear();
+            ++m_captureGeneration;
+        }
+
+        {
+            // Events that were recorded before the capture started are discarded
+            AZStd::scoped_lock lock(m_buffersMutex);
+            for (auto& buffer : m_buffers)
+            {
+                buffer->Discard();
+            }
+        }
+
+        m_writeFailed = false;
+        m_droppedEventCount = 0;
+        m_output.clear();
+        m_trackUuids.clear();
+        m_categoryIds.clear();
+        m_nameCategoryIds.clear();
+        m_ticksPerSecond = AZStd::GetTimeTicksPerSecond();
+
+        // The first packet resets the interned names of the sequence, so a file never refers to names from a previous capture
+        m_packet.clear();
+        PerfettoProto::AppendVarIntField(m_packet, PerfettoProto::PacketTrustedSequenceId, PerfettoProto::SequenceId);
+        PerfettoProto::AppendVarIntField(m_packet, PerfettoProto::PacketSequenceFlags, PerfettoProto::SeqIncrementalStateCleared);
+        WritePacket();
+
+        m_stopRequested = false;
+        m_running = true;
+
+        AZStd::thread_desc threadDesc;
+        threadDesc.m_name = "Profiler Trace Writer";
+        m_writerThread = AZStd::thread(threadDesc, [this]() { WriterThreadMain(); });
+
+        AZ_TracePrintf("Profiler", "Streaming capture to '%s' started\n", outputFilePath.c_str());
+        return true;
+    }
+
+    bool CpuTraceStreamer::Stop()
+    {
+        if (!m_running)
+        {
+            return false;
+        }
+
+        {
+            AZStd::scoped_lock lock(m_writerMutex);
+            m_stopRequested = true;
+        }
+        m_writerCondition.notify_all();
+        m_writerThread.join();
+
+        AZ_Warning("Profiler", m_droppedEventCount == 0,
+            "%llu profiling events were dropped during the streaming capture because the thread buffers were full. "
+            "Increase profiler_traceBufferEventCount or decrease profiler_traceFlushIntervalMs to avoid losing data.",
+            static_cast<unsigned long long>(m_droppedEventCount));
+
+        m_file.Close();
+        m_running = false;
+        AZ_TracePrintf("Profiler", "Streaming capture ended\n");
+        return !m_writeFailed;
+    }
+
+    bool CpuTraceStreamer::IsRunning() const
+    {
+        return m_running;
+    }
+
+    AZStd::intrusive_ptr<TraceEventRingBuffer> CpuTraceStreamer::CreateThreadBuffer(AZStd::thread_id threadId)
+    {
+        AZStd::intrusive_ptr<TraceEventRingBuffer> buffer = aznew TraceEventRingBuffer(threadId, profiler_traceBufferEventCount);
+        AZStd::scoped_lock lock(m_buffersMutex);
+        m_buffers.push_back(buffer);
+        return buffer;
+    }
+
+    uint32_t CpuTraceStreamer::InternName(const char* groupName, AZStd::string_view regionName)
+    {
+        AZStd::scoped_lock lock(m_namesMutex);
+        m_names.push_back({ groupName ? groupName : "", regionName });
+        return aznumeric_cast<uint32_t>(m_names.size() - 1);
+    }
+
+    uint32_t CpuTraceStreamer::GetCaptureGeneration() const
+    {
+        return m_captureGeneration.load(AZStd::memory_order_acquire);
+    }
+
+    void CpuTraceStreamer::WriterThreadMain()
+    {
+        AZStd::unique_lock<AZStd::mutex> lock(m_writerMutex);
+        bool stopRequested = false;
+        while (!stopRequested)
+        {
+            m_writerCondition.wait_for(
+                lock,
+                AZStd::chrono::milliseconds(static_cast<uint32_t>(profiler_traceFlushIntervalMs)),
+                [this]()
+                {
+                    return m_stopRequested;
+                });
+            stopRequested = m_stopRequested;
+
+            // Always do a pass after a stop is requested, to write the events of the regions that ended before it
+            lock.unlock();
+            WriteBufferedEvents();
+            FlushOutput();
+            lock.lock();
+        }
+    }
+
+    void CpuTraceStreamer::WriteBufferedEvents()
+    {
+        // Copy the list so threads can register new buffers while the events are written
+        AZStd::vector<AZStd::intrusive_ptr<TraceEventRingBuffer>> buffers;
+        {
+            AZStd::scoped_lock lock(m_buffersMutex);
+            buffers = m_buffers;
+        }
+
+        for (const auto& buffer : buffers)
+        {
+            m_drainedEvents.clear();
+            buffer->Drain(
+                [this](const TraceEvent& event)
+                {
+                    m_drainedEvents.push_back(event);
+                });
+            m_droppedEventCount += buffer->TakeDroppedCount();
+
+            if (m_drainedEvents.empty())
+            {
+                continue;
+            }
+
+            uint64_t& trackUuid = m_trackUuids[buffer.get()];
+            if (trackUuid == 0)
+            {
+                trackUuid = m_trackUuids.size();
+                WriteTrackDescriptor(trackUuid, buffer->GetThreadId());
+            }
+
+            // Threads intern a name before pushing the first event that uses it, so every name used by the drained events
+            // is available now.
+            WriteNewNames();
+
+            for (const TraceEvent& event : m_drainedEvents)
+            {
+                WriteSlice(trackUuid, event);
+            }
+        }
+        buffers.clear();
+
+        // Release the buffers of threads that were destroyed once all of their events were written
+        AZStd::scoped_lock lock(m_buffersMutex);
+        AZStd::erase_if(
+            m_buffers,
+            [](const AZStd::intrusive_ptr<TraceEventRingBuffer>& buffer)
+            {
+                return buffer->use_count() == 1 && buffer->IsEmpty();
+            });
+    }
+
+    void CpuTraceStreamer::WriteNewNames()
+    {
+        AZStd::vector<InternedName> newNames;
+        {
+            AZStd::scoped_lock lock(m_namesMutex);
+            // Every name that was written has its category id stored
+            const size_t namesWritten = m_nameCategoryIds.size();
+            if (namesWritten == m_names.size())
+            {
+                return;
+            }
+            newNames.assign(m_names.begin() + namesWritten, m_names.end());
+        }
+
+        AZStd::vector<uint8_t> entry;
+        m_message.clear();
+        for (const InternedName& name : newNames)
+        {
+            // Groups are interned separately as categories, there are far fewer of them than region names
+            auto [categoryIt, categoryAdded] = m_categoryIds.try_emplace(name.m_groupName, aznumeric_cast<uint32_t>(m_categoryIds.size() + 1));
+            if (categoryAdded)
+            {
+                entry.clear();
+                PerfettoProto::AppendVarIntField(entry, PerfettoProto::InternedStringIid, categoryIt->second);
+                PerfettoProto::AppendStringField(entry, PerfettoProto::InternedStringName, name.m_groupName);
+                PerfettoProto::AppendMessageField(m_message, PerfettoProto::InternedEventCategories, entry);
+            }
+
+            // Interned ids must be non-zero
+            entry.clear();
+            PerfettoProto::AppendVarIntField(entry, PerfettoProto::InternedStringIid, m_nameCategoryIds.size() + 1);
+            PerfettoProto::AppendStringField(entry, PerfettoProto::InternedStringName, name.m_regionName);
+            PerfettoProto::AppendMessageField(m_message, PerfettoProto::InternedEventNames, entry);
+
+            m_nameCategoryIds.push_back(categoryIt->second);
+        }
+
+        m_packet.clear();
+        PerfettoProto::AppendVarIntField(m_packet, PerfettoProto::PacketTrustedSequenceId, PerfettoProto::SequenceId);
+        PerfettoProto::AppendVarIntField(m_packet, PerfettoProto::PacketSequenceFlags, PerfettoProto::SeqNeedsIncrementalState);
+        PerfettoProto::AppendMessageField(m_packet, PerfettoProto::PacketInternedData, m_message);
+        WritePacket();
+    }
+
+    void CpuTraceStreamer::WriteTrackDescriptor(uint64_t trackUuid, AZStd::thread_id threadId)
+    {
+        // Use the same thread id as the json captures, truncated to a positive 32 bit value as Perfetto expects
+        const size_t threadIdHash = AZStd::hash<AZStd::thread_id>{}(threadId);
+        const uint32_t tid = static_cast<uint32_t>(threadIdHash & 0x7fffffff);
+
+        AZStd::vector<uint8_t> threadDescriptor;
+        PerfettoProto::AppendVarIntField(threadDescriptor, PerfettoProto::ThreadDescriptorPid, AZ::Platform::GetCurrentProcessId());
+        PerfettoProto::AppendVarIntField(threadDescriptor, PerfettoProto::ThreadDescriptorTid, tid);
+        PerfettoProto::AppendStringField(
+            threadDescriptor, PerfettoProto::ThreadDescriptorThreadName, AZStd::string::format("Thread %zu", threadIdHash));
+
+        m_message.clear();
+        PerfettoProto::AppendVarIntField(m_message, PerfettoProto::TrackDescriptorUuid, trackUuid);
+        PerfettoProto::AppendMessageField(m_message, PerfettoProto::TrackDescriptorThread, threadDescriptor);
+
+        m_packet.clear();
+        PerfettoProto::AppendVarIntField(m_packet, PerfettoProto::PacketTrustedSequenceId, PerfettoProto::SequenceId);
+        PerfettoProto::AppendMessageField(m_packet, PerfettoProto::PacketTrackDescriptor, m_message);
+        WritePacket();
+    }
+
+    void CpuTraceStreamer::WriteSlice(uint64_t trackUuid, const TraceEvent& event)
+    {
+        // Events that were pushed with a name from a previous capture while the capture was restarting are skipped
+        if (event.m_nameId >= m_nameCategoryIds.size())
+        {
+            return;
+        }
+
+        m_message.clear();
+        PerfettoProto::AppendVarIntField(m_message, PerfettoProto::TrackEventType, PerfettoProto::TypeSliceBegin);
+        PerfettoProto::AppendVarIntField(m_message, PerfettoProto::TrackEventTrackUuid, trackUuid);
+        PerfettoProto::AppendVarIntField(m_message, PerfettoProto::TrackEventNameIid, event.m_nameId + 1);
+        PerfettoProto::AppendVarIntField(m_message, PerfettoProto::TrackEventCategoryIids, m_nameCategoryIds[event.m_nameId]);
+        WriteTrackEventPacket(TicksToNanoseconds(event.m_startTick));
+
+        m_message.clear();
+        PerfettoProto::AppendVarIntField(m_message, PerfettoProto::TrackEventType, PerfettoProto::TypeSliceEnd);
+        PerfettoProto::AppendVarIntField(m_message, PerfettoProto::TrackEventTrackUuid, trackUuid);
+        WriteTrackEventPacket(TicksToNanoseconds(event.m_endTick));
+    }
+
+    void CpuTraceStreamer::WriteTrackEventPacket(uint64_t timestamp)
+    {
+        m_packet.clear();
+        PerfettoProto::AppendVarIntField(m_packet, PerfettoProto::PacketTimestamp, timestamp);
+        PerfettoProto::AppendVarIntField(m_packet, PerfettoProto::PacketTrustedSequenceId, PerfettoProto::SequenceId);
+        PerfettoProto::AppendVarIntField(m_packet, PerfettoProto::PacketSequenceFlags, PerfettoProto::SeqNeedsIncrementalState);
+        PerfettoProto::AppendMessageField(m_packet, PerfettoProto::PacketTrackEvent, m_message);
+        WritePacket();
+    }
+
+    void CpuTraceStreamer::WritePacket()
+    {
+        PerfettoProto::AppendMessageField(m_output, PerfettoProto::TracePacket, m_packet);
+        if (m_output.size() >= OutputFlushSize)
+        {
+            FlushOutput();
+        }
+    }
+
+    void CpuTraceStreamer::FlushOutput()
+    {
+        if (!m_output.empty() && !m_writeFailed)
+        {
+            if (m_file.Write(m_output.size(), m_output.data()) != m_output.size())
+            {
+                AZ_Warning("Profiler", false, "Failed to write to the streaming capture file, the rest of the capture is discarded");
+                m_writeFailed = true;
+            }
+        }
+        m_output.clear();
+    }
+
+    uint64_t CpuTraceStreamer::TicksToNanoseconds(AZStd::sys_time_t ticks) const
+    {
+        // Split the conversion to avoid overflowing for large tick values
+        constexpr uint64_t NanosecondsPerSecond = 1000000000ull;
+        const uint64_t ticksPerSecond = static_cast<uint64_t>(m_ticksPerSecond);
+        const uint64_t unsignedTicks = static_cast<uint64_t>(ticks);
+        return (unsignedTicks / ticksPerSecond) * NanosecondsPerSecond + (unsignedTicks % ticksPerSecond) * NanosecondsPerSecond / ticksPerSecond;
+    }
+} // namespace Profiler
@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/condition_variable.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/intrusive_ptr.h>
+#include <AzCore/std/smart_ptr/intrusive_refcount.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/std/time.h>
+
+namespace Profiler
+{
+    //! Compact record of a completed time region, written to the thread's TraceEventRingBuffer when the region ends.
+    struct TraceEvent
+    {
+        AZStd::sys_time_t m_startTick = 0;
+        AZStd::sys_time_t m_endTick = 0;
+        //! Id returned by CpuTraceStreamer::InternName for the group and region name
+        uint32_t m_nameId = 0;
+        uint16_t m_stackDepth = 0;
+    };
+
+    //! Fixed size, single producer/single consumer ring buffer of TraceEvents.
+    //! The owning thread pushes events without taking any locks and the CpuTraceStreamer's writer thread drains them.
+    //! When the buffer is full new events are dropped and counted, so memory use is bounded by the capacity.
+    class TraceEventRingBuffer
+        : public AZStd::intrusive_refcount<AZStd::atomic_uint>
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(TraceEventRingBuffer, AZ::SystemAllocator);
+
+        //! @param capacity The maximum number of events in the buffer, rounded up to a power of two.
+        TraceEventRingBuffer(AZStd::thread_id threadId, size_t capacity);
+
+        //! Producer side, adds an event or drops it if the buffer is full.
+        bool TryPush(const TraceEvent& event);
+
+        //! Consumer side, invokes callback on each buffered event in order and removes them from the buffer.
+        template<typename Callback>
+        size_t Drain(Callback&& callback);
+
+        //! Consumer side, removes all buffered events and resets the dropped event count.
+        void Discard();
+
+        //! Consumer side, returns true if there are no buffered events.
+        bool IsEmpty() const;
+
+        //! Returns the number of events that were dropped since the last call and resets the count.
+        uint64_t TakeDroppedCount();
+
+        AZStd::thread_id GetThreadId() const;
+
+    private:
+        AZStd::vector<TraceEvent> m_events;
+        uint64_t m_mask = 0;
+        AZStd::thread_id m_threadId;
+
+        // The indices are only written by one side each, keep them on separate cache lines to avoid false sharing
+        alignas(64) AZStd::atomic<uint64_t> m_head{ 0 };
+        alignas(64) AZStd::atomic<uint64_t> m_tail{ 0 };
+        AZStd::atomic<uint64_t> m_droppedCount{ 0 };
+    };
+
+    //! Streams the time regions of all profiled threads to disk during a continuous capture.
+    //! Threads record completed regions into their own TraceEventRingBuffer and a background thread periodically drains
+    //! the buffers and appends them to the capture file in the Perfetto protobuf trace format, which can be opened with
+    //! the Perfetto UI (https://ui.perfetto.dev). Memory use is bounded by the size of the per thread buffers
+    //! (profiler_traceBufferEventCount) rather than the length of the capture, so it can be left running for hours.
+    class CpuTraceStreamer
+    {
+    public:
+        CpuTraceStreamer() = default;
+        ~CpuTraceStreamer();
+
+        //! Opens the output file and starts the writer thread.
+        bool Start(const AZStd::string& outputFilePath);
+
+        //! Writes the remaining events, stops the writer thread and closes the output file.
+        //! @return True if the capture was written without errors.
+        bool Stop();
+
+        bool IsRunning() const;
+
+        //! Returns a new ring buffer for the calling thread. The streamer keeps a reference until the thread releases it.
+        AZStd::intrusive_ptr<TraceEventRingBuffer> CreateThreadBuffer(AZStd::thread_id threadId);
+
+        //! Returns the id to store in TraceEvent::m_nameId for a group and region name.
+        //! Ids are only valid for the capture generation they were returned for, threads are expected to cache them.
+        uint32_t InternName(const char* groupName, AZStd::string_view regionName);
+
+        //! Incremented each time a capture starts, invalidating all ids returned by InternName.
+        uint32_t GetCaptureGeneration() const;
+
+    private:
+        struct InternedName
+        {
+            AZStd::string m_groupName;
+            AZStd::string m_regionName;
+        };
+
+        void WriterThreadMain();
+
+        // Drains all thread buffers and appends their events to the output file. Only called from the writer thread,
+        // or after it was joined.
+        void WriteBufferedEvents();
+
+        // Writes the interned names that were added since the last call
+        void WriteNewNames();
+
+        void WriteTrackDescriptor(uint64_t trackUuid, AZStd::thread_id threadId);
+        void WriteSlice(uint64_t trackUuid, const TraceEvent& event);
+        void WriteTrackEventPacket(uint64_t timestamp);
+        void WritePacket();
+        void FlushOutput();
+
+        uint64_t TicksToNanoseconds(AZStd::sys_time_t ticks) const;
+
+        // Registered thread buffers
+        AZStd::vector<AZStd::intrusive_ptr<TraceEventRingBuffer>> m_buffers;
+        AZStd::mutex m_buffersMutex;
+
+        // Interned group/region names, indexed by id
+        AZStd::vector<InternedName> m_names;
+        AZStd::mutex m_namesMutex;
+        AZStd::atomic<uint32_t> m_captureGeneration{ 0 };
+
+        AZStd::thread m_writerThread;
+        AZStd::mutex m_writerMutex;
+        AZStd::condition_variable m_writerCondition;
+        bool m_stopRequested = false;
+        AZStd::atomic_bool m_running{ false };
+
+        // State owned by the writer thread
+        AZ::IO::FileIOStream m_file;
+        bool m_writeFailed = false;
+        AZStd::vector<uint8_t> m_output;
+        AZStd::vector<uint8_t> m_packet;
+        AZStd::vector<uint8_t> m_message;
+        AZStd::vector<TraceEvent> m_drainedEvents;
+        AZStd::unordered_map<const TraceEventRingBuffer*, uint64_t> m_trackUuids;
+        AZStd::unordered_map<AZStd::string, uint32_t> m_categoryIds;
+        // Category id of each name that was written, indexed by name id
+        AZStd::vector<uint32_t> m_nameCategoryIds;
+        uint64_t m_droppedEventCount = 0;
+        AZStd::sys_time_t m_ticksPerSecond = 1;
+    };
+
+    template<typename Callback>
+    size_t TraceEventRingBuffer::Drain(Callback&& callback)
+    {
+        const uint64_t tail = m_tail.load(AZStd::memory_order_relaxed);
+        const uint64_t head = m_head.load(AZStd::memory_order_acquire);
+        for (uint64_t index = tail; index != head; ++index)
+        {
+            callback(m_events[index & m_mask]);
+        }
+        m_tail.store(head, AZStd::memory_order_release);
+        return static_cast<size_t>(head - tail);
+    }
+} // namespace Profiler
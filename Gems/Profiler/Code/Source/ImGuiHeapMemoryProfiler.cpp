@@ -18,7 +18,8 @@ namespace Profiler
         HeapProfilerColumnID_Name = 0,
         HeapProfilerColumnID_ParentName,
         HeapProfilerColumnID_AllocatedMem,
-        HeapProfilerColumnID_CapacityMem
+        HeapProfilerColumnID_CapacityMem,
+        HeapProfilerColumnID_HighWaterMem
     };
 
     void ImGuiHeapMemoryProfiler::Draw(bool& draw)
@@ -34,13 +35,14 @@ namespace Profiler
             ImGui::SameLine();
             m_filter.Draw("");            
             ImGuiTableFlags flags = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_Sortable;
-            constexpr int NumColumns = 4;
+            constexpr int NumColumns = 5;
             if (ImGui::BeginTable("table", NumColumns, flags))
             {
                 ImGui::TableSetupColumn(
                     "Allocator Name", ImGuiTableColumnFlags_WidthFixed | ImGuiTableColumnFlags_DefaultSort, 0.f, HeapProfilerColumnID_Name);
                 ImGui::TableSetupColumn("Allocated Memory (kB)", 0, 0.f, HeapProfilerColumnID_AllocatedMem);
                 ImGui::TableSetupColumn("Capacity Memory (kB)", 0, 0.f, HeapProfilerColumnID_CapacityMem);
+                ImGui::TableSetupColumn("Peak Memory (kB)", 0, 0.f, HeapProfilerColumnID_HighWaterMem);
                 ImGui::TableSetupColumn("Parent Name", 0, 0.f, HeapProfilerColumnID_ParentName);
                 ImGui::TableHeadersRow();
 
@@ -71,6 +73,8 @@ namespace Profiler
                                 return left->m_allocatedBytes < right->m_allocatedBytes;
                             case HeapProfilerColumnID_CapacityMem:
                                 return left->m_capacityBytes < right->m_capacityBytes;
+                            case HeapProfilerColumnID_HighWaterMem:
+                                return left->m_highWaterBytes < right->m_highWaterBytes;
                             case HeapProfilerColumnID_ParentName:
                                 return left->m_parentName < right->m_parentName;
                             default:
@@ -92,6 +96,8 @@ namespace Profiler
                         ImGui::TableNextColumn();
                         ImGui::Text("%.1f", static_cast<float>(stat.m_capacityBytes) / KB);
                         ImGui::TableNextColumn();
+                        ImGui::Text("%.1f", static_cast<float>(stat.m_highWaterBytes) / KB);
+                        ImGui::TableNextColumn();
                         ImGui::TextUnformatted(stat.m_parentName.c_str());
                     }
                 }
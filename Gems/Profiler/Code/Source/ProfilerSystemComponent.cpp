@@ -8,6 +8,7 @@
 
 #include <ProfilerSystemComponent.h>
 
+#include <AzCore/IO/Path/Path.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/EditContextConstants.inl>
@@ -68,7 +69,7 @@ namespace Profiler
             captureInfo = AZStd::string::format("Failed to save Cpu Profiling Statistics data to file '%s'. Error: %s",
                 outputFilePath.c_str(),
                 saveResult.GetError().c_str());
-            AZ_Warning("ProfilerSystemComponent", false, captureInfo.c_str());
+            AZ_Warning("ProfilerSystemComponent", false, "%s", captureInfo.c_str());
         }
         else
         {
@@ -200,12 +201,53 @@ namespace Profiler
 
     bool ProfilerSystemComponent::StartCapture(AZStd::string outputFilePath)
     {
-        m_captureFile = AZStd::move(outputFilePath);
-        return m_cpuProfiler.BeginContinuousCapture();
+        // EndCapture ends the capture based on m_streamingCapture, so it can't change while a capture is running
+        if (m_cpuProfiler.IsContinuousCaptureInProgress())
+        {
+            AZ_TracePrintf("ProfilerSystemComponent", "Cannot start a capture while another one is in progress\n");
+            return false;
+        }
+
+        // Captures to Perfetto traces are streamed to disk while capturing, everything else is serialized to json at the end
+        const AZ::IO::PathView extension = AZ::IO::PathView(outputFilePath).Extension();
+        const bool streamingCapture = extension == ".pftrace" || extension == ".perfetto-trace";
+        const bool captureStarted =
+            streamingCapture ? m_cpuProfiler.BeginStreamingCapture(outputFilePath) : m_cpuProfiler.BeginContinuousCapture();
+        if (captureStarted)
+        {
+            m_captureFile = AZStd::move(outputFilePath);
+            m_streamingCapture = streamingCapture;
+        }
+        return captureStarted;
     }
 
     bool ProfilerSystemComponent::EndCapture()
     {
+        if (m_streamingCapture)
+        {
+            if (!m_cpuProfiler.IsContinuousCaptureInProgress())
+            {
+                AZ_TracePrintf("ProfilerSystemComponent", "Could not end the streaming capture, is one in progress?\n");
+                return false;
+            }
+
+            const bool success = m_cpuProfiler.EndStreamingCapture();
+            AZStd::string captureInfo = m_captureFile;
+            if (!success)
+            {
+                captureInfo = AZStd::string::format("Failed to write the streaming capture to file '%s'", m_captureFile.c_str());
+                AZ_Warning("ProfilerSystemComponent", false, "%s", captureInfo.c_str());
+            }
+            else
+            {
+                AZ_Printf("ProfilerSystemComponent", "Cpu profiling trace was saved to file [%s]\n", m_captureFile.c_str());
+            }
+
+            AZ::Debug::ProfilerNotificationBus::Broadcast(
+                &AZ::Debug::ProfilerNotificationBus::Events::OnCaptureFinished, success, captureInfo);
+            return success;
+        }
+
         bool expected = false;
         if (!m_cpuDataSerializationInProgress.compare_exchange_strong(expected, true))
         {
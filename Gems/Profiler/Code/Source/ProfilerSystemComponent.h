@@ -54,6 +54,8 @@ namespace Profiler
 
         CpuProfiler m_cpuProfiler;
         AZStd::string m_captureFile;
+        // True if the current continuous capture is streamed to m_captureFile by the CpuProfiler
+        bool m_streamingCapture = false;
     };
 
 } // namespace Profiler
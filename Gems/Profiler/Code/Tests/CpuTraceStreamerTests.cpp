@@ -0,0 +1,278 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <CpuTraceStreamer.h>
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Utils/Utils.h>
+#include <AzCore/std/containers/span.h>
+#include <AzFramework/IO/LocalFileIO.h>
+#include <AzTest/AzTest.h>
+#include <AzTest/Utils.h>
+
+AZ_UNIT_TEST_HOOK(DEFAULT_UNIT_TEST_ENV);
+
+namespace UnitTest
+{
+    namespace
+    {
+        Profiler::TraceEvent MakeEvent(uint32_t nameId)
+        {
+            Profiler::TraceEvent event;
+            event.m_startTick = nameId;
+            event.m_endTick = nameId + 1;
+            event.m_nameId = nameId;
+            return event;
+        }
+
+        AZStd::vector<uint32_t> DrainNameIds(Profiler::TraceEventRingBuffer& buffer)
+        {
+            AZStd::vector<uint32_t> nameIds;
+            buffer.Drain(
+                [&nameIds](const Profiler::TraceEvent& event)
+                {
+                    nameIds.push_back(event.m_nameId);
+                });
+            return nameIds;
+        }
+
+        // Field of a decoded protobuf message. Length delimited fields keep their bytes, varint fields their value.
+        struct ProtoField
+        {
+            uint32_t m_number = 0;
+            uint32_t m_wireType = 0;
+            uint64_t m_value = 0;
+            AZStd::span<const uint8_t> m_bytes;
+        };
+
+        bool ReadVarInt(AZStd::span<const uint8_t>& data, uint64_t& value)
+        {
+            value = 0;
+            for (uint32_t shift = 0; shift < 64 && !data.empty(); shift += 7)
+            {
+                const uint8_t byte = data.front();
+                data = data.subspan(1);
+                value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+                if ((byte & 0x80) == 0)
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        // Only decodes the wire types the streamer writes, anything else fails the test.
+        AZStd::vector<ProtoField> ParseMessage(AZStd::span<const uint8_t> data)
+        {
+            AZStd::vector<ProtoField> fields;
+            while (!data.empty())
+            {
+                uint64_t tag = 0;
+                ProtoField field;
+                if (!ReadVarInt(data, tag))
+                {
+                    ADD_FAILURE() << "Truncated field tag";
+                    break;
+                }
+                field.m_number = static_cast<uint32_t>(tag >> 3);
+                field.m_wireType = static_cast<uint32_t>(tag & 0x7);
+
+                if (field.m_wireType == 0)
+                {
+                    if (!ReadVarInt(data, field.m_value))
+                    {
+                        ADD_FAILURE() << "Truncated varint field " << field.m_number;
+                        break;
+                    }
+                }
+                else if (field.m_wireType == 2)
+                {
+                    uint64_t size = 0;
+                    if (!ReadVarInt(data, size) || size > data.size())
+                    {
+                        ADD_FAILURE() << "Truncated length delimited field " << field.m_number;
+                        break;
+                    }
+                    field.m_bytes = data.first(static_cast<size_t>(size));
+                    data = data.subspan(static_cast<size_t>(size));
+                }
+                else
+                {
+                    ADD_FAILURE() << "Unexpected wire type " << field.m_wireType;
+                    break;
+                }
+                fields.push_back(field);
+            }
+            return fields;
+        }
+
+        const ProtoField* FindField(const AZStd::vector<ProtoField>& fields, uint32_t number)
+        {
+            for (const ProtoField& field : fields)
+            {
+                if (field.m_number == number)
+                {
+                    return &field;
+                }
+            }
+            return nullptr;
+        }
+    } // namespace
+
+    using TraceEventRingBufferTests = LeakDetectionFixture;
+
+    TEST_F(TraceEventRingBufferTests, TryPush_BufferFull_EventsDroppedAndCounted)
+    {
+        // The capacity is rounded up to 4
+        Profiler::TraceEventRingBuffer buffer(AZStd::this_thread::get_id(), 3);
+        for (uint32_t nameId = 0; nameId < 4; ++nameId)
+        {
+            EXPECT_TRUE(buffer.TryPush(MakeEvent(nameId)));
+        }
+        EXPECT_FALSE(buffer.TryPush(MakeEvent(4)));
+        EXPECT_FALSE(buffer.TryPush(MakeEvent(5)));
+
+        EXPECT_EQ(2u, buffer.TakeDroppedCount());
+        EXPECT_EQ(0u, buffer.TakeDroppedCount());
+        EXPECT_EQ(AZStd::vector<uint32_t>({ 0, 1, 2, 3 }), DrainNameIds(buffer));
+        EXPECT_TRUE(buffer.IsEmpty());
+    }
+
+    TEST_F(TraceEventRingBufferTests, PushAndDrain_IndicesWrapAround_EventsKeepTheirOrder)
+    {
+        Profiler::TraceEventRingBuffer buffer(AZStd::this_thread::get_id(), 4);
+        uint32_t nextNameId = 0;
+        for (int round = 0; round < 10; ++round)
+        {
+            AZStd::vector<uint32_t> expectedNameIds;
+            for (int i = 0; i < 3; ++i)
+            {
+                expectedNameIds.push_back(nextNameId);
+                EXPECT_TRUE(buffer.TryPush(MakeEvent(nextNameId++)));
+            }
+            EXPECT_EQ(expectedNameIds, DrainNameIds(buffer));
+        }
+        EXPECT_TRUE(buffer.IsEmpty());
+        EXPECT_EQ(0u, buffer.TakeDroppedCount());
+    }
+
+    TEST_F(TraceEventRingBufferTests, Discard_EventsAndDroppedCountCleared)
+    {
+        Profiler::TraceEventRingBuffer buffer(AZStd::this_thread::get_id(), 2);
+        for (uint32_t nameId = 0; nameId < 3; ++nameId)
+        {
+            buffer.TryPush(MakeEvent(nameId));
+        }
+
+        buffer.Discard();
+        EXPECT_TRUE(buffer.IsEmpty());
+        EXPECT_EQ(0u, buffer.TakeDroppedCount());
+
+        EXPECT_TRUE(buffer.TryPush(MakeEvent(7)));
+        EXPECT_EQ(AZStd::vector<uint32_t>({ 7 }), DrainNameIds(buffer));
+    }
+
+    class CpuTraceStreamerTests : public LeakDetectionFixture
+    {
+    protected:
+        void SetUp() override
+        {
+            LeakDetectionFixture::SetUp();
+            m_prevFileIO = AZ::IO::FileIOBase::GetInstance();
+            AZ::IO::FileIOBase::SetInstance(nullptr);
+            m_fileIO = AZStd::make_unique<AZ::IO::LocalFileIO>();
+            AZ::IO::FileIOBase::SetInstance(m_fileIO.get());
+        }
+
+        void TearDown() override
+        {
+            AZ::IO::FileIOBase::SetInstance(nullptr);
+            m_fileIO.reset();
+            AZ::IO::FileIOBase::SetInstance(m_prevFileIO);
+            LeakDetectionFixture::TearDown();
+        }
+
+        AZ::Test::ScopedAutoTempDirectory m_tempDirectory;
+        AZStd::unique_ptr<AZ::IO::LocalFileIO> m_fileIO;
+        AZ::IO::FileIOBase* m_prevFileIO = nullptr;
+    };
+
+    TEST_F(CpuTraceStreamerTests, StreamingCapture_SingleEvent_WritesPerfettoTracePackets)
+    {
+        const AZ::IO::Path capturePath = m_tempDirectory.Resolve("capture.pftrace");
+        {
+            Profiler::CpuTraceStreamer streamer;
+            ASSERT_TRUE(streamer.Start(capturePath.Native()));
+
+            AZStd::intrusive_ptr<Profiler::TraceEventRingBuffer> buffer = streamer.CreateThreadBuffer(AZStd::this_thread::get_id());
+            Profiler::TraceEvent event;
+            event.m_startTick = 0;
+            event.m_endTick = AZStd::GetTimeTicksPerSecond();
+            event.m_nameId = streamer.InternName("Group", "Region");
+            EXPECT_TRUE(buffer->TryPush(event));
+
+            EXPECT_TRUE(streamer.Stop());
+        }
+
+        auto readResult = AZ::Utils::ReadFile<AZStd::vector<uint8_t>>(capturePath.Native());
+        ASSERT_TRUE(readResult.IsSuccess());
+        const AZStd::vector<uint8_t>& trace = readResult.GetValue();
+
+        // Trace.packet { trusted_packet_sequence_id: 1, sequence_flags: SEQ_INCREMENTAL_STATE_CLEARED }
+        const AZStd::vector<uint8_t> resetPacket = { 0x0a, 0x04, 0x50, 0x01, 0x68, 0x01 };
+        ASSERT_GE(trace.size(), resetPacket.size());
+        EXPECT_TRUE(AZStd::equal(resetPacket.begin(), resetPacket.end(), trace.begin()));
+
+        // The reset, the thread's track descriptor, the interned names and the begin and end of the slice
+        const AZStd::vector<ProtoField> packets = ParseMessage(trace);
+        ASSERT_EQ(5u, packets.size());
+        for (const ProtoField& packet : packets)
+        {
+            EXPECT_EQ(1u, packet.m_number);
+            EXPECT_EQ(2u, packet.m_wireType);
+        }
+
+        // TrackDescriptor { uuid: 1, thread: { ... } }
+        const AZStd::vector<ProtoField> trackPacket = ParseMessage(packets[1].m_bytes);
+        const ProtoField* trackDescriptor = FindField(trackPacket, 60);
+        ASSERT_NE(nullptr, trackDescriptor);
+        const AZStd::vector<ProtoField> trackFields = ParseMessage(trackDescriptor->m_bytes);
+        const ProtoField* trackUuid = FindField(trackFields, 1);
+        ASSERT_NE(nullptr, trackUuid);
+        EXPECT_EQ(1u, trackUuid->m_value);
+        EXPECT_NE(nullptr, FindField(trackFields, 4));
+
+        // InternedData { event_categories: { iid: 1, name: "Group" }, event_names: { iid: 1, name: "Region" } }
+        const AZStd::vector<ProtoField> internedPacket = ParseMessage(packets[2].m_bytes);
+        const ProtoField* internedData = FindField(internedPacket, 12);
+        ASSERT_NE(nullptr, internedData);
+        const AZStd::vector<uint8_t> expectedInternedData = {
+            0x0a, 0x09, 0x08, 0x01, 0x12, 0x05, 'G', 'r', 'o', 'u', 'p',
+            0x12, 0x0a, 0x08, 0x01, 0x12, 0x06, 'R', 'e', 'g', 'i', 'o', 'n'
+        };
+        EXPECT_EQ(expectedInternedData, AZStd::vector<uint8_t>(internedData->m_bytes.begin(), internedData->m_bytes.end()));
+
+        // timestamp: 0, trusted_packet_sequence_id: 1, sequence_flags: SEQ_NEEDS_INCREMENTAL_STATE,
+        // track_event { type: TYPE_SLICE_BEGIN, track_uuid: 1, name_iid: 1, category_iids: 1 }
+        const AZStd::vector<uint8_t> expectedBeginPacket = {
+            0x40, 0x00, 0x50, 0x01, 0x68, 0x02,
+            0x5a, 0x08, 0x48, 0x01, 0x58, 0x01, 0x50, 0x01, 0x18, 0x01
+        };
+        EXPECT_EQ(expectedBeginPacket, AZStd::vector<uint8_t>(packets[3].m_bytes.begin(), packets[3].m_bytes.end()));
+
+        // The end of the slice is one second later, track_event { type: TYPE_SLICE_END, track_uuid: 1 }
+        const AZStd::vector<ProtoField> endPacket = ParseMessage(packets[4].m_bytes);
+        const ProtoField* timestamp = FindField(endPacket, 8);
+        ASSERT_NE(nullptr, timestamp);
+        EXPECT_EQ(1000000000u, timestamp->m_value);
+        const ProtoField* trackEvent = FindField(endPacket, 11);
+        ASSERT_NE(nullptr, trackEvent);
+        const AZStd::vector<uint8_t> expectedEndEvent = { 0x48, 0x02, 0x58, 0x01 };
+        EXPECT_EQ(expectedEndEvent, AZStd::vector<uint8_t>(trackEvent->m_bytes.begin(), trackEvent->m_bytes.end()));
+    }
+} // namespace UnitTest